@@ -0,0 +1,149 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/tnn/device/cpu/acc/compute/compute_elewise.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/compute/compute_elewise.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/compute/compute_elewise.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/compute/compute_int8.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/compute/compute_int8.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/compute/compute_int8.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_ histogram_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu__histogram_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu__histogram_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_abs_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_abs_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_abs_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_acos_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_acos_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_acos_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_add_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_add_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_add_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_and_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_and_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_and_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_arg_max_or_min_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_arg_max_or_min_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_arg_max_or_min_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_asin_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_asin_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_asin_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_atan_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_atan_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_atan_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_batch_norm_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_batch_norm_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_batch_norm_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_bias_add_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_bias_add_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_bias_add_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_binary_op_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_binary_op_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_binary_op_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_bitshift_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_bitshift_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_bitshift_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_cast_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_cast_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_cast_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_ceil_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_ceil_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_ceil_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_clip_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_clip_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_clip_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_concat_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_concat_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_concat_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_const_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_const_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_const_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_constantofshape_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_constantofshape_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_constantofshape_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_conv_1d_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_conv_1d_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_conv_1d_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_conv_3d_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_conv_3d_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_conv_3d_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_conv_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_conv_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_conv_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_cos_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_cos_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_cos_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_deconv_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_deconv_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_deconv_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_detection_output_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_detection_output_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_detection_output_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_detection_post_process_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_detection_post_process_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_detection_post_process_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_div_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_div_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_div_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_einsum_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_einsum_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_einsum_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_elu_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_elu_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_elu_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_equal_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_equal_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_equal_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_erf_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_erf_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_erf_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_exp_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_exp_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_exp_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_expand_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_expand_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_expand_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_flatten_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_flatten_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_flatten_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_floor_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_floor_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_floor_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_gather_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_gather_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_gather_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_gathernd_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_gathernd_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_gathernd_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_gelu_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_gelu_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_gelu_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_greater_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_greater_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_greater_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_gridsample_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_gridsample_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_gridsample_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_group_norm_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_group_norm_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_group_norm_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_hard_sigmoid_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_hard_sigmoid_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_hard_sigmoid_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_hard_swish_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_hard_swish_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_hard_swish_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_hdrguide_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_hdrguide_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_hdrguide_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_inner_product_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_inner_product_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_inner_product_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_instance_norm_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_instance_norm_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_instance_norm_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_inverse_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_inverse_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_inverse_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_layer_norm_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_layer_norm_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_layer_norm_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_less_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_less_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_less_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_log_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_log_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_log_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_log_sigmoid_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_log_sigmoid_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_log_sigmoid_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_log_softmax_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_log_softmax_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_log_softmax_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_lrn_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_lrn_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_lrn_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_lstm_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_lstm_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_lstm_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_mat_mul_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_mat_mul_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_mat_mul_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_max_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_max_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_max_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_min_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_min_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_min_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_mul_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_mul_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_mul_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_neg_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_neg_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_neg_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_non_max_suppression.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_non_max_suppression.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_non_max_suppression.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_nonzero_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_nonzero_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_nonzero_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_normalize_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_normalize_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_normalize_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_not_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_not_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_not_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_onehot_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_onehot_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_onehot_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_pad_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_pad_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_pad_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_padv2_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_padv2_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_padv2_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_permute_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_permute_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_permute_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_pixel_shuffle_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_pixel_shuffle_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_pixel_shuffle_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_pool_1d_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_pool_1d_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_pool_1d_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_pool_3d_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_pool_3d_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_pool_3d_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_pool_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_pool_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_pool_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_pow_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_pow_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_pow_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_prelu_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_prelu_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_prelu_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_prior_box_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_prior_box_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_prior_box_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_range_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_range_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_range_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_reciprocal_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reciprocal_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reciprocal_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_reduce_l1_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reduce_l1_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reduce_l1_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_reduce_l2_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reduce_l2_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reduce_l2_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_reduce_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reduce_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reduce_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_reduce_log_sum_exp_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reduce_log_sum_exp_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reduce_log_sum_exp_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_reduce_log_sum_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reduce_log_sum_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reduce_log_sum_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_reduce_max_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reduce_max_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reduce_max_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_reduce_mean_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reduce_mean_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reduce_mean_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_reduce_min_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reduce_min_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reduce_min_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_reduce_prod_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reduce_prod_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reduce_prod_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_reduce_sum_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reduce_sum_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reduce_sum_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_reduce_sum_square_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reduce_sum_square_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reduce_sum_square_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_reformat_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reformat_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reformat_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_relu6_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_relu6_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_relu6_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_relu_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_relu_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_relu_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_reorg_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reorg_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reorg_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_reshape_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reshape_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_reshape_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_roialign_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_roialign_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_roialign_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_rsqrt_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_rsqrt_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_rsqrt_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_scale_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_scale_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_scale_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_scatter_elements_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_scatter_elements_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_scatter_elements_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_scatter_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_scatter_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_scatter_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_scatter_nd_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_scatter_nd_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_scatter_nd_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_selu_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_selu_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_selu_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_shape_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_shape_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_shape_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_shuffle_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_shuffle_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_shuffle_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_sigmoid_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_sigmoid_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_sigmoid_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_sign_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_sign_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_sign_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_signed_mul_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_signed_mul_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_signed_mul_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_sin_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_sin_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_sin_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_size_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_size_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_size_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_softmax_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_softmax_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_softmax_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_softplus_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_softplus_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_softplus_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_splitv_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_splitv_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_splitv_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_sqrt_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_sqrt_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_sqrt_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_squared_difference_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_squared_difference_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_squared_difference_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_squeeze_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_squeeze_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_squeeze_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_stride_slice_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_stride_slice_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_stride_slice_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_stride_slice_v2_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_stride_slice_v2_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_stride_slice_v2_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_sub_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_sub_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_sub_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_swish_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_swish_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_swish_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_tan_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_tan_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_tan_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_tanh_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_tanh_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_tanh_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_tile_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_tile_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_tile_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_topk_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_topk_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_topk_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_unary_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_unary_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_unary_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_unsqueeze_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_unsqueeze_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_unsqueeze_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_upsample_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_upsample_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_upsample_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/acc/cpu_where_layer_acc.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_where_layer_acc.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/acc/cpu_where_layer_acc.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/cpu_blob_converter.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/cpu_blob_converter.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/cpu_blob_converter.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/cpu_context.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/cpu_context.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/cpu_context.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/cpu_device.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/cpu_device.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/cpu_device.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/cpu_mat_converter.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/cpu_mat_converter.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/cpu_mat_converter.cc.o.d"
+  "/root/repo/source/tnn/device/cpu/cpu_mat_util.cc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/cpu_mat_util.cc.o" "gcc" "source/tnn/device/cpu/CMakeFiles/TNNCpu.dir/cpu_mat_util.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
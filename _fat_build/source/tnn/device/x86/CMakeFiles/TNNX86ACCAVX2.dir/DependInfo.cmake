@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/tnn/device/x86/acc/compute/x86_compute.cc" "source/tnn/device/x86/CMakeFiles/TNNX86ACCAVX2.dir/acc/compute/x86_compute.cc.o" "gcc" "source/tnn/device/x86/CMakeFiles/TNNX86ACCAVX2.dir/acc/compute/x86_compute.cc.o.d"
+  "/root/repo/source/tnn/device/x86/acc/compute/x86_compute_elementwise.cc" "source/tnn/device/x86/CMakeFiles/TNNX86ACCAVX2.dir/acc/compute/x86_compute_elementwise.cc.o" "gcc" "source/tnn/device/x86/CMakeFiles/TNNX86ACCAVX2.dir/acc/compute/x86_compute_elementwise.cc.o.d"
+  "/root/repo/source/tnn/device/x86/acc/compute/x86_compute_winograd.cc" "source/tnn/device/x86/CMakeFiles/TNNX86ACCAVX2.dir/acc/compute/x86_compute_winograd.cc.o" "gcc" "source/tnn/device/x86/CMakeFiles/TNNX86ACCAVX2.dir/acc/compute/x86_compute_winograd.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TNNX86ACCAVX2.dir/acc/compute/x86_compute.cc.o"
+  "CMakeFiles/TNNX86ACCAVX2.dir/acc/compute/x86_compute.cc.o.d"
+  "CMakeFiles/TNNX86ACCAVX2.dir/acc/compute/x86_compute_elementwise.cc.o"
+  "CMakeFiles/TNNX86ACCAVX2.dir/acc/compute/x86_compute_elementwise.cc.o.d"
+  "CMakeFiles/TNNX86ACCAVX2.dir/acc/compute/x86_compute_winograd.cc.o"
+  "CMakeFiles/TNNX86ACCAVX2.dir/acc/compute/x86_compute_winograd.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TNNX86ACCAVX2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
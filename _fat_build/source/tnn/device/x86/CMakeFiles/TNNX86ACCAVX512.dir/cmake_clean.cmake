@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TNNX86ACCAVX512.dir/acc/compute/x86_compute_elementwise.cc.o"
+  "CMakeFiles/TNNX86ACCAVX512.dir/acc/compute/x86_compute_elementwise.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TNNX86ACCAVX512.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,131 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/flags.cc" "test/unit_test/CMakeFiles/unit_test.dir/__/flags.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/__/flags.cc.o.d"
+  "/root/repo/test/test_utils.cc" "test/unit_test/CMakeFiles/unit_test.dir/__/test_utils.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/__/test_utils.cc.o.d"
+  "/root/repo/test/timer.cc" "test/unit_test/CMakeFiles/unit_test.dir/__/timer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/__/timer.cc.o.d"
+  "/root/repo/test/unit_test/batching_executor_test.cc" "test/unit_test/CMakeFiles/unit_test.dir/batching_executor_test.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/batching_executor_test.cc.o.d"
+  "/root/repo/test/unit_test/bind_blob_test.cc" "test/unit_test/CMakeFiles/unit_test.dir/bind_blob_test.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/bind_blob_test.cc.o.d"
+  "/root/repo/test/unit_test/blob_converter_test.cc" "test/unit_test/CMakeFiles/unit_test.dir/blob_converter_test.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/blob_converter_test.cc.o.d"
+  "/root/repo/test/unit_test/blob_memory_planner_test.cc" "test/unit_test/CMakeFiles/unit_test.dir/blob_memory_planner_test.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/blob_memory_planner_test.cc.o.d"
+  "/root/repo/test/unit_test/blocked_layout_test.cc" "test/unit_test/CMakeFiles/unit_test.dir/blocked_layout_test.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/blocked_layout_test.cc.o.d"
+  "/root/repo/test/unit_test/concat_elimination_test.cc" "test/unit_test/CMakeFiles/unit_test.dir/concat_elimination_test.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/concat_elimination_test.cc.o.d"
+  "/root/repo/test/unit_test/cpu_allocator_test.cc" "test/unit_test/CMakeFiles/unit_test.dir/cpu_allocator_test.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/cpu_allocator_test.cc.o.d"
+  "/root/repo/test/unit_test/forward_async_test.cc" "test/unit_test/CMakeFiles/unit_test.dir/forward_async_test.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/forward_async_test.cc.o.d"
+  "/root/repo/test/unit_test/inplace_layer_test.cc" "test/unit_test/CMakeFiles/unit_test.dir/inplace_layer_test.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/inplace_layer_test.cc.o.d"
+  "/root/repo/test/unit_test/instance_clone_test.cc" "test/unit_test/CMakeFiles/unit_test.dir/instance_clone_test.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/instance_clone_test.cc.o.d"
+  "/root/repo/test/unit_test/layer_memory_scheduler_test.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_memory_scheduler_test.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_memory_scheduler_test.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/layer_test.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/layer_test.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/layer_test.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/layer_test_utils.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/layer_test_utils.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/layer_test_utils.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_abs_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_abs_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_abs_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_acos_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_acos_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_acos_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_add_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_add_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_add_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_arg_max_or_min_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_arg_max_or_min_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_arg_max_or_min_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_asin_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_asin_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_asin_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_atan_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_atan_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_atan_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_batch_norm_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_batch_norm_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_batch_norm_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_binary_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_binary_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_binary_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_ceil_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_ceil_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_ceil_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_clip_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_clip_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_clip_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_concat_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_concat_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_concat_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_conv1d_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_conv1d_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_conv1d_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_conv_3d_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_conv_3d_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_conv_3d_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_conv_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_conv_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_conv_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_conv_quant_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_conv_quant_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_conv_quant_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_conv_winograd_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_conv_winograd_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_conv_winograd_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_cos_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_cos_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_cos_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_deconv_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_deconv_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_deconv_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_div_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_div_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_div_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_elu_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_elu_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_elu_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_exp_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_exp_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_exp_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_floor_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_floor_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_floor_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_gelu_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_gelu_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_gelu_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_grid_sample_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_grid_sample_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_grid_sample_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_group_norm_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_group_norm_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_group_norm_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_hard_sigmoid_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_hard_sigmoid_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_hard_sigmoid_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_hard_swish_broadcast_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_hard_swish_broadcast_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_hard_swish_broadcast_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_hard_swish_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_hard_swish_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_hard_swish_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_hdrguide_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_hdrguide_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_hdrguide_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_innerproduct_int8_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_innerproduct_int8_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_innerproduct_int8_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_innerproduct_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_innerproduct_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_innerproduct_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_instance_norm_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_instance_norm_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_instance_norm_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_inverse_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_inverse_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_inverse_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_layer_norm_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_layer_norm_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_layer_norm_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_log_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_log_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_log_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_log_sigmoid_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_log_sigmoid_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_log_sigmoid_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_log_softmax_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_log_softmax_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_log_softmax_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_lstm_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_lstm_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_lstm_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_matmul_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_matmul_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_matmul_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_max_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_max_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_max_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_min_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_min_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_min_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_mul_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_mul_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_mul_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_neg_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_neg_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_neg_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_normalize_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_normalize_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_normalize_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_pad_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_pad_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_pad_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_padv2_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_padv2_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_padv2_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_permute_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_permute_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_permute_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_pixel_shuffle_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_pixel_shuffle_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_pixel_shuffle_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_pooling_3d_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_pooling_3d_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_pooling_3d_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_pooling_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_pooling_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_pooling_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_pow_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_pow_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_pow_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_prelu_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_prelu_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_prelu_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_priox_box_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_priox_box_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_priox_box_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_reciprocal_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_reciprocal_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_reciprocal_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_reduce_op_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_reduce_op_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_reduce_op_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_reformat_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_reformat_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_reformat_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_relu6_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_relu6_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_relu6_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_relu_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_relu_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_relu_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_reorg_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_reorg_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_reorg_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_reshape_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_reshape_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_reshape_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_roialign_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_roialign_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_roialign_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_selu_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_selu_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_selu_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_shuffle_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_shuffle_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_shuffle_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_sigmoid_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_sigmoid_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_sigmoid_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_sign_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_sign_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_sign_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_signed_mul_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_signed_mul_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_signed_mul_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_sin_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_sin_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_sin_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_softmax_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_softmax_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_softmax_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_softplus_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_softplus_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_softplus_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_splitv_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_splitv_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_splitv_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_sqrt_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_sqrt_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_sqrt_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_squeeze_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_squeeze_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_squeeze_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_stride_slice_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_stride_slice_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_stride_slice_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_sub_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_sub_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_sub_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_swish_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_swish_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_swish_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_tan_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_tan_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_tan_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_tanh_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_tanh_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_tanh_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_tile_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_tile_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_tile_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_unary_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_unary_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_unary_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_unsqueeze_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_unsqueeze_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_unsqueeze_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_test/test_upsample_layer.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_upsample_layer.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_test/test_upsample_layer.cc.o.d"
+  "/root/repo/test/unit_test/layer_workspace_test.cc" "test/unit_test/CMakeFiles/unit_test.dir/layer_workspace_test.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/layer_workspace_test.cc.o.d"
+  "/root/repo/test/unit_test/mapped_model_test.cc" "test/unit_test/CMakeFiles/unit_test.dir/mapped_model_test.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/mapped_model_test.cc.o.d"
+  "/root/repo/test/unit_test/mat_converter_test.cc" "test/unit_test/CMakeFiles/unit_test.dir/mat_converter_test.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/mat_converter_test.cc.o.d"
+  "/root/repo/test/unit_test/packed_cache_test.cc" "test/unit_test/CMakeFiles/unit_test.dir/packed_cache_test.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/packed_cache_test.cc.o.d"
+  "/root/repo/test/unit_test/packed_resource_cache_test.cc" "test/unit_test/CMakeFiles/unit_test.dir/packed_resource_cache_test.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/packed_resource_cache_test.cc.o.d"
+  "/root/repo/test/unit_test/parallel_init_test.cc" "test/unit_test/CMakeFiles/unit_test.dir/parallel_init_test.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/parallel_init_test.cc.o.d"
+  "/root/repo/test/unit_test/parallel_layers_test.cc" "test/unit_test/CMakeFiles/unit_test.dir/parallel_layers_test.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/parallel_layers_test.cc.o.d"
+  "/root/repo/test/unit_test/streaming_model_test.cc" "test/unit_test/CMakeFiles/unit_test.dir/streaming_model_test.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/streaming_model_test.cc.o.d"
+  "/root/repo/test/unit_test/thread_pool_test.cc" "test/unit_test/CMakeFiles/unit_test.dir/thread_pool_test.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/thread_pool_test.cc.o.d"
+  "/root/repo/test/unit_test/unit_test.cc" "test/unit_test/CMakeFiles/unit_test.dir/unit_test.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/unit_test.cc.o.d"
+  "/root/repo/test/unit_test/unit_test_common.cc" "test/unit_test/CMakeFiles/unit_test.dir/unit_test_common.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/unit_test_common.cc.o.d"
+  "/root/repo/test/unit_test/utils/network_helpers.cc" "test/unit_test/CMakeFiles/unit_test.dir/utils/network_helpers.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/utils/network_helpers.cc.o.d"
+  "/root/repo/test/unit_test/view_layer_test.cc" "test/unit_test/CMakeFiles/unit_test.dir/view_layer_test.cc.o" "gcc" "test/unit_test/CMakeFiles/unit_test.dir/view_layer_test.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_fat_build/CMakeFiles/TNN.dir/DependInfo.cmake"
+  "/root/repo/_fat_build/test/unit_test/third_party/googletest/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_fat_build/third_party/gflags/CMakeFiles/gflags_nothreads_static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
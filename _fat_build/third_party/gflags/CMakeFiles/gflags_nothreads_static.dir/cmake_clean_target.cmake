@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libgflags_nothreads.a"
+)
@@ -0,0 +1,80 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#ifndef TNN_INCLUDE_TNN_CORE_BATCHING_EXECUTOR_H_
+#define TNN_INCLUDE_TNN_CORE_BATCHING_EXECUTOR_H_
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "tnn/core/common.h"
+#include "tnn/core/instance.h"
+#include "tnn/core/macro.h"
+#include "tnn/core/mat.h"
+#include "tnn/core/status.h"
+#include "tnn/core/tnn.h"
+#include "tnn/utils/blob_converter.h"
+
+#pragma warning(push)
+#pragma warning(disable : 4251)
+
+namespace TNN_NS {
+
+struct PUBLIC BatchingConfig {
+    // max samples merged into one forward, it is clamped to the batch of max inputs shape
+    int max_batch_size = 8;
+
+    // max time in microseconds the oldest queued request waits for more requests
+    int max_queue_delay_us = 2000;
+
+    // convert param of each input, default MatConvertParam is used if the input is not set
+    std::map<std::string, MatConvertParam> input_params = {};
+};
+
+class BatchingExecutorImpl;
+
+// @brief BatchingExecutor merges requests from concurrent callers into one batch along N,
+// runs a single forward for the batch and gives each caller its slice of the outputs.
+class PUBLIC BatchingExecutor {
+public:
+    BatchingExecutor();
+
+    ~BatchingExecutor();
+
+    // create the instance with min and max inputs shape and start the batching thread.
+    // the instance is reshaped only when the batch size or input shape of a batch changes.
+    Status Init(TNN& tnn, NetworkConfig& net_config, InputShapesMap min_inputs_shape,
+                InputShapesMap max_inputs_shape, BatchingConfig batching_config = BatchingConfig());
+
+    // stop the batching thread, requests still in queue return error.
+    Status DeInit();
+
+    // run one request and block until its outputs are ready. input mats must be on DEVICE_NAIVE and
+    // share the same batch, a request is only merged with requests of the same input dims except batch.
+    // outputs are mats on DEVICE_NAIVE owned by the caller.
+    Status Forward(MatMap& inputs, MatMap& outputs);
+
+    // get the instance run by the executor, do not forward it directly while the executor is running.
+    std::shared_ptr<Instance> GetInstance();
+
+private:
+    std::shared_ptr<BatchingExecutorImpl> impl_ = nullptr;
+};
+
+}  // namespace TNN_NS
+
+#pragma warning(pop)
+
+#endif  // TNN_INCLUDE_TNN_CORE_BATCHING_EXECUTOR_H_
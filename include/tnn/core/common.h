@@ -15,6 +15,8 @@
 #ifndef TNN_INCLUDE_TNN_CORE_COMMON_H_
 #define TNN_INCLUDE_TNN_CORE_COMMON_H_
 
+#include <stdint.h>
+
 #include <functional>
 #include <string>
 #include <vector>
@@ -28,6 +30,9 @@ namespace TNN_NS {
 
 typedef std::function<void(void)> Callback;
 
+// @brief read up to size bytes of the model content to data, return the bytes read, 0 at the end and -1 on error
+typedef std::function<int64_t(char *data, int64_t size)> ModelReader;
+
 typedef enum {
     //auto
     //针对算子输入类型多变的情况，如二元算子中某个输入是权值，其可以为浮点也可以为整数
@@ -124,6 +129,15 @@ typedef enum {
     SHARE_MEMORY_MODE_SET_FROM_EXTERNAL = 2
 } ShareMemoryMode;
 
+typedef enum {
+    // kernels run with OpenMP if TNN is built with it
+    CPU_THREAD_POOL_NONE   = 0,
+    // instances with the same thread number and cpu affinity share one pool
+    CPU_THREAD_POOL_SHARED = 1,
+    // each instance owns its pool
+    CPU_THREAD_POOL_OWNED  = 2
+} CpuThreadPoolMode;
+
 typedef enum {
     MODEL_TYPE_TNN      = 0x0001,
     MODEL_TYPE_NCNN     = 0x0100,
@@ -162,11 +176,38 @@ struct PUBLIC NetworkConfig {
     Precision precision = PRECISION_AUTO;
 
     // cache path to store possible cache models or opt kernel
+    // X86 saves the packed weights of a tnn model with weights to it at the first init, and loads them at the next
+    // init instead of packing again. the cache is not used if the cpu isa or tnn version differ.
     std::string cache_path = "";
 
     // network init or reshape may cost more time to select opt kernel implement if enable tune kernel
     // cache_path can set to store tune kernel info.
     bool enable_tune_kernel = false;
+
+    // run independent layers concurrently on a shared worker pool, only for DEVICE_X86 and DEVICE_NAIVE.
+    // threads set by SetCpuNumThreads are split between the layers running at the same time.
+    bool enable_parallel_layers = false;
+
+    // run kernels on a persistent TNN thread pool instead of OpenMP teams, only for DEVICE_X86.
+    // threads set by SetCpuNumThreads include the calling thread, it works even if OpenMP is disabled.
+    CpuThreadPoolMode cpu_thread_pool_mode = CPU_THREAD_POOL_NONE;
+
+    // cpu ids the pool workers are pinned to, worker i runs on cpu_affinity[i % size], empty means no pinning
+    std::vector<int> cpu_affinity = {};
+
+    // place blobs at offsets of one 64 bytes aligned memory planned by blob lifetime instead of the borrow and
+    // refund pool, only for DEVICE_X86, DEVICE_NAIVE and DEVICE_ARM. it reduces the forward memory size.
+    // layers are also reordered within their dependencies if it lowers the peak memory.
+    bool enable_memory_plan = false;
+
+    // names of the net inputs and outputs Instance::BindInput and Instance::BindOutput bind to user memory.
+    // they get their own memory out of the shared forward memory, so forwards can read and write user memory
+    // in place of it.
+    std::vector<std::string> bound_blobs = {};
+
+    // init layer accs on the shared worker pool, only for DEVICE_X86 and DEVICE_NAIVE. output shapes and data
+    // formats are still inferred layer by layer, the weight packing of the layers runs in parallel.
+    bool enable_parallel_init = false;
 };
 
 struct PUBLIC ModelConfig {
@@ -194,6 +235,21 @@ struct PUBLIC ModelConfig {
     // set Conv_1 layer to use fp32 inference
     // in OpenCL, the result of conv is incorrect on some chips, you can use the unoptimized conv with following config,
     // "ExtraConfig:Conv_0:opencl_use_unoptimized_conv;"
+
+    // tnn model only: path of the model file, read in place of the model content if params[1] is empty.
+    // the file is memory mapped, weights of models packed with aligned weights by ModelPacker are used in place of
+    // the mapping without copy, so processes loading the same model share its pages.
+    std::string model_path = "";
+
+    // tnn model only: reader of the model content, used if params[1] and model_path are empty. weights are read
+    // straight into their buffers through a small buffer, the model content is never held in memory.
+    ModelReader model_reader = nullptr;
+
+    // tnn model only: path of the proto file, read in place of the proto content if params[0] is empty.
+    std::string proto_path = "";
+
+    // tnn model only: copy the weights of the layers out of the model content on the shared worker pool
+    bool enable_parallel_decode = false;
 };
 
 typedef enum {
@@ -16,7 +16,9 @@
 #define TNN_INCLUDE_TNN_CORE_INSTANCE_H_
 
 #include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "tnn/core/blob.h"
@@ -32,6 +34,7 @@ namespace TNN_NS {
 
 class AbstractNetwork;
 class AbstractModelInterpreter;
+struct NetResource;
 
 struct LayerInfo;
 
@@ -51,6 +54,13 @@ public:
     // init with model interpeter, min inputs shape and max inputs shape.
     Status Init(std::shared_ptr<AbstractModelInterpreter> interpreter, InputShapesMap min_inputs_shape, InputShapesMap max_inputs_shape);
 
+    // create an instance running the same model as this instance. the clone shares the optimized model and
+    // const folded constants, and allocates its own blobs, blob memory and layer accs. on x86 the layer accs share
+    // the weights packed by this instance, on other devices they pack the weights again.
+    // it starts with the max inputs shape of this instance, clones can forward concurrently.
+    // only instances of the default network type can be cloned.
+    std::shared_ptr<Instance> Clone(Status& status);
+
     // deinit, release network
     Status DeInit();
 
@@ -64,7 +74,8 @@ public:
     //  will result in undefined behavior.
     Status SetForwardMemory(void* memory);
 
-    // reshape instance with new input shapes
+    // reshape instance with new input shapes, inputs and outputs bound to user memory are unbound if their dims
+    // change
     Status Reshape(const InputShapesMap& inputs);
 
     // get tnn command queue
@@ -89,8 +100,32 @@ public:
 
     // tnn instance network infer async.
     // device gpu, all layer infer complete will call Callback.
+    // device x86 and naive, forward runs on the instance worker thread and returns at once,
+    // Callback is called on the worker thread when all layer infer complete.
     Status ForwardAsync(Callback call_back);
 
+    // tnn instance network infer async, forward gets the status of this forward. on device x86 and naive it is
+    // ready before Callback is called, so Callback may read the outputs, WaitForwardAsync waits for Callback too.
+    // outputs bound by BindOutput but not in place are copied on the worker thread before Callback is called,
+    // after forward is ready, so wait with WaitForwardAsync or in Callback before reading them.
+    Status ForwardAsync(Callback call_back, std::shared_future<Status>& forward);
+
+    // wait for the forward started by ForwardAsync to complete, return the forward status.
+    // SetInputMat, GetOutputMat, Forward and Reshape wait for it implicitly.
+    Status WaitForwardAsync();
+
+    // bind the input to user memory holding nchw float data of dims. if the input is in NetworkConfig::bound_blobs
+    // and its blob is nchw float of the same dims on DEVICE_X86, DEVICE_NAIVE or DEVICE_ARM, the next forwards read
+    // the memory in place. otherwise it is copied at the start of every forward as SetInputMat does. the memory
+    // must live until the input is bound again, data nullptr unbinds the input.
+    Status BindInput(const std::string& input_name, void* data, DimsVector dims);
+
+    // bind the output to user memory taking nchw float data of the output dims. if the output is in
+    // NetworkConfig::bound_blobs and its blob is nchw float on DEVICE_X86, DEVICE_NAIVE or DEVICE_ARM, forwards
+    // write the memory in place. otherwise it is copied there after Forward, or WaitForwardAsync after
+    // ForwardAsync. the memory must live until the output is bound again, data nullptr unbinds the output.
+    Status BindOutput(const std::string& output_name, void* data);
+
     // get all input blobs
     Status GetAllInputBlobs(BlobMap& blobs);
 
@@ -115,7 +150,15 @@ private:
     NetworkConfig net_config_;
     ModelConfig model_config_;
     
+    // network type resolved by Init
+    NetworkType network_type_ = NETWORK_TYPE_AUTO;
+    // net resource owned by a clone whose const folder rewrites constants on reshape
+    std::shared_ptr<NetResource> net_resource_ = nullptr;
+
     AbstractNetwork *GetNetwork();
+
+    // init as a clone of instance
+    Status Init(Instance *instance);
     
     //Mat interface for simple use
 public:
@@ -141,6 +184,26 @@ private:
     std::map<std::string, std::shared_ptr<Mat>> output_mats_ = {};
     // output mat convert status
     std::map<std::string, int> output_mats_convert_status_ = {};
+
+    // handles of the blobs bound to user memory in place, restored when they are unbound
+    std::map<std::string, BlobHandle> unbound_handles_ = {};
+    // user memory and its dims the inputs are copied from before forward
+    std::map<std::string, std::pair<void*, DimsVector>> input_bindings_ = {};
+    // user memory the outputs are copied to after forward
+    std::map<std::string, void*> output_bindings_ = {};
+    // the forward started by ForwardAsync has not copied the outputs bound out of place yet
+    bool bound_outputs_pending_ = false;
+    std::mutex bound_outputs_mutex_;
+
+    // bind the blob to user memory in place or restore its handle if data is nullptr
+    Status BindBlob(Blob* blob, void* data);
+    // copy the inputs bound to user memory out of place
+    Status CopyBoundInputs();
+    // copy the outputs bound to user memory out of place
+    Status CopyBoundOutputs();
+    // copy the bound outputs of the forward started by ForwardAsync if no one copied them yet, every way a
+    // forward completes ends here
+    Status CopyPendingBoundOutputs();
 };
 
 }  // namespace TNN_NS
@@ -62,6 +62,10 @@ public:
         NetworkConfig& config, Status& status,
         InputShapesMap min_inputs_shape, InputShapesMap max_inputs_shape);
 
+    // create tnn network instance as a clone of instance, see Instance::Clone.
+    // the clone skips model optimization and weight packing, so it is much faster than CreateInst.
+    std::shared_ptr<Instance> CloneInst(std::shared_ptr<Instance> instance, Status& status);
+
 private:
     std::shared_ptr<TNNImpl> impl_ = nullptr;
 };
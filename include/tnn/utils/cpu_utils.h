@@ -15,6 +15,7 @@
 #ifndef TNN_INCLUDE_TNN_UTILS_CPU_UTILS_H_
 #define TNN_INCLUDE_TNN_UTILS_CPU_UTILS_H_
 
+#include <stdint.h>
 #include <utility>
 #include <vector>
 
@@ -23,6 +24,20 @@
 
 namespace TNN_NS {
 
+// @brief statistics of the memory allocated by the x86 and naive devices
+struct PUBLIC CpuMemoryStats {
+    // bytes currently allocated
+    int64_t allocated_bytes = 0;
+    // max bytes allocated at the same time
+    int64_t peak_allocated_bytes = 0;
+    // bytes currently backed by huge pages, transparent ones are only requested
+    int64_t huge_page_bytes = 0;
+    // allocations made so far
+    int64_t allocation_count = 0;
+    // bytes allocated so far without filling them with zero
+    int64_t zero_fill_skipped_bytes = 0;
+};
+
 class CpuUtils {
 public:
     // @brief set cpu affinity
@@ -42,6 +57,13 @@ public:
     // @brief set x86 cpu denormal ftz and daz, no use for other cpu.
     // @param denormal 0:turn off denormal 1:turn on denormal
     PUBLIC static void SetCpuDenormal(int denormal);
+
+    // @brief back x86 and naive device memory of at least 2 MB with huge pages, only for linux.
+    // @param huge_page 0:off 1:transparent huge pages 2:explicit huge pages, transparent if none is reserved
+    PUBLIC static Status SetCpuHugePage(int huge_page);
+
+    // @brief get statistics of the memory allocated by the x86 and naive devices
+    PUBLIC static CpuMemoryStats GetCpuMemoryStats();
 };
 
 }  // namespace TNN_NS
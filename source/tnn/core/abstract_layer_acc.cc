@@ -99,6 +99,48 @@ void AbstractLayerAcc::SetRuntimeMode(RuntimeMode mode) {
     runtime_model_ = mode;
 }
 
+bool AbstractLayerAcc::SupportInplace(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs,
+                                      int input_index) {
+    return false;
+}
+
+int64_t AbstractLayerAcc::GetViewOffset(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs,
+                                        int output_index) {
+    return -1;
+}
+
+void AbstractLayerAcc::SetOutputsAsView(bool outputs_as_view) {
+    outputs_as_view_ = outputs_as_view;
+}
+
+int64_t AbstractLayerAcc::GetConcatOffset(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs,
+                                          int input_index) {
+    return -1;
+}
+
+size_t AbstractLayerAcc::GetWorkspaceSize(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
+    return 0;
+}
+
+void AbstractLayerAcc::SetWorkspace(Blob *workspace) {
+    workspace_ = workspace;
+}
+
+int AbstractLayerAcc::GetInplaceInputIndex(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
+    if (outputs.empty()) {
+        return -1;
+    }
+    auto output_handle = outputs[0]->GetHandle();
+    for (int i = 0; i < (int)inputs.size(); i++) {
+        auto input_handle = inputs[i]->GetHandle();
+        if (input_handle.base != nullptr && input_handle.base == output_handle.base &&
+            input_handle.bytes_offset == output_handle.bytes_offset) {
+            return i;
+        }
+    }
+    return -1;
+}
+
 #if TNN_PROFILE
 void AbstractLayerAcc::UpdateProfilingData(ProfilingData *pdata, LayerParam *param, DimsVector input_dim,
                                            DimsVector output_dim) {
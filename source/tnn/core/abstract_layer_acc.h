@@ -105,6 +105,36 @@ public:
     
     // @brief set runtime mode
     void SetRuntimeMode(RuntimeMode mode);
+
+    // @brief whether output 0 can be written to the memory of the input at input_index while the layer reads it,
+    // the blob manager lets them share memory if no later layer reads the input
+    virtual bool SupportInplace(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs,
+                                int input_index);
+
+    // @brief index of the input sharing memory with output 0, -1 if the layer does not run in place
+    int GetInplaceInputIndex(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs);
+
+    // @brief offset in bytes of the output inside input 0 if the output can be a view of input 0 with the current
+    // shapes, -1 if it needs its own memory. the blob manager places the outputs of a layer in the memory of
+    // input 0 if all of them can be views, the layer then computes nothing.
+    virtual int64_t GetViewOffset(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs,
+                                  int output_index);
+
+    // @brief set whether the outputs are placed in the memory of input 0
+    void SetOutputsAsView(bool outputs_as_view);
+
+    // @brief offset in bytes of the input inside output 0 if the input is a dense part of output 0 with the current
+    // shapes, -1 if not. the memory plan places the inputs of a concat layer in the memory of output 0 if all of
+    // them are, the layers writing them then fill output 0 and the layer moves no data.
+    virtual int64_t GetConcatOffset(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs,
+                                    int input_index);
+
+    // @brief bytes of scratch memory the layer needs in forward with the current shapes, 0 if none. the memory
+    // plan places it in the forward memory for the time the layer runs.
+    virtual size_t GetWorkspaceSize(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs);
+
+    // @brief set the blob holding the planned scratch memory, nullptr if the layer has none
+    virtual void SetWorkspace(Blob *workspace);
     
 #if TNN_PROFILE
     virtual void UpdateProfilingData(ProfilingData *pdata, LayerParam *param, DimsVector input_dim,
@@ -124,6 +154,8 @@ protected:
     
     std::map<std::string, std::shared_ptr<Blob> > const_blob_map_ = {};
     RuntimeMode runtime_model_ = RUNTIME_MODE_NORMAL;
+    bool outputs_as_view_ = false;
+    Blob *workspace_ = nullptr;
 };
 
 // @brief LayerAccCreator define create layer acc interface
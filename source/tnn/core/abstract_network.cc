@@ -24,6 +24,11 @@ Status AbstractNetwork::ForwardWithCallback(BlobStatisticCallback before, BlobSt
 }
 #endif  // end of FORWARD_CALLBACK_ENABLE
 
+Status AbstractNetwork::InitFromNetwork(AbstractNetwork *network, NetResource *net_resource) {
+    LOGE("Subclass of AbstractNetwork must implement this func InitFromNetwork\n");
+    return Status(TNNERR_COMMON_ERROR, "Subclass of AbstractNetwork must implement this func InitFromNetwork");
+}
+
 Status AbstractNetwork::ShareCommandQueue(AbstractNetwork *network) {
     LOGE("Subclass of AbstractNetwork must implement this func ShareCommandQueue\n");
     return Status(TNNERR_COMMON_ERROR, "Subclass of AbstractNetwork must implement this func ShareCommandQueue");
@@ -33,6 +38,19 @@ Status AbstractNetwork::SetCpuNumThreads(int num_threads) {
     return TNN_OK;
 }
 
+// networks without a worker thread complete the forward before ForwardAsync returns
+Status AbstractNetwork::ForwardAsync(Callback call_back, std::shared_future<Status> &forward) {
+    std::promise<Status> promise;
+    Status status = ForwardAsync(call_back);
+    promise.set_value(status);
+    forward = promise.get_future().share();
+    return status;
+}
+
+Status AbstractNetwork::WaitForwardAsync() {
+    return TNN_OK;
+}
+
 #if TNN_PROFILE
 void AbstractNetwork::StartProfile() {
     LOGI("subclass should implement the func: StartProfile\n");
@@ -15,6 +15,7 @@
 #ifndef TNN_SOURCE_TNN_CORE_ABSTRACT_NETWORK_H_
 #define TNN_SOURCE_TNN_CORE_ABSTRACT_NETWORK_H_
 
+#include <future>
 #include <map>
 #include <memory>
 #include <vector>
@@ -29,6 +30,8 @@
 
 namespace TNN_NS {
 
+struct NetResource;
+
 class AbstractNetwork {
 public:
     // @brief virtual default destructor
@@ -40,6 +43,12 @@ public:
     virtual Status Init(NetworkConfig &net_config, ModelConfig &model_config, AbstractModelInterpreter *interpreter,
         InputShapesMap min_inputs_shape, InputShapesMap max_inputs_shape, bool enable_const_folder=true) = 0;
 
+    // @brief init network as a clone of an inited network of the same type. the clone reuses the optimized net
+    // structure, net resource and packed layer resources of network, it only creates its own blobs and blob memory.
+    // @param network the network to clone
+    // @param net_resource net resource used by the clone, nullptr to share the net resource of network
+    virtual Status InitFromNetwork(AbstractNetwork *network, NetResource *net_resource = nullptr);
+
     // @brief deinit release init create resource
     virtual Status DeInit() = 0;
 
@@ -82,6 +91,14 @@ public:
     // @brief tnn instance network infer, it will not wait
     virtual Status ForwardAsync(Callback call_back) = 0;
 
+    // @brief tnn instance network infer, it will not wait
+    // @param forward gets the status of this forward, it is ready before call_back is called
+    virtual Status ForwardAsync(Callback call_back, std::shared_future<Status> &forward);
+
+    // @brief wait for the forward started by ForwardAsync to complete
+    // @return status of the forward
+    virtual Status WaitForwardAsync();
+
     // @brief get all input blobs
     // @param blobs input blobs name map
     virtual Status GetAllInputBlobs(BlobMap &blobs) = 0;
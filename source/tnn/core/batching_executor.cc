@@ -0,0 +1,341 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include "tnn/core/batching_executor.h"
+
+#include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "tnn/utils/dims_vector_utils.h"
+#include "tnn/utils/mat_converter_utils.h"
+
+namespace TNN_NS {
+
+struct BatchingRequest {
+    MatMap *inputs  = nullptr;
+    MatMap *outputs = nullptr;
+    int batch       = 0;
+    std::chrono::steady_clock::time_point enqueue_time;
+    std::promise<Status> done;
+};
+
+class BatchingExecutorImpl {
+public:
+    Status Init(TNN &tnn, NetworkConfig &net_config, InputShapesMap min_inputs_shape,
+                InputShapesMap max_inputs_shape, BatchingConfig batching_config);
+    Status DeInit();
+    Status Forward(MatMap &inputs, MatMap &outputs);
+    std::shared_ptr<Instance> GetInstance();
+
+private:
+    void BatchingLoop();
+    bool CanMerge(BatchingRequest *first, BatchingRequest *request);
+    Status RunBatch(std::vector<std::shared_ptr<BatchingRequest>> &batch);
+
+    std::shared_ptr<Instance> instance_ = nullptr;
+    BatchingConfig config_;
+    // shapes the instance is reshaped to, written by the batching thread and read by Forward under mutex_
+    InputShapesMap current_shapes_;
+    bool reshape_failed_ = false;
+
+    std::thread batching_thread_;
+    std::deque<std::shared_ptr<BatchingRequest>> requests_;
+    int queued_batch_ = 0;
+    bool running_     = false;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+};
+
+static size_t GetMatBatchBytes(Mat *mat) {
+    return (size_t)GetMatElementSize(mat) * DimsVectorUtils::Count(mat->GetDims(), 1);
+}
+
+Status BatchingExecutorImpl::Init(TNN &tnn, NetworkConfig &net_config, InputShapesMap min_inputs_shape,
+                                  InputShapesMap max_inputs_shape, BatchingConfig batching_config) {
+    if (running_) {
+        return Status(TNNERR_INST_ERR, "batching executor is already initialized");
+    }
+
+    Status status;
+    instance_ = tnn.CreateInst(net_config, status, min_inputs_shape, max_inputs_shape);
+    RETURN_ON_NEQ(status, TNN_OK);
+    if (!instance_) {
+        return Status(TNNERR_INST_ERR, "batching executor create instance failed");
+    }
+
+    BlobMap input_blobs;
+    RETURN_ON_NEQ(instance_->GetAllInputBlobs(input_blobs), TNN_OK);
+    int max_batch = INT_MAX;
+    for (auto iter : input_blobs) {
+        auto dims = iter.second->GetBlobDesc().dims;
+        if (max_inputs_shape.find(iter.first) != max_inputs_shape.end()) {
+            dims = max_inputs_shape[iter.first];
+        }
+        if (dims.empty()) {
+            return Status(TNNERR_PARAM_ERR, "batching executor needs inputs with batch dim");
+        }
+        max_batch = std::min(max_batch, dims[0]);
+        current_shapes_[iter.first] = iter.second->GetBlobDesc().dims;
+    }
+
+    config_                    = batching_config;
+    config_.max_batch_size     = std::min(std::max(config_.max_batch_size, 1), max_batch);
+    config_.max_queue_delay_us = std::max(config_.max_queue_delay_us, 0);
+
+    running_         = true;
+    batching_thread_ = std::thread(&BatchingExecutorImpl::BatchingLoop, this);
+    return TNN_OK;
+}
+
+Status BatchingExecutorImpl::DeInit() {
+    {
+        std::unique_lock<std::mutex> lck(mutex_);
+        if (!running_) {
+            return TNN_OK;
+        }
+        running_ = false;
+    }
+    condition_.notify_all();
+    batching_thread_.join();
+
+    {
+        std::unique_lock<std::mutex> lck(mutex_);
+        for (auto &request : requests_) {
+            request->done.set_value(Status(TNNERR_INST_ERR, "batching executor is stopped"));
+        }
+        requests_.clear();
+        queued_batch_ = 0;
+    }
+    instance_ = nullptr;
+    return TNN_OK;
+}
+
+Status BatchingExecutorImpl::Forward(MatMap &inputs, MatMap &outputs) {
+    if (inputs.empty()) {
+        return Status(TNNERR_PARAM_ERR, "batching executor request has no input");
+    }
+    int batch = -1;
+    for (auto iter : inputs) {
+        auto mat = iter.second;
+        if (!mat || mat->GetDims().empty() || !mat->GetData()) {
+            return Status(TNNERR_PARAM_ERR, "batching executor request has invalid input mat");
+        }
+        if (mat->GetDeviceType() != DEVICE_NAIVE && mat->GetDeviceType() != DEVICE_X86 &&
+            mat->GetDeviceType() != DEVICE_ARM) {
+            return Status(TNNERR_PARAM_ERR, "batching executor only supports input mats in cpu memory");
+        }
+        if (GetMatElementSize(mat.get()) <= 0 || mat->GetMatType() == NNV21 || mat->GetMatType() == NNV12) {
+            return Status(TNNERR_PARAM_ERR, "batching executor does not support the input mat type");
+        }
+        if (batch != -1 && mat->GetBatch() != batch) {
+            return Status(TNNERR_PARAM_ERR, "batching executor request inputs have different batch");
+        }
+        batch = mat->GetBatch();
+    }
+
+    auto request          = std::make_shared<BatchingRequest>();
+    request->inputs       = &inputs;
+    request->outputs      = &outputs;
+    request->batch        = batch;
+    request->enqueue_time = std::chrono::steady_clock::now();
+    auto result           = request->done.get_future();
+    {
+        std::unique_lock<std::mutex> lck(mutex_);
+        if (!running_) {
+            return Status(TNNERR_INST_ERR, "batching executor is not running");
+        }
+        if (batch <= 0 || batch > config_.max_batch_size) {
+            return Status(TNNERR_PARAM_ERR, "batching executor request batch exceeds max batch size");
+        }
+        if (current_shapes_.size() != inputs.size()) {
+            return Status(TNNERR_PARAM_ERR, "batching executor request inputs do not match the model");
+        }
+        for (auto iter : inputs) {
+            if (current_shapes_.find(iter.first) == current_shapes_.end()) {
+                return Status(TNNERR_PARAM_ERR, "batching executor request inputs do not match the model");
+            }
+        }
+        requests_.push_back(request);
+        queued_batch_ += batch;
+    }
+    condition_.notify_one();
+    return result.get();
+}
+
+std::shared_ptr<Instance> BatchingExecutorImpl::GetInstance() {
+    return instance_;
+}
+
+bool BatchingExecutorImpl::CanMerge(BatchingRequest *first, BatchingRequest *request) {
+    for (auto iter : *first->inputs) {
+        auto other = request->inputs->find(iter.first);
+        if (other == request->inputs->end() || other->second->GetMatType() != iter.second->GetMatType() ||
+            !DimsVectorUtils::Equal(other->second->GetDims(), iter.second->GetDims(), 1)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void BatchingExecutorImpl::BatchingLoop() {
+    while (true) {
+        std::vector<std::shared_ptr<BatchingRequest>> batch;
+        {
+            std::unique_lock<std::mutex> lck(mutex_);
+            condition_.wait(lck, [this] { return !running_ || !requests_.empty(); });
+            if (!running_) {
+                return;
+            }
+
+            // wait for more requests until the batch is full or the oldest request has waited long enough
+            auto deadline =
+                requests_.front()->enqueue_time + std::chrono::microseconds(config_.max_queue_delay_us);
+            condition_.wait_until(lck, deadline,
+                                  [this] { return !running_ || queued_batch_ >= config_.max_batch_size; });
+            if (!running_) {
+                return;
+            }
+
+            int total_batch = 0;
+            while (!requests_.empty()) {
+                auto request = requests_.front();
+                if (!batch.empty() && (total_batch + request->batch > config_.max_batch_size ||
+                                       !CanMerge(batch[0].get(), request.get()))) {
+                    break;
+                }
+                batch.push_back(request);
+                total_batch += request->batch;
+                queued_batch_ -= request->batch;
+                requests_.pop_front();
+            }
+        }
+
+        Status status = RunBatch(batch);
+        for (auto &request : batch) {
+            request->done.set_value(status);
+        }
+    }
+}
+
+Status BatchingExecutorImpl::RunBatch(std::vector<std::shared_ptr<BatchingRequest>> &batch) {
+    int total_batch = 0;
+    for (auto &request : batch) {
+        total_batch += request->batch;
+    }
+
+    // reshape only if the batch size or the input shape changes
+    auto &first_inputs = *batch[0]->inputs;
+    InputShapesMap shapes;
+    for (auto iter : first_inputs) {
+        auto dims          = iter.second->GetDims();
+        dims[0]            = total_batch;
+        shapes[iter.first] = dims;
+    }
+    if (reshape_failed_ || shapes != current_shapes_) {
+        // a failed reshape may leave the instance between two shapes, the next batch reshapes it again
+        reshape_failed_ = true;
+        RETURN_ON_NEQ(instance_->Reshape(shapes), TNN_OK);
+        reshape_failed_ = false;
+        std::unique_lock<std::mutex> lck(mutex_);
+        current_shapes_ = shapes;
+    }
+
+    // concat inputs of the requests along N
+    for (auto iter : first_inputs) {
+        const auto &name = iter.first;
+        auto mat         = iter.second;
+        if (batch.size() > 1) {
+            mat                = std::make_shared<Mat>(DEVICE_NAIVE, iter.second->GetMatType(), shapes[name]);
+            size_t batch_bytes = GetMatBatchBytes(iter.second.get());
+            char *dst          = static_cast<char *>(mat->GetData());
+            for (auto &request : batch) {
+                auto src = (*request->inputs)[name];
+                memcpy(dst, src->GetData(), batch_bytes * request->batch);
+                dst += batch_bytes * request->batch;
+            }
+        }
+
+        MatConvertParam param;
+        if (config_.input_params.find(name) != config_.input_params.end()) {
+            param = config_.input_params[name];
+        }
+        RETURN_ON_NEQ(instance_->SetInputMat(mat, param, name), TNN_OK);
+    }
+
+    RETURN_ON_NEQ(instance_->Forward(), TNN_OK);
+
+    // scatter output slices back to the requests
+    BlobMap output_blobs;
+    RETURN_ON_NEQ(instance_->GetAllOutputBlobs(output_blobs), TNN_OK);
+    for (auto iter : output_blobs) {
+        const auto &name = iter.first;
+        MatType mat_type = iter.second->GetBlobDesc().data_type == DATA_TYPE_INT32 ? NC_INT32 : NCHW_FLOAT;
+        std::shared_ptr<Mat> output_mat;
+        RETURN_ON_NEQ(instance_->GetOutputMat(output_mat, MatConvertParam(), name, DEVICE_NAIVE, mat_type), TNN_OK);
+
+        auto dims           = output_mat->GetDims();
+        bool split_by_batch = !dims.empty() && dims[0] == total_batch;
+        if (batch.size() > 1 && !split_by_batch) {
+            return Status(TNNERR_PARAM_ERR, "batching executor can not split output without batch dim");
+        }
+        size_t batch_bytes = split_by_batch ? GetMatBatchBytes(output_mat.get())
+                                            : GetMatElementSize(output_mat.get()) * DimsVectorUtils::Count(dims);
+        const char *src    = static_cast<const char *>(output_mat->GetData());
+        for (auto &request : batch) {
+            auto request_dims = dims;
+            size_t bytes      = batch_bytes;
+            if (split_by_batch) {
+                request_dims[0] = request->batch;
+                bytes           = batch_bytes * request->batch;
+            }
+            auto request_mat = std::make_shared<Mat>(DEVICE_NAIVE, mat_type, request_dims);
+            memcpy(request_mat->GetData(), src, bytes);
+            src += bytes;
+            (*request->outputs)[name] = request_mat;
+        }
+    }
+    return TNN_OK;
+}
+
+BatchingExecutor::BatchingExecutor() : impl_(std::make_shared<BatchingExecutorImpl>()) {}
+
+BatchingExecutor::~BatchingExecutor() {
+    impl_->DeInit();
+}
+
+Status BatchingExecutor::Init(TNN &tnn, NetworkConfig &net_config, InputShapesMap min_inputs_shape,
+                              InputShapesMap max_inputs_shape, BatchingConfig batching_config) {
+    return impl_->Init(tnn, net_config, min_inputs_shape, max_inputs_shape, batching_config);
+}
+
+Status BatchingExecutor::DeInit() {
+    return impl_->DeInit();
+}
+
+Status BatchingExecutor::Forward(MatMap &inputs, MatMap &outputs) {
+    return impl_->Forward(inputs, outputs);
+}
+
+std::shared_ptr<Instance> BatchingExecutor::GetInstance() {
+    return impl_->GetInstance();
+}
+
+}  // namespace TNN_NS
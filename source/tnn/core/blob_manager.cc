@@ -15,12 +15,15 @@
 #include "tnn/core/blob_manager.h"
 
 #include <algorithm>
+#include <climits>
 #include <cstring>
 #include <set>
 
+#include "tnn/memory_manager/blob_memory_planner.h"
 #include "tnn/memory_manager/blob_memory_pool_factory.h"
 #include "tnn/memory_manager/blob_memory_size_info.h"
 #include "tnn/memory_manager/memory_mode_state_factory.h"
+#include "tnn/memory_manager/memory_plan_assign_strategy.h"
 #include "tnn/memory_manager/memory_seperate_assign_strategy.h"
 #include "tnn/memory_manager/memory_unify_assign_strategy.h"
 #include "tnn/utils/dims_utils.h"
@@ -28,6 +31,9 @@
 
 namespace TNN_NS {
 
+// alignment of blob offsets in the memory plan, one cache line of x86 and arm
+static const int kMemoryPlanAlignment = 64;
+
 BlobManager::BlobManager(AbstractDevice *device) {
     device_            = device;
     // create 1d memory pool
@@ -107,6 +113,10 @@ Status BlobManager::Init(NetworkConfig &config, NetStructure *net_structure, Inp
         if (config.data_format != DATA_FORMAT_AUTO) {
             desc.data_format = config.data_format;
         }
+        // x86 has no kernels for NC16HW16 and inserts no reformat for it, the net is computed in nchw
+        if (config.device_type == DEVICE_X86 && config.data_format == DATA_FORMAT_NC16HW16) {
+            desc.data_format = DATA_FORMAT_NCHW;
+        }
 
         // check whether the input_shape is defined or not.
         if (instance_input_shapes_map.count(node_name) > 0) {
@@ -144,6 +154,16 @@ Status BlobManager::Init(NetworkConfig &config, NetStructure *net_structure, Inp
         output_blobs_[name] = blob;
     }
 
+    // only memory of cpu devices can be replaced by user memory
+    auto device_type = device_->GetDeviceType();
+    if (device_type == DEVICE_X86 || device_type == DEVICE_NAIVE || device_type == DEVICE_ARM) {
+        for (auto name : config.bound_blobs) {
+            if (input_blobs_.count(name) > 0 || output_blobs_.count(name) > 0) {
+                bound_blob_names_.insert(name);
+            }
+        }
+    }
+
     return TNN_OK;
 }
 
@@ -154,12 +174,18 @@ Status BlobManager::Init(NetworkConfig &config, NetStructure *net_structure, Inp
  *  The size may be different for different devices.
  */
 Status BlobManager::AllocateBlobMemory(int flag) {
+    Status ret = AllocateBoundBlobMemory(flag);
+    RETURN_ON_NEQ(ret, TNN_OK);
+    if (IsMemoryPlanEnabled()) {
+        return AllocateBlobMemoryWithPlan(flag);
+    }
+
     const auto &input_shapes_map = net_structure_->inputs_shape_map;
 
     for (auto iter : input_shapes_map) {
         std::string current_blob_name = iter.first;
         Blob *current_blob            = blobs_[current_blob_name];
-        if (current_blob->NeedAllocateInForward() ||
+        if (current_blob->NeedAllocateInForward() || IsBoundBlob(current_blob) ||
             DataFlagUtils::ChangeStatus(current_blob->GetFlag()) != DataFlagUtils::ChangeStatus(flag)) {
             continue;
         }
@@ -180,10 +206,12 @@ Status BlobManager::AllocateBlobMemory(int flag) {
      */
     for (size_t layer_index = 0; layer_index < net_structure_->layers.size(); layer_index++) {
         LayerInfo *layer_info = net_structure_->layers[layer_index].get();
+        // outputs of a view layer are placed in the memory of its input 0
+        BlobMemory *view_memory = GetViewBlobMemory((int)layer_index, flag);
         // allocating blob memory for every out nodes of this layer
         for (auto current_blob_name : layer_info->outputs) {
             Blob *current_blob = blobs_[current_blob_name];
-            if (current_blob->NeedAllocateInForward() ||
+            if (current_blob->NeedAllocateInForward() || IsBoundBlob(current_blob) ||
                 DataFlagUtils::ChangeStatus(current_blob->GetFlag()) != DataFlagUtils::ChangeStatus(flag)) {
                 continue;
             }
@@ -198,6 +226,26 @@ Status BlobManager::AllocateBlobMemory(int flag) {
                 // calculate the use count of this blob
                 int use_count = GetBlobUseCount(layer_index, current_blob_name);
 
+                if (view_memory) {
+                    view_memory->SetUseCount(view_memory->GetUseCount() + use_count);
+                    AddViewBlob((int)layer_index, current_blob, view_memory);
+                    continue;
+                }
+
+                // the output takes over the memory of an input read for the last time by this layer,
+                // the input refund below leaves the use count of the output
+                const auto &inputs         = layer_info->inputs;
+                BlobMemory *inplace_memory = GetInplaceBlobMemory(
+                    (int)layer_index, flag, [&](BlobMemory *blob_memory, const std::string &input_name) {
+                        // views of the input may still be read
+                        return blob_memory->GetUseCount() == std::count(inputs.begin(), inputs.end(), input_name);
+                    });
+                if (inplace_memory) {
+                    inplace_memory->SetUseCount(inplace_memory->GetUseCount() + use_count);
+                    blob_memory_mapping_.insert(std::make_pair(current_blob, inplace_memory));
+                    continue;
+                }
+
                 BlobMemorySizeInfo info = device_->Calculate(current_blob->GetBlobDesc());
                 // find an available BlobMemory
                 BlobMemory *blob_memory = blob_memory_pool_map_[info.dims.size()]->BorrowBlobMemory(use_count, info, false);
@@ -208,7 +256,7 @@ Status BlobManager::AllocateBlobMemory(int flag) {
         // refund the input blob memory
         for (auto current_blob_name : layer_info->inputs) {
             Blob *current_blob = blobs_[current_blob_name];
-            if (current_blob->NeedAllocateInForward() ||
+            if (current_blob->NeedAllocateInForward() || IsBoundBlob(current_blob) ||
                 DataFlagUtils::ChangeStatus(current_blob->GetFlag()) != DataFlagUtils::ChangeStatus(flag)) {
                 continue;
             }
@@ -260,6 +308,400 @@ Status BlobManager::AllocateBlobMemory(int flag) {
     return status;
 }
 
+bool BlobManager::IsMemoryPlanEnabled() {
+    auto device_type = device_->GetDeviceType();
+    return config_.enable_memory_plan &&
+           (device_type == DEVICE_X86 || device_type == DEVICE_NAIVE || device_type == DEVICE_ARM);
+}
+
+/*
+ *  Every blob gets its own blob memory with the lifetime from the layer writing it
+ *  to the last layer reading it. The planner places them in one memory, blobs whose
+ *  lifetime overlaps never share bytes.
+ */
+Status BlobManager::AllocateBlobMemoryWithPlan(int flag) {
+    const auto &input_shapes_map = net_structure_->inputs_shape_map;
+    const auto &layers           = GetLayerOrder();
+    const int layer_count        = (int)layers.size();
+    auto need_allocate           = [&](Blob *blob) {
+        return !blob->NeedAllocateInForward() && !IsBoundBlob(blob) &&
+               DataFlagUtils::ChangeStatus(blob->GetFlag()) == DataFlagUtils::ChangeStatus(flag);
+    };
+
+    BlobMemoryPlanner planner(kMemoryPlanAlignment);
+    std::map<BlobMemory *, int> blob_memory_blocks;
+    // last layer reading any blob placed in the blob memory
+    std::map<BlobMemory *, int> blob_memory_last_use;
+    auto extend_blob_memory = [&](BlobMemory *blob_memory, int last) {
+        planner.ExtendBlock(blob_memory_blocks[blob_memory], last);
+        blob_memory_last_use[blob_memory] = std::max(blob_memory_last_use[blob_memory], last);
+    };
+    auto add_blob_memory = [&](Blob *blob, int first, int last) -> Status {
+        BlobMemorySizeInfo info = device_->Calculate(blob->GetBlobDesc());
+        if (info.dims.size() != 1) {
+            return Status(TNNERR_COMMON_ERROR, "memory plan only supports 1d blob memory");
+        }
+        BlobMemory *blob_memory = blob_memory_pool_map_[1]->BorrowBlobMemory(1, info, true);
+        blob_memory_mapping_.insert(std::make_pair(blob, blob_memory));
+        blob_memory_blocks[blob_memory]   = planner.AddBlock(GetBlobMemoryBytesSize(info), first, last);
+        blob_memory_last_use[blob_memory] = last;
+        return TNN_OK;
+    };
+
+    // inputs are set before forward, they live through the whole forward
+    for (auto iter : input_shapes_map) {
+        Blob *current_blob = blobs_[iter.first];
+        if (!need_allocate(current_blob)) {
+            continue;
+        }
+        auto status = add_blob_memory(current_blob, 0, layer_count);
+        RETURN_ON_NEQ(status, TNN_OK);
+    }
+
+    // the first layer writing an input of a concat layer starts the block of the concat output
+    auto concat_inputs = GetConcatInputBlobs(flag);
+
+    for (int layer_index = 0; layer_index < layer_count; layer_index++) {
+        LayerInfo *layer_info = layers[layer_index].get();
+        for (auto current_blob_name : layer_info->outputs) {
+            Blob *current_blob = blobs_[current_blob_name];
+            auto concat_iter   = concat_inputs.find(current_blob);
+            if (concat_iter == concat_inputs.end() || blob_memory_mapping_.count(current_blob) > 0) {
+                continue;
+            }
+            int concat_index        = concat_iter->second;
+            std::string concat_name = layers[concat_index]->outputs[0];
+            Blob *concat_blob       = blobs_[concat_name];
+            auto status = add_blob_memory(concat_blob, layer_index, GetBlobLastUseIndex(concat_index, concat_name));
+            RETURN_ON_NEQ(status, TNN_OK);
+            AddConcatBlobs(concat_index, blob_memory_mapping_[concat_blob]);
+        }
+
+        BlobMemory *view_memory = GetViewBlobMemory(layer_index, flag);
+        for (auto current_blob_name : layer_info->outputs) {
+            Blob *current_blob = blobs_[current_blob_name];
+            if (!need_allocate(current_blob) || blob_memory_mapping_.count(current_blob) > 0) {
+                continue;
+            }
+            if (DimsVectorUtils::Count(current_blob->GetBlobDesc().dims) < 0) {
+                LOGE("Got empty blob, name:%s\n", current_blob_name.c_str());
+                return Status(TNNERR_LAYER_ERR, "blob dims is invaid");
+            }
+            int last_use_index = GetBlobLastUseIndex(layer_index, current_blob_name);
+            // the outputs of a view layer extend the block of its input 0
+            if (view_memory) {
+                AddViewBlob(layer_index, current_blob, view_memory);
+                extend_blob_memory(view_memory, last_use_index);
+                continue;
+            }
+            // the output takes over the block of an input read for the last time by this layer
+            BlobMemory *inplace_memory =
+                GetInplaceBlobMemory(layer_index, flag, [&](BlobMemory *blob_memory, const std::string &input_name) {
+                    // views of the input may still be read
+                    return blob_memory_last_use[blob_memory] <= layer_index;
+                });
+            if (inplace_memory) {
+                blob_memory_mapping_.insert(std::make_pair(current_blob, inplace_memory));
+                extend_blob_memory(inplace_memory, last_use_index);
+                continue;
+            }
+            auto status = add_blob_memory(current_blob, layer_index, last_use_index);
+            RETURN_ON_NEQ(status, TNN_OK);
+        }
+
+        // scratch memory lives only while the layer runs
+        auto workspace_iter = workspace_layers_.find(layer_info->name);
+        if (workspace_iter != workspace_layers_.end() && workspace_iter->second > 0 &&
+            DataFlagUtils::ChangeStatus(flag) == DataFlagUtils::ChangeStatus(DATA_FLAG_CHANGE_ALWAYS) &&
+            workspace_blobs_.count(layer_info->name) == 0) {
+            BlobDesc desc;
+            desc.device_type = device_->GetDeviceType();
+            desc.data_type   = DATA_TYPE_FLOAT;
+            desc.data_format = DATA_FORMAT_NCHW;
+            desc.dims        = {1, (int)((workspace_iter->second + sizeof(float) - 1) / sizeof(float)), 1, 1};
+            desc.name        = layer_info->name + "_workspace";
+            Blob *workspace  = new Blob(desc);
+            workspace_blobs_[layer_info->name] = workspace;
+            auto status = add_blob_memory(workspace, layer_index, layer_index);
+            RETURN_ON_NEQ(status, TNN_OK);
+        }
+    }
+
+    auto status = planner.Plan();
+    RETURN_ON_NEQ(status, TNN_OK);
+    for (auto iter : blob_memory_blocks) {
+        blob_memory_offsets_[iter.first] = planner.GetOffset(iter.second);
+    }
+    // forward memory sizes and the arena dims are int
+    if (planner.GetPeakSize() > (int64_t)INT_MAX - kMemoryPlanAlignment) {
+        LOGE("Error: memory plan peak %lld bytes exceeds INT_MAX\n", (long long)planner.GetPeakSize());
+        return Status(TNNERR_OUTOFMEMORY, "memory plan peak exceeds INT_MAX");
+    }
+    memory_plan_size_ = (int)planner.GetPeakSize();
+    LOGD("memory plan: %d blobs, peak %lld bytes, lower bound %lld bytes, without reuse %lld bytes\n",
+         (int)blob_memory_blocks.size(), (long long)planner.GetPeakSize(), (long long)planner.GetLowerBound(),
+         (long long)planner.GetTotalSize());
+
+    if (config_.share_memory_mode == SHARE_MEMORY_MODE_DEFAULT) {
+        if (memory_plan_size_ <= 0) {
+            BindBlobMemory();
+            return TNN_OK;
+        }
+        // every planned blob is written before it is read, except the padded channels of int8 blobs
+        bool zero_fill = false;
+        for (auto iter : blob_memory_blocks) {
+            zero_fill = zero_fill || iter.first->GetBlobMemorySizeInfo().data_type == DATA_TYPE_INT8;
+        }
+        // extra bytes to align the start of the memory
+        BlobMemorySizeInfo arena_info;
+        arena_info.data_type = DATA_TYPE_INT8;
+        arena_info.dims      = {memory_plan_size_ + kMemoryPlanAlignment};
+        arena_info.zero_fill = zero_fill;
+        status               = device_->Allocate(&memory_plan_arena_, arena_info);
+        RETURN_ON_NEQ(status, TNN_OK);
+        RETURN_VALUE_ON_NEQ(memory_plan_arena_ != nullptr, true, Status(TNNERR_OUTOFMEMORY, "memory plan allocate failed"));
+
+        auto arena_addr = reinterpret_cast<uintptr_t>(memory_plan_arena_);
+        auto arena_data = reinterpret_cast<void *>((arena_addr + kMemoryPlanAlignment - 1) /
+                                                   kMemoryPlanAlignment * kMemoryPlanAlignment);
+        MemoryPlanAssignStrategy strategy(arena_data, blob_memory_offsets_);
+        status = blob_memory_pool_map_[1]->AssignAllBlobMemory(strategy);
+        RETURN_ON_NEQ(status, TNN_OK);
+        BindBlobMemory();
+    } else if (config_.share_memory_mode == SHARE_MEMORY_MODE_SHARE_ONE_THREAD) {
+        SharedMemory share_memory = SharedMemoryManager::GetSharedMemory(memory_plan_size_, init_thread_id_, device_,
+                                                                         config_.device_id, this, status);
+        RETURN_ON_NEQ(status, TNN_OK);
+        shared_memory_allocated_ = true;
+        MemoryPlanAssignStrategy strategy(share_memory.shared_memory_data, blob_memory_offsets_);
+        status = blob_memory_pool_map_[1]->AssignAllBlobMemory(strategy);
+        RETURN_ON_NEQ(status, TNN_OK);
+        BindBlobMemory();
+    }
+    return TNN_OK;
+}
+
+int BlobManager::GetBlobLastUseIndex(int layer_index, std::string current_blob_name) {
+    const auto &layers    = GetLayerOrder();
+    const int layer_count = (int)layers.size();
+    if (net_structure_->outputs.count(current_blob_name) > 0) {
+        return layer_count;
+    }
+    int last_use_index = -1;
+    for (int next_layer_id = layer_index + 1; next_layer_id < layer_count; ++next_layer_id) {
+        const auto &inputs = layers[next_layer_id]->inputs;
+        if (std::find(inputs.begin(), inputs.end(), current_blob_name) != inputs.end()) {
+            last_use_index = next_layer_id;
+        }
+    }
+    // blob without reader is kept to the end as the refund pool does
+    return last_use_index >= 0 ? last_use_index : layer_count;
+}
+
+/*
+ * The only output of an in place layer shares the memory of an input if no later layer
+ * reads the input or the other blobs in its memory, the input is neither a net input nor
+ * a net output, and both blobs take the same bytes of 1d memory.
+ */
+BlobMemory *BlobManager::GetInplaceBlobMemory(int layer_index, int flag, const BlobMemoryFilter &is_last_reader) {
+    const auto &layers    = GetLayerOrder();
+    const int layer_count = (int)layers.size();
+    LayerInfo *layer_info = layers[layer_index].get();
+    auto iter             = inplace_layers_.find(layer_info->name);
+    if (iter == inplace_layers_.end() || layer_info->outputs.size() != 1) {
+        return nullptr;
+    }
+
+    Blob *output_blob              = blobs_[layer_info->outputs[0]];
+    BlobMemorySizeInfo output_info = device_->Calculate(output_blob->GetBlobDesc());
+    if (output_info.dims.size() != 1) {
+        return nullptr;
+    }
+    for (auto input_index : iter->second) {
+        if (input_index < 0 || input_index >= (int)layer_info->inputs.size()) {
+            continue;
+        }
+        std::string input_name = layer_info->inputs[input_index];
+        if (net_structure_->inputs_shape_map.count(input_name) > 0 || net_structure_->outputs.count(input_name) > 0) {
+            continue;
+        }
+        Blob *input_blob = blobs_[input_name];
+        // the output is bound to the start of the memory
+        if (blob_view_offsets_.count(input_blob) > 0 && blob_view_offsets_[input_blob] != 0) {
+            continue;
+        }
+        if (input_blob->NeedAllocateInForward() ||
+            DataFlagUtils::ChangeStatus(input_blob->GetFlag()) != DataFlagUtils::ChangeStatus(flag) ||
+            input_blob->GetBlobDesc().data_type != output_blob->GetBlobDesc().data_type) {
+            continue;
+        }
+        auto memory_iter = blob_memory_mapping_.find(input_blob);
+        if (memory_iter == blob_memory_mapping_.end() || GetBlobLastUseIndex(layer_index, input_name) != layer_count) {
+            continue;
+        }
+        BlobMemorySizeInfo input_info = device_->Calculate(input_blob->GetBlobDesc());
+        if (input_info.dims.size() == 1 && GetBlobMemoryBytesSize(input_info) == GetBlobMemoryBytesSize(output_info) &&
+            is_last_reader(memory_iter->second, input_name)) {
+            return memory_iter->second;
+        }
+    }
+    return nullptr;
+}
+
+/*
+ * All outputs of a view layer share the memory of input 0 if they need no more bytes than it,
+ * the layer then only points them at their part of the memory.
+ */
+BlobMemory *BlobManager::GetViewBlobMemory(int layer_index, int flag) {
+    const auto &layers    = GetLayerOrder();
+    LayerInfo *layer_info = layers[layer_index].get();
+    auto iter             = view_layers_.find(layer_info->name);
+    if (iter == view_layers_.end() || layer_info->inputs.empty() ||
+        iter->second.size() != layer_info->outputs.size()) {
+        return nullptr;
+    }
+    auto need_allocate = [&](Blob *blob) {
+        return !blob->NeedAllocateInForward() && !IsBoundBlob(blob) &&
+               DataFlagUtils::ChangeStatus(blob->GetFlag()) == DataFlagUtils::ChangeStatus(flag);
+    };
+
+    Blob *input_blob = blobs_[layer_info->inputs[0]];
+    auto memory_iter = blob_memory_mapping_.find(input_blob);
+    if (!need_allocate(input_blob) || memory_iter == blob_memory_mapping_.end()) {
+        return nullptr;
+    }
+    BlobMemorySizeInfo input_info = device_->Calculate(input_blob->GetBlobDesc());
+    if (input_info.dims.size() != 1) {
+        return nullptr;
+    }
+    for (auto output_name : layer_info->outputs) {
+        Blob *output_blob              = blobs_[output_name];
+        BlobMemorySizeInfo output_info = device_->Calculate(output_blob->GetBlobDesc());
+        if (!need_allocate(output_blob) || blob_memory_mapping_.count(output_blob) > 0 ||
+            output_info.dims.size() != 1 || GetBlobMemoryBytesSize(output_info) > GetBlobMemoryBytesSize(input_info)) {
+            return nullptr;
+        }
+    }
+    return memory_iter->second;
+}
+
+void BlobManager::AddViewBlob(int layer_index, Blob *blob, BlobMemory *blob_memory) {
+    LayerInfo *layer_info = GetLayerOrder()[layer_index].get();
+    const auto &outputs   = layer_info->outputs;
+    int output_index      = (int)(std::find(outputs.begin(), outputs.end(), blob->GetBlobDesc().name) - outputs.begin());
+    Blob *input_blob      = blobs_[layer_info->inputs[0]];
+    int64_t input_offset  = blob_view_offsets_.count(input_blob) > 0 ? blob_view_offsets_[input_blob] : 0;
+
+    blob_view_offsets_[blob] = input_offset + view_layers_[layer_info->name][output_index];
+    blob_memory_mapping_.insert(std::make_pair(blob, blob_memory));
+}
+
+/*
+ * The inputs of a concat layer are placed in the memory of its output if each of them is
+ * written by an earlier layer, read by no other layer, not a net output, and takes its part
+ * of the 1d memory of the output. A blob takes part in one concat layer at most.
+ */
+std::map<Blob *, int> BlobManager::GetConcatInputBlobs(int flag) {
+    std::map<Blob *, int> concat_inputs;
+    const auto &layers = GetLayerOrder();
+    auto need_allocate = [&](Blob *blob) {
+        return !blob->NeedAllocateInForward() && !IsBoundBlob(blob) &&
+               DataFlagUtils::ChangeStatus(blob->GetFlag()) == DataFlagUtils::ChangeStatus(flag);
+    };
+
+    std::map<std::string, int> read_counts;
+    for (auto layer : layers) {
+        for (auto input_name : layer->inputs) {
+            read_counts[input_name]++;
+        }
+    }
+    // blobs written by the layers before the current one
+    std::set<std::string> written_blobs;
+    std::set<Blob *> used_blobs;
+    for (int layer_index = 0; layer_index < (int)layers.size(); layer_index++) {
+        LayerInfo *layer_info = layers[layer_index].get();
+        auto iter             = concat_layers_.find(layer_info->name);
+        bool placeable        = iter != concat_layers_.end() && layer_info->outputs.size() == 1 &&
+                         iter->second.size() == layer_info->inputs.size();
+        Blob *output_blob     = placeable ? blobs_[layer_info->outputs[0]] : nullptr;
+        int64_t output_bytes  = 0;
+        if (placeable) {
+            BlobMemorySizeInfo output_info = device_->Calculate(output_blob->GetBlobDesc());
+            output_bytes                   = GetBlobMemoryBytesSize(output_info);
+            placeable = need_allocate(output_blob) && used_blobs.count(output_blob) == 0 &&
+                        net_structure_->inputs_shape_map.count(layer_info->outputs[0]) == 0 &&
+                        output_info.dims.size() == 1;
+        }
+        for (int i = 0; placeable && i < (int)layer_info->inputs.size(); i++) {
+            const auto &input_name = layer_info->inputs[i];
+            Blob *input_blob       = blobs_[input_name];
+            if (written_blobs.count(input_name) == 0 || read_counts[input_name] != 1 ||
+                net_structure_->outputs.count(input_name) > 0 || used_blobs.count(input_blob) > 0 ||
+                !need_allocate(input_blob) ||
+                input_blob->GetBlobDesc().data_type != output_blob->GetBlobDesc().data_type) {
+                placeable = false;
+                break;
+            }
+            BlobMemorySizeInfo input_info = device_->Calculate(input_blob->GetBlobDesc());
+            placeable = input_info.dims.size() == 1 &&
+                        iter->second[i] + GetBlobMemoryBytesSize(input_info) <= output_bytes;
+        }
+        if (placeable) {
+            used_blobs.insert(output_blob);
+            for (auto input_name : layer_info->inputs) {
+                used_blobs.insert(blobs_[input_name]);
+                concat_inputs[blobs_[input_name]] = layer_index;
+            }
+        }
+
+        for (auto output_name : layer_info->outputs) {
+            written_blobs.insert(output_name);
+        }
+    }
+    return concat_inputs;
+}
+
+bool BlobManager::IsBoundBlob(Blob *blob) {
+    return bound_blob_names_.count(blob->GetBlobDesc().name) > 0;
+}
+
+Status BlobManager::AllocateBoundBlobMemory(int flag) {
+    for (auto name : bound_blob_names_) {
+        Blob *blob = blobs_[name];
+        if (blob->NeedAllocateInForward() || bound_blob_memory_.count(blob) > 0 ||
+            DataFlagUtils::ChangeStatus(blob->GetFlag()) != DataFlagUtils::ChangeStatus(flag)) {
+            continue;
+        }
+        BlobMemorySizeInfo info = device_->Calculate(blob->GetBlobDesc());
+        void *data              = nullptr;
+        auto status             = device_->Allocate(&data, info);
+        RETURN_ON_NEQ(status, TNN_OK);
+        bound_blob_memory_[blob] = data;
+
+        BlobHandle handle;
+        handle.base = data;
+        blob->SetHandle(handle);
+    }
+    return TNN_OK;
+}
+
+void BlobManager::AddConcatBlobs(int layer_index, BlobMemory *blob_memory) {
+    LayerInfo *layer_info = GetLayerOrder()[layer_index].get();
+    const auto &offsets   = concat_layers_[layer_info->name];
+    for (int i = 0; i < (int)layer_info->inputs.size(); i++) {
+        Blob *input_blob               = blobs_[layer_info->inputs[i]];
+        blob_view_offsets_[input_blob] = offsets[i];
+        blob_memory_mapping_.insert(std::make_pair(input_blob, blob_memory));
+    }
+}
+
+bool BlobManager::IsBlobMemoryShared(Blob *blob, Blob *other_blob) {
+    auto iter       = blob_memory_mapping_.find(blob);
+    auto other_iter = blob_memory_mapping_.find(other_blob);
+    return iter != blob_memory_mapping_.end() && other_iter != blob_memory_mapping_.end() &&
+           iter->second == other_iter->second;
+}
+
 /*
  * This function calculate the use count of the given blob.
  * output layer is regarded as an additional reference.
@@ -291,6 +733,19 @@ Status BlobManager::DeInit() {
     for (auto blob : blobs_) {
         delete blob.second;
     }
+    for (auto iter : workspace_blobs_) {
+        delete iter.second;
+    }
+    workspace_blobs_.clear();
+
+    if (memory_plan_arena_ != nullptr) {
+        device_->Free(memory_plan_arena_);
+        memory_plan_arena_ = nullptr;
+    }
+    for (auto iter : bound_blob_memory_) {
+        device_->Free(iter.second);
+    }
+    bound_blob_memory_.clear();
 
     if (memory_mode_state_ != NULL) {
         delete memory_mode_state_;
@@ -300,6 +755,12 @@ Status BlobManager::DeInit() {
 }
 
 void BlobManager::OnSharedForwardMemoryChanged(void *memory) {
+    if (IsMemoryPlanEnabled()) {
+        MemoryPlanAssignStrategy strategy(memory, blob_memory_offsets_);
+        blob_memory_pool_map_[1]->AssignAllBlobMemory(strategy);
+        BindBlobMemory();
+        return;
+    }
     MemoryUnifyAssignStrategy strategy(memory);
     for (auto blob_memory_pool_iter : blob_memory_pool_map_) {
         blob_memory_pool_iter.second->AssignAllBlobMemory(strategy);
@@ -315,10 +776,15 @@ Status BlobManager::SetForwardMemory(void *memory) {
     if (config_.share_memory_mode != SHARE_MEMORY_MODE_SET_FROM_EXTERNAL) {
         return Status(TNNERR_NOT_SUPPORT_SET_FORWARD_MEM, "set memory from external is unsupported");
     }
-    MemoryUnifyAssignStrategy strategy(memory);
     Status status = TNN_OK;
-    for (auto blob_memory_pool_iter : blob_memory_pool_map_) {
-        status = blob_memory_pool_iter.second->AssignAllBlobMemory(strategy);
+    if (IsMemoryPlanEnabled()) {
+        MemoryPlanAssignStrategy strategy(memory, blob_memory_offsets_);
+        status = blob_memory_pool_map_[1]->AssignAllBlobMemory(strategy);
+    } else {
+        MemoryUnifyAssignStrategy strategy(memory);
+        for (auto blob_memory_pool_iter : blob_memory_pool_map_) {
+            status = blob_memory_pool_iter.second->AssignAllBlobMemory(strategy);
+        }
     }
     if (status == TNN_OK) {
         BindBlobMemory();
@@ -330,7 +796,12 @@ void BlobManager::BindBlobMemory() {
     memory_mode_state_->SetMemoryAllocatedFlag();
     // bind every blob_memory's data_ into every blob's data
     for (auto iter : blob_memory_mapping_) {
-        iter.first->SetHandle(iter.second->GetHandle());
+        BlobHandle handle = iter.second->GetHandle();
+        auto offset_iter  = blob_view_offsets_.find(iter.first);
+        if (offset_iter != blob_view_offsets_.end()) {
+            handle.bytes_offset += offset_iter->second;
+        }
+        iter.first->SetHandle(handle);
         // set blob data format to nchw when blob memory is 1d on opencl
         if (device_->GetDeviceType() == DEVICE_OPENCL &&
             iter.second->GetBlobMemorySizeInfo().dims.size() == 1) {
@@ -342,6 +813,9 @@ void BlobManager::BindBlobMemory() {
 }
 
 int BlobManager::GetAllBlobMemorySize() {
+    if (IsMemoryPlanEnabled()) {
+        return memory_plan_size_;
+    }
     int mem_size_all_blob = 0;
     for (auto blob_memory_pool_iter : blob_memory_pool_map_) {
         mem_size_all_blob += blob_memory_pool_iter.second->GetAllBlobMemorySize();
@@ -383,6 +857,35 @@ void BlobManager::ReplaceBlob(std::string name, Blob *new_blob) {
         output_blobs_[name] = new_blob;
 }
 
+void BlobManager::SetLayerOrder(std::vector<std::shared_ptr<LayerInfo>> layers) {
+    layer_order_ = layers;
+}
+
+void BlobManager::SetInplaceLayers(const std::map<std::string, std::vector<int>> &inplace_layers) {
+    inplace_layers_ = inplace_layers;
+}
+
+void BlobManager::SetViewLayers(const std::map<std::string, std::vector<int64_t>> &view_layers) {
+    view_layers_ = view_layers;
+}
+
+void BlobManager::SetConcatLayers(const std::map<std::string, std::vector<int64_t>> &concat_layers) {
+    concat_layers_ = concat_layers;
+}
+
+void BlobManager::SetWorkspaceLayers(const std::map<std::string, size_t> &workspace_layers) {
+    workspace_layers_ = workspace_layers;
+}
+
+Blob *BlobManager::GetWorkspaceBlob(const std::string &layer_name) {
+    auto iter = workspace_blobs_.find(layer_name);
+    return iter == workspace_blobs_.end() ? nullptr : iter->second;
+}
+
+const std::vector<std::shared_ptr<LayerInfo>> &BlobManager::GetLayerOrder() {
+    return layer_order_.empty() ? net_structure_->layers : layer_order_;
+}
+
 Status BlobManager::CheckBlobMemoryState() {
     return memory_mode_state_->GetStatus();
 }
@@ -15,8 +15,10 @@
 #ifndef TNN_SOURCE_TNN_CORE_BLOB_MANAGER_H_
 #define TNN_SOURCE_TNN_CORE_BLOB_MANAGER_H_
 
+#include <functional>
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <thread>
 
@@ -79,10 +81,60 @@ public:
     // @brief replace blob with new_blob, and delete the original blob if exist
     void ReplaceBlob(std::string name, Blob *new_blob);
 
+    // @brief whether blob memory is placed by the memory plan
+    bool IsMemoryPlanEnabled();
+
+    // @brief set the order layers run in, blob lifetimes of the memory plan follow it
+    void SetLayerOrder(std::vector<std::shared_ptr<LayerInfo>> layers);
+
+    // @brief set indexes of the inputs whose memory the output of each layer can share, keyed by layer name
+    void SetInplaceLayers(const std::map<std::string, std::vector<int>> &inplace_layers);
+
+    // @brief set offsets in bytes of the outputs inside input 0 of the layers whose outputs can all be views,
+    // keyed by layer name
+    void SetViewLayers(const std::map<std::string, std::vector<int64_t>> &view_layers);
+
+    // @brief set offsets in bytes of the inputs inside the output of the layers whose inputs are all dense parts of
+    // the output, keyed by layer name. only the memory plan places them there.
+    void SetConcatLayers(const std::map<std::string, std::vector<int64_t>> &concat_layers);
+
+    // @brief set bytes of scratch memory each layer needs in forward, keyed by layer name. only the memory plan
+    // places it in the forward memory.
+    void SetWorkspaceLayers(const std::map<std::string, size_t> &workspace_layers);
+
+    // @brief blob holding the planned scratch memory of the layer, nullptr if it has none
+    Blob *GetWorkspaceBlob(const std::string &layer_name);
+
+    // @brief whether the blobs are placed in the same blob memory
+    bool IsBlobMemoryShared(Blob *blob, Blob *other_blob);
+
 protected:
     void BindBlobMemory();
     int GetBlobUseCount(int layer_index, std::string current_blob_name);
 
+    // @brief allocate blob memory at offsets planned by blob lifetime
+    Status AllocateBlobMemoryWithPlan(int flag);
+    // @brief layers in the order they run
+    const std::vector<std::shared_ptr<LayerInfo>> &GetLayerOrder();
+    // @brief index of the last layer reading the blob, layer count if the blob lives to the end of forward
+    int GetBlobLastUseIndex(int layer_index, std::string current_blob_name);
+    // @brief tells whether the layer is the last one reading any blob in the blob memory of its input
+    typedef std::function<bool(BlobMemory *, const std::string &)> BlobMemoryFilter;
+    // @brief blob memory of an input the output of the layer can share, nullptr if the layer can not run in place
+    BlobMemory *GetInplaceBlobMemory(int layer_index, int flag, const BlobMemoryFilter &is_last_reader);
+    // @brief blob memory of input 0 all outputs of the layer are placed in, nullptr if they need their own memory
+    BlobMemory *GetViewBlobMemory(int layer_index, int flag);
+    // @brief place the output of a view layer in the blob memory of input 0
+    void AddViewBlob(int layer_index, Blob *blob, BlobMemory *blob_memory);
+    // @brief inputs of the concat layers placed in the memory of their output, mapped to the concat layer index
+    std::map<Blob *, int> GetConcatInputBlobs(int flag);
+    // @brief place the inputs of a concat layer in the blob memory of its output
+    void AddConcatBlobs(int layer_index, BlobMemory *blob_memory);
+    // @brief whether the blob is bound to user memory and owns its memory out of the shared memory
+    bool IsBoundBlob(Blob *blob);
+    // @brief allocate the own memory of the blobs bound to user memory
+    Status AllocateBoundBlobMemory(int flag);
+
     NetworkConfig config_;
     NetStructure *net_structure_;
     // dimension-memory pool
@@ -95,6 +147,23 @@ protected:
     std::map<Blob *, BlobMemory *> blob_memory_mapping_;
     bool shared_memory_allocated_;
 
+    // offsets of blob memory in the memory plan
+    std::map<BlobMemory *, int64_t> blob_memory_offsets_;
+    std::vector<std::shared_ptr<LayerInfo>> layer_order_;
+    std::map<std::string, std::vector<int>> inplace_layers_;
+    std::map<std::string, std::vector<int64_t>> view_layers_;
+    std::map<std::string, std::vector<int64_t>> concat_layers_;
+    // offsets of views and concat inputs from the start of their blob memory
+    std::map<Blob *, int64_t> blob_view_offsets_;
+    // net inputs and outputs bound to user memory and their own memory
+    std::set<std::string> bound_blob_names_;
+    std::map<Blob *, void *> bound_blob_memory_;
+    // scratch memory of layers and the blobs holding it, keyed by layer name
+    std::map<std::string, size_t> workspace_layers_;
+    std::map<std::string, Blob *> workspace_blobs_;
+    int memory_plan_size_    = 0;
+    void *memory_plan_arena_ = nullptr;
+
     std::thread::id init_thread_id_;
     MemoryModeState *memory_mode_state_;
 };
@@ -66,6 +66,19 @@ Status ConstFolder::Init(NetworkConfig &net_config, ModelConfig &model_config, A
     return Forward();
 }
 
+Status ConstFolder::InitFromNetwork(AbstractNetwork *network, NetResource *net_resource) {
+    auto device = GetDevice(DEVICE_NAIVE);
+    RETURN_VALUE_ON_NEQ(device != NULL, true, TNNERR_DEVICE_NOT_SUPPORT);
+    runtime_blob_pool_ = BlobMemoryPoolFactory::CreateBlobMemoryPool(device);
+
+    auto ret = DefaultNetwork::InitFromNetwork(network, net_resource);
+    if (ret != TNN_OK) {
+        return ret;
+    }
+
+    return Forward();
+}
+
 Status ConstFolder::AllocateBlobMemory() {
     return blob_manager_->AllocateBlobMemory(DATA_FLAG_CHANGE_IF_SHAPE_DIFFER);
 }
@@ -58,6 +58,9 @@ public:
     virtual Status Init(NetworkConfig &net_config, ModelConfig &model_config, AbstractModelInterpreter *interpreter,
                         InputShapesMap min_inputs_shape, InputShapesMap max_inputs_shape);
 
+    // @brief init const folder as a clone of an inited const folder, the clone folds constants into net_resource
+    virtual Status InitFromNetwork(AbstractNetwork *network, NetResource *net_resource = nullptr);
+
     // fold for new inputs shape
     Status Reshape(const InputShapesMap& inputs_shape);
 
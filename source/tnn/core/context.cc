@@ -46,6 +46,10 @@ Status Context::SetNumThreads(int num_threads) {
     return TNN_OK;
 }
 
+int Context::GetNumThreads() {
+    return 1;
+}
+
 void Context::SetPrecision(Precision precision) {
     precision_ = precision;
 }
@@ -62,6 +66,30 @@ bool Context::GetEnableTuneKernel() {
     return enable_tune_kernel_;
 }
 
+void Context::SetCpuThreadPoolMode(CpuThreadPoolMode mode) {
+    cpu_thread_pool_mode_ = mode;
+}
+
+CpuThreadPoolMode Context::GetCpuThreadPoolMode() {
+    return cpu_thread_pool_mode_;
+}
+
+void Context::SetCpuAffinity(std::vector<int> cpu_affinity) {
+    cpu_affinity_ = cpu_affinity;
+}
+
+std::vector<int> Context::GetCpuAffinity() {
+    return cpu_affinity_;
+}
+
+void Context::SetResourceCacheKey(std::string resource_cache_key) {
+    resource_cache_key_ = resource_cache_key;
+}
+
+std::string Context::GetResourceCacheKey() {
+    return resource_cache_key_;
+}
+
 void Context::SetCachePath(std::string cache_path) {
     cache_path_ = cache_path;
 }
@@ -78,6 +106,46 @@ std::string Context::GetCacheFilePath() {
     return cache_file_path_;
 }
 
+std::string Context::GetPackedCacheTag() {
+    return "";
+}
+
+void Context::SetPackedCacheFilePath(std::string packed_cache_file_path) {
+    packed_cache_file_path_ = packed_cache_file_path;
+}
+
+std::string Context::GetPackedCacheFilePath() {
+    return packed_cache_file_path_;
+}
+
+void Context::SetPackedResources(std::map<std::string, std::shared_ptr<RawBuffer>> resources) {
+    std::unique_lock<std::mutex> lck(packed_resources_mtx_);
+    packed_resources_         = resources;
+    packed_resources_updated_ = false;
+}
+
+std::map<std::string, std::shared_ptr<RawBuffer>> Context::GetPackedResources() {
+    std::unique_lock<std::mutex> lck(packed_resources_mtx_);
+    return packed_resources_;
+}
+
+std::shared_ptr<RawBuffer> Context::GetPackedResource(const std::string &key) {
+    std::unique_lock<std::mutex> lck(packed_resources_mtx_);
+    auto iter = packed_resources_.find(key);
+    return iter != packed_resources_.end() ? iter->second : nullptr;
+}
+
+void Context::AddPackedResource(const std::string &key, std::shared_ptr<RawBuffer> resource) {
+    std::unique_lock<std::mutex> lck(packed_resources_mtx_);
+    packed_resources_[key]    = resource;
+    packed_resources_updated_ = true;
+}
+
+bool Context::IsPackedResourcesUpdated() {
+    std::unique_lock<std::mutex> lck(packed_resources_mtx_);
+    return packed_resources_updated_;
+}
+
 #if TNN_PROFILE
 void Context::StartProfile() {
     profile_layer     = true;
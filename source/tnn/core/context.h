@@ -15,7 +15,9 @@
 #ifndef TNN_SOURCE_TNN_CORE_CONTEXT_H_
 #define TNN_SOURCE_TNN_CORE_CONTEXT_H_
 
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -26,6 +28,8 @@
 
 namespace TNN_NS {
 
+class RawBuffer;
+
 class Context {
 public:
     // @brief virtual destructor
@@ -59,6 +63,9 @@ public:
     // @brief set threads run on device
     virtual Status SetNumThreads(int num_threads);
 
+    // @brief get threads run on device
+    virtual int GetNumThreads();
+
     void SetPrecision(Precision precision);
 
     Precision GetPrecision();
@@ -67,6 +74,18 @@ public:
 
     bool GetEnableTuneKernel();
 
+    void SetCpuThreadPoolMode(CpuThreadPoolMode mode);
+
+    CpuThreadPoolMode GetCpuThreadPoolMode();
+
+    void SetCpuAffinity(std::vector<int> cpu_affinity);
+
+    std::vector<int> GetCpuAffinity();
+
+    void SetResourceCacheKey(std::string resource_cache_key);
+
+    std::string GetResourceCacheKey();
+
     void SetCachePath(std::string cache_path);
 
     std::string GetCachePath();
@@ -75,6 +94,29 @@ public:
 
     std::string GetCacheFilePath();
 
+    // @brief tag of the devices and isa the packed resources of layer accs are packed for,
+    // empty if the device does not save packed resources to the cache file
+    virtual std::string GetPackedCacheTag();
+
+    // @brief path of the cache file saving packed resources, layer accs record what they pack only if it is set
+    void SetPackedCacheFilePath(std::string packed_cache_file_path);
+
+    std::string GetPackedCacheFilePath();
+
+    // @brief packed resources loaded from the cache file or recorded by layer accs, keyed by layer and packing
+    void SetPackedResources(std::map<std::string, std::shared_ptr<RawBuffer>> resources);
+
+    std::map<std::string, std::shared_ptr<RawBuffer>> GetPackedResources();
+
+    // @brief get the packed resource loaded from the cache file, nullptr if not found
+    std::shared_ptr<RawBuffer> GetPackedResource(const std::string &key);
+
+    // @brief record the resource a layer acc packs, so it is saved to the cache file
+    void AddPackedResource(const std::string &key, std::shared_ptr<RawBuffer> resource);
+
+    // @brief whether layer accs packed resources not found in the cache file
+    bool IsPackedResourcesUpdated();
+
 #if TNN_PROFILE
 public:
     virtual void StartProfile();
@@ -90,8 +132,15 @@ protected:
 protected:
     Precision precision_ = PRECISION_AUTO;
     bool enable_tune_kernel_ = true;
+    CpuThreadPoolMode cpu_thread_pool_mode_ = CPU_THREAD_POOL_NONE;
+    std::vector<int> cpu_affinity_ = {};
+    std::string resource_cache_key_ = ""; // instances with the same key share packed layer resources
     std::string cache_path_ = ""; // dir to save cache files
     std::string cache_file_path_ = "";
+    std::string packed_cache_file_path_ = "";
+    std::map<std::string, std::shared_ptr<RawBuffer>> packed_resources_;
+    bool packed_resources_updated_ = false;
+    std::mutex packed_resources_mtx_;
 };
 
 }  // namespace TNN_NS
@@ -16,12 +16,27 @@
 
 #include <string.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <queue>
+#include <sstream>
+#include <thread>
+
 #include "tnn/core/blob_int8.h"
 #include "tnn/core/profile.h"
 #include "tnn/interpreter/default_model_interpreter.h"
 #include "tnn/interpreter/layer_param.h"
 #include "tnn/interpreter/layer_resource_generator.h"
+#include "tnn/interpreter/tnn/model_packer.h"
+#include "tnn/interpreter/tnn/objseri.h"
 #include "tnn/memory_manager/blob_memory_pool_factory.h"
+#include "tnn/memory_manager/blob_memory_size_info.h"
+#include "tnn/optimizer/layer_memory_scheduler.h"
 #include "tnn/optimizer/net_optimizer_manager.h"
 #include "tnn/utils/blob_dump_utils.h"
 #include "tnn/utils/blob_transfer_utils.h"
@@ -29,6 +44,8 @@
 #include "tnn/utils/data_flag_utils.h"
 #include "tnn/utils/dims_utils.h"
 #include "tnn/utils/md5.h"
+#include "tnn/utils/omp_utils.h"
+#include "tnn/utils/packed_resource_cache.h"
 #include "tnn/utils/string_utils_inner.h"
 
 namespace TNN_NS {
@@ -41,6 +58,54 @@ NetworkImplFactoryRegister<NetworkImplFactory<DefaultNetwork>> g_network_impl_de
 
 std::mutex DefaultNetwork::optimize_mtx_;
 
+// md5_str joins the md5 of all params, false if the model has no weights in params and generates random resources
+static bool GetAllParamsMd5(DefaultModelInterpreter *interpreter, std::string &md5_str) {
+    auto all_params_md5         = interpreter->GetParamsMd5();
+    const std::string empty_md5 = md5(std::string(""));
+    bool has_all_params         = all_params_md5.size() >= 2;
+    md5_str                     = "";
+    for (const auto &md5_item : all_params_md5) {
+        has_all_params = has_all_params && md5_item != empty_md5;
+        md5_str += md5_item;
+    }
+    return has_all_params;
+}
+
+// besides the model, device and precision naming the cache file, the optimizers depend on the data format and the
+// network type, and the const folder on the inputs shape
+static std::string GetOptimizedNetSignature(NetworkConfig &net_config, InputShapesMap &min_inputs_shape,
+                                            InputShapesMap &max_inputs_shape) {
+    std::string signature = ToString(net_config.data_format) + "_" + ToString(net_config.network_type);
+    for (auto inputs_shape : {&min_inputs_shape, &max_inputs_shape}) {
+        signature += "|";
+        for (const auto &iter : *inputs_shape) {
+            signature += iter.first + ":";
+            for (auto dim : iter.second) {
+                signature += ToString(dim) + ",";
+            }
+            signature += ";";
+        }
+    }
+    return signature;
+}
+
+static std::shared_ptr<RawBuffer> StringToBuffer(const std::string &value) {
+    auto buffer = std::make_shared<RawBuffer>((int)value.size());
+    memcpy(buffer->force_to<char *>(), value.data(), value.size());
+    return buffer;
+}
+
+static std::string BufferToString(std::shared_ptr<RawBuffer> buffer) {
+    return std::string(buffer->force_to<char *>(), buffer->GetBytesSize());
+}
+
+static std::string ReadFileContent(const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    std::ostringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
 DefaultNetwork::DefaultNetwork()
     : device_(nullptr), context_(nullptr), blob_manager_(nullptr), net_structure_(nullptr) {}
 
@@ -77,17 +142,8 @@ Status DefaultNetwork::Init(NetworkConfig &net_config, ModelConfig &model_config
     device_ = GetDevice(net_config.device_type);
     RETURN_VALUE_ON_NEQ(device_ != NULL, true, TNNERR_DEVICE_NOT_SUPPORT);
 
-    context_ = device_->CreateContext(net_config.device_id);
-    RETURN_VALUE_ON_NEQ(context_ != NULL, true, TNNERR_DEVICE_CONTEXT_CREATE);
-
-#ifdef DEBUG
-    {
-        static bool cpu_support_fp16 = CpuUtils::CpuSupportFp16();
-        LOGD("support fp 16: %d\n", cpu_support_fp16 ? 1 : 0);
-    }
-#endif
-    context_->SetPrecision(net_config.precision);
-    context_->SetEnableTuneKernel(net_config.enable_tune_kernel);
+    ret = InitContext(net_config);
+    RETURN_ON_NEQ(ret, TNN_OK);
 
     if(!net_config.cache_path.empty()) {
         auto params_md5 = default_interpreter->GetParamsMd5();
@@ -95,18 +151,44 @@ Status DefaultNetwork::Init(NetworkConfig &net_config, ModelConfig &model_config
             return Status(TNNERR_PARAM_ERR, "model params md5 missing");
         }
         context_->SetCachePath(net_config.cache_path);
-        context_->SetCacheFilePath(GenerateCacheFileName(model_config, params_md5[0]));
+        context_->SetCacheFilePath(GenerateCacheFileName(net_config, model_config, params_md5[0]));
     }
 
-    ret = context_->LoadLibrary(net_config.library_path);
-    RETURN_ON_NEQ(ret, TNN_OK);
+    // packed layer resources are shared between instances of the same model in the process,
+    // models without weights in params generate random resources and are only shared with clones of this network
+    std::string md5_str = "";
+    bool has_all_params = GetAllParamsMd5(default_interpreter, md5_str);
+    if (has_all_params) {
+        context_->SetResourceCacheKey(GenerateCacheFileName(net_config, model_config, md5_str));
+    } else {
+        static std::atomic<int> network_count(0);
+        context_->SetResourceCacheKey("network_" + ToString(network_count++));
+    }
+
+    // layer accs load the resources packed at the last start from the cache file instead of packing them again
+    std::string packed_cache_tag   = context_->GetPackedCacheTag();
+    std::string optimized_net_file = "";
+    if (!net_config.cache_path.empty() && has_all_params && runtime_model_ == RUNTIME_MODE_NORMAL &&
+        !packed_cache_tag.empty()) {
+        std::string packed_cache_file =
+            GenerateCacheFilePath(net_config, model_config, md5_str, packed_cache_tag, ".packed");
+        std::map<std::string, std::shared_ptr<RawBuffer>> packed_resources;
+        if (PackedResourceFile::Load(packed_cache_file, packed_cache_tag, packed_resources) == TNN_OK) {
+            context_->SetPackedResources(packed_resources);
+        }
+        context_->SetPackedCacheFilePath(packed_cache_file);
+        if (!net_structure->optimized) {
+            optimized_net_file =
+                GenerateCacheFilePath(net_config, model_config, md5_str, packed_cache_tag, ".optimized");
+        }
+    }
 
     /*
      * The NetOptimizeManager holds a list of network optimization processes.
      * The optimization process may change the network structure accoundingly.
      * eg. fuse conv+bn, conv+relu.
      */
-    if (runtime_model_ == RUNTIME_MODE_NORMAL) {
+    if (runtime_model_ == RUNTIME_MODE_NORMAL && !net_structure->optimized) {
         // use mutex to protect net_resource and net_structure in multi-thread
         std::unique_lock<std::mutex> lck(optimize_mtx_);
         ret = optimizer::NetOptimizerManager::Optimize(net_structure, net_resource, net_config);
@@ -125,6 +207,241 @@ Status DefaultNetwork::Init(NetworkConfig &net_config, ModelConfig &model_config
         }
     }
 
+    ret = InitNetwork(net_structure, net_resource, max_inputs_shape);
+    RETURN_ON_NEQ(ret, TNN_OK);
+
+    if (!optimized_net_file.empty()) {
+        ret = SaveOptimizedNet(optimized_net_file, net_structure, net_resource, min_inputs_shape, max_inputs_shape);
+        if (ret != TNN_OK) {
+            LOGE("save optimized net %s failed: %s\n", optimized_net_file.c_str(), ret.description().c_str());
+        }
+    }
+
+    return SavePackedCache();
+}
+
+/*
+ * Save the resources packed by layer accs if they are not all loaded from the cache file. The network works without
+ * the cache, so failures are only logged.
+ */
+Status DefaultNetwork::SavePackedCache() {
+    const std::string packed_cache_file = context_->GetPackedCacheFilePath();
+    if (packed_cache_file.empty()) {
+        return TNN_OK;
+    }
+    if (context_->IsPackedResourcesUpdated()) {
+        Status ret = PackedResourceFile::Save(packed_cache_file, context_->GetPackedCacheTag(),
+                                              context_->GetPackedResources());
+        if (ret != TNN_OK) {
+            LOGE("save packed cache %s failed: %s\n", packed_cache_file.c_str(), ret.description().c_str());
+        }
+    }
+    // layer accs hold what they use, drop the rest of the loaded resources
+    context_->SetPackedResources({});
+    context_->SetPackedCacheFilePath("");
+    return TNN_OK;
+}
+
+/*
+ * Save the optimized net with the constants folded into it, so the next init with the same config and inputs shape
+ * skips the optimizers and the const folder. Constants folded again on reshape need the const folder, the net is not
+ * saved then. The network works without the file, so the caller only logs failures.
+ */
+Status DefaultNetwork::SaveOptimizedNet(const std::string &path, NetStructure *net_structure,
+                                        NetResource *net_resource, InputShapesMap min_inputs_shape,
+                                        InputShapesMap max_inputs_shape) {
+    if (!net_resource->shape_differ_layers.empty()) {
+        LOGD("constants of the net change with the inputs shape, optimized net %s is not saved\n", path.c_str());
+        return TNN_OK;
+    }
+
+    // the packer writes files, pack to temp files next to path and keep their content
+    std::ostringstream temp_suffix;
+    temp_suffix << ".tmp" << std::this_thread::get_id() << "_"
+                << std::chrono::steady_clock::now().time_since_epoch().count();
+    const std::string proto_path = path + temp_suffix.str() + ".tnnproto";
+    const std::string model_path = path + temp_suffix.str() + ".tnnmodel";
+    ModelPacker packer(net_structure, net_resource);
+    packer.SetVersion(2);
+    Status ret        = packer.Pack(proto_path, model_path);
+    std::string proto = ReadFileContent(proto_path);
+    std::string model = ReadFileContent(model_path);
+    remove(proto_path.c_str());
+    remove(model_path.c_str());
+    RETURN_ON_NEQ(ret, TNN_OK);
+
+    // the model keeps the folded constants, their flags and the blob shapes and data types are kept here
+    std::ostringstream folded_stream;
+    Serializer serializer(folded_stream);
+    serializer.PutInt((int)net_resource->constant_blob_flags.size());
+    for (const auto &iter : net_resource->constant_blob_flags) {
+        serializer.PutString(iter.first);
+        serializer.PutInt(iter.second);
+    }
+    serializer.PutInt((int)net_resource->constant_layers.size());
+    for (const auto &name : net_resource->constant_layers) {
+        serializer.PutString(name);
+    }
+    for (auto shapes_map : {&net_resource->blob_shapes_map, &net_resource->min_blob_shapes_map}) {
+        serializer.PutInt((int)shapes_map->size());
+        for (const auto &iter : *shapes_map) {
+            serializer.PutString(iter.first);
+            serializer.PutInt((int)iter.second.size());
+            for (auto dim : iter.second) {
+                serializer.PutInt(dim);
+            }
+        }
+    }
+    serializer.PutInt((int)net_resource->blob_datatype_map.size());
+    for (const auto &iter : net_resource->blob_datatype_map) {
+        serializer.PutString(iter.first);
+        serializer.PutInt(iter.second);
+    }
+
+    std::map<std::string, std::shared_ptr<RawBuffer>> entries = {
+        {"signature", StringToBuffer(GetOptimizedNetSignature(config_, min_inputs_shape, max_inputs_shape))},
+        {"proto", StringToBuffer(proto)},
+        {"model", StringToBuffer(model)},
+        {"folded", StringToBuffer(folded_stream.str())},
+    };
+    return PackedResourceFile::Save(path, context_->GetPackedCacheTag(), entries);
+}
+
+/*
+ * The optimized net replaces the net structure and net resource of the interpreter in place, so the params md5
+ * naming the cache files stay the ones of the model. DefaultNetwork::Init does not optimize the net again.
+ */
+Status DefaultNetwork::LoadOptimizedNet(NetworkConfig &net_config, ModelConfig &model_config,
+                                        AbstractModelInterpreter *interpreter, InputShapesMap min_inputs_shape,
+                                        InputShapesMap max_inputs_shape) {
+    auto default_interpreter = dynamic_cast<DefaultModelInterpreter *>(interpreter);
+    std::string md5_str      = "";
+    if (!default_interpreter || net_config.cache_path.empty() || !GetAllParamsMd5(default_interpreter, md5_str)) {
+        return Status(TNNERR_PARAM_ERR, "model has no optimized net cache");
+    }
+    auto device = GetDevice(net_config.device_type);
+    RETURN_VALUE_ON_NEQ(device != NULL, true, TNNERR_DEVICE_NOT_SUPPORT);
+    std::shared_ptr<Context> context(device->CreateContext(net_config.device_id));
+    RETURN_VALUE_ON_NEQ(context != nullptr, true, TNNERR_DEVICE_CONTEXT_CREATE);
+    // the optimized net is saved with the packed cache, only devices packing their resources save it
+    const std::string tag = context->GetPackedCacheTag();
+    if (tag.empty()) {
+        return Status(TNNERR_PARAM_ERR, "device has no optimized net cache");
+    }
+
+    const std::string path = GenerateCacheFilePath(net_config, model_config, md5_str, tag, ".optimized");
+    std::map<std::string, std::shared_ptr<RawBuffer>> entries;
+    RETURN_ON_NEQ(PackedResourceFile::Load(path, tag, entries), TNN_OK);
+    for (const auto &name : {"signature", "proto", "model", "folded"}) {
+        if (entries.find(name) == entries.end()) {
+            return Status(TNNERR_INVALID_MODEL, "optimized net cache is broken");
+        }
+    }
+    if (BufferToString(entries["signature"]) != GetOptimizedNetSignature(net_config, min_inputs_shape,
+                                                                          max_inputs_shape)) {
+        LOGD("optimized net %s is saved for another config or inputs shape\n", path.c_str());
+        return Status(TNNERR_INVALID_MODEL, "optimized net cache is stale");
+    }
+
+    std::shared_ptr<AbstractModelInterpreter> optimized(CreateModelInterpreter(MODEL_TYPE_TNN));
+    auto optimized_interpreter = dynamic_cast<DefaultModelInterpreter *>(optimized.get());
+    CHECK_PARAM_NULL(optimized_interpreter);
+    std::vector<std::string> params = {BufferToString(entries["proto"]), BufferToString(entries["model"])};
+    RETURN_ON_NEQ(optimized_interpreter->Interpret(params), TNN_OK);
+    NetStructure net_structure = *optimized_interpreter->GetNetStructure();
+    NetResource net_resource   = *optimized_interpreter->GetNetResource();
+
+    std::istringstream folded_stream(BufferToString(entries["folded"]));
+    Deserializer deserializer(folded_stream);
+    int count = deserializer.GetInt();
+    for (int i = 0; i < count; i++) {
+        auto name                              = deserializer.GetString();
+        net_resource.constant_blob_flags[name] = deserializer.GetInt();
+    }
+    count = deserializer.GetInt();
+    for (int i = 0; i < count; i++) {
+        net_resource.constant_layers.insert(deserializer.GetString());
+    }
+    for (auto shapes_map : {&net_resource.blob_shapes_map, &net_resource.min_blob_shapes_map}) {
+        count = deserializer.GetInt();
+        for (int i = 0; i < count; i++) {
+            auto name      = deserializer.GetString();
+            DimsVector dims(deserializer.GetInt());
+            for (auto &dim : dims) {
+                dim = deserializer.GetInt();
+            }
+            (*shapes_map)[name] = dims;
+        }
+    }
+    count = deserializer.GetInt();
+    for (int i = 0; i < count; i++) {
+        auto name                            = deserializer.GetString();
+        net_resource.blob_datatype_map[name] = (DataType)deserializer.GetInt();
+    }
+
+    net_structure.optimized                 = true;
+    *default_interpreter->GetNetStructure() = net_structure;
+    *default_interpreter->GetNetResource()  = net_resource;
+    return TNN_OK;
+}
+
+/*
+ * The clone shares the optimized net structure with the network, and the net resource unless net_resource is set.
+ * Layer accs pack their weights through the resource cache key of the network, so packed weights are shared too.
+ */
+Status DefaultNetwork::InitFromNetwork(AbstractNetwork *network, NetResource *net_resource) {
+    DefaultNetwork *default_network = dynamic_cast<DefaultNetwork *>(network);
+    if (!default_network || !default_network->net_structure_ || !default_network->net_resource_) {
+        LOGE("ERROR: network to clone is not an inited default network\n");
+        return Status(TNNERR_NET_ERR, "network to clone is not an inited default network");
+    }
+
+    config_ = default_network->config_;
+    device_ = default_network->device_;
+
+    Status ret = InitContext(config_);
+    RETURN_ON_NEQ(ret, TNN_OK);
+
+    auto src_context = default_network->context_;
+    if (!config_.cache_path.empty()) {
+        context_->SetCachePath(src_context->GetCachePath());
+        context_->SetCacheFilePath(src_context->GetCacheFilePath());
+    }
+    context_->SetResourceCacheKey(src_context->GetResourceCacheKey());
+
+    if (!net_resource) {
+        net_resource = default_network->net_resource_;
+    }
+    return InitNetwork(default_network->net_structure_, net_resource, default_network->max_inputs_shape_);
+}
+
+Status DefaultNetwork::InitContext(NetworkConfig &net_config) {
+    context_ = device_->CreateContext(net_config.device_id);
+    RETURN_VALUE_ON_NEQ(context_ != NULL, true, TNNERR_DEVICE_CONTEXT_CREATE);
+
+#ifdef DEBUG
+    {
+        static bool cpu_support_fp16 = CpuUtils::CpuSupportFp16();
+        LOGD("support fp 16: %d\n", cpu_support_fp16 ? 1 : 0);
+    }
+#endif
+    context_->SetPrecision(net_config.precision);
+    context_->SetEnableTuneKernel(net_config.enable_tune_kernel);
+    context_->SetCpuThreadPoolMode(net_config.cpu_thread_pool_mode);
+    context_->SetCpuAffinity(net_config.cpu_affinity);
+
+    return context_->LoadLibrary(net_config.library_path);
+}
+
+/*
+ * Create blobs and layers of the optimized net, allocate blob memory and reshape layers.
+ */
+Status DefaultNetwork::InitNetwork(NetStructure *net_structure, NetResource *net_resource,
+                                   InputShapesMap max_inputs_shape) {
+    Status ret        = TNN_OK;
+    max_inputs_shape_ = max_inputs_shape;
+    auto &net_config  = config_;
+
     blob_manager_ = new BlobManager(device_);
 
     ret = blob_manager_->Init(net_config, net_structure, max_inputs_shape, GetNetResourceDataType(net_resource));
@@ -133,6 +450,11 @@ Status DefaultNetwork::Init(NetworkConfig &net_config, ModelConfig &model_config
     ret = InitLayers(net_structure, net_resource);
     RETURN_ON_NEQ(ret, TNN_OK);
 
+    if (runtime_model_ == RUNTIME_MODE_NORMAL && blob_manager_->IsMemoryPlanEnabled()) {
+        ret = ScheduleLayersByMemory(net_structure);
+        RETURN_ON_NEQ(ret, TNN_OK);
+    }
+
     ret = AllocateBlobMemory();
     RETURN_ON_NEQ(ret, TNN_OK);
 
@@ -146,6 +468,14 @@ Status DefaultNetwork::Init(NetworkConfig &net_config, ModelConfig &model_config
     RETURN_ON_NEQ(ret, TNN_OK);
 
     ret = context_->OnInstanceReshapeEnd();
+    RETURN_ON_NEQ(ret, TNN_OK);
+
+    // layers write blobs in place of the blob manager, so only the cpu devices without command queue can run them
+    // concurrently
+    if (net_config.enable_parallel_layers && runtime_model_ == RUNTIME_MODE_NORMAL &&
+        (device_->GetDeviceType() == DEVICE_X86 || device_->GetDeviceType() == DEVICE_NAIVE)) {
+        layer_pool_ = ThreadPool::GetSharedPool();
+    }
     return ret;
 }
 
@@ -262,6 +592,10 @@ Status DefaultNetwork::InitLayers(NetStructure *net_structure, NetResource *net_
         }
     }
 
+    // shapes and data formats are inferred layer by layer, the layer accs of cpu devices init in parallel after it
+    const bool parallel_init = config_.enable_parallel_init && runtime_model_ == RUNTIME_MODE_NORMAL &&
+                               (device_->GetDeviceType() == DEVICE_X86 || device_->GetDeviceType() == DEVICE_NAIVE);
+
     // init layer
     for (auto layer_info : net_structure->layers) {
         if (runtime_model_ == RUNTIME_MODE_NORMAL && const_layers.find(layer_info->name) != const_layers.end()) {
@@ -328,7 +662,14 @@ Status DefaultNetwork::InitLayers(NetStructure *net_structure, NetResource *net_
         cur_layer->SetRuntimeMode(runtime_model_);
         cur_layer->SetConstantResource(&net_resource->constant_map);
         cur_layer->SetConstantResourceFlag(&net_resource->constant_blob_flags);
-        ret = cur_layer->Init(context_, layer_info->param.get(), layer_resource, inputs, outputs, device_);
+        if (parallel_init) {
+            ret = cur_layer->InitOutputs(context_, layer_info->param.get(), layer_resource, inputs, outputs, device_);
+            if (ret == TNN_OK) {
+                ret = cur_layer->ResolveBlobDataFormats();
+            }
+        } else {
+            ret = cur_layer->Init(context_, layer_info->param.get(), layer_resource, inputs, outputs, device_);
+        }
         if (ret != TNN_OK) {
             LOGE("Error Init layer %s (err: %d or 0x%X)\n", cur_layer->GetLayerName().c_str(), (int)ret, (int)ret);
             // release layer if Init failed
@@ -339,11 +680,176 @@ Status DefaultNetwork::InitLayers(NetStructure *net_structure, NetResource *net_
 
         layers_.push_back(cur_layer);
     }
+
+    if (parallel_init) {
+        ret = InitLayerAccs();
+    }
     return ret;
 }
 
+/*
+ * Init the layer accs of layers_ on the shared worker pool, most of the time goes to weight packing.
+ * The error of the first failed layer in order is returned.
+ */
+Status DefaultNetwork::InitLayerAccs() {
+    std::vector<Status> status(layers_.size(), TNN_OK);
+    auto pool = ThreadPool::GetSharedPool();
+    pool->ParallelFor(
+        0, (long)layers_.size(), [&](long i, int thread_id) { status[i] = layers_[i]->InitLayerAcc(context_); },
+        pool->GetThreadNum() + 1);
+
+    for (size_t i = 0; i < layers_.size(); i++) {
+        if (status[i] != TNN_OK) {
+            LOGE("Error Init layer %s (err: %d or 0x%X)\n", layers_[i]->GetLayerName().c_str(), (int)status[i],
+                 (int)status[i]);
+            return status[i];
+        }
+    }
+    return TNN_OK;
+}
+
+/*
+ * Layers only depend on the layers writing their inputs, so any topological order gives the same result.
+ * The order with lower peak of live blob bytes is used by layers_ and the memory plan of blob_manager_.
+ */
+Status DefaultNetwork::ScheduleLayersByMemory(NetStructure *net_structure) {
+    std::vector<optimizer::ScheduleLayer> schedule_layers;
+    std::map<std::string, int64_t> blob_bytes;
+    for (auto layer : layers_) {
+        optimizer::ScheduleLayer schedule_layer;
+        auto inputs  = layer->GetInputBlobs();
+        auto outputs = layer->GetOutputBlobs();
+        for (auto blob : inputs) {
+            schedule_layer.inputs.push_back(blob->GetBlobDesc().name);
+        }
+        for (auto blob : outputs) {
+            schedule_layer.outputs.push_back(blob->GetBlobDesc().name);
+        }
+        for (auto blob : outputs) {
+            if (blob->NeedAllocateInForward() ||
+                DataFlagUtils::ChangeStatus(blob->GetFlag()) != DATA_FLAG_CHANGE_ALWAYS) {
+                continue;
+            }
+            auto size_info                       = device_->Calculate(blob->GetBlobDesc());
+            blob_bytes[blob->GetBlobDesc().name] = GetBlobMemoryBytesSize(size_info);
+        }
+        schedule_layers.push_back(schedule_layer);
+    }
+
+    std::set<std::string> persistent_blobs = net_structure->outputs;
+    for (auto iter : net_structure->inputs_shape_map) {
+        persistent_blobs.insert(iter.first);
+    }
+
+    optimizer::LayerMemoryScheduler scheduler(schedule_layers, blob_bytes, persistent_blobs);
+    std::vector<int> order;
+    Status ret = scheduler.Schedule(order);
+    RETURN_ON_NEQ(ret, TNN_OK);
+
+    std::vector<int> original_order(layers_.size());
+    for (int i = 0; i < (int)original_order.size(); i++) {
+        original_order[i] = i;
+    }
+    model_order_peak_bytes_ = scheduler.GetPeakBytes(original_order);
+    schedule_peak_bytes_    = scheduler.GetPeakBytes(order);
+    LOGI("layer schedule by memory: peak %lld bytes before, %lld bytes after\n", (long long)model_order_peak_bytes_,
+         (long long)schedule_peak_bytes_);
+    if (order == original_order) {
+        return TNN_OK;
+    }
+
+    std::vector<BaseLayer *> layers;
+    for (auto index : order) {
+        layers.push_back(layers_[index]);
+    }
+    layers_ = layers;
+
+    // layers not in layers_ do not run, they keep their place before the running layers
+    std::map<std::string, std::shared_ptr<LayerInfo>> layer_infos;
+    for (auto layer_info : net_structure->layers) {
+        layer_infos[layer_info->name] = layer_info;
+    }
+    std::vector<std::shared_ptr<LayerInfo>> layer_order;
+    std::set<std::string> running_layers;
+    for (auto layer : layers_) {
+        running_layers.insert(layer->GetLayerName());
+    }
+    for (auto layer_info : net_structure->layers) {
+        if (running_layers.count(layer_info->name) == 0) {
+            layer_order.push_back(layer_info);
+        }
+    }
+    for (auto layer : layers_) {
+        auto iter = layer_infos.find(layer->GetLayerName());
+        RETURN_VALUE_ON_NEQ(iter != layer_infos.end(), true, Status(TNNERR_NET_ERR, "layer info not found"));
+        layer_order.push_back(iter->second);
+    }
+    blob_manager_->SetLayerOrder(layer_order);
+    return TNN_OK;
+}
+
 Status DefaultNetwork::AllocateBlobMemory() {
-    return blob_manager_->AllocateBlobMemory(DATA_FLAG_CHANGE_ALWAYS);
+    // outputs of in place layers may share memory with an input no later layer reads
+    std::map<std::string, std::vector<int>> inplace_layers;
+    for (auto layer : layers_) {
+        auto indexes = layer->GetInplaceInputIndexes();
+        if (!indexes.empty()) {
+            inplace_layers[layer->GetLayerName()] = indexes;
+        }
+    }
+    blob_manager_->SetInplaceLayers(inplace_layers);
+
+    // outputs of view layers may be placed in the memory of their input 0
+    std::map<std::string, std::vector<int64_t>> view_layers;
+    for (auto layer : layers_) {
+        auto offsets = layer->GetViewOffsets();
+        if (!offsets.empty()) {
+            view_layers[layer->GetLayerName()] = offsets;
+        }
+    }
+    blob_manager_->SetViewLayers(view_layers);
+
+    // inputs of concat layers may be placed in the memory of their output
+    std::map<std::string, std::vector<int64_t>> concat_layers;
+    for (auto layer : layers_) {
+        auto offsets = layer->GetConcatOffsets();
+        if (!offsets.empty()) {
+            concat_layers[layer->GetLayerName()] = offsets;
+        }
+    }
+    blob_manager_->SetConcatLayers(concat_layers);
+
+    // scratch memory of layers may be planned with the blobs, layers running concurrently keep their own
+    std::map<std::string, size_t> workspace_layers;
+    if (!config_.enable_parallel_layers) {
+        for (auto layer : layers_) {
+            size_t workspace_size = layer->GetWorkspaceSize();
+            if (workspace_size > 0) {
+                workspace_layers[layer->GetLayerName()] = workspace_size;
+            }
+        }
+    }
+    blob_manager_->SetWorkspaceLayers(workspace_layers);
+
+    Status ret = blob_manager_->AllocateBlobMemory(DATA_FLAG_CHANGE_ALWAYS);
+    RETURN_ON_NEQ(ret, TNN_OK);
+
+    for (auto layer : layers_) {
+        layer->SetWorkspace(blob_manager_->GetWorkspaceBlob(layer->GetLayerName()));
+    }
+
+    for (auto layer : layers_) {
+        if (view_layers.count(layer->GetLayerName()) == 0) {
+            continue;
+        }
+        auto input   = layer->GetInputBlobs()[0];
+        bool as_view = true;
+        for (auto output : layer->GetOutputBlobs()) {
+            as_view = as_view && blob_manager_->IsBlobMemoryShared(input, output);
+        }
+        layer->SetOutputsAsView(as_view);
+    }
+    return TNN_OK;
 }
 
 Status DefaultNetwork::GenerateInt8Blob(const std::string &name, NetResource *net_resource, Blob **blob) {
@@ -443,7 +949,15 @@ Status DefaultNetwork::GetForwardMemorySize(int &memory_size) {
     return TNN_OK;
 }
 
+Status DefaultNetwork::GetLayerSchedulePeakBytes(int64_t &model_order_peak, int64_t &schedule_peak) {
+    model_order_peak = model_order_peak_bytes_;
+    schedule_peak    = schedule_peak_bytes_;
+    return TNN_OK;
+}
+
 Status DefaultNetwork::SetForwardMemory(void *memory) {
+    WaitForwardAsync();
+    layer_graph_valid_ = false;
     return blob_manager_->SetForwardMemory(memory);
 }
 
@@ -466,6 +980,7 @@ Status DefaultNetwork::GetAllOutputBlobs(BlobMap &blobs) {
  * Memory allocation may be involved in Reshape function.
  */
 Status DefaultNetwork::Reshape(const InputShapesMap &inputs) {
+    WaitForwardAsync();
     Status ret = TNN_OK;
     bool shape_changed = false;
     ret = PrepareDoReshape(inputs, shape_changed);
@@ -512,6 +1027,9 @@ Status DefaultNetwork::DoReshape() {
 }
 
 Status DefaultNetwork::DeInit() {
+    WaitForwardAsync();
+    async_worker_ = nullptr;
+
     for (size_t i = 0; i < layers_.size(); i++) {
         if (layers_[i] != NULL) {
             delete layers_[i];
@@ -534,6 +1052,12 @@ Status DefaultNetwork::DeInit() {
         context_ = NULL;
     }
 
+    layer_pool_ = nullptr;
+    layer_successors_.clear();
+    layer_dependency_count_.clear();
+    layer_graph_valid_ = false;
+    layer_graph_net_blobs_memory_.clear();
+
     return TNN_OK;
 }
 /*
@@ -568,6 +1092,7 @@ Context* DefaultNetwork::GetContext() {
 }
 
 Status DefaultNetwork::Forward() {
+    WaitForwardAsync();
     auto status = blob_manager_->CheckBlobMemoryState();
     RETURN_ON_NEQ(status, TNN_OK);
     
@@ -578,6 +1103,14 @@ Status DefaultNetwork::Forward() {
     
     status = context_->OnInstanceForwardBegin();
     RETURN_ON_NEQ(status, TNN_OK);
+
+    if (IsParallelLayersEnabled()) {
+        status = ForwardLayersParallel();
+        RETURN_ON_NEQ(status, TNN_OK);
+        context_->OnInstanceForwardEnd();
+        context_->Synchronize();
+        return status;
+    }
     
     int cnt = 0;
     for (auto layer : layers_) {
@@ -648,6 +1181,7 @@ Status DefaultNetwork::Forward() {
 
 #ifdef FORWARD_CALLBACK_ENABLE
 Status DefaultNetwork::ForwardWithCallback(BlobStatisticCallback before, BlobStatisticCallback after) {
+    WaitForwardAsync();
     Status result = TNN_OK;
     result        = blob_manager_->CheckBlobMemoryState();
     if (result != TNN_OK) {
@@ -684,13 +1218,105 @@ Status DefaultNetwork::ForwardWithCallback(BlobStatisticCallback before, BlobSta
 // @brief tnn instance network infer, it will not wait
 // blob dump is not implement in this funciton.
 Status DefaultNetwork::ForwardAsync(Callback call_back) {
+    std::shared_future<Status> forward;
+    return ForwardAsync(call_back, forward);
+}
+
+Status DefaultNetwork::ForwardAsync(Callback call_back, std::shared_future<Status> &forward) {
     Status result = TNN_OK;
+    // wait for the previous forward, only one forward is in flight
+    WaitForwardAsync();
     result        = blob_manager_->CheckBlobMemoryState();
     if (result != TNN_OK) {
         return result;
     }
 
+    // cpu devices have no command queue, the forward runs on the worker thread of the network instead
+    if (runtime_model_ == RUNTIME_MODE_NORMAL &&
+        (device_->GetDeviceType() == DEVICE_X86 || device_->GetDeviceType() == DEVICE_NAIVE)) {
+        if (!async_worker_) {
+            async_worker_ = std::make_shared<ThreadPool>(1);
+        }
+        auto promise = std::make_shared<std::promise<Status>>();
+        auto done    = std::make_shared<std::promise<void>>();
+        {
+            std::unique_lock<std::mutex> lck(async_mutex_);
+            async_forward_ = promise->get_future().share();
+            async_task_    = done->get_future().share();
+            async_forward_id_++;
+            forward = async_forward_;
+        }
+        async_worker_->Enqueue([this, promise, done, call_back]() {
+            {
+                std::unique_lock<std::mutex> lck(async_mutex_);
+                async_worker_thread_ = std::this_thread::get_id();
+            }
+            Status status = ForwardLayers();
+            if (status != TNN_OK) {
+                LOGE("ForwardAsync error %s\n", status.description().c_str());
+            }
+            // the forward is complete before the callback, which may read the outputs or wait for the forward
+            promise->set_value(status);
+            if (call_back) {
+                call_back();
+            }
+            done->set_value();
+        });
+        return TNN_OK;
+    }
+
+    result = ForwardLayers();
+    std::promise<Status> promise;
+    promise.set_value(result);
+    forward = promise.get_future().share();
+    return result;
+}
+
+/*
+ * Other threads wait for the callback as well, it may still read the outputs. The callback runs on the
+ * worker thread, it only gets the status of its own forward, a forward it started is queued behind it.
+ */
+Status DefaultNetwork::WaitForwardAsync() {
+    std::shared_future<Status> forward;
+    std::shared_future<void> task;
+    int64_t forward_id = 0;
+    bool on_worker     = false;
+    {
+        std::unique_lock<std::mutex> lck(async_mutex_);
+        if (!async_forward_.valid()) {
+            return TNN_OK;
+        }
+        forward    = async_forward_;
+        task       = async_task_;
+        forward_id = async_forward_id_;
+        on_worker  = std::this_thread::get_id() == async_worker_thread_;
+        if (on_worker && forward.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            LOGE("Error: ForwardAsync callback waits for a forward queued behind it on the worker thread\n");
+            return Status(TNNERR_NET_ERR, "callback of ForwardAsync can not wait for the next forward");
+        }
+    }
+    if (on_worker) {
+        return forward.get();
+    }
+    task.wait();
+    Status result = forward.get();
+    std::unique_lock<std::mutex> lck(async_mutex_);
+    if (forward_id == async_forward_id_) {
+        async_forward_ = std::shared_future<Status>();
+        async_task_    = std::shared_future<void>();
+    }
+    return result;
+}
+
+Status DefaultNetwork::ForwardLayers() {
+    Status result = TNN_OK;
     context_->OnInstanceForwardBegin();
+    if (IsParallelLayersEnabled()) {
+        result = ForwardLayersParallel();
+        RETURN_ON_NEQ(result, TNN_OK);
+        context_->OnInstanceForwardEnd();
+        return result;
+    }
     for (auto layer : layers_) {
         result = layer->Forward();
         RETURN_ON_NEQ(result, TNN_OK);
@@ -709,13 +1335,21 @@ std::shared_ptr<ProfileResult> DefaultNetwork::FinishProfile() {
 }
 #endif
 
-std::string DefaultNetwork::GenerateCacheFileName(ModelConfig &model_config, std::string& md5_str) {
-    return CACHE_TAG + "_" + ToString(config_.device_type) + "_" + ToString(config_.device_id)
-        + "_" + ToString(config_.precision) + "_" + ToString(model_config.model_type) +
+std::string DefaultNetwork::GenerateCacheFilePath(NetworkConfig &net_config, ModelConfig &model_config,
+                                                  std::string &md5_str, const std::string &tag,
+                                                  const std::string &suffix) {
+    return net_config.cache_path + "/" + GenerateCacheFileName(net_config, model_config, md5_str) + "_" + tag + suffix;
+}
+
+std::string DefaultNetwork::GenerateCacheFileName(NetworkConfig &net_config, ModelConfig &model_config,
+                                                  std::string &md5_str) {
+    return CACHE_TAG + "_" + ToString(net_config.device_type) + "_" + ToString(net_config.device_id)
+        + "_" + ToString(net_config.precision) + "_" + ToString(model_config.model_type) +
         "_" + md5_str;
 }
 
 Status DefaultNetwork::ReshapeLayers() {
+    layer_graph_valid_ = false;
     for (auto cur_layer : layers_) {
         auto status = cur_layer->Reshape();
         RETURN_ON_NEQ(status, TNN_OK);
@@ -725,4 +1359,210 @@ Status DefaultNetwork::ReshapeLayers() {
     return TNN_OK;
 }
 
+bool DefaultNetwork::IsParallelLayersEnabled() {
+#if TNN_PROFILE
+    // profiling data is collected layer by layer
+    if (context_->profile_layer) {
+        return false;
+    }
+#endif
+    return layer_pool_ != nullptr;
+}
+
+/*
+ * The memory a layer touches is given by the blob handles. Blobs bound to the same memory by
+ * BlobManager get overlapped ranges, so the reuse decisions of AllocateBlobMemory turn into
+ * dependencies between the layers, besides the data dependencies by blob names.
+ * Outputs of view layers are bound to their input by the forward of the layer, their memory is
+ * taken from the input so a rebound input moves them before that forward runs.
+ */
+std::vector<std::pair<char *, int64_t>> DefaultNetwork::GetLayerGraphMemorySnapshot() {
+    std::map<Blob *, char *> view_memory;
+    std::vector<std::pair<char *, int64_t>> snapshot;
+    for (auto layer : layers_) {
+        auto inputs  = layer->GetInputBlobs();
+        auto outputs = layer->GetOutputBlobs();
+        auto offsets = layer->GetViewOffsets();
+        bool as_view = !offsets.empty() && inputs[0]->GetHandle().base != nullptr;
+        for (auto output : outputs) {
+            as_view = as_view && blob_manager_->IsBlobMemoryShared(inputs[0], output);
+        }
+        if (as_view) {
+            auto handle = inputs[0]->GetHandle();
+            auto base   = view_memory.count(inputs[0]) ? view_memory[inputs[0]]
+                                                       : static_cast<char *>(handle.base) + handle.bytes_offset;
+            for (size_t i = 0; i < outputs.size(); i++) {
+                view_memory[outputs[i]] = base + offsets[i];
+            }
+        }
+
+        auto blobs = inputs;
+        blobs.insert(blobs.end(), outputs.begin(), outputs.end());
+        for (auto blob : blobs) {
+            auto handle = blob->GetHandle();
+            if (handle.base == nullptr) {
+                // blob without memory, only the blob itself is shared
+                snapshot.push_back(std::make_pair(reinterpret_cast<char *>(blob), (int64_t)1));
+            } else {
+                auto size_info = device_->Calculate(blob->GetBlobDesc());
+                int64_t bytes  = std::max(GetBlobMemoryBytesSize(size_info), (int64_t)1);
+                auto memory    = view_memory.count(blob) ? view_memory[blob]
+                                                         : static_cast<char *>(handle.base) + handle.bytes_offset;
+                snapshot.push_back(std::make_pair(memory, bytes));
+            }
+        }
+    }
+    return snapshot;
+}
+
+std::vector<char *> DefaultNetwork::GetNetBlobsMemory() {
+    BlobMap input_blobs, output_blobs;
+    blob_manager_->GetAllInputBlobs(input_blobs);
+    blob_manager_->GetAllOutputBlobs(output_blobs);
+    std::vector<char *> memory;
+    for (auto blobs : {&input_blobs, &output_blobs}) {
+        for (auto iter : *blobs) {
+            auto handle = iter.second->GetHandle();
+            memory.push_back(static_cast<char *>(handle.base) + handle.bytes_offset);
+        }
+    }
+    return memory;
+}
+
+// rebuilding the snapshot takes every blob, only the few net blobs are checked for each forward
+bool DefaultNetwork::IsLayerGraphValid() {
+    return layer_graph_valid_ && layer_dependency_count_.size() == layers_.size() &&
+           GetNetBlobsMemory() == layer_graph_net_blobs_memory_;
+}
+
+static inline bool IsMemoryOverlapped(const std::pair<char *, int64_t> &a, const std::pair<char *, int64_t> &b) {
+    auto a_begin = reinterpret_cast<uintptr_t>(a.first);
+    auto b_begin = reinterpret_cast<uintptr_t>(b.first);
+    return a_begin < b_begin + b.second && b_begin < a_begin + a.second;
+}
+
+static bool IsMemoryOverlapped(const std::vector<std::pair<char *, int64_t>> &a,
+                               const std::vector<std::pair<char *, int64_t>> &b) {
+    for (const auto &range_a : a) {
+        for (const auto &range_b : b) {
+            if (IsMemoryOverlapped(range_a, range_b)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/*
+ * Layer i depends on an earlier layer j if i reads what j writes, or i writes what j reads or writes.
+ */
+Status DefaultNetwork::BuildLayerGraph() {
+    const int layer_count = (int)layers_.size();
+    auto snapshot         = GetLayerGraphMemorySnapshot();
+
+    std::vector<std::vector<std::pair<char *, int64_t>>> reads(layer_count), writes(layer_count);
+    int offset = 0;
+    for (int i = 0; i < layer_count; i++) {
+        const int input_count  = (int)layers_[i]->GetInputBlobs().size();
+        const int output_count = (int)layers_[i]->GetOutputBlobs().size();
+        reads[i].assign(snapshot.begin() + offset, snapshot.begin() + offset + input_count);
+        offset += input_count;
+        writes[i].assign(snapshot.begin() + offset, snapshot.begin() + offset + output_count);
+        offset += output_count;
+    }
+
+    layer_successors_.assign(layer_count, std::vector<int>());
+    layer_dependency_count_.assign(layer_count, 0);
+    for (int i = 0; i < layer_count; i++) {
+        for (int j = 0; j < i; j++) {
+            if (IsMemoryOverlapped(writes[j], reads[i]) || IsMemoryOverlapped(writes[j], writes[i]) ||
+                IsMemoryOverlapped(reads[j], writes[i])) {
+                layer_successors_[j].push_back(i);
+                layer_dependency_count_[i]++;
+            }
+        }
+    }
+    layer_graph_net_blobs_memory_ = GetNetBlobsMemory();
+    layer_graph_valid_            = true;
+    return TNN_OK;
+}
+
+/*
+ * Ready layers are dispatched to the worker pool, at most num_threads layers run at the same time.
+ * Each layer gets an even share of the threads among the layers running and waiting.
+ */
+Status DefaultNetwork::ForwardLayersParallel() {
+    if (!IsLayerGraphValid()) {
+        RETURN_ON_NEQ(BuildLayerGraph(), TNN_OK);
+    }
+
+    const int layer_count = (int)layers_.size();
+    const int num_threads = std::max(context_->GetNumThreads(), 1);
+    // kernels of the layers keep using the kernel pool bound by the context in this thread
+    ThreadPool *kernel_pool = ThreadPool::GetBoundPool();
+
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::vector<int> dependency_count = layer_dependency_count_;
+    std::queue<int> ready_layers;
+    for (int i = 0; i < layer_count; i++) {
+        if (dependency_count[i] == 0) {
+            ready_layers.push(i);
+        }
+    }
+
+    int running  = 0;
+    int finished = 0;
+    Status result = TNN_OK;
+    // at most num_threads layers run at the same time, each takes a free slot for its scratch memory
+    std::vector<int> free_slots;
+    for (int slot = num_threads - 1; slot >= 0; slot--) {
+        free_slots.push_back(slot);
+    }
+
+    std::unique_lock<std::mutex> lck(mtx);
+    while (finished < layer_count) {
+        while (!ready_layers.empty() && running < num_threads && result == TNN_OK) {
+            int index = ready_layers.front();
+            ready_layers.pop();
+            running++;
+            int layer_threads = std::max(num_threads / (running + (int)ready_layers.size()), 1);
+            int slot          = free_slots.back();
+            free_slots.pop_back();
+            layer_pool_->Enqueue([&, index, layer_threads, kernel_pool, slot]() {
+                OMP_SET_THREADS_(layer_threads);
+                ThreadPool::BindCurrentThread(kernel_pool, layer_threads, slot);
+                Status status = layers_[index]->Forward();
+                ThreadPool::BindCurrentThread(nullptr, 1);
+                LOGD("layer name: %s, forward result: %d \n", layers_[index]->GetLayerName().c_str(), (int)status);
+
+                std::unique_lock<std::mutex> task_lck(mtx);
+                if (status != TNN_OK && result == TNN_OK) {
+                    LOGE("Forward error %s, exit\n", status.description().c_str());
+                    result = status;
+                }
+                for (auto next : layer_successors_[index]) {
+                    if (--dependency_count[next] == 0) {
+                        ready_layers.push(next);
+                    }
+                }
+                free_slots.push_back(slot);
+                running--;
+                finished++;
+                // notify with the lock held, the waiting thread owns mtx and cv
+                cv.notify_one();
+            });
+        }
+
+        if (running == 0) {
+            if (result == TNN_OK && finished < layer_count) {
+                return Status(TNNERR_NET_ERR, "layers are left unscheduled in parallel forward");
+            }
+            break;
+        }
+        cv.wait(lck);
+    }
+    return result;
+}
+
 }  // namespace TNN_NS
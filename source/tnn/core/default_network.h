@@ -15,6 +15,11 @@
 #ifndef TNN_SOURCE_TNN_CORE_DEFAULT_NETWORK_H_
 #define TNN_SOURCE_TNN_CORE_DEFAULT_NETWORK_H_
 
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "tnn/core/abstract_device.h"
@@ -31,6 +36,7 @@
 #include "tnn/interpreter/net_resource.h"
 #include "tnn/interpreter/net_structure.h"
 #include "tnn/layer/base_layer.h"
+#include "tnn/utils/thread_pool.h"
 
 namespace TNN_NS {
 
@@ -52,6 +58,9 @@ public:
     virtual Status Init(NetworkConfig &net_config, ModelConfig &model_config, AbstractModelInterpreter *interpreter,
         InputShapesMap min_inputs_shape, InputShapesMap max_inputs_shape, bool enable_const_folder=true);
 
+    // @brief init network as a clone of an inited default network, see AbstractNetwork::InitFromNetwork
+    virtual Status InitFromNetwork(AbstractNetwork *network, NetResource *net_resource = nullptr);
+
     // @brief reshape with input shape info
     // @inputs input shape info
     virtual Status Reshape(const InputShapesMap &inputs);
@@ -74,6 +83,12 @@ public:
     // @brief tnn instance network infer, it will not wait
     virtual Status ForwardAsync(Callback call_back);
 
+    // @brief tnn instance network infer, it will not wait, forward is ready before call_back is called
+    virtual Status ForwardAsync(Callback call_back, std::shared_future<Status> &forward);
+
+    // @brief wait for the forward started by ForwardAsync to complete
+    virtual Status WaitForwardAsync();
+
     // @brief network deinit to release init create resource
     virtual Status DeInit();
 
@@ -92,6 +107,16 @@ public:
     // @brief set threads run on device
     virtual Status SetCpuNumThreads(int num_threads);
 
+    // @brief peak bytes of live blobs with layers in the model order and in the order they run, both are 0 unless
+    // the memory plan schedules the layers
+    Status GetLayerSchedulePeakBytes(int64_t &model_order_peak, int64_t &schedule_peak);
+
+    // @brief replace the net of interpreter by the optimized and const folded net an earlier init with the same
+    // config and inputs shape saved next to the packed cache, returns TNN_OK if the net is replaced
+    static Status LoadOptimizedNet(NetworkConfig &net_config, ModelConfig &model_config,
+                                   AbstractModelInterpreter *interpreter, InputShapesMap min_inputs_shape,
+                                   InputShapesMap max_inputs_shape);
+
 #if TNN_PROFILE
 public:
     virtual void StartProfile();
@@ -99,7 +124,18 @@ public:
 #endif
 
 protected:
+    // @brief create context of device_ and set it with net_config
+    Status InitContext(NetworkConfig &net_config);
+    // @brief init blobs and layers of the optimized net structure, allocate blob memory and reshape
+    Status InitNetwork(NetStructure *net_structure, NetResource *net_resource, InputShapesMap max_inputs_shape);
+    // @brief save the resources packed by layer accs to the packed cache file of the context
+    Status SavePackedCache();
+    // @brief save the optimized net with its folded constants to path, see LoadOptimizedNet
+    Status SaveOptimizedNet(const std::string &path, NetStructure *net_structure, NetResource *net_resource,
+                            InputShapesMap min_inputs_shape, InputShapesMap max_inputs_shape);
     virtual Status InitLayers(NetStructure *net_structure, NetResource *net_resource);
+    // @brief init the layer accs of layers_ in parallel, after their outputs are inited in order
+    Status InitLayerAccs();
     virtual Status AllocateBlobMemory();
     RuntimeMode runtime_model_ = RUNTIME_MODE_NORMAL;
     
@@ -107,7 +143,11 @@ protected:
     Status UpdateBlobPrecision(std::shared_ptr<LayerInfo> layer_info, bool is_input, bool is_quantized_net,
                                const std::string &name, NetResource *net_resource, Blob **blob);
 
-    std::string GenerateCacheFileName(ModelConfig &model_config, std::string& md5_str);
+    static std::string GenerateCacheFileName(NetworkConfig &net_config, ModelConfig &model_config,
+                                             std::string &md5_str);
+    // @brief path of a cache file in the cache path of net_config, the tag tells the isa it is built for apart
+    static std::string GenerateCacheFilePath(NetworkConfig &net_config, ModelConfig &model_config,
+                                             std::string &md5_str, const std::string &tag, const std::string &suffix);
 
     Status PrepareDoReshape(const InputShapesMap &inputs, bool& shape_changed);
     Status DoReshape();
@@ -125,6 +165,8 @@ protected:
     NetResource *net_resource_ = nullptr;
 
     NetworkConfig config_;
+    // max inputs shape the blob manager is inited with, clones are inited with it too
+    InputShapesMap max_inputs_shape_;
 
     static std::mutex optimize_mtx_;
 
@@ -132,6 +174,42 @@ private:
 
    Status ReshapeLayers();
 
+   // @brief reorder layers_ within their dependencies to lower the peak memory of the memory plan
+   Status ScheduleLayersByMemory(NetStructure *net_structure);
+   int64_t model_order_peak_bytes_ = 0;
+   int64_t schedule_peak_bytes_    = 0;
+
+   // @brief run all layers without blob dump, used by ForwardAsync
+   Status ForwardLayers();
+
+   bool IsParallelLayersEnabled();
+   // @brief run layers_ concurrently following the dependency graph
+   Status ForwardLayersParallel();
+   // @brief build layer dependency graph from blob memory the layers read and write
+   Status BuildLayerGraph();
+   bool IsLayerGraphValid();
+   std::vector<std::pair<char *, int64_t>> GetLayerGraphMemorySnapshot();
+   // @brief memory of the net inputs and outputs, the only blobs the user may rebind between reshapes
+   std::vector<char *> GetNetBlobsMemory();
+
+   std::shared_ptr<ThreadPool> layer_pool_ = nullptr;
+   // successors and dependency count of each layer in layers_
+   std::vector<std::vector<int>> layer_successors_;
+   std::vector<int> layer_dependency_count_;
+   // the graph is rebuilt after reshape, SetForwardMemory or a rebind of the net inputs and outputs
+   bool layer_graph_valid_ = false;
+   std::vector<char *> layer_graph_net_blobs_memory_;
+
+   // worker thread of ForwardAsync on cpu devices, the forward in flight and its forward with the callback.
+   // the callback of a forward may start the next one on the worker while another thread waits, so they are
+   // guarded by async_mutex_
+   std::shared_ptr<ThreadPool> async_worker_ = nullptr;
+   std::mutex async_mutex_;
+   std::shared_future<Status> async_forward_;
+   std::shared_future<void> async_task_;
+   int64_t async_forward_id_ = 0;
+   std::thread::id async_worker_thread_;
+
 };
 
 }  // namespace TNN_NS
@@ -14,16 +14,19 @@
 
 #include "tnn/core/instance.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "tnn/core/abstract_network.h"
 #include "tnn/core/common.h"
 #include "tnn/core/const_folder.h"
+#include "tnn/core/default_network.h"
 #include "tnn/core/macro.h"
 #include "tnn/core/profile.h"
 #include "tnn/core/status.h"
 #include "tnn/interpreter/abstract_model_interpreter.h"
 #include "tnn/interpreter/default_model_interpreter.h"
+#include "tnn/interpreter/net_resource.h"
 #include "tnn/utils/dims_utils.h"
 
 namespace TNN_NS {
@@ -83,6 +86,7 @@ Status Instance::Init(std::shared_ptr<AbstractModelInterpreter> interpreter, Inp
         LOGE("ERROR: network_ is nil, network_type may not support\n");
         return Status(TNNERR_NET_ERR, "network_ is nil, network_type may not support");
     }
+    network_type_ = network_type;
     if (net_config_.device_type == DEVICE_CUDA) {
         auto ret = network_->Init(net_config_, model_config_, interpreter_.get(), min_inputs_shape, max_inputs_shape, false);
         if (ret == TNN_OK) {
@@ -93,12 +97,18 @@ Status Instance::Init(std::shared_ptr<AbstractModelInterpreter> interpreter, Inp
         network_.reset();
     }
 
-    if (default_interpreter && default_interpreter->GetNetStructure() &&
+    // the optimized net an earlier init saved in the cache path replaces the model, its constants are folded already
+    bool net_loaded = network_type == NETWORK_TYPE_DEFAULT &&
+                      DefaultNetwork::LoadOptimizedNet(net_config_, model_config_, interpreter_.get(),
+                                                       min_inputs_shape, max_inputs_shape) == TNN_OK;
+    if (!net_loaded && default_interpreter && default_interpreter->GetNetStructure() &&
         (NeedDoConstantFolding(default_interpreter->GetNetStructure()) ||
          net_config_.device_type == DEVICE_CUDA || net_config_.device_type == DEVICE_APPLE_NPU)) {
         auto const_folder = std::make_shared<ConstFolder>();
         auto folder_net_config = net_config_;
         folder_net_config.share_memory_mode = SHARE_MEMORY_MODE_DEFAULT;
+        // const folder saves blobs of constant layers after forward, keep its memory layout unchanged
+        folder_net_config.enable_memory_plan = false;
         auto status = const_folder->Init(folder_net_config, model_config_, interpreter_.get(), min_inputs_shape, max_inputs_shape);
         RETURN_ON_NEQ(status, TNN_OK);
 
@@ -127,8 +137,61 @@ Status Instance::Init(std::shared_ptr<AbstractModelInterpreter> interpreter, Inp
     return TNN_OK;
 }
 
+std::shared_ptr<Instance> Instance::Clone(Status &status) {
+    auto instance = std::make_shared<Instance>(net_config_, model_config_);
+    status        = instance->Init(this);
+
+    if (status != TNN_OK) {
+        return nullptr;
+    }
+    return instance;
+}
+
+/*
+ * The clone skips interpreter copy and net optimization of Init. It still creates and inits its own layer accs,
+ * the accs of devices sharing packed weights through the resource cache key (x86) take the weights packed by this
+ * instance instead of packing them again, the accs of other devices pack their weights again.
+ * Const folder rewrites the constants of the net resource on reshape, so a clone with const folder
+ * folds into its own copy of the net resource. The copy shares layer resources and constants with this instance.
+ */
+Status Instance::Init(Instance *instance) {
+    if (!instance || !instance->network_) {
+        return Status(TNNERR_NET_ERR, "instance to clone is not inited");
+    }
+    if (instance->network_type_ != NETWORK_TYPE_DEFAULT) {
+        LOGE("ERROR: only instance of default network can be cloned, network type: %d\n", instance->network_type_);
+        return Status(TNNERR_NET_ERR, "only instance of default network can be cloned");
+    }
+
+    interpreter_  = instance->interpreter_;
+    network_type_ = instance->network_type_;
+
+    Status status = TNN_OK;
+    if (instance->const_folder_) {
+        auto default_interpreter = dynamic_cast<DefaultModelInterpreter *>(interpreter_.get());
+        CHECK_PARAM_NULL(default_interpreter);
+        net_resource_ = std::make_shared<NetResource>(*default_interpreter->GetNetResource());
+
+        auto const_folder = std::make_shared<ConstFolder>();
+        status            = const_folder->InitFromNetwork(instance->const_folder_.get(), net_resource_.get());
+        RETURN_ON_NEQ(status, TNN_OK);
+        const_folder_ = const_folder;
+    }
+
+    network_ = NetworkImplManager::GetNetworkImpl(network_type_);
+    if (!network_) {
+        return Status(TNNERR_NET_ERR, "network_ is nil, network_type may not support");
+    }
+    return network_->InitFromNetwork(instance->network_.get(), net_resource_.get());
+}
+
 Status Instance::DeInit() {
-    network_ = nullptr;
+    // the forward started by ForwardAsync copies the bound outputs through network_ on the worker thread
+    if (network_) {
+        network_->WaitForwardAsync();
+    }
+    network_      = nullptr;
+    const_folder_ = nullptr;
     return TNN_OK;
 }
 
@@ -141,14 +204,41 @@ Status Instance::SetForwardMemory(void *memory) {
 }
 
 Status Instance::Reshape(const InputShapesMap &inputs) {
-    Status status = TNN_OK;
+    Status status = WaitForwardAsync();
+    RETURN_ON_NEQ(status, TNN_OK);
+
+    BlobMap blobs, output_blobs;
+    RETURN_ON_NEQ(network_->GetAllInputBlobs(blobs), TNN_OK);
+    RETURN_ON_NEQ(network_->GetAllOutputBlobs(output_blobs), TNN_OK);
+    blobs.insert(output_blobs.begin(), output_blobs.end());
+    std::map<std::string, DimsVector> dims_before;
+    for (auto iter : blobs) {
+        dims_before[iter.first] = iter.second->GetBlobDesc().dims;
+    }
+
     if (const_folder_) {
         auto folder = dynamic_cast<ConstFolder*>(const_folder_.get());
         status = folder->Reshape(inputs);
         RETURN_ON_NEQ(status, TNN_OK);
     }
     status = network_->Reshape(inputs);
-    return status;
+    RETURN_ON_NEQ(status, TNN_OK);
+
+    // user memory bound before holds the data of the old dims
+    for (auto iter : blobs) {
+        const auto &name = iter.first;
+        const auto &dims = iter.second->GetBlobDesc().dims;
+        if (input_bindings_.count(name) > 0 && !DimsVectorUtils::Equal(input_bindings_[name].second, dims)) {
+            input_bindings_.erase(name);
+        }
+        if (DimsVectorUtils::Equal(dims_before[name], dims)) {
+            continue;
+        }
+        output_bindings_.erase(name);
+        status = BindBlob(iter.second, nullptr);
+        RETURN_ON_NEQ(status, TNN_OK);
+    }
+    return TNN_OK;
 }
 
 Status Instance::GetCommandQueue(void **command_queue) {
@@ -164,14 +254,25 @@ AbstractNetwork *Instance::GetNetwork() {
 }
 
 Status Instance::Forward() {
+    // the outputs of the forward started by ForwardAsync are copied before this one overwrites them
+    auto status = WaitForwardAsync();
+    RETURN_ON_NEQ(status, TNN_OK);
     output_mats_convert_status_.clear();
-    return network_->Forward();
+    status = CopyBoundInputs();
+    RETURN_ON_NEQ(status, TNN_OK);
+    status = network_->Forward();
+    RETURN_ON_NEQ(status, TNN_OK);
+    return CopyBoundOutputs();
 }
 
 #ifdef FORWARD_CALLBACK_ENABLE
 Status Instance::ForwardWithCallback(BlobStatisticCallback before, BlobStatisticCallback after) {
     output_mats_convert_status_.clear();
-    return network_->ForwardWithCallback(before, after);
+    auto status = CopyBoundInputs();
+    RETURN_ON_NEQ(status, TNN_OK);
+    status = network_->ForwardWithCallback(before, after);
+    RETURN_ON_NEQ(status, TNN_OK);
+    return CopyBoundOutputs();
 }
 #endif  // end of FORWARD_CALLBACK_ENABLE
 
@@ -183,8 +284,159 @@ std::shared_ptr<AbstractModelInterpreter> Instance::GetInterpreter() {
 #endif  // end of GET_INTERP_ENABLE
 
 Status Instance::ForwardAsync(Callback call_back) {
+    std::shared_future<Status> forward;
+    return ForwardAsync(call_back, forward);
+}
+
+Status Instance::ForwardAsync(Callback call_back, std::shared_future<Status> &forward) {
+    // the previous forward copies its bound outputs before the inputs of this one are written
+    auto status = WaitForwardAsync();
+    RETURN_ON_NEQ(status, TNN_OK);
     output_mats_convert_status_.clear();
-    return (Status)network_->ForwardAsync(call_back);
+    status = CopyBoundInputs();
+    RETURN_ON_NEQ(status, TNN_OK);
+    {
+        std::unique_lock<std::mutex> lck(bound_outputs_mutex_);
+        bound_outputs_pending_ = !output_bindings_.empty();
+    }
+    // devices running the forward on a worker thread copy the bound outputs there before call_back
+    return network_->ForwardAsync(
+        [this, call_back]() {
+            CopyPendingBoundOutputs();
+            if (call_back) {
+                call_back();
+            }
+        },
+        forward);
+}
+
+Status Instance::WaitForwardAsync() {
+    auto status = network_->WaitForwardAsync();
+    RETURN_ON_NEQ(status, TNN_OK);
+    return CopyPendingBoundOutputs();
+}
+
+/*
+ * Blobs in NetworkConfig::bound_blobs own their memory out of the shared forward memory,
+ * so pointing them at user memory changes no other blob.
+ */
+static bool IsBindableInPlace(const NetworkConfig &config, Blob *blob, void *data) {
+    const auto &desc        = blob->GetBlobDesc();
+    const auto &bound_blobs = config.bound_blobs;
+    bool cpu_device         = desc.device_type == DEVICE_X86 || desc.device_type == DEVICE_NAIVE ||
+                      desc.device_type == DEVICE_ARM;
+    // blob memory was at least 16 bytes aligned before
+    return std::find(bound_blobs.begin(), bound_blobs.end(), desc.name) != bound_blobs.end() && cpu_device &&
+           desc.data_type == DATA_TYPE_FLOAT && desc.data_format == DATA_FORMAT_NCHW &&
+           reinterpret_cast<uintptr_t>(data) % 16 == 0;
+}
+
+Status Instance::BindBlob(Blob *blob, void *data) {
+    const auto &name = blob->GetBlobDesc().name;
+    auto iter        = unbound_handles_.find(name);
+    if (!data) {
+        if (iter != unbound_handles_.end()) {
+            blob->SetHandle(iter->second);
+            unbound_handles_.erase(iter);
+        }
+        return TNN_OK;
+    }
+    if (iter == unbound_handles_.end()) {
+        unbound_handles_[name] = blob->GetHandle();
+    }
+    BlobHandle handle;
+    handle.base = data;
+    blob->SetHandle(handle);
+    return TNN_OK;
+}
+
+Status Instance::BindInput(const std::string &input_name, void *data, DimsVector dims) {
+    // input blobs may be in use by the forward started by ForwardAsync
+    auto status = WaitForwardAsync();
+    RETURN_ON_NEQ(status, TNN_OK);
+
+    BlobMap input_blobs;
+    status = network_->GetAllInputBlobs(input_blobs);
+    RETURN_ON_NEQ(status, TNN_OK);
+    if (input_blobs.find(input_name) == input_blobs.end()) {
+        LOGE("instance dont have the input with name: %s\n", input_name.c_str());
+        return Status(TNNERR_PARAM_ERR, "instance dont have the input with name");
+    }
+    auto input_blob = input_blobs[input_name];
+    input_bindings_.erase(input_name);
+    if (data && IsBindableInPlace(net_config_, input_blob, data) &&
+        DimsVectorUtils::Equal(dims, input_blob->GetBlobDesc().dims)) {
+        return BindBlob(input_blob, data);
+    }
+    status = BindBlob(input_blob, nullptr);
+    RETURN_ON_NEQ(status, TNN_OK);
+    if (data) {
+        input_bindings_[input_name] = std::make_pair(data, dims);
+    }
+    return TNN_OK;
+}
+
+Status Instance::BindOutput(const std::string &output_name, void *data) {
+    // output blobs may be in use by the forward started by ForwardAsync
+    auto status = WaitForwardAsync();
+    RETURN_ON_NEQ(status, TNN_OK);
+
+    BlobMap output_blobs;
+    status = network_->GetAllOutputBlobs(output_blobs);
+    RETURN_ON_NEQ(status, TNN_OK);
+    if (output_blobs.find(output_name) == output_blobs.end()) {
+        LOGE("instance dont have the output with name: %s\n", output_name.c_str());
+        return Status(TNNERR_PARAM_ERR, "instance dont have the output with name");
+    }
+    auto output_blob = output_blobs[output_name];
+    output_bindings_.erase(output_name);
+    if (data && IsBindableInPlace(net_config_, output_blob, data)) {
+        return BindBlob(output_blob, data);
+    }
+    status = BindBlob(output_blob, nullptr);
+    RETURN_ON_NEQ(status, TNN_OK);
+    if (data) {
+        output_bindings_[output_name] = data;
+    }
+    return TNN_OK;
+}
+
+Status Instance::CopyBoundInputs() {
+    for (auto iter : input_bindings_) {
+        auto mat    = std::make_shared<Mat>(DEVICE_NAIVE, NCHW_FLOAT, iter.second.second, iter.second.first);
+        auto status = SetInputMat(mat, MatConvertParam(), iter.first);
+        RETURN_ON_NEQ(status, TNN_OK);
+    }
+    return TNN_OK;
+}
+
+Status Instance::CopyBoundOutputs() {
+    if (output_bindings_.empty()) {
+        return TNN_OK;
+    }
+    BlobMap output_blobs;
+    auto status = network_->GetAllOutputBlobs(output_blobs);
+    RETURN_ON_NEQ(status, TNN_OK);
+
+    void *command_queue = nullptr;
+    network_->GetCommandQueue(&command_queue);
+    for (auto iter : output_bindings_) {
+        auto output_blob = output_blobs[iter.first];
+        Mat mat(DEVICE_NAIVE, NCHW_FLOAT, output_blob->GetBlobDesc().dims, iter.second);
+        BlobConverter blob_converter(output_blob);
+        status = blob_converter.ConvertToMat(mat, MatConvertParam(), command_queue);
+        RETURN_ON_NEQ(status, TNN_OK);
+    }
+    return TNN_OK;
+}
+
+Status Instance::CopyPendingBoundOutputs() {
+    std::unique_lock<std::mutex> lck(bound_outputs_mutex_);
+    if (!bound_outputs_pending_) {
+        return TNN_OK;
+    }
+    bound_outputs_pending_ = false;
+    return CopyBoundOutputs();
 }
 
 Status Instance::GetAllInputBlobs(BlobMap &blobs) {
@@ -206,6 +458,9 @@ Status Instance::SetInputMat(std::shared_ptr<Mat> mat, MatConvertParam param, st
         return Status(TNNERR_PARAM_ERR, "input mat is empty ,please check!");
     }
 
+    // input blobs may be in use by the forward started by ForwardAsync
+    WaitForwardAsync();
+
     // get input blobs
     BlobMap input_blobs;
     auto status = network_->GetAllInputBlobs(input_blobs);
@@ -250,6 +505,9 @@ Status Instance::SetInputMat(std::shared_ptr<Mat> mat, MatConvertParam param, st
 // get output Mat
 Status Instance::GetOutputMat(std::shared_ptr<Mat> &mat, MatConvertParam param, std::string output_name,
                               DeviceType device, MatType mat_type) {
+    // output blobs are ready after the forward started by ForwardAsync
+    WaitForwardAsync();
+
     // get output blobs
     BlobMap output_blobs;
     auto status = network_->GetAllOutputBlobs(output_blobs);
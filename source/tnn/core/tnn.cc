@@ -72,4 +72,13 @@ std::shared_ptr<Instance> TNN::CreateInst(NetworkConfig& config, Status& status,
     return impl_->CreateInst(config, status, min_inputs_shape, max_inputs_shape);
 }
 
+std::shared_ptr<Instance> TNN::CloneInst(std::shared_ptr<Instance> instance, Status& status) {
+    if (!instance) {
+        status = Status(TNNERR_PARAM_ERR, "instance to clone is nil");
+        return nullptr;
+    }
+
+    return instance->Clone(status);
+}
+
 }  // namespace TNN_NS
@@ -322,6 +322,13 @@ struct TNNVector {
         }
         return dst;
     }
+    static T reduce_add(const TNNVector<T, len>& v) {
+        T sum = 0;
+        for (int i = 0; i < len; ++i) {
+            sum += v.value[i];
+        }
+        return sum;
+    }
     static void zip(TNNVector<T, len>& v1, TNNVector<T, len>& v2) {
         if (len % 2 != 0) {
             LOGE("%s\n", "vecotr zip does not support len is odd");
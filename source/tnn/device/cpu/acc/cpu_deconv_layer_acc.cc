@@ -70,6 +70,8 @@ void CpuDeconvLayerAcc::ActiveOutput(ConvLayerParam *param, float &sum) {
         }
     } else if(param->activation_type == ActivationType_SIGMOID_MUL) {
         sum = 1.0f / (1.0f + exp(-sum)) * sum;
+    } else if (param->activation_type == ActivationType_HARDSWISH) {
+        sum = sum * std::min(std::max(sum + 3.0f, 0.0f), 6.0f) / 6.0f;
     }
 }
 
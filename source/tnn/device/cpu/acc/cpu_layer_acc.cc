@@ -13,6 +13,9 @@
 // specific language governing permissions and limitations under the License.
 
 #include "tnn/device/cpu/acc/cpu_layer_acc.h"
+
+#include <mutex>
+
 #include "tnn/utils/blob_transfer_utils.h"
 
 namespace TNN_NS {
@@ -27,8 +30,12 @@ Status CpuLayerAcc::Init(Context *context, LayerParam *param, LayerResource *res
     auto status = AbstractLayerAcc::Init(context, param, resource, inputs, outputs);
     RETURN_ON_NEQ(status, TNN_OK);
     
-    status = ReloadConstantBlobs(inputs, false);
-
+    {
+        // layers sharing a constant input may init in parallel
+        static std::mutex reload_mtx;
+        std::unique_lock<std::mutex> lck(reload_mtx);
+        status = ReloadConstantBlobs(inputs, false);
+    }
     RETURN_ON_NEQ(status, TNN_OK);
 
     return Reshape(inputs, outputs);
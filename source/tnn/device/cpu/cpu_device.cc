@@ -15,6 +15,7 @@
 #include "tnn/device/cpu/cpu_device.h"
 #include "tnn/device/cpu/cpu_context.h"
 #include "tnn/utils/blob_memory_size_utils.h"
+#include "tnn/utils/cpu_allocator.h"
 
 namespace TNN_NS {
 
@@ -61,9 +62,9 @@ Status CpuDevice::Allocate(void** handle, BlobMemorySizeInfo& size_info) {
     if (handle) {
         auto size = GetBlobMemoryBytesSize(size_info);
         if (size > 0) {
-            *handle = malloc(size);
-            if (*handle && size > 0) {
-                memset(*handle, 0, size);
+            *handle = CpuAllocator::GetInstance().Allocate(size, size_info.zero_fill);
+            if (!*handle) {
+                return Status(TNNERR_OUTOFMEMORY, "CpuDevice::Allocate failed");
             }
         } else if (size == 0) {
             //support empty blob for yolov5 Slice_507, only in device cpu
@@ -76,9 +77,7 @@ Status CpuDevice::Allocate(void** handle, BlobMemorySizeInfo& size_info) {
 }
 
 Status CpuDevice::Free(void* handle) {
-    if (handle) {
-        free(handle);
-    }
+    CpuAllocator::GetInstance().Free(handle);
     return TNN_OK;
 }
 
@@ -0,0 +1,203 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#ifndef Float16_hpp
+#define Float16_hpp
+#include "tnn/core/macro.h"
+#include "tnn/device/x86/x86_common.h"
+#include "tnn/device/x86/acc/Float8.h"
+#ifndef __AVX512F__
+#include "tnn/device/arm/acc/TNNVector.h"
+#endif
+
+namespace TNN_NS {
+X86_SIMD_NAMESPACE_BEGIN
+#ifndef __AVX512F__
+using Float16 = TNNVector<float, 16>;
+#else
+// exp, log and tanh run on the two 256 bits halves with the avx kernels of Float8
+struct Float16 {
+    __m512 value;
+    Float16() {}
+    Float16(const float v) {
+        value = _mm512_set1_ps(v);
+    }
+    Float16(const float *addr) {
+        value = _mm512_set1_ps(*addr);
+    }
+    Float16(const __m512& v) {
+        value = v;
+    }
+    Float16(const Float16& lr) {
+        value = lr.value;
+    }
+
+    static Float16 load(const float* addr) {
+        Float16 v;
+        v.value = _mm512_load_ps(addr);
+        return v;
+    }
+    static Float16 loadu(const float* addr) {
+        Float16 v;
+        v.value = _mm512_loadu_ps(addr);
+        return v;
+    }
+    static void save(float* addr, const Float16& v) {
+        _mm512_store_ps(addr, v.value);
+    }
+    static void saveu(float* addr, const Float16& v) {
+        _mm512_storeu_ps(addr, v.value);
+    }
+    // mla_231
+    static void mla(Float16& v1, const Float16& v2, const Float16& v3) {
+        v1.value = _mm512_fmadd_ps(v2.value, v3.value, v1.value);
+    }
+    static void mla_123(Float16& v1, const Float16& v2, const Float16& v3) {
+        v1.value = _mm512_fmadd_ps(v1.value, v2.value, v3.value);
+    }
+    static void mls(Float16& v1, const Float16& v2, const Float16& v3) {
+        v1.value = _mm512_fnmadd_ps(v2.value, v3.value, v1.value);
+    }
+    static Float16 bsl_cle(const Float16& c1, const Float16& c2, const Float16& v1, const Float16& v2) {
+        Float16 dst;
+        dst.value = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(c1.value, c2.value, _CMP_GE_OQ), v1.value, v2.value);
+        return dst;
+    }
+    static Float16 bsl_clt(const Float16& c1, const Float16& c2, const Float16& v1, const Float16& v2) {
+        Float16 dst;
+        dst.value = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(c1.value, c2.value, _CMP_GT_OQ), v1.value, v2.value);
+        return dst;
+    }
+    static Float16 bsl_cge(const Float16& c1, const Float16& c2, const Float16& v1, const Float16& v2) {
+        Float16 dst;
+        dst.value = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(c1.value, c2.value, _CMP_LE_OQ), v1.value, v2.value);
+        return dst;
+    }
+    static Float16 bsl_cgt(const Float16& c1, const Float16& c2, const Float16& v1, const Float16& v2) {
+        Float16 dst;
+        dst.value = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(c1.value, c2.value, _CMP_LT_OQ), v1.value, v2.value);
+        return dst;
+    }
+    static Float16 max(const Float16& v1, const Float16& v2) {
+        Float16 dst;
+        dst.value = _mm512_max_ps(v1.value, v2.value);
+        return dst;
+    }
+    static Float16 min(const Float16& v1, const Float16& v2) {
+        Float16 dst;
+        dst.value = _mm512_min_ps(v1.value, v2.value);
+        return dst;
+    }
+    static Float16 add(const Float16& v1, const Float16& v2) {
+        Float16 dst;
+        dst.value = _mm512_add_ps(v1.value, v2.value);
+        return dst;
+    }
+    static Float16 sub(const Float16& v1, const Float16& v2) {
+        Float16 dst;
+        dst.value = _mm512_sub_ps(v1.value, v2.value);
+        return dst;
+    }
+    static Float16 mul(const Float16& v1, const Float16& v2) {
+        Float16 dst;
+        dst.value = _mm512_mul_ps(v1.value, v2.value);
+        return dst;
+    }
+    static Float16 div(const Float16& v1, const Float16& v2) {
+        Float16 dst;
+        dst.value = _mm512_div_ps(v1.value, v2.value);
+        return dst;
+    }
+    static float reduce_add(const Float16& v) {
+        return _mm512_reduce_add_ps(v.value);
+    }
+    static Float16 neg(const Float16 &v) {
+        Float16 dst;
+        dst.value = _mm512_sub_ps(_mm512_setzero_ps(), v.value);
+        return dst;
+    }
+    static Float16 abs(const Float16 &v) {
+        Float16 dst;
+        dst.value = _mm512_max_ps(_mm512_sub_ps(_mm512_setzero_ps(), v.value), v.value);
+        return dst;
+    }
+    static Float16 sqrt(const Float16 &v) {
+        Float16 dst;
+        dst.value = _mm512_sqrt_ps(v.value);
+        return dst;
+    }
+    static Float16 sigmoid(const Float16 &v) {
+        Float16 dst;
+        const __m512 one = _mm512_set1_ps(1.0f);
+        dst.value = _mm512_div_ps(one, _mm512_add_ps(one, exp(neg(v)).value));
+        return dst;
+    }
+    static Float16 exp(const Float16 &v) {
+        return combine(Float8::exp(low(v)), Float8::exp(high(v)));
+    }
+    static Float16 log(const Float16 &v) {
+        return combine(Float8::log(low(v)), Float8::log(high(v)));
+    }
+    static Float16 tanh(const Float16& v) {
+        return combine(Float8::tanh(low(v)), Float8::tanh(high(v)));
+    }
+    Float16 operator+(const Float16& lr) const {
+        Float16 dst;
+        dst.value = _mm512_add_ps(value, lr.value);
+        return dst;
+    }
+    Float16 operator-(const Float16& lr) const {
+        Float16 dst;
+        dst.value = _mm512_sub_ps(value, lr.value);
+        return dst;
+    }
+    Float16 operator*(float lr) const {
+        Float16 dst;
+        dst.value = _mm512_mul_ps(value, _mm512_set1_ps(lr));
+        return dst;
+    }
+    Float16 operator*(const Float16& lr) const {
+        Float16 dst;
+        dst.value = _mm512_mul_ps(value, lr.value);
+        return dst;
+    }
+    Float16& operator=(const Float16& lr) {
+        value = lr.value;
+        return *this;
+    }
+    Float16 operator-() const {
+        Float16 dst;
+        dst.value = _mm512_sub_ps(_mm512_setzero_ps(), value);
+        return dst;
+    }
+
+private:
+    static Float8 low(const Float16& v) {
+        return Float8(_mm512_castps512_ps256(v.value));
+    }
+    static Float8 high(const Float16& v) {
+        return Float8(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(v.value), 1)));
+    }
+    static Float16 combine(const Float8& low, const Float8& high) {
+        Float16 dst;
+        dst.value = _mm512_castpd_ps(
+            _mm512_insertf64x4(_mm512_castps_pd(_mm512_castps256_ps512(low.value)), _mm256_castps_pd(high.value), 1));
+        return dst;
+    }
+};
+#endif
+X86_SIMD_NAMESPACE_END
+}  // namespace TNN_NS
+
+#endif /* Float16_hpp */
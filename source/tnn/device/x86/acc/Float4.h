@@ -26,6 +26,7 @@
 #endif
 
 namespace TNN_NS {
+X86_SIMD_NAMESPACE_BEGIN
 
 #ifdef VEC_NAIVE_IMPL
 using Float4 = TNNVector<float, 4>;
@@ -188,9 +189,7 @@ struct Float4 {
         Float4 dst;
         dst.value = _mm_hadd_ps(v.value, v.value);
         dst.value = _mm_hadd_ps(dst.value, dst.value);
-        float rst[4];
-        _mm_store_ps(rst, dst.value);        
-        return rst[0];
+        return _mm_cvtss_f32(dst.value);
     }
     static Float4 neg(const Float4 &v) {
         Float4 dst;
@@ -306,6 +305,7 @@ struct Float4x4 {
 };
 #endif
 
+X86_SIMD_NAMESPACE_END
 }  // namespace TNN_NS
 
 #endif /* Float4_hpp */
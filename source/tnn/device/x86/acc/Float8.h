@@ -24,6 +24,7 @@
 #endif
 
 namespace TNN_NS {
+X86_SIMD_NAMESPACE_BEGIN
 #ifndef __AVX__
 using Float8 = TNNVector<float, 8>;
 #else
@@ -146,12 +147,11 @@ struct Float8 {
         return dst;
     }
     static float reduce_add(const Float8& v) {
-        Float8 tmp;
-        tmp.value = _mm256_hadd_ps(v.value, v.value);
-        tmp.value = _mm256_hadd_ps(tmp.value, tmp.value);
-        float rst[8];
-        _mm256_store_ps(rst, tmp.value);
-        return rst[0];
+        // hadd works in each 128 bits lane, add the high lane to the low lane first
+        __m128 sum = _mm_add_ps(_mm256_castps256_ps128(v.value), _mm256_extractf128_ps(v.value, 1));
+        sum        = _mm_hadd_ps(sum, sum);
+        sum        = _mm_hadd_ps(sum, sum);
+        return _mm_cvtss_f32(sum);
     }
     static Float8 neg(const Float8 &v) {
         Float8 dst;
@@ -230,6 +230,7 @@ struct Float8 {
     }
 };
 #endif
+X86_SIMD_NAMESPACE_END
 }  // namespace TNN_NS
 
 #endif /* Float8_hpp */
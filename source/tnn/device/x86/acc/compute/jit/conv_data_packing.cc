@@ -108,8 +108,13 @@ void pack_col_a_n(const T * a, dim_t lda, T * b, dim_t ldb, dim_t m, dim_t n, co
                 i+=8;
                 break;
             default:
-                conv_gemm_conf.pack_t_ker_[16](m, cur_a, lda, cur_b, ldb, block_size);
-                i+=16;
+                if (cur_n >= 32) {
+                    conv_gemm_conf.pack_t_ker_[32](m, cur_a, lda, cur_b, ldb, block_size);
+                    i+=32;
+                } else {
+                    conv_gemm_conf.pack_t_ker_[16](m, cur_a, lda, cur_b, ldb, block_size);
+                    i+=16;
+                }
                 break;
         }
     }
@@ -168,10 +173,10 @@ void pack_col_a_t(
     dim_t block_size = conv_gemm_conf.m_block_;
     dim_t i = 0;
 
-    if (block_size == 16) {
+    if (block_size >= 16) {
         for (; i + 15 < cur_m; i += 16) {
             auto a_ptr = src_a + i * lda;
-            auto b_ptr = src_b + i * ldb;
+            auto b_ptr = src_b + divDown(i, block_size) * ldb + i % block_size;
             pack_a_t_trans<16, T>(a_ptr, lda, b_ptr, cur_k, block_size);
         }
     }
@@ -22,11 +22,28 @@
 #include "tnn/device/x86/acc/compute/jit/conv_gemm_config.h"
 #include "tnn/device/x86/acc/compute/jit/utils/timer.hpp"
 #include "tnn/device/x86/acc/compute/jit/conv_sgemm_driver.h"
+#include "tnn/device/x86/acc/compute/x86_activation.h"
+#include "tnn/device/x86/acc/Float4.h"
 #include "tnn/utils/omp_utils.h"
 #include <xbyak/xbyak.h>
 
 namespace TNN_NS {
 
+// the jit kernels fuse relu and relu6, other activations are applied to the block they wrote while it is in cache
+static void conv_sgemm_post_act(float * dst, dim_t M, dim_t N, dim_t ldc, dim_t act_type)
+{
+    for (dim_t j = 0; j < N; j++) {
+        float * dst_j = dst + j * ldc;
+        dim_t i = 0;
+        for (; i + 3 < M; i += 4) {
+            Float4::saveu(dst_j + i, X86Activate(Float4::loadu(dst_j + i), act_type));
+        }
+        for (; i < M; i++) {
+            dst_j[i] = X86Activate(dst_j[i], act_type);
+        }
+    }
+}
+
 void conv_sgemm_block_n(
         dim_t M, dim_t N, dim_t K,
         const float * src_a, dim_t lda,
@@ -38,6 +55,10 @@ void conv_sgemm_block_n(
 
     dim_t K_c = conv_gemm_conf.K_c_;
     dim_t m_block = conv_gemm_conf.m_block_;
+    dim_t post_act = act_type;
+    if (act_type != ActivationType_ReLU && act_type != ActivationType_ReLU6) {
+        act_type = ActivationType_None;
+    }
 
     for(dim_t i=0;i<M;)  {
         dim_t cur_m = MIN(M - i, conv_gemm_conf.kernel_m_r_);
@@ -75,11 +96,20 @@ void conv_sgemm_block_n(
                 i+=8;
                 break;
             default:
-                conv_gemm_conf.kernels_[16][N](K, cur_a, lda, cur_b, ldb, cur_c, ldc, bias, first, act_type);
-                i+=16;
+                if (cur_m >= 32) {
+                    conv_gemm_conf.kernels_[32][N](K, cur_a, lda, cur_b, ldb, cur_c, ldc, bias, first, act_type);
+                    i+=32;
+                } else {
+                    conv_gemm_conf.kernels_[16][N](K, cur_a, lda, cur_b, ldb, cur_c, ldc, bias, first, act_type);
+                    i+=16;
+                }
                 break;
         }
     }
+
+    if (post_act != act_type) {
+        conv_sgemm_post_act(dst, M, N, ldc, post_act);
+    }
 }
 
 // sgemm col_major a no_trans, b no_trans
@@ -185,9 +215,8 @@ void conv_sgemm_nn_col_major_prepack_b(
         // pack b -> K_c * N;
         const float *pack_b_k = src_b + k * divUp(N, n_block);
 
-        OMP_PARALLEL_FOR_DYNAMIC_
-        for (dim_t i = 0; i < M; i += M_c)  {
-            int thread_id = OMP_TID_;
+        PARALLEL_FOR_(0, (M + M_c - 1) / M_c, [&](long m_idx, int thread_id) {
+            dim_t i = m_idx * M_c;
             auto src_trans_per_t = src_trans_buf + thread_id * M_c * K_c;
             dim_t cur_m = MIN(M - i, M_c);
             // pack a -> M_c * K_c;
@@ -202,7 +231,7 @@ void conv_sgemm_nn_col_major_prepack_b(
                 conv_sgemm_block_n(cur_m, cur_n, cur_k, src_trans_per_t, lda, packed_cur_b, ldb, cur_c, ldc, cur_bias, first, post_type, conv_gemm_conf);
                 j += cur_n;
             }
-        }
+        });
         // if k != 0, first = 1
         first = 1;
     }
@@ -307,8 +336,8 @@ void conv_sgemm_tn_col_major_prepack_a(
         // pack b -> K_c * N;
         pack_col_b_n(src_b + k, ldb, pack_b_buf, K_c, cur_k, N, conv_gemm_conf);
 
-        OMP_PARALLEL_FOR_DYNAMIC_
-        for (dim_t i = 0; i < M; i += M_c)  {
+        PARALLEL_FOR_(0, (M + M_c - 1) / M_c, [&](long m_idx, int thread_id) {
+            dim_t i = m_idx * M_c;
             dim_t cur_m = MIN(M - i, M_c);
             // pack a -> M_c * K_c;
             auto src_a_i = src_a + k * divUp(M, m_block) + i * K_c;
@@ -322,7 +351,7 @@ void conv_sgemm_tn_col_major_prepack_a(
                 conv_sgemm_block_n(cur_m, cur_n, cur_k, src_a_i, lda, packed_cur_b, ldb, cur_c, ldc, cur_bias, first, post_type, conv_gemm_conf);
                 j += cur_n;
             }
-        }
+        });
         // if k != 0, first = 1
         first = 1;
     }
@@ -383,14 +412,16 @@ void conv_pack_col_a_t(
 void conv_ajust_m_blk_size(
     int max_num_threads,
     dim_t m_all,
-    dim_t &m_blk)
+    dim_t &m_blk,
+    dim_t m_block)
 {
     // for 32bit, min M blk = 8
-    // for 64bit, min M blk = 16
-    int m_min = 8;
+    // for 64bit, min M blk = 16, 32 with avx512
+    dim_t m_min = 8;
 #ifdef XBYAK64
     m_min = 16;
 #endif
+    m_min = MAX(m_min, m_block);
 
     while ((m_all / m_blk) < max_num_threads &&
            m_blk > m_min) {
@@ -108,8 +108,13 @@ void pack_t(const T * a, dim_t lda, T * b, dim_t ldb, dim_t m, dim_t n, gemm_con
                 i+=8;
                 break;
             default:
-                gemm_conf.pack_t_ker_[16](m, cur_a, lda, cur_b, ldb, block_size);
-                i+=16;
+                if (cur_n >= 32) {
+                    gemm_conf.pack_t_ker_[32](m, cur_a, lda, cur_b, ldb, block_size);
+                    i+=32;
+                } else {
+                    gemm_conf.pack_t_ker_[16](m, cur_a, lda, cur_b, ldb, block_size);
+                    i+=16;
+                }
                 break;
         }
     }
@@ -23,6 +23,7 @@
 
 #include "tnn/device/x86/acc/compute/jit/kernels/base_jit_kernel.h"
 #include "tnn/device/x86/acc/compute/jit/kernels/jit_kernels.h"
+#include "tnn/device/x86/acc/compute/jit/utils/cpu_isa.h"
 
 namespace TNN_NS {
 
@@ -34,7 +35,7 @@ gemm_config<a_t, b_t, c_t>::gemm_config(const char * trans_a, const char * trans
                 a_(a), b_(b), c_(c), m_(m), n_(n), k_(k), lda_(lda), ldb_(ldb), ldc_(ldc), 
                 alpha_(alpha), beta_(beta), m_block_(m_block), n_block_(n_block)
 {
-    std::vector<int> supported_m_block = {8, 16};
+    std::vector<int> supported_m_block = {8, 16, 32};
     std::vector<int> supported_n_block = {6};
     if (std::find(supported_m_block.begin(), supported_m_block.end(), m_block_) == supported_m_block.end()) {
        throw std::runtime_error("value of m_block is not supported.");
@@ -47,7 +48,12 @@ gemm_config<a_t, b_t, c_t>::gemm_config(const char * trans_a, const char * trans
     K_c_ = 256;
 
 #ifdef XBYAK64
-    kernel_m_r_ = 16; 
+    if (cpu_with_isa(avx512)) {
+        m_block_ = 32;
+        kernel_m_r_ = 32;
+    } else {
+        kernel_m_r_ = 16;
+    }
 #else 
     m_block_ = 8;
     kernel_m_r_ = 8; 
@@ -69,6 +75,7 @@ void gemm_config<a_t, b_t, c_t>::init_jit_kernel()
     static std::shared_ptr<jit::base_jit_kernel> g_pack_n_ker[nb_kernels_n + 1];
     static std::shared_ptr<jit::base_jit_kernel> g_kernel_8 [nb_kernels_m + 1][nb_kernels_n + 1];
     static std::shared_ptr<jit::base_jit_kernel> g_kernel_16[nb_kernels_m + 1][nb_kernels_n + 1];
+    static std::shared_ptr<jit::base_jit_kernel> g_kernel_32[nb_kernels_m + 1][nb_kernels_n + 1];
 
     static std::once_flag initialized;
     std::call_once(initialized, [] {
@@ -132,6 +139,11 @@ void gemm_config<a_t, b_t, c_t>::init_jit_kernel()
                 case 16:
                     g_pack_t_ker[i] = std::make_shared<jit::sgemm_fetch_t_16_ker_t>();
                     break;
+                case 32:
+                    if (cpu_with_isa(avx512)) {
+                        g_pack_t_ker[i] = std::make_shared<jit::sgemm_fetch_t_32_ker_t>();
+                    }
+                    break;
                 default:
                     break;
             }
@@ -144,6 +156,8 @@ void gemm_config<a_t, b_t, c_t>::init_jit_kernel()
             std::make_shared<jit::sgemm_avx_kernel<M, N, 8, 6>>();                              \
             if (M <= 16) g_kernel_16[M][N] =                                                    \
             std::make_shared<jit::sgemm_avx_kernel<M, N, 16, 6>>();                             \
+            if (M <= 32 && cpu_with_isa(avx512)) g_kernel_32[M][N] =                            \
+            std::make_shared<jit::sgemm_avx_kernel<M, N, 32, 6>>();                             \
 
 #define REGISTER_KERNEL_M(M)                                                                    \
             REGISTER_KERNEL(M, 1);                                                              \
@@ -158,6 +172,9 @@ void gemm_config<a_t, b_t, c_t>::init_jit_kernel()
         REGISTER_KERNEL_M(4);
         REGISTER_KERNEL_M(8);
         REGISTER_KERNEL_M(16);
+#ifdef XBYAK64
+        REGISTER_KERNEL_M(32);
+#endif
 
 #ifdef TNN_JIT_DUMP_KERNEL 
         for(int i=1;i<=nb_kernels_m;i++) {
@@ -181,6 +198,9 @@ void gemm_config<a_t, b_t, c_t>::init_jit_kernel()
                 if (g_kernel_16[m][n]) {
                     g_kernel_16[m][n]->dump_to_file();
                 }
+                if (g_kernel_32[m][n]) {
+                    g_kernel_32[m][n]->dump_to_file();
+                }
             }
         }
 #endif
@@ -215,6 +235,8 @@ void gemm_config<a_t, b_t, c_t>::init_jit_kernel()
         kernel_array = &g_kernel_8;
     } else if (m_block_ == 16)  {
         kernel_array = &g_kernel_16;
+    } else if (m_block_ == 32)  {
+        kernel_array = &g_kernel_32;
     } else {
         throw std::runtime_error("unsupported m_block value."); 
     }
@@ -38,6 +38,7 @@
 #include "tnn/device/x86/acc/compute/jit/kernels/conv_sgemm_avx_4_i.h"
 #include "tnn/device/x86/acc/compute/jit/kernels/conv_sgemm_avx_2_i.h"
 #include "tnn/device/x86/acc/compute/jit/kernels/conv_sgemm_avx_1_i.h"
+#include "tnn/device/x86/acc/compute/jit/kernels/conv_sgemm_avx512_32_i.h"
 
 namespace TNN_NS {
 namespace jit {
@@ -72,6 +73,9 @@ public:
             case 16:
                 actual = new conv_sgemm_avx_16xi<N, M_BLOCK_SIZE, N_BLOCK_SIZE>();
                 break;
+            case 32:
+                actual = new conv_sgemm_avx512_32xi<N, M_BLOCK_SIZE, N_BLOCK_SIZE>();
+                break;
             default:
                 throw std::runtime_error("kernel not found for specified param."); 
                 break;
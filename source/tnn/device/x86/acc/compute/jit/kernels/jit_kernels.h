@@ -21,6 +21,7 @@
 #include "tnn/device/x86/acc/compute/jit/kernels/sgemm_fetch_t_4.h"
 #include "tnn/device/x86/acc/compute/jit/kernels/sgemm_fetch_t_8.h"
 #include "tnn/device/x86/acc/compute/jit/kernels/sgemm_fetch_t_16.h"
+#include "tnn/device/x86/acc/compute/jit/kernels/sgemm_fetch_t_32.h"
 #include "tnn/device/x86/acc/compute/jit/kernels/sgemm_fetch_t_4x16.h"
 #include "tnn/device/x86/acc/compute/jit/kernels/sgemm_avx_kernels.h"
 #include "tnn/device/x86/acc/compute/jit/kernels/conv_sgemm_avx_kernels.h"
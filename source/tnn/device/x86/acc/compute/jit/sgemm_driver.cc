@@ -74,8 +74,13 @@ void sgemm_block_n(
                 i+=8;
                 break;
             default:
-                gemm_conf.kernels_[16][N](K, &alpha, cur_a, lda, cur_b, ldb, &beta, cur_c, ldc);
-                i+=16;
+                if (cur_m >= 32) {
+                    gemm_conf.kernels_[32][N](K, &alpha, cur_a, lda, cur_b, ldb, &beta, cur_c, ldc);
+                    i+=32;
+                } else {
+                    gemm_conf.kernels_[16][N](K, &alpha, cur_a, lda, cur_b, ldb, &beta, cur_c, ldc);
+                    i+=16;
+                }
                 break;
         }
     }
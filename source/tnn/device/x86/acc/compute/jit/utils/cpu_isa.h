@@ -38,6 +38,8 @@ typedef enum {
     avx2,
     avx512,
     avx512_vnni,
+    // avx2 with the vex encoded vnni instructions
+    avx_vnni,
 } x86_isa_t;
 
 bool cpu_with_isa(x86_isa_t arch);
@@ -0,0 +1,79 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#ifndef SOURCE_TNN_DEVICE_X86_ACC_COMPUTE_X86_ACTIVATION_H_
+#define SOURCE_TNN_DEVICE_X86_ACC_COMPUTE_X86_ACTIVATION_H_
+
+#include <algorithm>
+#include <cmath>
+
+#include "tnn/interpreter/layer_param.h"
+
+namespace TNN_NS {
+
+// @brief number of activations fused by the x86 conv kernels
+static const int X86_FUSED_ACTIVATION_COUNT = 5;
+
+// @brief index of activation_type in the activation indexed kernels, -1 if the x86 conv kernels can not fuse it
+inline int X86ActivationIndex(int activation_type) {
+    switch (activation_type) {
+        case ActivationType_None:
+            return 0;
+        case ActivationType_ReLU:
+            return 1;
+        case ActivationType_ReLU6:
+            return 2;
+        case ActivationType_SIGMOID_MUL:
+            return 3;
+        case ActivationType_HARDSWISH:
+            return 4;
+        default:
+            return -1;
+    }
+}
+
+// @brief activation applied by the conv kernels to their output before it is stored, a constant activation_type
+// folds to the one branch taken
+template <typename VEC>
+inline VEC X86Activate(const VEC &v, int activation_type) {
+    if (activation_type == ActivationType_ReLU) {
+        return VEC::max(v, VEC(0.f));
+    } else if (activation_type == ActivationType_ReLU6) {
+        return VEC::min(VEC::max(v, VEC(0.f)), VEC(6.f));
+    } else if (activation_type == ActivationType_SIGMOID_MUL) {
+        return VEC::mul(v, VEC::sigmoid(v));
+    } else if (activation_type == ActivationType_HARDSWISH) {
+        VEC gate = VEC::min(VEC::max(VEC::add(v, VEC(3.f)), VEC(0.f)), VEC(6.f));
+        return VEC::mul(v, VEC::mul(gate, VEC(1.f / 6.f)));
+    }
+    return v;
+}
+
+template <>
+inline float X86Activate<float>(const float &v, int activation_type) {
+    if (activation_type == ActivationType_ReLU) {
+        return std::max(v, 0.f);
+    } else if (activation_type == ActivationType_ReLU6) {
+        return std::min(std::max(v, 0.f), 6.f);
+    } else if (activation_type == ActivationType_SIGMOID_MUL) {
+        return v / (1.f + std::exp(-v));
+    } else if (activation_type == ActivationType_HARDSWISH) {
+        return v * std::min(std::max(v + 3.f, 0.f), 6.f) * (1.f / 6.f);
+    }
+    return v;
+}
+
+}  // namespace TNN_NS
+
+#endif  // SOURCE_TNN_DEVICE_X86_ACC_COMPUTE_X86_ACTIVATION_H_
@@ -28,6 +28,11 @@
 
 namespace TNN_NS {
 
+#ifdef X86_COMPUTE_NAMESPACE
+// the avx2 build of this file in fat binaries, keep its symbols apart from the sse4.2 build
+namespace X86_COMPUTE_NAMESPACE {
+#endif
+
 Status X86_IM2COL(float* src, int channel, int height, int width, int kernelh, int kernelw, int padl, int padr,
                   int padt, int padb, int strideh, int stridew, int dilationh, int dilationw, float* dst) {
     int height_col   = (height + padt + padb - dilationh * (kernelh - 1) - 1) / strideh + 1;
@@ -227,11 +232,11 @@ void X86MaxPoolingCorner(const float* src, long iw, long ih, float* dst, long ow
             for (long ky = kys; ky < kye; ++ky) {
                 const auto src_ptr_h = src_ptr + (ky * iw) * pack_c;
                 for (long kx = kxs; kx < kxe; kx++) {
-                    vmax = T::max(vmax, T::load(src_ptr_h + kx * pack_c));
+                    vmax = T::max(vmax, T::loadu(src_ptr_h + kx * pack_c));
                 }
             }
 
-            T::save(dst_ptr, vmax);
+            T::saveu(dst_ptr, vmax);
         }
     }
 }
@@ -253,11 +258,11 @@ void X86MaxPoolingCenter3x3s2(const float* src, long iw, long ih, float* dst, lo
 
             for (long ky = 0; ky < 3; ++ky) {
                 const auto src_ptr_h = src_ptr + (ky * iw) * pack_c;
-                vmax                 = T::max(vmax, T::load(src_ptr_h + 0 * pack_c));
-                vmax                 = T::max(vmax, T::load(src_ptr_h + 1 * pack_c));
-                vmax                 = T::max(vmax, T::load(src_ptr_h + 2 * pack_c));
+                vmax                 = T::max(vmax, T::loadu(src_ptr_h + 0 * pack_c));
+                vmax                 = T::max(vmax, T::loadu(src_ptr_h + 1 * pack_c));
+                vmax                 = T::max(vmax, T::loadu(src_ptr_h + 2 * pack_c));
             }
-            T::save(dst_ptr, vmax);
+            T::saveu(dst_ptr, vmax);
         }
     }
 }
@@ -280,11 +285,11 @@ void X86MaxPoolingCenter(const float* src, long iw, long ih, float* dst, long ow
             for (long ky = 0; ky < kh; ++ky) {
                 const auto src_ptr_h = src_ptr + (ky * iw) * pack_c;
                 for (long kx = 0; kx < kw; kx++) {
-                    vmax = T::max(vmax, T::load(src_ptr_h + kx * pack_c));
+                    vmax = T::max(vmax, T::loadu(src_ptr_h + kx * pack_c));
                 }
             }
 
-            T::save(dst_ptr, vmax);
+            T::saveu(dst_ptr, vmax);
         }
     }
 }
@@ -339,12 +344,12 @@ void X86AvgPooling(const float* src, long iw, long ih, float* dst, long ow, long
             for (long ky = kys; ky < kye; ++ky) {
                 const auto src_ptr_h = src_ptr + (ky * iw) * pack_c;
                 for (long kx = kxs; kx < kxe; kx++) {
-                    vavg = vavg + T::load(src_ptr_h + kx * pack_c);
+                    vavg = vavg + T::loadu(src_ptr_h + kx * pack_c);
                 }
             }
 
             vavg = vavg * T(kernel_count);
-            T::save(dst_ptr, vavg);
+            T::saveu(dst_ptr, vavg);
         }
     }
 }
@@ -434,6 +439,46 @@ template Status X86_FMA<Float8, 8>(float *input_data, float *output_data, float
 template Status X86_FMA<Float4, 4>(float *input_data, float *output_data, float *scale_data, float *bias_data,
                bool shared_channel, bool has_bias, DimsVector output_dim);
 
+/*
+fma on blocked data, scale and bias are zero in the pad channels so the pads stay zero
+*/
+template <class T, int pack_c>
+Status X86_FMA_Blocked(float *input_data, float *output_data, float *scale_data, float *bias_data,
+                       bool shared_channel, bool has_bias, DimsVector output_dim) {
+    const int batch    = output_dim[0];
+    const int channel  = output_dim[1];
+    const int c_blocks = UP_DIV(channel, pack_c);
+    const long area    = DimsVectorUtils::Count(output_dim, 2);
+    for (int b = 0; b < batch; b++) {
+        for (int cb = 0; cb < c_blocks; cb++) {
+            float scale_c[pack_c] = {0.f};
+            float bias_c[pack_c]  = {0.f};
+            for (int i = 0; i < pack_c && cb * pack_c + i < channel; i++) {
+                int c      = shared_channel ? 0 : cb * pack_c + i;
+                scale_c[i] = scale_data[c];
+                bias_c[i]  = has_bias ? bias_data[c] : 0.f;
+            }
+            T scale = T::loadu(scale_c);
+            T bias  = T::loadu(bias_c);
+            T src;
+            float *input  = input_data + (b * c_blocks + cb) * area * pack_c;
+            float *output = output_data + (b * c_blocks + cb) * area * pack_c;
+            for (long i = 0; i < area; i++) {
+                src = T::loadu(input + i * pack_c);
+                T::mla_123(src, scale, bias);
+                T::saveu(output + i * pack_c, src);
+            }
+        }
+    }
+    return TNN_OK;
+}
+template Status X86_FMA_Blocked<Float8, 8>(float *input_data, float *output_data, float *scale_data,
+                                           float *bias_data, bool shared_channel, bool has_bias,
+                                           DimsVector output_dim);
+template Status X86_FMA_Blocked<Float4, 4>(float *input_data, float *output_data, float *scale_data,
+                                           float *bias_data, bool shared_channel, bool has_bias,
+                                           DimsVector output_dim);
+
 template<class T, int pack>
 Status X86_GroupNorm_FMA(
     float *input_data, float *output_data,
@@ -728,8 +773,6 @@ void DepthwiseConv(float* dst, const float* src, const float* weight, const floa
                    long dilate_x_step, long dilate_y_step, long height, long srcHStep, long dstHStep) {
     long dx, fx, fy;
     VEC bias_v = VEC::loadu(bias);
-    VEC v_zero = VEC(0.f);
-    VEC v_6    = VEC(6.f);
     for (long y = 0; y < height; ++y) {
         auto srcY = src + y * srcHStep;
         auto dstY = dst + y * dstHStep;
@@ -745,33 +788,24 @@ void DepthwiseConv(float* dst, const float* src, const float* weight, const floa
                 const auto* weight_y = weight_z + fy * fw * pack;
                 for (fx = 0; fx < fw; ++fx) {
                     VEC weight_v = VEC::loadu(weight_y + pack * fx);
-                    VEC src_v0   = VEC::load(src_y + fx * dilate_x_step);
-                    VEC src_v1   = VEC::load(src_y + fx * dilate_x_step + src_w_step);
-                    VEC src_v2   = VEC::load(src_y + fx * dilate_x_step + 2 * src_w_step);
-                    VEC src_v3   = VEC::load(src_y + fx * dilate_x_step + 3 * src_w_step);
+                    VEC src_v0   = VEC::loadu(src_y + fx * dilate_x_step);
+                    VEC src_v1   = VEC::loadu(src_y + fx * dilate_x_step + src_w_step);
+                    VEC src_v2   = VEC::loadu(src_y + fx * dilate_x_step + 2 * src_w_step);
+                    VEC src_v3   = VEC::loadu(src_y + fx * dilate_x_step + 3 * src_w_step);
                     VEC::mla(dst_v[0], src_v0, weight_v);
                     VEC::mla(dst_v[1], src_v1, weight_v);
                     VEC::mla(dst_v[2], src_v2, weight_v);
                     VEC::mla(dst_v[3], src_v3, weight_v);
                 }
             }
-            if (activation_type == ActivationType_ReLU || 
-                activation_type == ActivationType_ReLU6) {
-                dst_v[0] = VEC::max(dst_v[0], v_zero);
-                dst_v[1] = VEC::max(dst_v[1], v_zero);
-                dst_v[2] = VEC::max(dst_v[2], v_zero);
-                dst_v[3] = VEC::max(dst_v[3], v_zero);
-            }
-            if (activation_type == ActivationType_ReLU6) {
-                dst_v[0] = VEC::min(dst_v[0], v_6);
-                dst_v[1] = VEC::min(dst_v[1], v_6);
-                dst_v[2] = VEC::min(dst_v[2], v_6);
-                dst_v[3] = VEC::min(dst_v[3], v_6);
-            }
-            VEC::save(dstY + (dx + 0) * pack, dst_v[0]);
-            VEC::save(dstY + (dx + 1) * pack, dst_v[1]);
-            VEC::save(dstY + (dx + 2) * pack, dst_v[2]);
-            VEC::save(dstY + (dx + 3) * pack, dst_v[3]);
+            dst_v[0] = X86Activate(dst_v[0], activation_type);
+            dst_v[1] = X86Activate(dst_v[1], activation_type);
+            dst_v[2] = X86Activate(dst_v[2], activation_type);
+            dst_v[3] = X86Activate(dst_v[3], activation_type);
+            VEC::saveu(dstY + (dx + 0) * pack, dst_v[0]);
+            VEC::saveu(dstY + (dx + 1) * pack, dst_v[1]);
+            VEC::saveu(dstY + (dx + 2) * pack, dst_v[2]);
+            VEC::saveu(dstY + (dx + 3) * pack, dst_v[3]);
         }
         for (; dx < width; ++dx) {
             VEC dst_v = bias_v;
@@ -781,19 +815,13 @@ void DepthwiseConv(float* dst, const float* src, const float* weight, const floa
                 const auto* src_y    = src_z + fy * dilate_y_step;
                 const auto* weight_y = weight_z + fy * fw * pack;
                 for (fx = 0; fx < fw; ++fx) {
-                    VEC src_v    = VEC::load(src_y + fx * dilate_x_step);
+                    VEC src_v    = VEC::loadu(src_y + fx * dilate_x_step);
                     VEC weight_v = VEC::loadu(weight_y + pack * fx);
                     VEC::mla(dst_v, src_v, weight_v);
                 }
             }
-            if (activation_type == ActivationType_ReLU || 
-                activation_type == ActivationType_ReLU6) {
-                dst_v = VEC::max(dst_v, v_zero);
-            }
-            if (activation_type == ActivationType_ReLU6) {
-                dst_v = VEC::min(dst_v, v_6);
-            }
-            VEC::save(dstY + dx * pack, dst_v);
+            dst_v = X86Activate(dst_v, activation_type);
+            VEC::saveu(dstY + dx * pack, dst_v);
         }
     }
 }
@@ -810,6 +838,14 @@ template void DepthwiseConv<ActivationType_ReLU6, Float4, 4>(
     float* dst, const float* src, const float* weight, const float* bias, long width, long src_w_step, long fw, long fh,
     long dilate_x_step, long dilate_y_step, long height, long srcHStep, long dstHStep);
 
+template void DepthwiseConv<ActivationType_SIGMOID_MUL, Float4, 4>(
+    float* dst, const float* src, const float* weight, const float* bias, long width, long src_w_step, long fw, long fh,
+    long dilate_x_step, long dilate_y_step, long height, long srcHStep, long dstHStep);
+
+template void DepthwiseConv<ActivationType_HARDSWISH, Float4, 4>(
+    float* dst, const float* src, const float* weight, const float* bias, long width, long src_w_step, long fw, long fh,
+    long dilate_x_step, long dilate_y_step, long height, long srcHStep, long dstHStep);
+
 template void DepthwiseConv<ActivationType_None, Float8, 8>(
     float* dst, const float* src, const float* weight, const float* bias, long width, long src_w_step, long fw, long fh,
     long dilate_x_step, long dilate_y_step, long height, long srcHStep, long dstHStep);
@@ -822,6 +858,14 @@ template void DepthwiseConv<ActivationType_ReLU6, Float8, 8>(
     float* dst, const float* src, const float* weight, const float* bias, long width, long src_w_step, long fw, long fh,
     long dilate_x_step, long dilate_y_step, long height, long srcHStep, long dstHStep);
 
+template void DepthwiseConv<ActivationType_SIGMOID_MUL, Float8, 8>(
+    float* dst, const float* src, const float* weight, const float* bias, long width, long src_w_step, long fw, long fh,
+    long dilate_x_step, long dilate_y_step, long height, long srcHStep, long dstHStep);
+
+template void DepthwiseConv<ActivationType_HARDSWISH, Float8, 8>(
+    float* dst, const float* src, const float* weight, const float* bias, long width, long src_w_step, long fw, long fh,
+    long dilate_x_step, long dilate_y_step, long height, long srcHStep, long dstHStep);
+
 template <int left, int oc_>
 void X86SgemvLeft(float* dst, const float* src, const float* weight, float *bias, size_t batch_stride) {
     float acc[8];
@@ -905,44 +949,85 @@ void X86_Post_Exec(float *dst, const float *bias, long channel, long area) {
     for (long c = 0; c < channel; c++) {
         auto dst_c = dst + c * area;
         VEC bias_v = VEC(bias + c);
-        VEC zero_v = VEC(0.f);
-        VEC six_v = VEC(6.f);
         long i = 0;
         for (; i + pack - 1 < area; i += pack) {
             VEC src_v = VEC::loadu(dst_c + i);
             VEC dst_v = VEC::add(src_v, bias_v);
-
-            if (activation_type == ActivationType_ReLU || 
-                activation_type == ActivationType_ReLU6) {
-                dst_v = VEC::max(dst_v, zero_v);
-            }
-            if (activation_type == ActivationType_ReLU6) {
-                dst_v = VEC::min(dst_v, six_v);
-            }
-            VEC::saveu(dst_c + i, dst_v);
+            VEC::saveu(dst_c + i, X86Activate(dst_v, activation_type));
         }
 
         for (; i < area; i++) {
-            float dst_value = dst_c[i] + bias[c];
-            if (activation_type == ActivationType_ReLU || 
-                activation_type == ActivationType_ReLU6) {
-                dst_value = std::max(dst_value, 0.f);
-            }
-            if (activation_type == ActivationType_ReLU6) {
-                dst_value = std::min(dst_value, 6.f);
-            }
-            dst_c[i] = dst_value;
+            dst_c[i] = X86Activate(dst_c[i] + bias[c], activation_type);
         }
     }
 }
 template void X86_Post_Exec<ActivationType_None, Float4, 4>(float *dst, const float *bias, long channel, long area);
 template void X86_Post_Exec<ActivationType_ReLU, Float4, 4>(float *dst, const float *bias, long channel, long area);
 template void X86_Post_Exec<ActivationType_ReLU6, Float4, 4>(float *dst, const float *bias, long channel, long area);
+template void X86_Post_Exec<ActivationType_SIGMOID_MUL, Float4, 4>(float *dst, const float *bias, long channel,
+                                                                  long area);
+template void X86_Post_Exec<ActivationType_HARDSWISH, Float4, 4>(float *dst, const float *bias, long channel, long area);
 template void X86_Post_Exec<ActivationType_None, Float8, 8>(float *dst, const float *bias, long channel, long area);
 template void X86_Post_Exec<ActivationType_ReLU, Float8, 8>(float *dst, const float *bias, long channel, long area);
 template void X86_Post_Exec<ActivationType_ReLU6, Float8, 8>(float *dst, const float *bias, long channel, long area);
+template void X86_Post_Exec<ActivationType_SIGMOID_MUL, Float8, 8>(float *dst, const float *bias, long channel,
+                                                                  long area);
+template void X86_Post_Exec<ActivationType_HARDSWISH, Float8, 8>(float *dst, const float *bias, long channel, long area);
+
+/*
+direct conv of tile output pixels of one channel block in the blocked layout, each input lane is broadcast
+against the output channels of one weight row
+*/
+template <int activation_type, typename VEC, int pack, int tile>
+static inline void X86ConvBlockedTile(float *dst, const float *src, const float *weight, const VEC &bias_v,
+                                      long ic_blocks, long src_c_step, long kw, long kh, long src_w_step,
+                                      long dilate_x_step, long dilate_y_step) {
+    VEC acc[tile];
+    for (int t = 0; t < tile; t++) {
+        acc[t] = bias_v;
+    }
+    for (long icb = 0; icb < ic_blocks; icb++) {
+        const float *src_c    = src + icb * src_c_step;
+        const float *weight_c = weight + icb * kh * kw * pack * pack;
+        for (long ky = 0; ky < kh; ky++) {
+            for (long kx = 0; kx < kw; kx++) {
+                const float *src_k    = src_c + ky * dilate_y_step + kx * dilate_x_step;
+                const float *weight_k = weight_c + (ky * kw + kx) * pack * pack;
+                for (int l = 0; l < pack; l++) {
+                    VEC weight_v = VEC::loadu(weight_k + l * pack);
+                    for (int t = 0; t < tile; t++) {
+                        VEC::mla(acc[t], weight_v, VEC(src_k[t * src_w_step + l]));
+                    }
+                }
+            }
+        }
+    }
+
+    for (int t = 0; t < tile; t++) {
+        VEC::saveu(dst + t * pack, X86Activate(acc[t], activation_type));
+    }
+}
 
-//ActivationType_SIGMOID_MUL TBD
+/*
+one output row of one output channel block, src is the padded input row the row reads from,
+weight is [ic block][kh][kw][ic lane][oc lane] of the output channel block
+*/
+template <int activation_type, typename VEC, int pack>
+void X86ConvBlocked(float *dst, const float *src, const float *weight, const float *bias, long ow, long ic_blocks,
+                    long src_c_step, long kw, long kh, long src_w_step, long dilate_x_step, long dilate_y_step) {
+    VEC bias_v = VEC::loadu(bias);
+    long ox    = 0;
+    for (; ox + 7 < ow; ox += 8) {
+        X86ConvBlockedTile<activation_type, VEC, pack, 8>(dst + ox * pack, src + ox * src_w_step, weight, bias_v,
+                                                          ic_blocks, src_c_step, kw, kh, src_w_step, dilate_x_step,
+                                                          dilate_y_step);
+    }
+    for (; ox < ow; ox++) {
+        X86ConvBlockedTile<activation_type, VEC, pack, 1>(dst + ox * pack, src + ox * src_w_step, weight, bias_v,
+                                                          ic_blocks, src_c_step, kw, kh, src_w_step, dilate_x_step,
+                                                          dilate_y_step);
+    }
+}
 
 template <typename VEC, int pack>
 void X86_VectorAdd(float *dst, const float *src_a, const float *src_b, long len) {
@@ -1042,4 +1127,62 @@ void X86StrideSliceImpl(DimsVector begins, DimsVector strides, DimsVector dims_o
     }
 }
 
+template <typename VEC, int pack>
+X86ComputeKernels CreateX86ComputeKernels() {
+    X86ComputeKernels kernels;
+    kernels.pack              = pack;
+    kernels.max_pooling       = X86MaxPooling<VEC, pack>;
+    kernels.avg_pooling       = X86AvgPooling<VEC, pack>;
+    kernels.fma               = X86_FMA<VEC, pack>;
+    kernels.fma_blocked       = X86_FMA_Blocked<VEC, pack>;
+    kernels.group_norm_fma    = X86_GroupNorm_FMA<VEC, pack>;
+    kernels.depthwise_conv[0] = DepthwiseConv<ActivationType_None, VEC, pack>;
+    kernels.depthwise_conv[1] = DepthwiseConv<ActivationType_ReLU, VEC, pack>;
+    kernels.depthwise_conv[2] = DepthwiseConv<ActivationType_ReLU6, VEC, pack>;
+    kernels.depthwise_conv[3] = DepthwiseConv<ActivationType_SIGMOID_MUL, VEC, pack>;
+    kernels.depthwise_conv[4] = DepthwiseConv<ActivationType_HARDSWISH, VEC, pack>;
+    kernels.post_exec[0]      = X86_Post_Exec<ActivationType_None, VEC, pack>;
+    kernels.post_exec[1]      = X86_Post_Exec<ActivationType_ReLU, VEC, pack>;
+    kernels.post_exec[2]      = X86_Post_Exec<ActivationType_ReLU6, VEC, pack>;
+    kernels.post_exec[3]      = X86_Post_Exec<ActivationType_SIGMOID_MUL, VEC, pack>;
+    kernels.post_exec[4]      = X86_Post_Exec<ActivationType_HARDSWISH, VEC, pack>;
+    kernels.conv_blocked[0]   = X86ConvBlocked<ActivationType_None, VEC, pack>;
+    kernels.conv_blocked[1]   = X86ConvBlocked<ActivationType_ReLU, VEC, pack>;
+    kernels.conv_blocked[2]   = X86ConvBlocked<ActivationType_ReLU6, VEC, pack>;
+    kernels.conv_blocked[3]   = X86ConvBlocked<ActivationType_SIGMOID_MUL, VEC, pack>;
+    kernels.conv_blocked[4]   = X86ConvBlocked<ActivationType_HARDSWISH, VEC, pack>;
+    kernels.sgemv             = X86Sgemv<VEC, pack>;
+    kernels.vector_add        = X86_VectorAdd<VEC, pack>;
+    return kernels;
+}
+
+#ifdef TNN_X86_COMPUTE_AVX2
+X86ComputeKernels CreateAvx2ComputeKernels() {
+    return CreateX86ComputeKernels<Float8, 8>();
 }
+
+}  // namespace X86_COMPUTE_NAMESPACE
+#else
+
+#ifdef TNN_X86_FAT_BINARY
+namespace x86_avx2 {
+X86ComputeKernels CreateAvx2ComputeKernels();
+}  // namespace x86_avx2
+#endif
+
+// the avx2 table is only created once an avx2 cpu asks for it, creating it runs avx2 code in fat binaries
+const X86ComputeKernels &GetX86ComputeKernels(x86_isa_t arch) {
+    if (arch == avx2) {
+#ifdef TNN_X86_FAT_BINARY
+        static const X86ComputeKernels avx_kernels = x86_avx2::CreateAvx2ComputeKernels();
+#else
+        static const X86ComputeKernels avx_kernels = CreateX86ComputeKernels<Float8, 8>();
+#endif
+        return avx_kernels;
+    }
+    static const X86ComputeKernels sse_kernels = CreateX86ComputeKernels<Float4, 4>();
+    return sse_kernels;
+}
+#endif
+
+}  // namespace TNN_NS
@@ -19,10 +19,21 @@
 #include "tnn/core/blob.h"
 #include "tnn/core/status.h"
 #include "tnn/device/x86/acc/x86_reduce_op_layer_acc.h"
+#include "tnn/device/x86/acc/x86_binary_op_layer_acc.h"
 #include "tnn/utils/dims_utils.h"
 #include "tnn/interpreter/layer_param.h"
 #include "tnn/device/x86/acc/Float4.h"
 #include "tnn/device/x86/acc/Float8.h"
+#include "tnn/device/x86/acc/compute/x86_activation.h"
+#include "tnn/device/x86/acc/compute/jit/utils/cpu_isa.h"
+
+// with TNN_X86_FAT_BINARY the files of simd kernels are built once more for each isa, those builds put their kernels
+// in a namespace of the isa and the sse4.2 build fills the kernel tables from them.
+#if defined(TNN_X86_COMPUTE_AVX512)
+#define X86_COMPUTE_NAMESPACE x86_avx512
+#elif defined(TNN_X86_COMPUTE_AVX2)
+#define X86_COMPUTE_NAMESPACE x86_avx2
+#endif
 
 namespace TNN_NS {
 
@@ -59,6 +70,16 @@ template <class T, int pack_c>
 Status X86_FMA(float *input, float *output, float *scale, float *bias,
                bool shared_channel, bool has_bias, DimsVector output_dim);
 
+// @brief X86_FMA on the blocked layout of pack_c channels
+template <class T, int pack_c>
+Status X86_FMA_Blocked(float *input, float *output, float *scale, float *bias,
+                       bool shared_channel, bool has_bias, DimsVector output_dim);
+
+// @brief direct conv of one output row of one output channel block in the blocked layout
+template <int activation_type, typename VEC, int pack>
+void X86ConvBlocked(float *dst, const float *src, const float *weight, const float *bias, long ow, long ic_blocks,
+                    long src_c_step, long kw, long kh, long src_w_step, long dilate_x_step, long dilate_y_step);
+
 template <int activation_type, typename VEC, int pack>
 void DepthwiseConv(float* dst, const float* src, const float* weight, const float* bias, long width, long src_w_step, long fw, long fh,
                    long dilate_x_step, long dilate_y_step, long height, long srcHStep, long dstHStep);
@@ -85,7 +106,89 @@ Status X86_GroupNorm_FMA(
     float *scale_data, float *bias_data,
     int group, float epsilon,
     int batch_time_group, int channels_per_group, int channel_area, int group_area);
-    
+
+// @brief simd kernels of one vector width, layer accs take them by arch_ instead of naming Float8 or Float4.
+// with TNN_X86_FAT_BINARY the avx2 ones are built in a separate object with avx2 and fma, the rest of the accs are
+// built for sse4.2, so one library runs on any sse4.2 cpu and uses avx2 when the cpu has it.
+struct X86ComputeKernels {
+    int pack = 4;
+    void (*max_pooling)(const float *src, long iw, long ih, float *dst, long ow, long oh, long kw, long kh,
+                        long stride_w, long stride_h, long pad_w, long pad_h, long l, long r, long t, long b);
+    void (*avg_pooling)(const float *src, long iw, long ih, float *dst, long ow, long oh, long kw, long kh,
+                        long stride_w, long stride_h, long pad_w, long pad_h);
+    Status (*fma)(float *input, float *output, float *scale, float *bias, bool shared_channel, bool has_bias,
+                  DimsVector output_dim);
+    Status (*fma_blocked)(float *input, float *output, float *scale, float *bias, bool shared_channel,
+                          bool has_bias, DimsVector output_dim);
+    Status (*group_norm_fma)(float *input_data, float *output_data, float *scale_data, float *bias_data, int group,
+                             float epsilon, int batch_time_group, int channels_per_group, int channel_area,
+                             int group_area);
+    // indexed by X86ActivationIndex
+    void (*depthwise_conv[X86_FUSED_ACTIVATION_COUNT])(float *dst, const float *src, const float *weight,
+                                                       const float *bias, long width, long src_w_step, long fw,
+                                                       long fh, long dilate_x_step, long dilate_y_step, long height,
+                                                       long srcHStep, long dstHStep);
+    void (*post_exec[X86_FUSED_ACTIVATION_COUNT])(float *dst, const float *bias, long channel, long area);
+    void (*conv_blocked[X86_FUSED_ACTIVATION_COUNT])(float *dst, const float *src, const float *weight,
+                                                     const float *bias, long ow, long ic_blocks, long src_c_step,
+                                                     long kw, long kh, long src_w_step, long dilate_x_step,
+                                                     long dilate_y_step);
+    void (*sgemv)(float *dst, const float *src, const float *weight, float *bias, DimsVector dims_input,
+                  DimsVector dims_output);
+    void (*vector_add)(float *dst, const float *src, long len);
+};
+
+// @brief Float8 kernels for avx2, Float4 kernels for sse42
+const X86ComputeKernels &GetX86ComputeKernels(x86_isa_t arch);
+
+typedef void (*unary2_kernel_func_t)(std::vector<int> dims, const float *src, float *dst, LayerParam *param);
+
+// @brief simd kernels on plain nchw data, they do not depend on the blocked layout of the accs, so fat binaries run
+// them with the widest vector of the cpu.
+struct X86ElementwiseKernels {
+    // indexed by X86BinaryOpType
+    binary_func_t binary[X86_BINARY_OP_COUNT];
+    void (*softmax)(float *input, float *output, int channel, int count, void *workspace);
+    void (*layer_norm)(float *input, float *output, int channels, int area, const float *k_data, const float *b_data,
+                       float ep);
+    // k_data and b_data hold one value per channel, b_data may be nullptr
+    void (*instance_norm)(float *input, float *output, int batch, int channels, int area, const float *k_data,
+                          const float *b_data, float ep);
+    void (*prelu)(float *input, float *output, const float *slope, DimsVector dims, bool is_channel_shared);
+    // input1 has the dims of input0, or one value per channel if their dims[2] differ
+    void (*hard_swish)(float *output, const float *input0, const float *input1, DimsVector dims0, DimsVector dims1,
+                       float alpha, float beta);
+    // kernel of the unary layer type, nullptr if the type has none
+    unary2_kernel_func_t (*unary2)(LayerType type);
+};
+
+// @brief isa of the elementwise kernels for accs running with arch, avx512 on avx512 cpus in fat binaries
+x86_isa_t X86ElementwiseArch(x86_isa_t arch);
+
+// @brief Float16 kernels for avx512, Float8 kernels for avx2, Float4 kernels for sse42, picked by
+// X86ElementwiseArch(arch)
+const X86ElementwiseKernels &GetX86ElementwiseKernels(x86_isa_t arch);
+
+// @brief kernels of the winograd 3x3 conv on channel blocks of pack
+struct X86WinogradKernels {
+    int pack = 4;
+    void (*pack_input)(const float *din, float *dout, int cs, int hs, int he, int ws, int we, int channel, int width,
+                       int height, float *zero_ptr);
+    void (*pack_input_blocked)(const float *din, float *dout, int cs, int hs, int he, int ws, int we, int channel,
+                               int width, int height, float *zero_ptr);
+    void (*unpack_output)(const float *din, float *dout, int cs, int ce, int hs, int he, int ws, int we, int channel,
+                          int height, int width, bool flag_relu, float *trash_ptr);
+    void (*gemm)(float *dst, float *src, const float *weight, const float *bias, int ic_8, int oc_8, int width);
+    // indexed by dst_unit / 2 - 1 of F(2x2,3x3), F(4x4,3x3) and F(6x6,3x3)
+    void (*input_trans[3])(const float *src, int src_stride, int src_h_stride, float *dest, int dest_stride,
+                           int dest_h_stride);
+    void (*output_trans[3])(const float *src, int src_stride, int src_h_stride, float *dest, int dest_stride,
+                            int dest_h_stride, const float *bias_value, int relu_type);
+};
+
+// @brief Float8 kernels for avx2, Float4 kernels for sse42
+const X86WinogradKernels &GetX86WinogradKernels(x86_isa_t arch);
+
 }   // namespace TNN_NS
 
 #endif
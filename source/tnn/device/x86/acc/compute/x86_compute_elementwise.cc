@@ -0,0 +1,953 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include "tnn/device/x86/acc/compute/x86_compute.h"
+#include "tnn/device/x86/acc/Float16.h"
+#include "tnn/device/x86/acc/Float4.h"
+#include "tnn/device/x86/acc/Float8.h"
+#include "tnn/utils/dims_utils.h"
+#include "tnn/utils/omp_utils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace TNN_NS {
+
+#ifdef X86_COMPUTE_NAMESPACE
+// the avx2 and avx512 builds of this file in fat binaries, keep their symbols apart from the sse4.2 build
+namespace X86_COMPUTE_NAMESPACE {
+#endif
+
+template <X86BinaryOpType type>
+static inline float binary_op(const float &a, const float &b) {
+    switch (type) {
+        case X86BinaryOpType::kADD:
+            return a + b;
+        case X86BinaryOpType::kSUB:
+            return a - b;
+        case X86BinaryOpType::kMUL:
+            return a * b;
+        case X86BinaryOpType::kDIV:
+            return a / b;
+        case X86BinaryOpType::kMAX:
+            return a > b ? a : b;
+        case X86BinaryOpType::kMIN:
+            return a < b ? a : b;
+        default:
+            return a;
+    }
+}
+
+template <X86BinaryOpType type, typename VEC>
+static inline VEC binary_op(const VEC &a, const VEC &b) {
+    switch (type) {
+        case X86BinaryOpType::kADD:
+            return VEC::add(a, b);
+        case X86BinaryOpType::kSUB:
+            return VEC::sub(a, b);
+        case X86BinaryOpType::kMUL:
+            return VEC::mul(a, b);
+        case X86BinaryOpType::kDIV:
+            return VEC::div(a, b);
+        case X86BinaryOpType::kMAX:
+            return VEC::max(a, b);
+        case X86BinaryOpType::kMIN:
+            return VEC::min(a, b);
+        default:
+            return a;
+    }
+}
+
+static void BroadCastInit(const DimsVector &dims, const DimsVector &dims0, const DimsVector &dims1, BroadcastType &type,
+                          DimsVector &dims_broadcast, bool &swap_flag) {
+    if (DimsVectorUtils::Equal(dims0, dims1)) {
+        type = BroadcastTypeNormal;
+        dims_broadcast.clear();
+    } else if (DimsVectorUtils::Equal(dims0, dims1, 1) &&
+              (DimsVectorUtils::Count(dims0, 0, 1) == 1 ||
+               DimsVectorUtils::Count(dims1, 0, 1) == 1)) {
+        type = BroadcastTypeElement;
+        dims_broadcast.clear();
+        if (dims0[0] < dims1[0])
+            swap_flag = true;
+    } else if (DimsVectorUtils::Equal(dims0, dims1, 2) &&
+              (DimsVectorUtils::Count(dims0, 0, 2) == 1 ||
+               DimsVectorUtils::Count(dims1, 0, 2) == 1)) {
+        type = BroadcastTypeHeightWidth;
+        dims_broadcast.clear();
+        if (dims0[1] < dims1[1])
+            swap_flag = true;
+    } else if (DimsVectorUtils::Equal(dims0, dims1, 3) &&
+              (DimsVectorUtils::Count(dims0, 0, 3) == 1 ||
+               DimsVectorUtils::Count(dims1, 0, 3) == 1)) {
+        type = BroadcastTypeWidth;
+        dims_broadcast.clear();
+        if (dims0[1] < dims1[1])
+            swap_flag = true;
+    } else if (DimsVectorUtils::Equal(dims0, dims)) {
+        dims_broadcast = dims1;
+    } else {
+        dims_broadcast = dims0;
+        swap_flag      = true;
+    }
+}
+
+/*
+Binary func with different opreator,
+set dims0 full shape, dims1 broadcast shape, so we need to swap input ptrs
+*/
+template <X86BinaryOpType op_type, typename VEC, int pack>
+static Status BinaryFunc(float *output_ptr, const float *input0_ptr, const float *input1_ptr, DimsVector &dims0,
+                         DimsVector &dims1, DimsVector &output_dims) {
+    DimsVector dims = DimsVectorUtils::Max(dims0, dims1);
+    DimsVector dims_broadcast;
+    BroadcastType type = BroadcastTypeUnknown;
+    auto _input0       = input0_ptr;
+    auto _input1       = input1_ptr;
+    bool swap_flag     = false;
+
+    BroadCastInit(dims, dims0, dims1, type, dims_broadcast, swap_flag);
+
+    if (swap_flag) {
+        std::swap(_input0, _input1);
+    }
+
+    if (dims_broadcast.size() == 1) {
+        type = BroadcastTypeSingle; // dims_broadcast[0] == 1
+    } else if (dims_broadcast.size() >= 2) {
+        type = (dims_broadcast[1] == 1) ? BroadcastTypeSingle : BroadcastTypeChannel;
+    }
+
+    size_t count = DimsVectorUtils::Count(dims);
+    size_t batch_stride = 1;
+    size_t channel_stride = 1;
+    if (dims.size() > 1) {
+        batch_stride = DimsVectorUtils::Count(dims, 1);
+    }
+    if (dims.size() > 2) {
+        channel_stride = DimsVectorUtils::Count(dims, 2);
+    }
+
+    if (type == BroadcastTypeNormal) {
+        size_t n = 0;
+        for (; n + pack - 1 < count; n += pack) {
+            VEC v1 = VEC::loadu(_input0 + n);
+            VEC v2 = VEC::loadu(_input1 + n);
+            VEC::saveu(output_ptr + n, binary_op<op_type, VEC>(v1, v2));
+        }
+        for (; n < count; n++) {
+            output_ptr[n] = binary_op<op_type>(_input0[n], _input1[n]);
+        }
+        return TNN_OK;
+    }
+
+    if (swap_flag) {
+        if (type == BroadcastTypeSingle) {
+            // broadcast single
+            VEC v2 = VEC(_input1[0]);
+            size_t n = 0;
+            for (; n + pack - 1 < count; n += pack) {
+                VEC v1 = VEC::loadu(_input0 + n);
+                VEC::saveu(output_ptr + n, binary_op<op_type, VEC>(v2, v1));
+            }
+            for (; n < count; n++) {
+                output_ptr[n] = binary_op<op_type>(_input1[0], _input0[n]);
+            }
+        } else if (type == BroadcastTypeChannel) {
+            // broadcast channel
+            for (int b = 0; b < dims[0]; b++) {
+                for (int c = 0; c < dims[1]; c++) {
+                    VEC v2 = VEC(_input1[c]);
+                    auto _input0_c = _input0 + b * batch_stride + c * channel_stride;
+                    auto _output_c = output_ptr + b * batch_stride + c * channel_stride;
+                    int hw = 0;
+                    for (; hw + pack - 1 < channel_stride; hw += pack) {
+                        VEC v1 = VEC::loadu(_input0_c + hw);
+                        VEC::saveu(_output_c + hw, binary_op<op_type, VEC>(v2, v1));
+                    }
+                    for (; hw < channel_stride; hw++) {
+                        _output_c[hw] = binary_op<op_type>(_input1[c], _input0_c[hw]);
+                    }
+                }
+            }
+        } else if (type == BroadcastTypeElement) {
+            // broadcast chw
+            for (int b = 0; b < dims[0]; b++) {
+                auto _input0_b = _input0 + b * batch_stride;
+                auto _output_b = output_ptr + b * batch_stride;
+                int chw = 0;
+                for (; chw + pack - 1 < batch_stride; chw += pack) {
+                    VEC v2 = VEC::loadu(_input1 + chw);
+                    VEC v1 = VEC::loadu(_input0_b + chw);
+                    VEC::saveu(_output_b + chw, binary_op<op_type, VEC>(v2, v1));
+                }
+                for (; chw < batch_stride; chw++) {
+                    _output_b[chw] = binary_op<op_type>(_input1[chw], _input0_b[chw]);
+                }
+            }
+        } else if (type == BroadcastTypeHeightWidth) {
+            // broadcast hw
+            for (int b = 0; b < dims[0]; b++) {
+                for (int c = 0; c < dims[1]; c++) {
+                    auto _input0_c = _input0 + b * batch_stride + c * channel_stride;
+                    auto _output_c = output_ptr + b * batch_stride + c * channel_stride;
+                    int hw = 0;
+                    for (; hw + pack - 1 < channel_stride; hw += pack) {
+                        VEC v2 = VEC::loadu(_input1 + hw);
+                        VEC v1 = VEC::loadu(_input0_c + hw);
+                        VEC::saveu(_output_c + hw, binary_op<op_type, VEC>(v2, v1));
+                    }
+                    for (; hw < channel_stride; hw++) {
+                        _output_c[hw] = binary_op<op_type>(_input1[hw], _input0_c[hw]);
+                    }
+                }
+            }
+        } else if (type == BroadcastTypeWidth) {
+            // broadcast w
+            for (int b = 0; b < dims[0]; b++) {
+                for (int c = 0; c < dims[1]; c++) {
+                    auto _input0_c = _input0 + b * batch_stride + c * channel_stride;
+                    auto _output_c = output_ptr + b * batch_stride + c * channel_stride;
+                    for (int h = 0; h < dims[2]; h++) {
+                        auto _input0_h = _input0_c + h * dims[3];
+                        auto _output_h = _output_c + h * dims[3];
+                        int w = 0;
+                        for (; w + pack - 1 < dims[3]; w += pack) {
+                            VEC v2 = VEC::loadu(_input1 + w);
+                            VEC v1 = VEC::loadu(_input0_h + w);
+                            VEC::saveu(_output_h + w, binary_op<op_type, VEC>(v2, v1));
+                        }
+                        for (; w < dims[3]; w++) {
+                            _output_h[w] = binary_op<op_type>(_input1[w], _input0_h[w]);
+                        }
+                    }
+                }
+            }
+        } else {
+            LOGE("Error: invalid add type\n");
+            return Status(TNNERR_LAYER_ERR, "Error: Binary layer's unsupported broadcast type");
+        }
+    } else {
+        if (type == BroadcastTypeSingle) {
+            // broadcast single
+            VEC v2 = VEC(_input1[0]);
+            size_t n = 0;
+            for (; n + pack - 1 < count; n += pack) {
+                VEC v1 = VEC::loadu(_input0 + n);
+                VEC::saveu(output_ptr + n, binary_op<op_type, VEC>(v1, v2));
+            }
+            for (; n < count; n++) {
+                output_ptr[n] = binary_op<op_type>(_input0[n], _input1[0]);
+            }
+        } else if (type == BroadcastTypeChannel) {
+            // broadcast channel
+            for (int b = 0; b < dims[0]; b++) {
+                for (int c = 0; c < dims[1]; c++) {
+                    VEC v2 = VEC(_input1[c]);
+                    auto _input0_c = _input0 + b * batch_stride + c * channel_stride;
+                    auto _output_c = output_ptr + b * batch_stride + c * channel_stride;
+                    int hw = 0;
+                    for (; hw + pack - 1 < channel_stride; hw += pack) {
+                        VEC v1 = VEC::loadu(_input0_c + hw);
+                        VEC::saveu(_output_c + hw, binary_op<op_type, VEC>(v1, v2));
+                    }
+                    for (; hw < channel_stride; hw++) {
+                        _output_c[hw] = binary_op<op_type>(_input0_c[hw], _input1[c]);
+                    }
+                }
+            }
+        } else if (type == BroadcastTypeElement) {
+            // broadcast chw
+            for (int b = 0; b < dims[0]; b++) {
+                auto _input0_b = _input0 + b * batch_stride;
+                auto _output_b = output_ptr + b * batch_stride;
+                int chw = 0;
+                for (; chw + pack - 1 < batch_stride; chw += pack) {
+                    VEC v2 = VEC::loadu(_input1 + chw);
+                    VEC v1 = VEC::loadu(_input0_b + chw);
+                    VEC::saveu(_output_b + chw, binary_op<op_type, VEC>(v1, v2));
+                }
+                for (; chw < batch_stride; chw++) {
+                    _output_b[chw] = binary_op<op_type>(_input0_b[chw], _input1[chw]);
+                }
+            }
+        } else if (type == BroadcastTypeHeightWidth) {
+            // broadcast hw
+            for (int b = 0; b < dims[0]; b++) {
+                for (int c = 0; c < dims[1]; c++) {
+                    auto _input0_c = _input0 + b * batch_stride + c * channel_stride;
+                    auto _output_c = output_ptr + b * batch_stride + c * channel_stride;
+                    int hw = 0;
+                    for (; hw + pack - 1 < channel_stride; hw += pack) {
+                        VEC v2 = VEC::loadu(_input1 + hw);
+                        VEC v1 = VEC::loadu(_input0_c + hw);
+                        VEC::saveu(_output_c + hw, binary_op<op_type, VEC>(v1, v2));
+                    }
+                    for (; hw < channel_stride; hw++) {
+                        _output_c[hw] = binary_op<op_type>(_input0_c[hw], _input1[hw]);
+                    }
+                }
+            }
+        } else if (type == BroadcastTypeWidth) {
+            // broadcast w
+            for (int b = 0; b < dims[0]; b++) {
+                for (int c = 0; c < dims[1]; c++) {
+                    auto _input0_c = _input0 + b * batch_stride + c * channel_stride;
+                    auto _output_c = output_ptr + b * batch_stride + c * channel_stride;
+                    for (int h = 0; h < dims[2]; h++) {
+                        auto _input0_h = _input0_c + h * dims[3];
+                        auto _output_h = _output_c + h * dims[3];
+                        int w = 0;
+                        for (; w + pack - 1 < dims[3]; w += pack) {
+                            VEC v2 = VEC::loadu(_input1 + w);
+                            VEC v1 = VEC::loadu(_input0_h + w);
+                            VEC::saveu(_output_h + w, binary_op<op_type, VEC>(v1, v2));
+                        }
+                        for (; w < dims[3]; w++) {
+                            _output_h[w] = binary_op<op_type>(_input0_h[w], _input1[w]);
+                        }
+                    }
+                }
+            }
+        } else {
+            LOGE("Error: invalid add type\n");
+            return Status(TNNERR_LAYER_ERR, "Error: Binary layer's unsupported broadcast type");
+        }
+    }
+
+    return TNN_OK;
+}
+
+template <typename VEC, int pack>
+static void softmax_channel_func(float *input_ptr, float *output_ptr, int channel, int count, void *workspace) {
+    float *temp = reinterpret_cast<float *>(workspace);
+
+    temp[0] = input_ptr[0];
+    // max
+    int ele    = 0;
+    auto v_max = VEC(temp[0]);
+    float vec_buf[pack];
+    for (; ele + pack - 1 < channel; ele += pack) {
+        v_max = VEC::max(v_max, VEC::loadu(input_ptr + ele));
+    }
+    for (; ele < channel; ele++) {
+        temp[0] = std::max(temp[0], input_ptr[ele]);
+    }
+    VEC::saveu(vec_buf, v_max);
+    for (int i = 0; i < pack; i++) {
+        temp[0] = std::max(temp[0], vec_buf[i]);
+    }
+
+    // exp
+    ele = 0;
+    for (; ele + pack - 1 < channel; ele += pack) {
+        VEC::saveu(output_ptr + ele, VEC::exp(VEC::loadu(input_ptr + ele) - VEC(temp[0])));
+    }
+    for (; ele < channel; ele++) {
+        output_ptr[ele] = expf(input_ptr[ele] - temp[0]);
+    }
+
+    // sum
+    temp[0]    = 0.f;
+    auto v_sum = VEC(0.f);
+    ele        = 0;
+    for (; ele + pack - 1 < channel; ele += pack) {
+        v_sum = v_sum + VEC::loadu(output_ptr + ele);
+    }
+    for (; ele < channel; ele++) {
+        temp[0] += output_ptr[ele];
+    }
+    VEC::saveu(vec_buf, v_sum);
+    for (int i = 0; i < pack; i++) {
+        temp[0] += vec_buf[i];
+    }
+
+    // division
+    temp[0] = 1.f / temp[0];
+
+    //
+    ele = 0;
+    for (; ele + pack - 1 < channel; ele += pack) {
+        VEC::saveu(output_ptr + ele, VEC::loadu(output_ptr + ele) * temp[0]);
+    }
+    for (; ele < channel; ele++) {
+        output_ptr[ele] *= temp[0];
+    }
+}
+
+template <typename VEC, int pack>
+static void softmax_func(float *input_ptr, float *output_ptr, int channel, int count, void *workspace) {
+    if (count == 1) {
+        return softmax_channel_func<VEC, pack>(input_ptr, output_ptr, channel, count, workspace);
+    }
+
+    float *temp = reinterpret_cast<float *>(workspace);
+    // max
+    memcpy(temp, input_ptr, count * sizeof(float));
+    for (int c = 1; c < channel; c++) {
+        float *input_channel = input_ptr + c * count;
+        int ele              = 0;
+        for (; ele + pack - 1 < count; ele += pack) {
+            VEC::saveu(temp + ele, VEC::max(VEC::loadu(temp + ele), VEC::loadu(input_channel + ele)));
+        }
+        for (; ele < count; ele++) {
+            temp[ele] = std::max(temp[ele], input_channel[ele]);
+        }
+    }
+
+    // exp
+    for (int c = 0; c < channel; c++) {
+        float *input_channel  = input_ptr + c * count;
+        float *output_channel = output_ptr + c * count;
+
+        int ele = 0;
+        for (; ele + pack - 1 < count; ele += pack) {
+            VEC::saveu(output_channel + ele, VEC::exp(VEC::loadu(input_channel + ele) - VEC::loadu(temp + ele)));
+        }
+        for (; ele < count; ele++) {
+            output_channel[ele] = expf(input_channel[ele] - temp[ele]);
+        }
+    }
+
+    // sum
+    memcpy(temp, output_ptr, count * sizeof(float));
+    for (int c = 1; c < channel; c++) {
+        float *output_channel = output_ptr + c * count;
+        int ele               = 0;
+        for (; ele + pack - 1 < count; ele += pack) {
+            VEC::saveu(temp + ele, VEC::loadu(temp + ele) + VEC::loadu(output_channel + ele));
+        }
+        for (; ele < count; ele++) {
+            temp[ele] += output_channel[ele];
+        }
+    }
+
+    // division
+    int ele = 0;
+    for (; ele + pack - 1 < count; ele += pack) {
+        VEC::saveu(temp + ele, VEC::div(VEC(1.f), VEC::loadu(temp + ele)));
+    }
+    for (; ele < count; ele++) {
+        temp[ele] = 1.0f / temp[ele];
+    }
+
+    for (int c = 0; c < channel; c++) {
+        float *output_channel = output_ptr + c * count;
+        int ele               = 0;
+        for (; ele + pack - 1 < count; ele += pack) {
+            VEC::saveu(output_channel + ele, VEC::loadu(temp + ele) * VEC::loadu(output_channel + ele));
+        }
+        for (; ele < count; ele++) {
+            output_channel[ele] *= temp[ele];
+        }
+    }
+}
+
+// @brief mean and 1 / sqrt(variance + ep) of area values
+template <typename VEC, int pack>
+static void norm_moments(const float *input_data, int area, float ep, float &mean, float &inv_std) {
+    VEC v_sum_x  = VEC(0.f);
+    VEC v_sum_x2 = VEC(0.f);
+    VEC v_temp   = VEC(0.f);
+    float buffer[pack];
+    const int tail = area - area % pack;
+    double var;
+
+    for (int i = 0; i < tail; i += pack) {
+        v_temp  = VEC::loadu(input_data + i);
+        v_sum_x = VEC::add(v_sum_x, v_temp);
+        VEC::mla(v_sum_x2, v_temp, v_temp);
+    }
+
+    float sum_x = 0.f, sum_x2 = 0.f;
+    VEC::saveu(buffer, v_sum_x);
+    for (int i = 0; i < pack; i++)
+        sum_x += buffer[i];
+    VEC::saveu(buffer, v_sum_x2);
+    for (int i = 0; i < pack; i++)
+        sum_x2 += buffer[i];
+    for (int i = tail; i < area; i++) {
+        var = input_data[i];
+        sum_x += var;
+        sum_x2 += var * var;
+    }
+
+    auto mean_x    = sum_x / area;
+    auto mean_x2   = sum_x2 / area;
+    float variance = mean_x2 - mean_x * mean_x;
+    variance       = variance > 0 ? variance : 0;
+    mean           = mean_x;
+    inv_std        = 1.0f / sqrt(variance + ep);
+}
+
+template <typename VEC, int pack>
+static void norm_func(float *input, float *output, int channels, int area, const float *k_data, const float *b_data,
+                      float ep) {
+    float *input_data  = input;
+    float *output_data = output;
+    for (int c = 0; c < channels; c++) {
+        // step 1: calc varience
+        float mean_x, variance;
+        norm_moments<VEC, pack>(input_data, area, ep, mean_x, variance);
+        const int tail = area - area % pack;
+
+        // step2: normlization
+        VEC v_variance = VEC(&variance);
+        VEC v_mean     = VEC(&mean_x);
+        for (int i = 0; i < tail; i += pack, input_data += pack, output_data += pack) {
+            VEC v_scale = VEC::loadu(k_data + i);
+            VEC v_bias  = VEC::loadu(b_data + i);
+            VEC v_data  = VEC::loadu(input_data);
+
+            v_scale = VEC::mul(v_variance, v_scale);  // var * k
+            v_bias  = VEC::sub(v_bias, VEC::mul(v_scale, v_mean));
+
+            VEC::mla(v_bias, v_data, v_scale);
+            VEC::saveu(output_data, v_bias);
+        }
+
+        for (int i = tail; i < area; i++, output_data++, input_data++) {
+            float b      = b_data[i] - variance * mean_x * k_data[i];
+            *output_data = (*input_data) * variance * k_data[i] + b;
+        }
+    }
+}
+
+template <typename VEC, int pack>
+static void instance_norm_func(float *input, float *output, int batch, int channels, int area, const float *k_data,
+                               const float *b_data, float ep) {
+    for (int b = 0; b < batch; b++) {
+        for (int c = 0; c < channels; c++) {
+            float *input_data  = input + (b * channels + c) * area;
+            float *output_data = output + (b * channels + c) * area;
+
+            float mean_x, variance;
+            norm_moments<VEC, pack>(input_data, area, ep, mean_x, variance);
+            variance *= k_data[c];
+            float bias = b_data == nullptr ? 0.0f : b_data[c];
+            bias -= mean_x * variance;
+
+            VEC v_scale = VEC(variance);
+            VEC v_bias  = VEC(bias);
+            int i       = 0;
+            for (; i + pack - 1 < area; i += pack) {
+                VEC v_data = v_bias;
+                VEC::mla(v_data, VEC::loadu(input_data + i), v_scale);
+                VEC::saveu(output_data + i, v_data);
+            }
+            for (; i < area; i++) {
+                output_data[i] = input_data[i] * variance + bias;
+            }
+        }
+    }
+}
+
+template <typename VEC, int pack>
+static void prelu_func(float *input, float *output, const float *slope, DimsVector dims, bool is_channel_shared) {
+    auto plane = DimsVectorUtils::Count(dims, 2);
+
+    for (int b = 0; b < dims[0]; b++) {
+        for (int c = 0; c < dims[1]; c++) {
+            float coef    = is_channel_shared ? slope[0] : slope[c];
+            auto input_c  = input + b * DimsVectorUtils::Count(dims, 1) + c * plane;
+            auto output_c = output + b * DimsVectorUtils::Count(dims, 1) + c * plane;
+            int i         = 0;
+            VEC v_zero(0.f);
+            VEC v_slope(coef);
+            for (; i + pack - 1 < plane; i += pack) {
+                VEC v_data = VEC::loadu(input_c + i);
+                VEC v_res  = VEC::bsl_clt(v_data, v_zero, v_data * v_slope, v_data);
+                VEC::saveu(output_c + i, v_res);
+            }
+
+            if (i > 0 && i < plane) {
+                i = plane - pack;
+                VEC v_data = VEC::loadu(input_c + i);
+                VEC v_res  = VEC::bsl_clt(v_data, v_zero, v_data * v_slope, v_data);
+                VEC::saveu(output_c + i, v_res);
+                i = plane;
+            }
+
+            for (; i < plane; i++) {
+                if (input_c[i] < 0) {
+                    output_c[i] = input_c[i] * coef;
+                } else {
+                    output_c[i] = input_c[i];
+                }
+            }
+        }
+    }
+}
+
+template <typename VEC, int pack>
+static void hard_swish_func(float *output, const float *input0, const float *input1, DimsVector dims0,
+                            DimsVector dims1, float alpha, float beta) {
+    const int batch        = dims0[0];
+    const int channel      = dims0.size() > 1 ? dims0[1] : 1;
+    const int channel_size = dims0.size() > 2 ? DimsVectorUtils::Count(dims0, 2) : 1;
+    const bool broadcast   = dims0.size() > 2 && !(dims1.size() > 2 && dims0[2] == dims1[2]);
+
+    const VEC v_alpha(alpha);
+    const VEC v_beta(beta);
+    const VEC v_zero(0.f);
+    const VEC v_one(1.f);
+
+    if (!broadcast) {
+        const int count = batch * channel * channel_size;
+        int i           = 0;
+        for (; i + pack - 1 < count; i += pack) {
+            VEC v_gate = v_beta;
+            VEC::mla(v_gate, VEC::loadu(input1 + i), v_alpha);
+            v_gate = VEC::max(VEC::min(v_gate, v_one), v_zero);
+            VEC::saveu(output + i, VEC::loadu(input0 + i) * v_gate);
+        }
+        for (; i < count; i++) {
+            float gate = std::max(std::min(input1[i] * alpha + beta, 1.f), 0.f);
+            output[i]  = input0[i] * gate;
+        }
+        return;
+    }
+
+    // input1 holds one value of each channel
+    for (int bc = 0; bc < batch * channel; bc++) {
+        const float gate   = std::max(std::min(input1[bc] * alpha + beta, 1.f), 0.f);
+        const VEC v_gate   = VEC(gate);
+        const float *src   = input0 + bc * channel_size;
+        float *dst         = output + bc * channel_size;
+        int i              = 0;
+        for (; i + pack - 1 < channel_size; i += pack) {
+            VEC::saveu(dst + i, VEC::loadu(src + i) * v_gate);
+        }
+        for (; i < channel_size; i++) {
+            dst[i] = src[i] * gate;
+        }
+    }
+}
+
+typedef struct x86_unary2_operator {
+public:
+    Status Init(LayerParam *param = nullptr) {
+        param_ = param;
+        return TNN_OK;
+    }
+
+protected:
+    LayerParam *param_ = nullptr;
+} X86_UNARY2_OP;
+
+typedef struct x86_abs_operator : x86_unary2_operator {
+    float operator()(const float v) {
+        return fabs(v);
+    }
+
+    template <typename VEC>
+    VEC operator()(const VEC &v) {
+        return VEC::abs(v);
+    }
+} X86_ABS_OP;
+
+typedef struct x86_exp_operator : x86_unary2_operator {
+    float operator()(const float v) {
+        return exp(v);
+    }
+
+    template <typename VEC>
+    VEC operator()(const VEC &v) {
+        return VEC::exp(v);
+    }
+} X86_EXP_OP;
+
+template <typename VEC>
+static VEC fast_erf_approximation(const VEC x) {
+    auto t = VEC::div(VEC(1.f), VEC(1.f) + VEC(0.5f) * VEC::abs(x));
+    auto t_2 = t * t;
+    auto t_3 = t_2 * t;
+    auto t_4 = t_3 * t;
+    auto t_5 = t_4 * t;
+    auto t_6 = t_5 * t;
+    auto t_7 = t_6 * t;
+    auto t_8 = t_7 * t;
+    auto t_9 = t_8 * t;
+
+    auto v = t * VEC::exp(VEC::neg(x) * x - VEC(1.26551223) +
+                             VEC(1.00002368) * t +
+                             VEC(0.37409196) * t_2 +
+                             VEC(0.09678418) * t_3 -
+                             VEC(0.18628806) * t_4 +
+                             VEC(0.27886807) * t_5 -
+                             VEC(1.13520398) * t_6 +
+                             VEC(1.48851587) * t_7 -
+                             VEC(0.82215223) * t_8 +
+                             VEC(0.17087277) * t_9);
+    auto v_pos = VEC(1.f) - v;
+    auto v_neg = v - VEC(1.f);
+
+    return VEC::bsl_cge(x, VEC(0.f), v_pos, v_neg);
+}
+
+typedef struct x86_gelu_operator : x86_unary2_operator {
+    float operator()(const float v) {
+        return 0.5f * v * (erff(v * 0.707106793288165f) + 1.0f);
+    }
+
+    template <typename VEC>
+    VEC operator()(const VEC &v) {
+        return VEC(0.5f) * v * (fast_erf_approximation<VEC>(v * VEC(0.707106793288165f)) + VEC(1.f));
+    }
+} X86_GELU_OP;
+
+typedef struct x86_log_operator : x86_unary2_operator {
+    float operator()(const float v) {
+        return log(v);
+    }
+
+    template <typename VEC>
+    VEC operator()(const VEC &v) {
+        return VEC::log(v);
+    }
+} X86_LOG_OP;
+
+typedef struct x86_log_sigmoid_operator : x86_unary2_operator {
+    float operator()(const float v) {
+        return log(1.0f / (1.0f + exp(-v)));
+    }
+
+    template <typename VEC>
+    VEC operator()(const VEC &v) {
+        return VEC::log(VEC::sigmoid(v));
+    }
+} X86_LOGSIGMOID_OP;
+
+typedef struct x86_neg_operator : x86_unary2_operator {
+    float operator()(const float v) {
+        return -v;
+    }
+
+    template <typename VEC>
+    VEC operator()(const VEC &v) {
+        return VEC::neg(v);
+    }
+} X86_NEG_OP;
+
+typedef struct x86_relu6_operator : x86_unary2_operator {
+    float operator()(const float v) {
+        float tmp = std::max(v, 0.0f);
+        tmp       = std::min(tmp, 6.0f);
+        return tmp;
+    }
+
+    template <typename VEC>
+    VEC operator()(const VEC &v) {
+        return VEC::min(VEC::max(v, VEC(0.f)), VEC(6.f));
+    }
+} X86_RELU6_OP;
+
+typedef struct x86_relu_operator : x86_unary2_operator {
+    float operator()(const float v) {
+        return std::max(v, 0.0f);
+    }
+
+    template <typename VEC>
+    VEC operator()(const VEC &v) {
+        return VEC::max(v, VEC(0.f));
+    }
+} X86_RELU_OP;
+
+typedef struct x86_sigmoid_operator : x86_unary2_operator {
+    float operator()(const float v) {
+        return 1.0f / (1.0f + exp(-v));
+    }
+
+    template <typename VEC>
+    VEC operator()(const VEC &v) {
+        return VEC::sigmoid(v);
+    }
+} X86_SIGMOID_OP;
+
+typedef struct x86_softplus_operator : x86_unary2_operator {
+    float operator()(const float v) {
+        return log(exp(v) + 1.0f);
+    }
+
+    template <typename VEC>
+    VEC operator()(const VEC &v) {
+        return VEC::log(VEC::exp(v) + VEC(1.0f));
+    }
+} X86_SOFTPLUS_OP;
+
+typedef struct x86_softsign_operator : x86_unary2_operator {
+    float operator()(const float v) {
+        return v / (std::abs(v) + 1.0f);
+    }
+
+    template <typename VEC>
+    VEC operator()(const VEC &v) {
+        return VEC::div(v, (VEC::abs(v) + VEC(1.0f)));
+    }
+} X86_SOFTSIGN_OP;
+
+typedef struct x86_sqrt_operator : x86_unary2_operator {
+    float operator()(const float v) {
+        return sqrt(v);
+    }
+
+    template <typename VEC>
+    VEC operator()(const VEC &v) {
+        return VEC::sqrt(v);
+    }
+} X86_SQRT_OP;
+
+typedef struct x86_tanh_operator : x86_unary2_operator {
+    float operator()(const float v) {
+        return tanh(v);
+    }
+
+    template <typename VEC>
+    VEC operator()(const VEC &v) {
+        return VEC::tanh(v);
+    }
+} X86_TANH_OP;
+
+// elements processed by one parallel task, a multiple of the simd width
+#define UNARY2_BLOCK_SIZE 4096
+
+template <typename UNARY2_OP, typename VEC, int pack>
+static void unary2_kernel(std::vector<int> dims, const float *src, float *dst, LayerParam *param) {
+    UNARY2_OP op;
+    op.Init(param);
+
+    auto count = DimsVectorUtils::Count(dims);
+    auto count_vec = count / pack * pack;
+
+    PARALLEL_FOR_(0, UP_DIV(count_vec, UNARY2_BLOCK_SIZE), [&](long block, int) {
+        int x_end = MIN(count_vec, (int)(block + 1) * UNARY2_BLOCK_SIZE);
+        for (int x = block * UNARY2_BLOCK_SIZE; x < x_end; x += pack) {
+            VEC::saveu(dst + x, op(VEC::loadu(src + x)));
+        }
+    });
+    for (int x = count_vec; x < count; x++) {
+        dst[x] = op(src[x]);
+    }
+}
+
+template <typename VEC, int pack>
+static unary2_kernel_func_t GetUnary2Kernel(LayerType type) {
+    switch (type) {
+        case LAYER_ABS:
+            return unary2_kernel<X86_ABS_OP, VEC, pack>;
+        case LAYER_EXP:
+            return unary2_kernel<X86_EXP_OP, VEC, pack>;
+        case LAYER_GELU:
+            return unary2_kernel<X86_GELU_OP, VEC, pack>;
+        case LAYER_LOG:
+            return unary2_kernel<X86_LOG_OP, VEC, pack>;
+        case LAYER_LOGSIGMOID:
+            return unary2_kernel<X86_LOGSIGMOID_OP, VEC, pack>;
+        case LAYER_NEG:
+            return unary2_kernel<X86_NEG_OP, VEC, pack>;
+        case LAYER_RELU6:
+            return unary2_kernel<X86_RELU6_OP, VEC, pack>;
+        case LAYER_RELU:
+            return unary2_kernel<X86_RELU_OP, VEC, pack>;
+        case LAYER_SIGMOID:
+            return unary2_kernel<X86_SIGMOID_OP, VEC, pack>;
+        case LAYER_SOFTPLUS:
+            return unary2_kernel<X86_SOFTPLUS_OP, VEC, pack>;
+        case LAYER_SOFTSIGN:
+            return unary2_kernel<X86_SOFTSIGN_OP, VEC, pack>;
+        case LAYER_SQRT:
+            return unary2_kernel<X86_SQRT_OP, VEC, pack>;
+        case LAYER_TANH:
+            return unary2_kernel<X86_TANH_OP, VEC, pack>;
+        default:
+            return nullptr;
+    }
+}
+
+template <typename VEC, int pack>
+X86ElementwiseKernels CreateX86ElementwiseKernels() {
+    X86ElementwiseKernels kernels;
+    kernels.binary[(int)X86BinaryOpType::kADD] = BinaryFunc<X86BinaryOpType::kADD, VEC, pack>;
+    kernels.binary[(int)X86BinaryOpType::kSUB] = BinaryFunc<X86BinaryOpType::kSUB, VEC, pack>;
+    kernels.binary[(int)X86BinaryOpType::kMUL] = BinaryFunc<X86BinaryOpType::kMUL, VEC, pack>;
+    kernels.binary[(int)X86BinaryOpType::kDIV] = BinaryFunc<X86BinaryOpType::kDIV, VEC, pack>;
+    kernels.binary[(int)X86BinaryOpType::kMAX] = BinaryFunc<X86BinaryOpType::kMAX, VEC, pack>;
+    kernels.binary[(int)X86BinaryOpType::kMIN] = BinaryFunc<X86BinaryOpType::kMIN, VEC, pack>;
+    kernels.softmax                            = softmax_func<VEC, pack>;
+    kernels.layer_norm                         = norm_func<VEC, pack>;
+    kernels.instance_norm                      = instance_norm_func<VEC, pack>;
+    kernels.prelu                              = prelu_func<VEC, pack>;
+    kernels.hard_swish                         = hard_swish_func<VEC, pack>;
+    kernels.unary2                             = GetUnary2Kernel<VEC, pack>;
+    return kernels;
+}
+
+#if defined(TNN_X86_COMPUTE_AVX512)
+X86ElementwiseKernels CreateAvx512ElementwiseKernels() {
+    return CreateX86ElementwiseKernels<Float16, 16>();
+}
+
+}  // namespace X86_COMPUTE_NAMESPACE
+#elif defined(TNN_X86_COMPUTE_AVX2)
+X86ElementwiseKernels CreateAvx2ElementwiseKernels() {
+    return CreateX86ElementwiseKernels<Float8, 8>();
+}
+
+}  // namespace X86_COMPUTE_NAMESPACE
+#else
+
+#ifdef TNN_X86_FAT_BINARY
+namespace x86_avx2 {
+X86ElementwiseKernels CreateAvx2ElementwiseKernels();
+}  // namespace x86_avx2
+namespace x86_avx512 {
+X86ElementwiseKernels CreateAvx512ElementwiseKernels();
+}  // namespace x86_avx512
+#endif
+
+x86_isa_t X86ElementwiseArch(x86_isa_t arch) {
+#ifdef TNN_X86_FAT_BINARY
+    static const bool avx512_cpu = cpu_with_isa(avx512);
+    if (arch == avx2 && avx512_cpu) {
+        return avx512;
+    }
+#endif
+    return arch;
+}
+
+// the tables of an isa are only created once a cpu with the isa asks for them, creating them runs code of the isa
+const X86ElementwiseKernels &GetX86ElementwiseKernels(x86_isa_t arch) {
+    const x86_isa_t isa = X86ElementwiseArch(arch);
+#ifdef TNN_X86_FAT_BINARY
+    if (isa == avx512) {
+        static const X86ElementwiseKernels avx512_kernels = x86_avx512::CreateAvx512ElementwiseKernels();
+        return avx512_kernels;
+    }
+    if (isa == avx2) {
+        static const X86ElementwiseKernels avx2_kernels = x86_avx2::CreateAvx2ElementwiseKernels();
+        return avx2_kernels;
+    }
+#else
+    if (isa == avx2) {
+        static const X86ElementwiseKernels avx2_kernels = CreateX86ElementwiseKernels<Float8, 8>();
+        return avx2_kernels;
+    }
+#endif
+    static const X86ElementwiseKernels sse_kernels = CreateX86ElementwiseKernels<Float4, 4>();
+    return sse_kernels;
+}
+#endif
+
+}  // namespace TNN_NS
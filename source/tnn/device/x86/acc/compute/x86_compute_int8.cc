@@ -305,6 +305,193 @@ void X86SSEGemmInt8Unit4x4(const int8_t* src, const int8_t* weight, int8_t* dst,
     }
 }
 
+#if defined(__GNUC__) || defined(__clang__)
+#define TNN_X86_TARGET_AVX512_VNNI __attribute__((target("avx512f,avx512bw,avx512vl,avx512vnni")))
+#define TNN_X86_TARGET_AVX_VNNI __attribute__((target("avx2,fma,avxvnni")))
+#else
+#define TNN_X86_TARGET_AVX512_VNNI
+#define TNN_X86_TARGET_AVX_VNNI
+#endif
+
+// bias, scale, fusion and rounding of 4 int32 output channels
+static inline void X86GemmInt8Post4(__m128i dst_vec_0, int8_t* dst_x, const float* scale, const int32_t* bias,
+                                    long relu, const int8_t* add_input_x, const float* add_scale,
+                                    __m128 relu6_max_vec) {
+    DeclareRounding();
+    __m128i bias_vec = _mm_loadu_si128((__m128i*)bias);
+    __m128 scale_vec = _mm_loadu_ps(scale);
+    __m128 dst_4x32  = _mm_cvtepi32_ps(_mm_add_epi32(dst_vec_0, bias_vec));
+    dst_4x32         = _mm_mul_ps(dst_4x32, scale_vec);
+
+    if (relu == -1) {
+        dst_4x32 = _mm_max_ps(dst_4x32, zero_f32);
+    }
+    if (add_input_x) {
+        int add_input_4x8 = *((int*)(add_input_x));
+        __m128 add_scale_vec = _mm_loadu_ps(add_scale);
+        __m128 add_input_vec = _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_cvtsi32_si128(add_input_4x8)));
+        dst_4x32 = _mm_add_ps(dst_4x32, _mm_mul_ps(add_input_vec, add_scale_vec));
+    }
+    if (relu == 1) {
+        dst_4x32 = _mm_max_ps(dst_4x32, zero_f32);
+    }
+    // Conv-Add-Relu6
+    else if (relu == 2) {
+        dst_4x32 = _mm_max_ps(dst_4x32, zero_f32);
+        dst_4x32 = _mm_min_ps(dst_4x32, relu6_max_vec);
+    }
+    F32X4TOI8X4(dst_4x32, dst_x);
+}
+
+static inline __m128 X86LoadRelu6Max4(long relu, const int8_t* relu6_max) {
+    if (relu == 2) {
+        return _mm_setr_ps((float)relu6_max[0], (float)relu6_max[1], (float)relu6_max[2], (float)relu6_max[3]);
+    }
+    return _mm_setzero_ps();
+}
+
+#ifdef TNN_X86_AVX512_VNNI_KERNEL
+/*
+the packed weights of one sz, 4 output channels x 16 input channels, fill one zmm.
+vpdpbusd takes uint8 x int8, the input is xored with 0x80 to add 128, which the bias compensates.
+*/
+TNN_X86_TARGET_AVX512_VNNI
+void X86AVX512VNNIGemmInt8Unit4x4(const int8_t* src, const int8_t* weight, int8_t* dst, long src_w_step,
+                                  long dst_depth, long cdiv8, const float* scale, const int32_t* bias, long relu,
+                                  const int8_t* add_input, const float* add_scale, const int8_t* relu6_max) {
+    const __m128i sign_i8 = _mm_set1_epi8((char)0x80);
+    // two sets of accumulators for even and odd sz to hide the latency of vpdpbusd
+    __m512i dst_i32x16[4];
+    __m512i dst_i32x16_odd[4];
+    for (long w = 0; w < 4; ++w) {
+        dst_i32x16[w]     = _mm512_setzero_si512();
+        dst_i32x16_odd[w] = _mm512_setzero_si512();
+    }
+
+    long sz = 0;
+    for (; sz + 1 < cdiv8 / 2; sz += 2) {
+        const auto src_z = src + sz * 16;
+        __m512i w_vec0   = _mm512_loadu_si512(weight + (4 * 16) * sz);
+        __m512i w_vec1   = _mm512_loadu_si512(weight + (4 * 16) * sz + 64);
+        for (long w = 0; w < 4; ++w) {
+            __m128i src_vec0  = _mm_xor_si128(_mm_loadu_si128((__m128i*)(src_z + w * src_w_step)), sign_i8);
+            __m128i src_vec1  = _mm_xor_si128(_mm_loadu_si128((__m128i*)(src_z + w * src_w_step + 16)), sign_i8);
+            dst_i32x16[w]     = _mm512_dpbusd_epi32(dst_i32x16[w], _mm512_broadcast_i32x4(src_vec0), w_vec0);
+            dst_i32x16_odd[w] = _mm512_dpbusd_epi32(dst_i32x16_odd[w], _mm512_broadcast_i32x4(src_vec1), w_vec1);
+        }
+    }
+    for (long w = 0; w < 4; ++w) {
+        dst_i32x16[w] = _mm512_add_epi32(dst_i32x16[w], dst_i32x16_odd[w]);
+    }
+    for (; sz < cdiv8 / 2; ++sz) {
+        const auto src_z = src + sz * 16;
+        __m512i w_vec    = _mm512_loadu_si512(weight + (4 * 16) * sz);
+        for (long w = 0; w < 4; ++w) {
+            __m128i src_vec = _mm_xor_si128(_mm_loadu_si128((__m128i*)(src_z + w * src_w_step)), sign_i8);
+            dst_i32x16[w]   = _mm512_dpbusd_epi32(dst_i32x16[w], _mm512_broadcast_i32x4(src_vec), w_vec);
+        }
+    }
+    // the last 8 input channels, the upper 8 weights are packed as zeros
+    if (sz < cdiv8 / 2 + cdiv8 % 2) {
+        const auto src_z = src + sz * 16;
+        __m512i w_vec    = _mm512_loadu_si512(weight + (4 * 16) * sz);
+        for (long w = 0; w < 4; ++w) {
+            __m128i src_vec = _mm_xor_si128(_mm_loadl_epi64((__m128i*)(src_z + w * src_w_step)), sign_i8);
+            dst_i32x16[w]   = _mm512_dpbusd_epi32(dst_i32x16[w], _mm512_broadcast_i32x4(src_vec), w_vec);
+        }
+    }
+
+    __m128 relu6_max_vec = X86LoadRelu6Max4(relu, relu6_max);
+    for (long w = 0; w < 4; ++w) {
+        __m128i d_32_0    = _mm512_castsi512_si128(dst_i32x16[w]);
+        __m128i d_32_1    = _mm512_extracti32x4_epi32(dst_i32x16[w], 1);
+        __m128i d_32_2    = _mm512_extracti32x4_epi32(dst_i32x16[w], 2);
+        __m128i d_32_3    = _mm512_extracti32x4_epi32(dst_i32x16[w], 3);
+        __m128i dst_vec_0 = _mm_hadd_epi32(_mm_hadd_epi32(d_32_0, d_32_1), _mm_hadd_epi32(d_32_2, d_32_3));
+        X86GemmInt8Post4(dst_vec_0, dst + w * dst_depth, scale, bias, relu,
+                         add_input ? add_input + w * dst_depth : nullptr, add_scale, relu6_max_vec);
+    }
+}
+#endif
+
+#ifdef TNN_X86_AVX_VNNI_KERNEL
+/*
+same as X86AVX512VNNIGemmInt8Unit4x4, the packed weights of one sz fill two ymm, 2 output channels each.
+*/
+TNN_X86_TARGET_AVX_VNNI
+void X86AVXVNNIGemmInt8Unit4x4(const int8_t* src, const int8_t* weight, int8_t* dst, long src_w_step,
+                               long dst_depth, long cdiv8, const float* scale, const int32_t* bias, long relu,
+                               const int8_t* add_input, const float* add_scale, const int8_t* relu6_max) {
+    const __m128i sign_i8 = _mm_set1_epi8((char)0x80);
+    __m256i dst_i32x8_0[4];
+    __m256i dst_i32x8_1[4];
+    for (long w = 0; w < 4; ++w) {
+        dst_i32x8_0[w] = _mm256_setzero_si256();
+        dst_i32x8_1[w] = _mm256_setzero_si256();
+    }
+
+    long sz = 0;
+    for (; sz < cdiv8 / 2; ++sz) {
+        const auto src_z = src + sz * 16;
+        __m256i w_vec0   = _mm256_loadu_si256((__m256i*)(weight + (4 * 16) * sz));
+        __m256i w_vec1   = _mm256_loadu_si256((__m256i*)(weight + (4 * 16) * sz + 32));
+        for (long w = 0; w < 4; ++w) {
+            __m128i src_vec = _mm_xor_si128(_mm_loadu_si128((__m128i*)(src_z + w * src_w_step)), sign_i8);
+            __m256i src_u8  = _mm256_broadcastsi128_si256(src_vec);
+            dst_i32x8_0[w]  = _mm256_dpbusd_avx_epi32(dst_i32x8_0[w], src_u8, w_vec0);
+            dst_i32x8_1[w]  = _mm256_dpbusd_avx_epi32(dst_i32x8_1[w], src_u8, w_vec1);
+        }
+    }
+    // the last 8 input channels, the upper 8 weights are packed as zeros
+    if (sz < cdiv8 / 2 + cdiv8 % 2) {
+        const auto src_z = src + sz * 16;
+        __m256i w_vec0   = _mm256_loadu_si256((__m256i*)(weight + (4 * 16) * sz));
+        __m256i w_vec1   = _mm256_loadu_si256((__m256i*)(weight + (4 * 16) * sz + 32));
+        for (long w = 0; w < 4; ++w) {
+            __m128i src_vec = _mm_xor_si128(_mm_loadl_epi64((__m128i*)(src_z + w * src_w_step)), sign_i8);
+            __m256i src_u8  = _mm256_broadcastsi128_si256(src_vec);
+            dst_i32x8_0[w]  = _mm256_dpbusd_avx_epi32(dst_i32x8_0[w], src_u8, w_vec0);
+            dst_i32x8_1[w]  = _mm256_dpbusd_avx_epi32(dst_i32x8_1[w], src_u8, w_vec1);
+        }
+    }
+
+    __m128 relu6_max_vec = X86LoadRelu6Max4(relu, relu6_max);
+    for (long w = 0; w < 4; ++w) {
+        __m128i d_32_0    = _mm256_castsi256_si128(dst_i32x8_0[w]);
+        __m128i d_32_1    = _mm256_extracti128_si256(dst_i32x8_0[w], 1);
+        __m128i d_32_2    = _mm256_castsi256_si128(dst_i32x8_1[w]);
+        __m128i d_32_3    = _mm256_extracti128_si256(dst_i32x8_1[w], 1);
+        __m128i dst_vec_0 = _mm_hadd_epi32(_mm_hadd_epi32(d_32_0, d_32_1), _mm_hadd_epi32(d_32_2, d_32_3));
+        X86GemmInt8Post4(dst_vec_0, dst + w * dst_depth, scale, bias, relu,
+                         add_input ? add_input + w * dst_depth : nullptr, add_scale, relu6_max_vec);
+    }
+}
+#endif
+
+x86_isa_t X86GemmInt8Arch(x86_isa_t arch) {
+#ifdef TNN_X86_AVX512_VNNI_KERNEL
+    if (cpu_with_isa(avx512_vnni)) {
+        return avx512_vnni;
+    }
+#endif
+#ifdef TNN_X86_AVX_VNNI_KERNEL
+    if (cpu_with_isa(avx_vnni)) {
+        return avx_vnni;
+    }
+#endif
+    return arch;
+}
+
+void X86GemmInt8VnniCompensate(int32_t* bias, const int8_t* weight, long oc, long k) {
+    for (long o = 0; o < oc; ++o) {
+        int32_t sum = 0;
+        for (long i = 0; i < k; ++i) {
+            sum += weight[o * k + i];
+        }
+        bias[o] -= 128 * sum;
+    }
+}
+
 static void DepthwiseI8K3Kernel(int8_t* dst, const int8_t* src, const int8_t* weight, const int32_t* bias_z,
                                 long src_y_step, long src_w_step, long dst_depth, const float* scale_z,
                                 long dx, long dc) {
@@ -913,6 +1100,82 @@ void X86GemvInt8(int8_t* dst, const int8_t* src, const int8_t* weight, const int
     }
 }
 
+/*
+4 output channels of X86VNNIGemvInt8, the packed weights of 16 input channels fill one zmm.
+src_tail holds the input channels after the last multiple of 16, padded with zeros.
+*/
+#ifdef TNN_X86_AVX512_VNNI_KERNEL
+TNN_X86_TARGET_AVX512_VNNI
+static __m128i X86AVX512VNNIGemvInt8Unit4(const int8_t* src, const int8_t* src_tail, const int8_t* weight_o,
+                                          long ic_r4) {
+    const __m128i sign_i8 = _mm_set1_epi8((char)0x80);
+    __m512i acc           = _mm512_setzero_si512();
+    long c                = 0;
+    for (; c < ic_r4; c += 16) {
+        const int8_t* src_c = c + 15 < ic_r4 ? src + c : src_tail;
+        __m128i a           = _mm_xor_si128(_mm_loadu_si128((__m128i*)src_c), sign_i8);
+        acc = _mm512_dpbusd_epi32(acc, _mm512_broadcast_i32x4(a), _mm512_loadu_si512(weight_o + c * 4));
+    }
+    __m128i acc0 = _mm512_castsi512_si128(acc);
+    __m128i acc1 = _mm512_extracti32x4_epi32(acc, 1);
+    __m128i acc2 = _mm512_extracti32x4_epi32(acc, 2);
+    __m128i acc3 = _mm512_extracti32x4_epi32(acc, 3);
+    return _mm_hadd_epi32(_mm_hadd_epi32(acc0, acc1), _mm_hadd_epi32(acc2, acc3));
+}
+#endif
+
+#ifdef TNN_X86_AVX_VNNI_KERNEL
+TNN_X86_TARGET_AVX_VNNI
+static __m128i X86AVXVNNIGemvInt8Unit4(const int8_t* src, const int8_t* src_tail, const int8_t* weight_o,
+                                       long ic_r4) {
+    const __m128i sign_i8 = _mm_set1_epi8((char)0x80);
+    __m256i acc_0         = _mm256_setzero_si256();
+    __m256i acc_1         = _mm256_setzero_si256();
+    long c                = 0;
+    for (; c < ic_r4; c += 16) {
+        const int8_t* src_c = c + 15 < ic_r4 ? src + c : src_tail;
+        __m128i a_vec       = _mm_xor_si128(_mm_loadu_si128((__m128i*)src_c), sign_i8);
+        __m256i a           = _mm256_broadcastsi128_si256(a_vec);
+        acc_0 = _mm256_dpbusd_avx_epi32(acc_0, a, _mm256_loadu_si256((__m256i*)(weight_o + c * 4)));
+        acc_1 = _mm256_dpbusd_avx_epi32(acc_1, a, _mm256_loadu_si256((__m256i*)(weight_o + c * 4 + 32)));
+    }
+    __m128i acc0 = _mm256_castsi256_si128(acc_0);
+    __m128i acc1 = _mm256_extracti128_si256(acc_0, 1);
+    __m128i acc2 = _mm256_castsi256_si128(acc_1);
+    __m128i acc3 = _mm256_extracti128_si256(acc_1, 1);
+    return _mm_hadd_epi32(_mm_hadd_epi32(acc0, acc1), _mm_hadd_epi32(acc2, acc3));
+}
+#endif
+
+void X86VNNIGemvInt8(int8_t* dst, const int8_t* src, const int8_t* weight, const int32_t* bias, const float* scale,
+                     long ic_r4, long oc_r4, x86_isa_t arch) {
+    __m128i (*gemv_unit)(const int8_t*, const int8_t*, const int8_t*, long) = nullptr;
+#ifdef TNN_X86_AVX512_VNNI_KERNEL
+    if (arch == avx512_vnni) {
+        gemv_unit = X86AVX512VNNIGemvInt8Unit4;
+    }
+#endif
+#ifdef TNN_X86_AVX_VNNI_KERNEL
+    if (arch == avx_vnni) {
+        gemv_unit = X86AVXVNNIGemvInt8Unit4;
+    }
+#endif
+    if (!gemv_unit) {
+        LOGE("X86VNNIGemvInt8 does not support arch %d\n", arch);
+        return;
+    }
+
+    const long ic_r16  = ROUND_UP(ic_r4, 16);
+    int8_t src_tail[16] = {0};
+    memcpy(src_tail, src + ic_r4 / 16 * 16, ic_r4 % 16);
+
+    OMP_PARALLEL_FOR_GUIDED_
+    for (long dc = 0; dc < oc_r4; dc += 4) {
+        __m128i dst_4xi32 = gemv_unit(src, src_tail, weight + dc * ic_r16, ic_r4);
+        X86GemmInt8Post4(dst_4xi32, dst + dc, scale + dc, bias + dc, 0, nullptr, nullptr, _mm_setzero_ps());
+    }
+}
+
 static bool is_per_tensor_quant(const std::vector<Blob *> &inputs) {
     bool int8_per_tensor_flag = true;
     for (auto &blob : inputs) {
@@ -19,6 +19,15 @@
 #include "tnn/core/blob.h"
 #include "tnn/core/status.h"
 #include "tnn/interpreter/layer_param.h"
+#include "tnn/device/x86/acc/compute/jit/utils/cpu_isa.h"
+
+// vnni kernels are built with target attributes and picked by the cpu at runtime, they need no compile flags
+#if (defined(_MSC_VER) && _MSC_VER >= 1920) || defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 8)
+#define TNN_X86_AVX512_VNNI_KERNEL
+#endif
+#if (defined(__clang__) && __clang_major__ >= 13) || (!defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 11)
+#define TNN_X86_AVX_VNNI_KERNEL
+#endif
 
 namespace TNN_NS {
 
@@ -32,6 +41,25 @@ void X86SSEGemmInt8Unit4x4(const int8_t* src, const int8_t* weight, int8_t* dst,
                      const float* scale, const int32_t* bias, long relu, const int8_t* add_input,
                      const float* add_scale, const int8_t* relu6_max);
 
+// @brief same as X86AVXGemmInt8Unit4x4 with vpdpbusd, bias must be compensated by X86GemmInt8VnniCompensate
+#ifdef TNN_X86_AVX512_VNNI_KERNEL
+void X86AVX512VNNIGemmInt8Unit4x4(const int8_t* src, const int8_t* weight, int8_t* dst, long src_w_step,
+                                  long dst_depth, long cdiv8, const float* scale, const int32_t* bias, long relu,
+                                  const int8_t* add_input, const float* add_scale, const int8_t* relu6_max);
+#endif
+#ifdef TNN_X86_AVX_VNNI_KERNEL
+void X86AVXVNNIGemmInt8Unit4x4(const int8_t* src, const int8_t* weight, int8_t* dst, long src_w_step,
+                               long dst_depth, long cdiv8, const float* scale, const int32_t* bias, long relu,
+                               const int8_t* add_input, const float* add_scale, const int8_t* relu6_max);
+#endif
+
+// @brief isa of the int8 gemm kernels, avx512_vnni or avx_vnni if the cpu and the compiler support it, else arch
+x86_isa_t X86GemmInt8Arch(x86_isa_t arch);
+
+// @brief vnni kernels add 128 to the int8 input to multiply it as uint8, so 128 * sum of the weights of each
+// output channel is taken off its bias. weight is [oc][k].
+void X86GemmInt8VnniCompensate(int32_t* bias, const int8_t* weight, long oc, long k);
+
 void X86DepthwiseI8Unit(int8_t* dst, const int8_t* src, const int8_t* weight, const int32_t* bias, long fw, long fh,
                      long weight_y_step, long dilate_y_step, long dilate_x_step, const float* scale, long dst_depth);
 
@@ -62,6 +90,11 @@ void X86MatrixAddInt8(int8_t* dst, const int8_t* A, const int8_t* B, float* dst_
 void X86GemvInt8(int8_t* dst, const int8_t* src, const int8_t* weight, const int32_t* bias, const float* scale,
                  long ic_r4, long oc_r4);
 
+// @brief X86GemvInt8 for arch avx512_vnni and avx_vnni, weight is packed by PackINT8Weight as [oc/4][ic/16][o4][i16],
+// bias must be compensated by X86GemmInt8VnniCompensate
+void X86VNNIGemvInt8(int8_t* dst, const int8_t* src, const int8_t* weight, const int32_t* bias, const float* scale,
+                     long ic_r4, long oc_r4, x86_isa_t arch);
+
 void X86ConcatChannelInt8(Blob *output, const std::vector<Blob *> &inputs);
 void X86ConcatCommonInt8(Blob *output, const std::vector<Blob *> &inputs, int axis);
 
@@ -0,0 +1,723 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include "tnn/device/x86/acc/compute/x86_compute.h"
+#include "tnn/device/x86/acc/Float4.h"
+#include "tnn/device/x86/acc/Float8.h"
+
+#include <cstring>
+
+namespace TNN_NS {
+
+#ifdef X86_COMPUTE_NAMESPACE
+// the avx2 build of this file in fat binaries, keep its symbols apart from the sse4.2 build
+namespace X86_COMPUTE_NAMESPACE {
+#endif
+
+static void pack_input_c8(const float *din, float *dout, int cs, int hs, int he, int ws, int we, int channel, int width,
+                          int height, float *zero_ptr) {
+    int size_w = we - ws;
+    int size_c = width * height;
+    int pad_l  = ws < 0 ? -ws : 0;
+    int pad_r  = we > width ? we - width : 0;
+    auto dst   = dout;
+
+    for (int h = hs; h < he; h++) {
+        dst         = dout + (h - hs) * 8 * size_w;
+        auto ptr_c0 = din + cs * size_c + h * width;
+        auto ptr_c1 = ptr_c0 + size_c;
+        auto ptr_c2 = ptr_c1 + size_c;
+        auto ptr_c3 = ptr_c2 + size_c;
+        auto ptr_c4 = ptr_c3 + size_c;
+        auto ptr_c5 = ptr_c4 + size_c;
+        auto ptr_c6 = ptr_c5 + size_c;
+        auto ptr_c7 = ptr_c6 + size_c;
+
+        if (h < 0 || h >= height) {
+            memset(dst, 0, sizeof(float) * 8 * size_w);
+            continue;
+        } else if (cs + 8 > channel) {
+            switch (cs + 8 - channel) {
+                case 7:
+                    ptr_c1 = zero_ptr;
+                case 6:
+                    ptr_c2 = zero_ptr;
+                case 5:
+                    ptr_c3 = zero_ptr;
+                case 4:
+                    ptr_c4 = zero_ptr;
+                case 3:
+                    ptr_c5 = zero_ptr;
+                case 2:
+                    ptr_c6 = zero_ptr;
+                case 1:
+                    ptr_c7 = zero_ptr;
+                default:
+                    break;
+            }
+        }
+
+        for (int w = ws; w < we; w++) {
+            if (w < 0 || w >= width) {
+                memset(dst, 0, 8 * sizeof(float));
+                dst += 8;
+                continue;
+            }
+
+            dst[0] = ptr_c0[w];
+            dst[1] = ptr_c1[w];
+            dst[2] = ptr_c2[w];
+            dst[3] = ptr_c3[w];
+            dst[4] = ptr_c4[w];
+            dst[5] = ptr_c5[w];
+            dst[6] = ptr_c6[w];
+            dst[7] = ptr_c7[w];
+            dst += 8;
+        }
+    }
+}
+
+static void pack_input_c4(const float *din, float *dout, int cs, int hs, int he, int ws, int we, int channel, int width,
+                          int height, float *zero_ptr) {
+    int size_w = we - ws;
+    int size_c = width * height;
+    int pad_l  = ws < 0 ? -ws : 0;
+    int pad_r  = we > width ? we - width : 0;
+    auto dst   = dout;
+
+    for (int h = hs; h < he; h++) {
+        dst         = dout + (h - hs) * 4 * size_w;
+        auto ptr_c0 = din + cs * size_c + h * width;
+        auto ptr_c1 = ptr_c0 + size_c;
+        auto ptr_c2 = ptr_c1 + size_c;
+        auto ptr_c3 = ptr_c2 + size_c;
+
+        if (h < 0 || h >= height) {
+            memset(dst, 0, sizeof(float) * 4 * size_w);
+            continue;
+        } else if (cs + 4 > channel) {
+            switch (cs + 4 - channel) {
+                case 3:
+                    ptr_c1 = zero_ptr;
+                case 2:
+                    ptr_c2 = zero_ptr;
+                case 1:
+                    ptr_c3 = zero_ptr;
+                default:
+                    break;
+            }
+        }
+
+        for (int w = ws; w < we; w++) {
+            if (w < 0 || w >= width) {
+                memset(dst, 0, 4 * sizeof(float));
+                dst += 4;
+                continue;
+            }
+
+            dst[0] = ptr_c0[w];
+            dst[1] = ptr_c1[w];
+            dst[2] = ptr_c2[w];
+            dst[3] = ptr_c3[w];
+            dst += 4;
+        }
+    }
+}
+
+// unpack c8
+// padded copy of the channel block starting at cs of a blocked input
+template <int CH_PACK>
+static void pack_input_blocked(const float *din, float *dout, int cs, int hs, int he, int ws, int we, int channel,
+                               int width, int height, float *zero_ptr) {
+    int size_w = we - ws;
+    int pad_l  = ws < 0 ? -ws : 0;
+    int pad_r  = we > width ? we - width : 0;
+    auto src   = din + (cs / CH_PACK) * width * height * CH_PACK;
+
+    for (int h = hs; h < he; h++) {
+        auto dst = dout + (h - hs) * CH_PACK * size_w;
+        if (h < 0 || h >= height) {
+            memset(dst, 0, sizeof(float) * CH_PACK * size_w);
+            continue;
+        }
+        memset(dst, 0, sizeof(float) * CH_PACK * pad_l);
+        memcpy(dst + pad_l * CH_PACK, src + h * width * CH_PACK, sizeof(float) * CH_PACK * width);
+        memset(dst + (pad_l + width) * CH_PACK, 0, sizeof(float) * CH_PACK * pad_r);
+    }
+}
+
+static void unpack_output_c8(const float *din, float *dout, int cs, int ce, int hs, int he, int ws, int we, int channel,
+                             int height, int width, bool flag_relu, float *trash_ptr) {
+    int size_c_out = width * height;
+
+    float *doutc0r0 = dout + cs * size_c_out + hs * width + ws;
+    float *doutc1r0 = doutc0r0 + size_c_out;
+    float *doutc2r0 = doutc1r0 + size_c_out;
+    float *doutc3r0 = doutc2r0 + size_c_out;
+    float *doutc4r0 = doutc3r0 + size_c_out;
+    float *doutc5r0 = doutc4r0 + size_c_out;
+    float *doutc6r0 = doutc5r0 + size_c_out;
+    float *doutc7r0 = doutc6r0 + size_c_out;
+
+    const float *ptr_din = din;
+
+    int size_h  = (he > height ? height : he) - hs;
+    int size_w  = (we > width ? width : we) - ws;
+    int valid_w = we - ws;
+
+    for (int h = 0; h < size_h; h++) {
+        float *doutc0_ptr = doutc0r0 + h * width;  // doutc0r0 + width;
+        float *doutc1_ptr = doutc1r0 + h * width;
+        float *doutc2_ptr = doutc2r0 + h * width;
+        float *doutc3_ptr = doutc3r0 + h * width;
+        float *doutc4_ptr = doutc4r0 + h * width;
+        float *doutc5_ptr = doutc5r0 + h * width;
+        float *doutc6_ptr = doutc6r0 + h * width;
+        float *doutc7_ptr = doutc7r0 + h * width;
+        if (ce > channel) {
+            switch (ce - channel) {
+                case 7:
+                    doutc1_ptr = trash_ptr;
+                case 6:
+                    doutc2_ptr = trash_ptr;
+                case 5:
+                    doutc3_ptr = trash_ptr;
+                case 4:
+                    doutc4_ptr = trash_ptr;
+                case 3:
+                    doutc5_ptr = trash_ptr;
+                case 2:
+                    doutc6_ptr = trash_ptr;
+                case 1:
+                    doutc7_ptr = trash_ptr;
+                default:
+                    break;
+            }
+        }
+        for (int w = 0; w < size_w; w++) {
+            doutc0_ptr[w] = ptr_din[(h * valid_w + w) * 8 + 0];
+            doutc1_ptr[w] = ptr_din[(h * valid_w + w) * 8 + 1];
+            doutc2_ptr[w] = ptr_din[(h * valid_w + w) * 8 + 2];
+            doutc3_ptr[w] = ptr_din[(h * valid_w + w) * 8 + 3];
+            doutc4_ptr[w] = ptr_din[(h * valid_w + w) * 8 + 4];
+            doutc5_ptr[w] = ptr_din[(h * valid_w + w) * 8 + 5];
+            doutc6_ptr[w] = ptr_din[(h * valid_w + w) * 8 + 6];
+            doutc7_ptr[w] = ptr_din[(h * valid_w + w) * 8 + 7];
+        }
+    }
+}
+
+static void unpack_output_c4(const float *din, float *dout, int cs, int ce, int hs, int he, int ws, int we, int channel,
+                             int height, int width, bool flag_relu, float *trash_ptr) {
+    int size_c_out = width * height;
+
+    float *doutc0r0 = dout + cs * size_c_out + hs * width + ws;
+    float *doutc1r0 = doutc0r0 + size_c_out;
+    float *doutc2r0 = doutc1r0 + size_c_out;
+    float *doutc3r0 = doutc2r0 + size_c_out;
+
+    const float *ptr_din = din;
+
+    int size_h  = (he > height ? height : he) - hs;
+    int size_w  = (we > width ? width : we) - ws;
+    int valid_w = we - ws;
+
+    for (int h = 0; h < size_h; h++) {
+        float *doutc0_ptr = doutc0r0 + h * width;  // doutc0r0 + width;
+        float *doutc1_ptr = doutc1r0 + h * width;
+        float *doutc2_ptr = doutc2r0 + h * width;
+        float *doutc3_ptr = doutc3r0 + h * width;
+        if (ce > channel) {
+            switch (ce - channel) {
+                case 3:
+                    doutc1_ptr = trash_ptr;
+                case 2:
+                    doutc2_ptr = trash_ptr;
+                case 1:
+                    doutc3_ptr = trash_ptr;
+                default:
+                    break;
+            }
+        }
+        for (int w = 0; w < size_w; w++) {
+            doutc0_ptr[w] = ptr_din[(h * valid_w + w) * 4 + 0];
+            doutc1_ptr[w] = ptr_din[(h * valid_w + w) * 4 + 1];
+            doutc2_ptr[w] = ptr_din[(h * valid_w + w) * 4 + 2];
+            doutc3_ptr[w] = ptr_din[(h * valid_w + w) * 4 + 3];
+        }
+    }
+}
+
+#define COMPUTE_UNIT(c)                                                                                                \
+    wgt  = VEC::loadu(weight_z + c * N);                                                                               \
+    data = VEC(src_z + K * 0 + c);                                                                                     \
+    VEC::mla(acc0, data, wgt);                                                                                         \
+    data = VEC(src_z + K * 1 + c);                                                                                     \
+    VEC::mla(acc1, data, wgt);                                                                                         \
+    data = VEC(src_z + K * 2 + c);                                                                                     \
+    VEC::mla(acc2, data, wgt);                                                                                         \
+    data = VEC(src_z + K * 3 + c);                                                                                     \
+    VEC::mla(acc3, data, wgt);                                                                                         \
+    data = VEC(src_z + K * 4 + c);                                                                                     \
+    VEC::mla(acc4, data, wgt);                                                                                         \
+    data = VEC(src_z + K * 5 + c);                                                                                     \
+    VEC::mla(acc5, data, wgt);
+
+// the last tiles of gemm_kernel_avx, R < M tiles share each weight load like the M tiles of the main loop
+template <typename VEC, int R, int K, int N>
+static void gemm_kernel_tail(float *dst_x, const float *src_x, const float *weight_dz, const float *bias, int ic_8,
+                             int src_depth_step) {
+    VEC acc[R];
+    for (int r = 0; r < R; r++) {
+        acc[r] = (bias) ? VEC::loadu(bias) : VEC(0.0f);
+    }
+
+    for (int ci = 0; ci < ic_8; ci++) {
+        auto src_z    = src_x + ci * src_depth_step;
+        auto weight_z = weight_dz + ci * K * N;
+        for (int c = 0; c < K; c++) {
+            VEC wgt = VEC::loadu(weight_z + c * N);
+            for (int r = 0; r < R; r++) {
+                VEC data = VEC(src_z + K * r + c);
+                VEC::mla(acc[r], data, wgt);
+            }
+        }
+    }
+
+    for (int r = 0; r < R; r++) {
+        VEC::saveu(dst_x + N * r, acc[r]);
+    }
+}
+
+// A=6x8, B=8x8, C=6x8
+template <typename VEC, int M, int K, int N>
+static void gemm_kernel_avx(float *dst, float *src, const float *weight, const float *bias, int ic_8, int oc_8,
+                            int width) {
+    auto w_unit         = width / M;
+    auto w_unit_end     = M * w_unit;
+    auto src_depth_step = width * K;
+
+    const int weight_unit_step = K * N;
+
+    for (int co = 0; co < oc_8; co++) {
+        auto dst_z     = dst + co * N * width;
+        auto weight_dz = weight + co * ic_8 * weight_unit_step;
+
+        for (int dx = 0; dx < w_unit; dx++) {
+            auto dst_x = dst_z + dx * N * M;
+            auto src_x = src + dx * K * M;
+
+            VEC acc0 = (bias) ? VEC::loadu(bias) : VEC(0.0f);
+            VEC acc1 = acc0;
+            VEC acc2 = acc0;
+            VEC acc3 = acc0;
+            VEC acc4 = acc0;
+            VEC acc5 = acc0;
+            VEC data;
+            VEC wgt;
+
+            for (int ci = 0; ci < ic_8; ci++) {
+                auto src_z    = src_x + ci * src_depth_step;
+                auto weight_z = weight_dz + ci * weight_unit_step;
+                if (K == 8) {
+                    COMPUTE_UNIT(0);
+                    COMPUTE_UNIT(1);
+                    COMPUTE_UNIT(2);
+                    COMPUTE_UNIT(3);
+                    COMPUTE_UNIT(4);
+                    COMPUTE_UNIT(5);
+                    COMPUTE_UNIT(6);
+                    COMPUTE_UNIT(7);
+                } else if (K == 4) {
+                    COMPUTE_UNIT(0);
+                    COMPUTE_UNIT(1);
+                    COMPUTE_UNIT(2);
+                    COMPUTE_UNIT(3);
+                }
+            }
+
+            VEC::saveu(dst_x + N * 0, acc0);
+            VEC::saveu(dst_x + N * 1, acc1);
+            VEC::saveu(dst_x + N * 2, acc2);
+            VEC::saveu(dst_x + N * 3, acc3);
+            VEC::saveu(dst_x + N * 4, acc4);
+            VEC::saveu(dst_x + N * 5, acc5);
+        }
+
+        auto dst_x = dst_z + w_unit_end * N;
+        auto src_x = src + w_unit_end * K;
+        switch (width - w_unit_end) {
+            case 5:
+                gemm_kernel_tail<VEC, 5, K, N>(dst_x, src_x, weight_dz, bias, ic_8, src_depth_step);
+                break;
+            case 4:
+                gemm_kernel_tail<VEC, 4, K, N>(dst_x, src_x, weight_dz, bias, ic_8, src_depth_step);
+                break;
+            case 3:
+                gemm_kernel_tail<VEC, 3, K, N>(dst_x, src_x, weight_dz, bias, ic_8, src_depth_step);
+                break;
+            case 2:
+                gemm_kernel_tail<VEC, 2, K, N>(dst_x, src_x, weight_dz, bias, ic_8, src_depth_step);
+                break;
+            case 1:
+                gemm_kernel_tail<VEC, 1, K, N>(dst_x, src_x, weight_dz, bias, ic_8, src_depth_step);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+// BT=[1, 0, -1, 0,
+//    0, 1,  1, 0,
+//    0, -1, 1, 0,
+//    0, 1,  0, -1]
+template <typename VEC>
+static void input_trans_4x4(const float *src, int src_stride, int src_h_stride, float *dest, int dest_stride,
+                            int dest_h_stride) {
+    VEC src00 = VEC::loadu(src);
+    VEC src01 = VEC::loadu(src + src_stride);
+    VEC src02 = VEC::loadu(src + src_stride + src_stride);
+    VEC src03 = VEC::loadu(src + src_stride + src_stride + src_stride);
+    src += src_h_stride;
+    VEC src10 = VEC::loadu(src);
+    VEC src11 = VEC::loadu(src + src_stride);
+    VEC src12 = VEC::loadu(src + src_stride + src_stride);
+    VEC src13 = VEC::loadu(src + src_stride + src_stride + src_stride);
+    src += src_h_stride;
+    VEC src20 = VEC::loadu(src);
+    VEC src21 = VEC::loadu(src + src_stride);
+    VEC src22 = VEC::loadu(src + src_stride + src_stride);
+    VEC src23 = VEC::loadu(src + src_stride + src_stride + src_stride);
+    src += src_h_stride;
+    VEC src30 = VEC::loadu(src);
+    VEC src31 = VEC::loadu(src + src_stride);
+    VEC src32 = VEC::loadu(src + src_stride + src_stride);
+    VEC src33 = VEC::loadu(src + src_stride + src_stride + src_stride);
+
+    VEC dst00 = (src00 - src02);
+    VEC dst10 = (src01 + src02);
+    VEC dst20 = (src02 - src01);
+    VEC dst30 = (src01 - src03);
+
+    VEC dst01 = (src10 - src12);
+    VEC dst11 = (src11 + src12);
+    VEC dst21 = (src12 - src11);
+    VEC dst31 = (src11 - src13);
+
+    VEC dst02 = (src20 - src22);
+    VEC dst12 = (src21 + src22);
+    VEC dst22 = (src22 - src21);
+    VEC dst32 = (src21 - src23);
+
+    VEC dst03 = (src30 - src32);
+    VEC dst13 = (src31 + src32);
+    VEC dst23 = (src32 - src31);
+    VEC dst33 = (src31 - src33);
+
+    VEC dest00 = (dst00 - dst02);
+    VEC dest10 = (dst01 + dst02);
+    VEC dest20 = (dst02 - dst01);
+    VEC dest30 = (dst01 - dst03);
+
+    VEC dest01 = (dst10 - dst12);
+    VEC dest11 = (dst11 + dst12);
+    VEC dest21 = (dst12 - dst11);
+    VEC dest31 = (dst11 - dst13);
+
+    VEC dest02 = (dst20 - dst22);
+    VEC dest12 = (dst21 + dst22);
+    VEC dest22 = (dst22 - dst21);
+    VEC dest32 = (dst21 - dst23);
+
+    VEC dest03 = (dst30 - dst32);
+    VEC dest13 = (dst31 + dst32);
+    VEC dest23 = (dst32 - dst31);
+    VEC dest33 = (dst31 - dst33);
+
+    VEC::saveu(dest, dest00);
+    VEC::saveu(dest + dest_stride, dest10);
+    VEC::saveu(dest + dest_stride + dest_stride, dest20);
+    VEC::saveu(dest + dest_stride + dest_stride + dest_stride, dest30);
+    dest += dest_h_stride;
+    VEC::saveu(dest, dest01);
+    VEC::saveu(dest + dest_stride, dest11);
+    VEC::saveu(dest + dest_stride + dest_stride, dest21);
+    VEC::saveu(dest + dest_stride + dest_stride + dest_stride, dest31);
+    dest += dest_h_stride;
+    VEC::saveu(dest, dest02);
+    VEC::saveu(dest + dest_stride, dest12);
+    VEC::saveu(dest + dest_stride + dest_stride, dest22);
+    VEC::saveu(dest + dest_stride + dest_stride + dest_stride, dest32);
+    dest += dest_h_stride;
+    VEC::saveu(dest, dest03);
+    VEC::saveu(dest + dest_stride, dest13);
+    VEC::saveu(dest + dest_stride + dest_stride, dest23);
+    VEC::saveu(dest + dest_stride + dest_stride + dest_stride, dest33);
+}
+
+// AT=[1, 1,  1,  0,
+//    0, 1, -1, -1
+template <typename VEC>
+static void output_trans_post_2x4(const float *src, int src_stride, int src_h_stride, float *dest, int dest_stride,
+                                  int dest_h_stride, const float *bias_value, int relu_type) {
+    VEC src00 = VEC::loadu(src);
+    VEC src01 = VEC::loadu(src + src_stride);
+    VEC src02 = VEC::loadu(src + src_stride + src_stride);
+    VEC src03 = VEC::loadu(src + src_stride + src_stride + src_stride);
+    src += src_h_stride;
+    VEC src10 = VEC::loadu(src);
+    VEC src11 = VEC::loadu(src + src_stride);
+    VEC src12 = VEC::loadu(src + src_stride + src_stride);
+    VEC src13 = VEC::loadu(src + src_stride + src_stride + src_stride);
+    src += src_h_stride;
+    VEC src20 = VEC::loadu(src);
+    VEC src21 = VEC::loadu(src + src_stride);
+    VEC src22 = VEC::loadu(src + src_stride + src_stride);
+    VEC src23 = VEC::loadu(src + src_stride + src_stride + src_stride);
+    src += src_h_stride;
+    VEC src30 = VEC::loadu(src);
+    VEC src31 = VEC::loadu(src + src_stride);
+    VEC src32 = VEC::loadu(src + src_stride + src_stride);
+    VEC src33 = VEC::loadu(src + src_stride + src_stride + src_stride);
+
+    VEC dst00 = (src00 + src01 + src02);
+    VEC dst10 = (src01 - src02 - src03);
+    VEC dst01 = (src10 + src11 + src12);
+    VEC dst11 = (src11 - src12 - src13);
+    VEC dst02 = (src20 + src21 + src22);
+    VEC dst12 = (src21 - src22 - src23);
+    VEC dst03 = (src30 + src31 + src32);
+    VEC dst13 = (src31 - src32 - src33);
+
+    VEC dest00 = (dst00 + dst01 + dst02);
+    VEC dest10 = (dst01 - dst02 - dst03);
+    VEC dest01 = (dst10 + dst11 + dst12);
+    VEC dest11 = (dst11 - dst12 - dst13);
+
+    if (bias_value) {
+        VEC bias = VEC::loadu(bias_value);
+        dest00   = (dest00 + bias);
+        dest10   = (dest10 + bias);
+        dest01   = (dest01 + bias);
+        dest11   = (dest11 + bias);
+    }
+
+    dest00 = X86Activate(dest00, relu_type);
+    dest10 = X86Activate(dest10, relu_type);
+    dest01 = X86Activate(dest01, relu_type);
+    dest11 = X86Activate(dest11, relu_type);
+
+    VEC::saveu(dest, dest00);
+    VEC::saveu(dest + dest_stride, dest10);
+    dest += dest_h_stride;
+    VEC::saveu(dest, dest01);
+    VEC::saveu(dest + dest_stride, dest11);
+}
+
+// 1D input (BT) and output (AT) transforms of F(m,3), UNIT = m + 2
+template <typename VEC, int UNIT>
+struct WinogradTrans {};
+
+// F(4,3), interpolation points 0, 1, -1, 2, -2, inf
+template <typename VEC>
+struct WinogradTrans<VEC, 6> {
+    // BT=[4,  0, -5,  0, 1, 0,
+    //     0, -4, -4,  1, 1, 0,
+    //     0,  4, -4, -1, 1, 0,
+    //     0, -2, -1,  2, 1, 0,
+    //     0,  2, -1, -2, 1, 0,
+    //     0,  4,  0, -5, 0, 1]
+    static inline void Input(const VEC *s, VEC *d) {
+        VEC t0 = s[4] - s[2];
+        VEC t1 = (s[3] - s[1]) * 2.f;
+        d[0]   = s[0] * 4.f - s[2] * 5.f + s[4];
+        d[1]   = s[3] + s[4] - (s[1] + s[2]) * 4.f;
+        d[2]   = s[4] - s[3] + (s[1] - s[2]) * 4.f;
+        d[3]   = t0 + t1;
+        d[4]   = t0 - t1;
+        d[5]   = s[1] * 4.f - s[3] * 5.f + s[5];
+    }
+
+    // AT=[1, 1,  1, 1,  1, 0,
+    //     0, 1, -1, 2, -2, 0,
+    //     0, 1,  1, 4,  4, 0,
+    //     0, 1, -1, 8, -8, 1]
+    static inline void Output(const VEC *s, VEC *d) {
+        VEC a1 = s[1] + s[2];
+        VEC b1 = s[1] - s[2];
+        VEC a2 = s[3] + s[4];
+        VEC b2 = s[3] - s[4];
+        d[0]   = s[0] + a1 + a2;
+        d[1]   = b1 + b2 * 2.f;
+        d[2]   = a1 + a2 * 4.f;
+        d[3]   = b1 + b2 * 8.f + s[5];
+    }
+};
+
+// F(6,3), interpolation points 0, 1, -1, 2, -2, 1/2, -1/2, inf
+template <typename VEC>
+struct WinogradTrans<VEC, 8> {
+    // BT=[1,  0,    -5.25,  0,     5.25,  0,    -1, 0,
+    //     0,  1,     1,    -4.25, -4.25,  1,     1, 0,
+    //     0, -1,     1,     4.25, -4.25, -1,     1, 0,
+    //     0,  0.5,   0.25, -2.5,  -1.25,  2,     1, 0,
+    //     0, -0.5,   0.25,  2.5,  -1.25, -2,     1, 0,
+    //     0,  2,     4,    -2.5,  -5,     0.5,   1, 0,
+    //     0, -2,     4,     2.5,  -5,    -0.5,   1, 0,
+    //     0, -1,     0,     5.25,  0,    -5.25,  0, 1]
+    static inline void Input(const VEC *s, VEC *d) {
+        VEC a1 = s[2] + s[6] - s[4] * 4.25f;
+        VEC b1 = s[1] + s[5] - s[3] * 4.25f;
+        VEC a2 = s[2] * 0.25f - s[4] * 1.25f + s[6];
+        VEC b2 = s[1] * 0.5f - s[3] * 2.5f + s[5] * 2.f;
+        VEC a3 = s[2] * 4.f - s[4] * 5.f + s[6];
+        VEC b3 = s[1] * 2.f - s[3] * 2.5f + s[5] * 0.5f;
+        d[0]   = s[0] - s[6] + (s[4] - s[2]) * 5.25f;
+        d[1]   = a1 + b1;
+        d[2]   = a1 - b1;
+        d[3]   = a2 + b2;
+        d[4]   = a2 - b2;
+        d[5]   = a3 + b3;
+        d[6]   = a3 - b3;
+        d[7]   = s[7] - s[1] + (s[3] - s[5]) * 5.25f;
+    }
+
+    // AT=[1, 1,  1,  1,   1, 32,  32, 0,
+    //     0, 1, -1,  2,  -2, 16, -16, 0,
+    //     0, 1,  1,  4,   4,  8,   8, 0,
+    //     0, 1, -1,  8,  -8,  4,  -4, 0,
+    //     0, 1,  1, 16,  16,  2,   2, 0,
+    //     0, 1, -1, 32, -32,  1,  -1, 1]
+    static inline void Output(const VEC *s, VEC *d) {
+        VEC a1 = s[1] + s[2];
+        VEC b1 = s[1] - s[2];
+        VEC a2 = s[3] + s[4];
+        VEC b2 = s[3] - s[4];
+        VEC a3 = s[5] + s[6];
+        VEC b3 = s[5] - s[6];
+        d[0]   = s[0] + a1 + a2 + a3 * 32.f;
+        d[1]   = b1 + b2 * 2.f + b3 * 16.f;
+        d[2]   = a1 + a2 * 4.f + a3 * 8.f;
+        d[3]   = b1 + b2 * 8.f + b3 * 4.f;
+        d[4]   = a1 + a2 * 16.f + a3 * 2.f;
+        d[5]   = b1 + b2 * 32.f + b3 + s[7];
+    }
+};
+
+// input transform of a UNIT x UNIT tile, rows first then columns, same layout as input_trans_4x4
+template <typename VEC, int UNIT>
+static void input_trans(const float *src, int src_stride, int src_h_stride, float *dest, int dest_stride,
+                        int dest_h_stride) {
+    VEC s[UNIT];
+    VEC d[UNIT];
+    VEC m[UNIT][UNIT];
+
+    for (int i = 0; i < UNIT; i++) {
+        const float *src_i = src + i * src_h_stride;
+        for (int j = 0; j < UNIT; j++) {
+            s[j] = VEC::loadu(src_i + j * src_stride);
+        }
+        WinogradTrans<VEC, UNIT>::Input(s, m[i]);
+    }
+
+    for (int j = 0; j < UNIT; j++) {
+        for (int i = 0; i < UNIT; i++) {
+            s[i] = m[i][j];
+        }
+        WinogradTrans<VEC, UNIT>::Input(s, d);
+        float *dest_j = dest + j * dest_h_stride;
+        for (int i = 0; i < UNIT; i++) {
+            VEC::saveu(dest_j + i * dest_stride, d[i]);
+        }
+    }
+}
+
+// output transform of a UNIT x UNIT tile with bias and relu, same layout as output_trans_post_2x4
+template <typename VEC, int UNIT>
+static void output_trans_post(const float *src, int src_stride, int src_h_stride, float *dest, int dest_stride,
+                              int dest_h_stride, const float *bias_value, int relu_type) {
+    const int DST_UNIT = UNIT - 2;
+    VEC s[UNIT];
+    VEC d[UNIT];
+    VEC m[UNIT][UNIT];
+
+    for (int i = 0; i < UNIT; i++) {
+        const float *src_i = src + i * src_h_stride;
+        for (int j = 0; j < UNIT; j++) {
+            s[j] = VEC::loadu(src_i + j * src_stride);
+        }
+        WinogradTrans<VEC, UNIT>::Output(s, m[i]);
+    }
+
+    VEC bias = bias_value ? VEC::loadu(bias_value) : VEC(0.f);
+    for (int j = 0; j < DST_UNIT; j++) {
+        for (int i = 0; i < UNIT; i++) {
+            s[i] = m[i][j];
+        }
+        WinogradTrans<VEC, UNIT>::Output(s, d);
+        float *dest_j = dest + j * dest_h_stride;
+        for (int i = 0; i < DST_UNIT; i++) {
+            VEC::saveu(dest_j + i * dest_stride, X86Activate(d[i] + bias, relu_type));
+        }
+    }
+}
+
+template <typename VEC, int pack>
+X86WinogradKernels CreateX86WinogradKernels() {
+    X86WinogradKernels kernels;
+    kernels.pack               = pack;
+    kernels.pack_input         = pack == 8 ? pack_input_c8 : pack_input_c4;
+    kernels.pack_input_blocked = pack_input_blocked<pack>;
+    kernels.unpack_output      = pack == 8 ? unpack_output_c8 : unpack_output_c4;
+    kernels.gemm               = gemm_kernel_avx<VEC, 6, pack, pack>;
+    kernels.input_trans[0]     = input_trans_4x4<VEC>;
+    kernels.input_trans[1]     = input_trans<VEC, 6>;
+    kernels.input_trans[2]     = input_trans<VEC, 8>;
+    kernels.output_trans[0]    = output_trans_post_2x4<VEC>;
+    kernels.output_trans[1]    = output_trans_post<VEC, 6>;
+    kernels.output_trans[2]    = output_trans_post<VEC, 8>;
+    return kernels;
+}
+
+#ifdef TNN_X86_COMPUTE_AVX2
+X86WinogradKernels CreateAvx2WinogradKernels() {
+    return CreateX86WinogradKernels<Float8, 8>();
+}
+
+}  // namespace X86_COMPUTE_NAMESPACE
+#else
+
+#ifdef TNN_X86_FAT_BINARY
+namespace x86_avx2 {
+X86WinogradKernels CreateAvx2WinogradKernels();
+}  // namespace x86_avx2
+#endif
+
+// the avx2 table is only created once an avx2 cpu asks for it, creating it runs avx2 code in fat binaries
+const X86WinogradKernels &GetX86WinogradKernels(x86_isa_t arch) {
+    if (arch == avx2) {
+#ifdef TNN_X86_FAT_BINARY
+        static const X86WinogradKernels avx_kernels = x86_avx2::CreateAvx2WinogradKernels();
+#else
+        static const X86WinogradKernels avx_kernels = CreateX86WinogradKernels<Float8, 8>();
+#endif
+        return avx_kernels;
+    }
+    static const X86WinogradKernels sse_kernels = CreateX86WinogradKernels<Float4, 4>();
+    return sse_kernels;
+}
+#endif
+
+}  // namespace TNN_NS
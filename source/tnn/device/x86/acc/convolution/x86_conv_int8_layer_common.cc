@@ -65,17 +65,32 @@ Status X86ConvInt8LayerCommon::allocateBufferWeight(const std::vector<Blob *> &i
 
         int weight_count   = group * oc_g_r4 * icrs_g_r16;
         int data_byte_size = weight_count * DataTypeUtils::GetBytesSize(conv_res->filter_handle.GetDataType());
-        RawBuffer temp_buffer(data_byte_size + SIMD_KERNEL_EXTRA_LOAD);
-
-        for (int g = 0; g < group; g++) {
-            auto weight_src_g = conv_res->filter_handle.force_to<int8_t *>() + g * oc_g * icrs_g;
-            auto weight_dst_g = temp_buffer.force_to<int8_t *>() + g * oc_g_r4 * icrs_g_r16;
-            // from [o][i][h][w]
-            // to: [o/4][h][w][i/16][o4][i16]
-            PackINT8Weight(weight_src_g, weight_dst_g, ic_g, oc_g,
-                           conv_param->kernels[1], conv_param->kernels[0]);
-        }
-        buffer_weight_ = temp_buffer;
+
+        auto pack_weight = [&](RawBuffer &temp_buffer) -> Status {
+            temp_buffer = RawBuffer(data_byte_size + SIMD_KERNEL_EXTRA_LOAD);
+            for (int g = 0; g < group; g++) {
+                auto weight_src_g = conv_res->filter_handle.force_to<int8_t *>() + g * oc_g * icrs_g;
+                auto weight_dst_g = temp_buffer.force_to<int8_t *>() + g * oc_g_r4 * icrs_g_r16;
+                // from [o][i][h][w]
+                // to: [o/4][h][w][i/16][o4][i16]
+                PackINT8Weight(weight_src_g, weight_dst_g, ic_g, oc_g,
+                               conv_param->kernels[1], conv_param->kernels[0]);
+            }
+            return TNN_OK;
+        };
+        RETURN_ON_NEQ(GetSharedPackedBuffer("conv_int8_gemm", pack_weight, buffer_weight_), TNN_OK);
+    }
+
+    gemm_arch_ = X86GemmInt8Arch(arch_);
+    if ((gemm_arch_ == avx512_vnni || gemm_arch_ == avx_vnni) && !buffer_gemm_bias_.GetBytesSize()) {
+        const int oc   = dims_output[1];
+        const int icrs = dims_input[1] / conv_param->group * conv_param->kernels[0] * conv_param->kernels[1];
+
+        buffer_gemm_bias_ = RawBuffer(buffer_bias_.GetBytesSize());
+        memcpy(buffer_gemm_bias_.force_to<int32_t *>(), buffer_bias_.force_to<int32_t *>(),
+               buffer_bias_.GetBytesSize());
+        X86GemmInt8VnniCompensate(buffer_gemm_bias_.force_to<int32_t *>(),
+                                  conv_res->filter_handle.force_to<int8_t *>(), oc, icrs);
     }
     return TNN_OK;
 }
@@ -385,6 +400,16 @@ void GemmInt8(int8_t* dst, const int8_t* src, const int8_t* weight, const int32_
         gemm_kernel = X86AVXGemmInt8Unit4x4;
     }
 #endif
+#ifdef TNN_X86_AVX512_VNNI_KERNEL
+    if (arch == avx512_vnni) {
+        gemm_kernel = X86AVX512VNNIGemmInt8Unit4x4;
+    }
+#endif
+#ifdef TNN_X86_AVX_VNNI_KERNEL
+    if (arch == avx_vnni) {
+        gemm_kernel = X86AVXVNNIGemmInt8Unit4x4;
+    }
+#endif
 
     for (int j = 0; j < dst_depth; j += 4) {
         int hw = 0;
@@ -470,7 +495,8 @@ Status X86ConvInt8LayerCommon::DoForward(const std::vector<Blob *> &inputs, cons
     int8_t *add_input_data = add_input ? handle_ptr<int8_t *>(add_input->GetHandle()) : nullptr;
 
     float *scale_ptr   = buffer_scale_.force_to<float *>();
-    int32_t *bias_ptr  = buffer_bias_.force_to<int32_t *>();
+    int32_t *bias_ptr  = buffer_gemm_bias_.GetBytesSize() ? buffer_gemm_bias_.force_to<int32_t *>()
+                                                          : buffer_bias_.force_to<int32_t *>();
     int8_t *weight_ptr = buffer_weight_.force_to<int8_t *>();
 
     const int crs_div8   = UP_DIV(ic_calc * conv_param->kernels[1] * conv_param->kernels[0], 8);
@@ -546,7 +572,7 @@ Status X86ConvInt8LayerCommon::DoForward(const std::vector<Blob *> &inputs, cons
                 GemmInt8(output_kernel, input_kernel, weight_g, bias_g, scale_g,
                          real_hw_tile, crs_div8, crs_div8 * 8, oc_g_r4, relu_,
                          add_input_kernel, buffer_add_scale_.force_to<float *>(),
-                         relu6_max_g, arch_);
+                         relu6_max_g, gemm_arch_);
             }
 
             if (conv_param->group > 1) {
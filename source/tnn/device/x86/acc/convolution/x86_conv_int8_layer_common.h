@@ -55,8 +55,11 @@ protected:
     RawBuffer buffer_add_scale_;
     // for conv relu6 fusion
     RawBuffer relu6_max_;
+    // bias with the compensation of the vnni gemm kernels
+    RawBuffer buffer_gemm_bias_;
 
     long relu_ = 0;
+    x86_isa_t gemm_arch_ = sse42;
     int tile_blk_ = 32;
 
     std::function<void(int8_t *, const int8_t *, const ConvLayerParam *, size_t, size_t, int,
@@ -59,18 +59,21 @@ Status X86ConvInt8LayerDepthwise::allocateBufferWeight(const std::vector<Blob *>
         const int channel  = inputs[0]->GetBlobDesc().dims[1];
         const int c_4      = ROUND_UP(channel, 4);
         int data_byte_size = c_4 * kh * kw;
-        RawBuffer temp_buffer(data_byte_size);
-        int8_t *temp_ptr = temp_buffer.force_to<int8_t *>();
-
-        for (int c = 0; c < channel; c++) {
-            int8_t *f_c = filter + c * kw * kh;
-            int8_t *t_c = temp_ptr + c;
-            for (int k = 0; k < kh * kw; k++) {
-                t_c[k * c_4] = f_c[k];
-            }
-        }
 
-        buffer_weight_ = temp_buffer;
+        auto pack_weight = [&](RawBuffer &temp_buffer) -> Status {
+            temp_buffer      = RawBuffer(data_byte_size);
+            int8_t *temp_ptr = temp_buffer.force_to<int8_t *>();
+
+            for (int c = 0; c < channel; c++) {
+                int8_t *f_c = filter + c * kw * kh;
+                int8_t *t_c = temp_ptr + c;
+                for (int k = 0; k < kh * kw; k++) {
+                    t_c[k * c_4] = f_c[k];
+                }
+            }
+            return TNN_OK;
+        };
+        RETURN_ON_NEQ(GetSharedPackedBuffer("conv_int8_depthwise", pack_weight, buffer_weight_), TNN_OK);
     }
     return TNN_OK;
 }
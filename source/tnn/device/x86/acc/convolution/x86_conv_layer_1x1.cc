@@ -50,6 +50,15 @@ bool X86ConvLayer1x1::isPrefered(ConvLayerParam *param, const std::vector<Blob *
 
 X86ConvLayer1x1::~X86ConvLayer1x1() {}
 
+// packed input of each thread, no im2col buffer
+size_t X86ConvLayer1x1::GetWorkspaceSize(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
+    auto dims_input     = inputs[0]->GetBlobDesc().dims;
+    int max_num_threads = PARALLEL_MAX_THREADS_NUM_;
+    auto gemm_conf      = conv_gemm_conf_;
+    conv_ajust_m_blk_size(max_num_threads, dims_input[2] * dims_input[3], gemm_conf.M_c_, gemm_conf.m_block_);
+    return gemm_conf.M_c_ * gemm_conf.K_c_ * max_num_threads * sizeof(float);
+}
+
 Status X86ConvLayer1x1::DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
     ConvLayerParam *param = dynamic_cast<ConvLayerParam *>(param_);
 
@@ -74,14 +83,9 @@ Status X86ConvLayer1x1::DoForward(const std::vector<Blob *> &inputs, const std::
     int n = src_z_step;
     int k = dims_input[1];
 
-    int max_num_threads = OMP_MAX_THREADS_NUM_;
-    conv_ajust_m_blk_size(max_num_threads, src_z_step, conv_gemm_conf_.M_c_);
-
-    int m_c = conv_gemm_conf_.M_c_;
-    int k_c = conv_gemm_conf_.K_c_;
-
-    float *src_buf = reinterpret_cast<float *>(
-        context_->GetSharedWorkSpace(m_c * k_c * max_num_threads * sizeof(float)));
+    float *src_buf = reinterpret_cast<float *>(GetWorkSpace(GetWorkspaceSize(inputs, outputs)));
+    int max_num_threads = PARALLEL_MAX_THREADS_NUM_;
+    conv_ajust_m_blk_size(max_num_threads, src_z_step, conv_gemm_conf_.M_c_, conv_gemm_conf_.m_block_);
 
     for (int batch_idx = 0; batch_idx < batch; batch_idx++) {
         const float * B = src_origin + batch_idx * k * n;
@@ -28,7 +28,22 @@ public:
     static bool isPrefered(ConvLayerParam *param, const std::vector<Blob *> &inputs,
                            const std::vector<Blob *> &outputs);
 
+    // @brief whether the winograd kernels read and write the blocked layout of the input directly, which needs
+    // kernels of the pack of the layout
+    static bool isBlockedPrefered(ConvLayerParam *param, const std::vector<Blob *> &inputs,
+                                  const std::vector<Blob *> &outputs);
+
     virtual Status allocateBufferWeight(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs);
+
+    // @brief output tile size m of F(mxm,3x3) with the least estimated cost, 2, 4 or 6
+    static int GetWinogradUnit(int ic, int oc, int oh, int ow);
+
+protected:
+    virtual X86WorkspaceLayout GetWorkspaceLayout(const std::vector<Blob *> &inputs,
+                                                  const std::vector<Blob *> &outputs);
+
+    // output tile size, chosen at init for the output size of the net
+    int dst_unit_ = 2;
 };
 
 }  // namespace TNN_NS
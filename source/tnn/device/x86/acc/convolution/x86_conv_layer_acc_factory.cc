@@ -17,6 +17,7 @@
 #include "tnn/device/x86/acc/convolution/x86_conv_layer_depthwise.h"
 #include "tnn/device/x86/acc/convolution/x86_conv_layer_1x1.h"
 #include "tnn/device/x86/acc/convolution/x86_conv_layer_3x3.h"
+#include "tnn/device/x86/acc/convolution/x86_conv_layer_blocked.h"
 #include "tnn/device/x86/acc/convolution/x86_conv_layer_common.h"
 #include "tnn/device/x86/acc/convolution/x86_conv_int8_layer_common.h"
 #include "tnn/device/x86/acc/convolution/x86_conv_int8_layer_depthwise.h"
@@ -25,7 +26,7 @@ namespace TNN_NS {
 
 /*
 get different impl based on conv params
-X86ConvLayerCommon always as the last solution
+X86ConvLayerCommon always as the last solution, it computes blocked inputs in nchw copies
 */
 void X86ConvLayerAccFactory::CreateImpFP(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs,
                                          LayerParam *param, std::shared_ptr<X86LayerAcc> &conv_acc_impl) {
@@ -33,6 +34,15 @@ void X86ConvLayerAccFactory::CreateImpFP(const std::vector<Blob *> &inputs, cons
         if (!dynamic_cast<X86ConvLayerDepthwise *>(conv_acc_impl.get())) {
             conv_acc_impl = std::make_shared<X86ConvLayerDepthwise>();
         }
+    } else if (X86ConvLayer3x3::isBlockedPrefered(dynamic_cast<ConvLayerParam *>(param), inputs, outputs)) {
+        // winograd 3x3 reads and writes the blocked layout directly
+        if (!dynamic_cast<X86ConvLayer3x3 *>(conv_acc_impl.get())) {
+            conv_acc_impl = std::make_shared<X86ConvLayer3x3>();
+        }
+    } else if (X86ConvLayerBlocked::isPrefered(dynamic_cast<ConvLayerParam *>(param), inputs, outputs)) {
+        if (!dynamic_cast<X86ConvLayerBlocked *>(conv_acc_impl.get())) {
+            conv_acc_impl = std::make_shared<X86ConvLayerBlocked>();
+        }
     } else if (X86ConvLayer1x1::isPrefered(dynamic_cast<ConvLayerParam *>(param), inputs, outputs)) {
         if (!dynamic_cast<X86ConvLayer1x1*>(conv_acc_impl.get())) {
             conv_acc_impl = std::make_shared<X86ConvLayer1x1>();
@@ -0,0 +1,169 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the 
+// specific language governing permissions and limitations under the License.
+
+#include "tnn/device/x86/acc/convolution/x86_conv_layer_blocked.h"
+#include "tnn/device/x86/x86_common.h"
+#include "tnn/device/x86/x86_context.h"
+#include "tnn/device/x86/x86_util.h"
+#include "tnn/device/x86/acc/compute/x86_compute.h"
+#include "tnn/interpreter/raw_buffer.h"
+#include "tnn/utils/data_type_utils.h"
+#include "tnn/utils/omp_utils.h"
+
+namespace TNN_NS {
+
+/*
+X86ConvLayerBlocked computes the convs without group in the blocked layout,
+any kernel size, pads, strides and dilations
+*/
+bool X86ConvLayerBlocked::isPrefered(ConvLayerParam *param, const std::vector<Blob *> &inputs,
+                                     const std::vector<Blob *> &outputs) {
+    if (!param) {
+        return false;
+    }
+
+    const auto &desc = inputs[0]->GetBlobDesc();
+    return param->group == 1 && desc.data_type == DATA_TYPE_FLOAT && desc.data_format == GetX86BlockedDataFormat();
+}
+
+X86ConvLayerBlocked::~X86ConvLayerBlocked() {}
+
+// weights of each output channel block as [ic block][kh][kw][ic lane][oc lane], zero in the pad channels
+Status X86ConvLayerBlocked::allocateBufferWeight(const std::vector<Blob *> &inputs,
+                                                 const std::vector<Blob *> &outputs) {
+    ConvLayerParam *param = dynamic_cast<ConvLayerParam *>(param_);
+    CHECK_PARAM_NULL(param);
+    ConvLayerResource *conv_res = dynamic_cast<ConvLayerResource *>(resource_);
+    CHECK_PARAM_NULL(conv_res);
+
+    if (!buffer_weight_.GetBytesSize()) {
+        const int kw             = param->kernels[0];
+        const int kh             = param->kernels[1];
+        const int input_channel  = inputs[0]->GetBlobDesc().dims[1];
+        const int output_channel = outputs[0]->GetBlobDesc().dims[1];
+        const int pack           = arch_ == avx2 ? 8 : 4;
+        const int ic_blocks      = UP_DIV(input_channel, pack);
+        const int oc_blocks      = UP_DIV(output_channel, pack);
+        const float *src         = conv_res->filter_handle.force_to<float *>();
+
+        if (conv_res->filter_handle.GetDataType() == DATA_TYPE_FLOAT) {
+            auto pack_weight = [&](RawBuffer &temp_buffer) -> Status {
+                temp_buffer = RawBuffer(oc_blocks * ic_blocks * kh * kw * pack * pack * sizeof(float));
+                float *dst  = temp_buffer.force_to<float *>();
+
+                for (int oc = 0; oc < output_channel; oc++) {
+                    for (int ic = 0; ic < input_channel; ic++) {
+                        const float *src_k = src + (oc * input_channel + ic) * kh * kw;
+                        float *dst_k = dst + ((oc / pack) * ic_blocks + ic / pack) * kh * kw * pack * pack +
+                                       (ic % pack) * pack + oc % pack;
+                        for (int k = 0; k < kh * kw; k++) {
+                            dst_k[k * pack * pack] = src_k[k];
+                        }
+                    }
+                }
+                temp_buffer.SetDataType(DATA_TYPE_FLOAT);
+                return TNN_OK;
+            };
+            RETURN_ON_NEQ(GetSharedPackedBuffer("conv_blocked", pack_weight, buffer_weight_), TNN_OK);
+        } else {
+            LOGE("Error: DataType %d not support\n", conv_res->filter_handle.GetDataType());
+            return Status(TNNERR_MODEL_ERR, "conv_res DataType is not supported");
+        }
+    }
+    return TNN_OK;
+}
+
+// padded input of one batch
+size_t X86ConvLayerBlocked::GetWorkspaceSize(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
+    ConvLayerParam *param = dynamic_cast<ConvLayerParam *>(param_);
+    auto dims_input       = inputs[0]->GetBlobDesc().dims;
+    int pack              = arch_ == avx2 ? 8 : 4;
+
+    int src_pad_w = dims_input[3] + param->pads[0] + param->pads[1];
+    int src_pad_h = dims_input[2] + param->pads[2] + param->pads[3];
+    return ROUND_UP(ROUND_UP(dims_input[1], pack) * src_pad_h * src_pad_w * sizeof(float), 32);
+}
+
+Status X86ConvLayerBlocked::DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
+    ConvLayerParam *param = dynamic_cast<ConvLayerParam *>(param_);
+
+    auto input       = inputs[0];
+    auto output      = outputs[0];
+    auto dims_input  = input->GetBlobDesc().dims;
+    auto dims_output = output->GetBlobDesc().dims;
+
+    const int pack      = arch_ == avx2 ? 8 : 4;
+    const int batch     = dims_output[0];
+    const int ih        = dims_input[2];
+    const int iw        = dims_input[3];
+    const int oh        = dims_output[2];
+    const int ow        = dims_output[3];
+    const int ic_blocks = UP_DIV(dims_input[1], pack);
+    const int oc_blocks = UP_DIV(dims_output[1], pack);
+    const int kw        = param->kernels[0];
+    const int kh        = param->kernels[1];
+
+    const bool has_pad    = param->pads[0] || param->pads[1] || param->pads[2] || param->pads[3];
+    const int src_pad_w   = iw + param->pads[0] + param->pads[1];
+    const int src_pad_h   = ih + param->pads[2] + param->pads[3];
+    const long src_c_step = (long)src_pad_w * src_pad_h * pack;
+    float *src_pad        = nullptr;
+    if (has_pad) {
+        src_pad = reinterpret_cast<float *>(GetWorkSpace(GetWorkspaceSize(inputs, outputs)));
+    }
+
+    auto &kernels  = GetX86ComputeKernels(arch_);
+    auto conv_func = kernels.conv_blocked[X86ActivationIndex(param->activation_type)];
+
+    const float *src_origin   = handle_ptr<const float *>(input->GetHandle());
+    float *dst_origin         = handle_ptr<float *>(output->GetHandle());
+    const float *weights_data = buffer_weight_.force_to<float *>();
+    const float *bias_data    = buffer_bias_.force_to<float *>();
+    const long weight_oc_step = (long)ic_blocks * kh * kw * pack * pack;
+
+    for (int b = 0; b < batch; b++) {
+        const float *src_b = src_origin + (long)b * ic_blocks * ih * iw * pack;
+        float *dst_b       = dst_origin + (long)b * oc_blocks * oh * ow * pack;
+
+        if (has_pad) {
+            PARALLEL_FOR_(0, ic_blocks, [&](long icb, int) {
+                const float *src_c = src_b + icb * ih * iw * pack;
+                float *dst_c       = src_pad + icb * src_c_step;
+                memset(dst_c, 0, param->pads[2] * src_pad_w * pack * sizeof(float));
+                for (int h = 0; h < ih; h++) {
+                    float *dst_h = dst_c + (param->pads[2] + h) * src_pad_w * pack;
+                    memset(dst_h, 0, param->pads[0] * pack * sizeof(float));
+                    memcpy(dst_h + param->pads[0] * pack, src_c + h * iw * pack, iw * pack * sizeof(float));
+                    memset(dst_h + (param->pads[0] + iw) * pack, 0, param->pads[1] * pack * sizeof(float));
+                }
+                memset(dst_c + (param->pads[2] + ih) * src_pad_w * pack, 0,
+                       param->pads[3] * src_pad_w * pack * sizeof(float));
+            });
+            src_b = src_pad;
+        }
+
+        PARALLEL_FOR_(0, oc_blocks * oh, [&](long index, int) {
+            long ocb         = index / oh;
+            long oy          = index % oh;
+            float *dst       = dst_b + (ocb * oh + oy) * ow * pack;
+            const float *src = src_b + oy * param->strides[1] * src_pad_w * pack;
+            conv_func(dst, src, weights_data + ocb * weight_oc_step, bias_data + ocb * pack, ow, ic_blocks,
+                      src_c_step, kw, kh, param->strides[0] * pack, param->dialations[0] * pack,
+                      param->dialations[1] * src_pad_w * pack);
+        });
+    }
+    return TNN_OK;
+}
+
+}  // namespace TNN_NS
@@ -55,17 +55,20 @@ Status X86ConvLayerCommon::allocateBufferWeight(const std::vector<Blob *> &input
         const float *src = conv_res->filter_handle.force_to<float *>();
 
         if (conv_res->filter_handle.GetDataType() == DATA_TYPE_FLOAT) {
-            RawBuffer temp_buffer(weight_pack_per_group * param->group * sizeof(float));
-            float *dst = temp_buffer.force_to<float *>();
-
-            for (int g = 0; g < param->group; g++) {
-                auto src_g = src + K * M * g;
-                auto dst_g = dst + weight_pack_per_group * g;
-                conv_pack_col_b_n(M, K, src_g, K, dst_g, conv_gemm_conf_);
-            }
-
-            temp_buffer.SetDataType(DATA_TYPE_FLOAT);
-            buffer_weight_ = temp_buffer;
+            auto pack_weight = [&](RawBuffer &temp_buffer) -> Status {
+                temp_buffer = RawBuffer(weight_pack_per_group * param->group * sizeof(float));
+                float *dst  = temp_buffer.force_to<float *>();
+
+                for (int g = 0; g < param->group; g++) {
+                    auto src_g = src + K * M * g;
+                    auto dst_g = dst + weight_pack_per_group * g;
+                    conv_pack_col_b_n(M, K, src_g, K, dst_g, conv_gemm_conf_);
+                }
+
+                temp_buffer.SetDataType(DATA_TYPE_FLOAT);
+                return TNN_OK;
+            };
+            RETURN_ON_NEQ(GetSharedPackedBuffer("conv_gemm", pack_weight, buffer_weight_), TNN_OK);
         } else {
             LOGE("Error: DataType %d not support\n", conv_res->filter_handle.GetDataType());
             return Status(TNNERR_MODEL_ERR, "conv_res DataType is not supported");
@@ -108,6 +111,40 @@ Status X86ConvLayerCommon::Init(Context *context, LayerParam *param, LayerResour
     return TNN_OK;
 }
 
+// im2col buffer of all groups, packed input of each thread and the nchw copies of blocked input and output
+enum { IM2COL_PART = 0, SRC_TRANS_PART, INPUT_NCHW_PART, OUTPUT_NCHW_PART };
+
+X86WorkspaceLayout X86ConvLayerCommon::GetWorkspaceLayout(const std::vector<Blob *> &inputs,
+                                                          const std::vector<Blob *> &outputs) {
+    auto input_dims  = inputs[0]->GetBlobDesc().dims;
+    auto output_dims = outputs[0]->GetBlobDesc().dims;
+    auto param       = dynamic_cast<ConvLayerParam *>(param_);
+    auto oh          = DimsFunctionUtils::GetDim(output_dims, 2);
+    auto ow          = DimsFunctionUtils::GetDim(output_dims, 3);
+    size_t col_size  = param->kernels[0] * param->kernels[1] * oh * ow * (input_dims[1] / param->group);
+
+    // DoForward adjusts the m block of conv_gemm_conf_ the same way
+    int max_num_threads = PARALLEL_MAX_THREADS_NUM_;
+    auto gemm_conf      = conv_gemm_conf_;
+    conv_ajust_m_blk_size(max_num_threads, oh * ow, gemm_conf.M_c_, gemm_conf.m_block_);
+
+    const bool blocked = IsBlockedBlob(inputs[0]);
+    X86WorkspaceLayout layout;
+    layout.Add(col_size * param->group * sizeof(float));
+    layout.Add(gemm_conf.M_c_ * gemm_conf.K_c_ * max_num_threads * sizeof(float));
+    layout.Add(blocked ? DimsVectorUtils::Count(input_dims) * sizeof(float) : 0);
+    layout.Add(blocked ? DimsVectorUtils::Count(output_dims) * sizeof(float) : 0);
+    return layout;
+}
+
+size_t X86ConvLayerCommon::GetWorkspaceSize(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
+    auto param = dynamic_cast<ConvLayerParam *>(param_);
+    if (!param || outputs[0]->GetBlobDesc().data_type != DATA_TYPE_FLOAT) {
+        return 0;
+    }
+    return GetWorkspaceLayout(inputs, outputs).GetSize();
+}
+
 Status X86ConvLayerCommon::DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
     Blob *input_blob    = inputs[0];
     Blob *output_blob   = outputs[0];
@@ -127,20 +164,25 @@ Status X86ConvLayerCommon::DoForward(const std::vector<Blob *> &inputs, const st
     int output_offset_ = output_dims[1] * conv_out_spatial_dim_ / param->group;
     size_t col_offset_ = param->kernels[0] * param->kernels[1] * oh * ow * (input_dims[1] / param->group);
 
-    int max_num_threads = OMP_MAX_THREADS_NUM_;
-    conv_ajust_m_blk_size(max_num_threads, conv_out_spatial_dim_, conv_gemm_conf_.M_c_);
+    auto layout     = GetWorkspaceLayout(inputs, outputs);
+    void *workspace = GetWorkSpace(layout.GetSize());
 
-    int m_c = conv_gemm_conf_.M_c_;
-    int k_c = conv_gemm_conf_.K_c_;
+    int max_num_threads = PARALLEL_MAX_THREADS_NUM_;
+    conv_ajust_m_blk_size(max_num_threads, conv_out_spatial_dim_, conv_gemm_conf_.M_c_, conv_gemm_conf_.m_block_);
+    int k_c     = conv_gemm_conf_.K_c_;
     int n_block = conv_gemm_conf_.n_block_;
-    size_t src_trans_size = m_c * k_c;
-
-    size_t im2col_size = ROUND_UP(col_offset_ * param->group * sizeof(float), 32);
-    size_t workspace_size = (im2col_size + ROUND_UP(src_trans_size * max_num_threads * sizeof(float), 32));
-    float *workspace = reinterpret_cast<float *>(context_->GetSharedWorkSpace(workspace_size));
 
-    float *im2col_workspace = workspace;
-    float *src_trans_workspace = workspace + im2col_size / sizeof(float);
+    float *im2col_workspace    = layout.Get<float>(workspace, IM2COL_PART);
+    float *src_trans_workspace = layout.Get<float>(workspace, SRC_TRANS_PART);
+    // blocked blobs are computed in nchw copies at the end of the workspace
+    const bool blocked = IsBlockedBlob(input_blob);
+    const int pack     = GetBlockedDataFormatPack(input_blob->GetBlobDesc().data_format);
+    if (blocked) {
+        float *input_nchw = layout.Get<float>(workspace, INPUT_NCHW_PART);
+        BlockedToNCHW(input_nchw, static_cast<float *>(input_ptr), input_dims, pack);
+        input_ptr  = input_nchw;
+        output_ptr = layout.Get<float>(workspace, OUTPUT_NCHW_PART);
+    }
 
     int K = input_dims[1] * param->kernels[0] * param->kernels[1] / param->group;
     int M = output_dims[1] / param->group;
@@ -175,6 +217,11 @@ Status X86ConvLayerCommon::DoForward(const std::vector<Blob *> &inputs, const st
         return Status(TNNERR_DEVICE_ACC_DATA_FORMAT_NOT_SUPPORT, "Error: x86 device not support this data type");
     }
 
+    if (blocked) {
+        NCHWToBlocked(handle_ptr<float *>(output_blob->GetHandle()), static_cast<float *>(output_ptr), output_dims,
+                      pack);
+    }
+
     return TNN_OK;
 }
 }  // namespace TNN_NS
@@ -32,6 +32,8 @@ public:
 
     virtual Status DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs);
 
+    virtual size_t GetWorkspaceSize(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs);
+
     // always true as last solution
     static bool isPrefered(ConvLayerParam *param, const std::vector<Blob *> &inputs,
                            const std::vector<Blob *> &outputs);
@@ -45,6 +47,10 @@ public:
     virtual Status allocateBufferBias(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs);
 
 protected:
+    // @brief parts of the workspace DoForward uses for the shapes of inputs and outputs, GetWorkspaceSize is their size
+    virtual X86WorkspaceLayout GetWorkspaceLayout(const std::vector<Blob *> &inputs,
+                                                  const std::vector<Blob *> &outputs);
+
     bool do_im2col_ = true;
     RawBuffer buffer_weight_;
     RawBuffer buffer_bias_;
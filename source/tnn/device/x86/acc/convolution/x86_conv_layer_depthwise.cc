@@ -62,16 +62,19 @@ Status X86ConvLayerDepthwise::allocateBufferWeight(const std::vector<Blob *> &in
         int data_byte_size = DataTypeUtils::GetBytesSize(conv_res->filter_handle.GetDataType());
 
         if (conv_res->filter_handle.GetDataType() == DATA_TYPE_FLOAT) {
-            RawBuffer temp_buffer(weight_count * data_byte_size);
-            float *dst = temp_buffer.force_to<float *>();
-
-            if (arch_ == avx2) {
-                PackC8(dst, src, kh * kw, kh * kw, kh * kw, group);
-            } else if (arch_ == sse42) {
-                PackC4(dst, src, kh * kw, kh * kw, kh * kw, group);
-            }
-            temp_buffer.SetDataType(DATA_TYPE_FLOAT);
-            buffer_weight_ = temp_buffer;
+            auto pack_weight = [&](RawBuffer &temp_buffer) -> Status {
+                temp_buffer = RawBuffer(weight_count * data_byte_size);
+                float *dst  = temp_buffer.force_to<float *>();
+
+                if (arch_ == avx2) {
+                    PackC8(dst, src, kh * kw, kh * kw, kh * kw, group);
+                } else if (arch_ == sse42) {
+                    PackC4(dst, src, kh * kw, kh * kw, kh * kw, group);
+                }
+                temp_buffer.SetDataType(DATA_TYPE_FLOAT);
+                return TNN_OK;
+            };
+            RETURN_ON_NEQ(GetSharedPackedBuffer("conv_depthwise", pack_weight, buffer_weight_), TNN_OK);
         } else {
             LOGE("Error: DataType %d not support\n", conv_res->filter_handle.GetDataType());
             return Status(TNNERR_MODEL_ERR, "conv_res DataType is not supported");
@@ -107,6 +110,41 @@ void PackWithPad(
     memset(dst_ptr + src_h * src_pad_w_stride, 0, pads[3] * src_pad_w_stride * sizeof(float));
 }
 
+// pad one channel block of a blocked input
+template <int c_pack>
+void CopyWithPad(const float *src, float *dst, std::vector<int> pads, int src_h, int src_w) {
+    int src_pad_w_stride = (src_w + pads[0] + pads[1]) * c_pack;
+    memset(dst, 0, pads[2] * src_pad_w_stride * sizeof(float));
+
+    auto dst_ptr = dst + pads[2] * src_pad_w_stride;
+    for (int i = 0; i < src_h; i++) {
+        auto dst_h_ptr = dst_ptr + i * src_pad_w_stride;
+        memset(dst_h_ptr, 0, pads[0] * c_pack * sizeof(float));
+        memcpy(dst_h_ptr + pads[0] * c_pack, src + i * src_w * c_pack, src_w * c_pack * sizeof(float));
+        memset(dst_h_ptr + pads[0] * c_pack + src_w * c_pack, 0, pads[1] * c_pack * sizeof(float));
+    }
+    memset(dst_ptr + src_h * src_pad_w_stride, 0, pads[3] * src_pad_w_stride * sizeof(float));
+}
+
+// padded input and output tile of each thread
+enum { SRC_PAD_PART = 0, DST_TMP_PART };
+
+X86WorkspaceLayout X86ConvLayerDepthwise::GetWorkspaceLayout(const std::vector<Blob *> &inputs,
+                                                             const std::vector<Blob *> &outputs) {
+    ConvLayerParam *param = dynamic_cast<ConvLayerParam *>(param_);
+    auto dims_input       = inputs[0]->GetBlobDesc().dims;
+    auto dims_output      = outputs[0]->GetBlobDesc().dims;
+    int c_pack            = arch_ == sse42 ? 4 : 8;
+
+    int src_pad_w       = dims_input[3] + param->pads[0] + param->pads[1];
+    int src_pad_h       = dims_input[2] + param->pads[2] + param->pads[3];
+    int max_num_threads = PARALLEL_MAX_THREADS_NUM_;
+    X86WorkspaceLayout layout;
+    layout.Add(src_pad_w * src_pad_h * c_pack * sizeof(float), max_num_threads);
+    layout.Add(dims_output[2] * dims_output[3] * c_pack * sizeof(float), max_num_threads);
+    return layout;
+}
+
 Status X86ConvLayerDepthwise::DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
     ConvLayerParam *param = dynamic_cast<ConvLayerParam *>(param_);
 
@@ -128,29 +166,14 @@ Status X86ConvLayerDepthwise::DoForward(const std::vector<Blob *> &inputs, const
     int dilate_x_step  = c_pack * param->dialations[0];
     int weight_z_step  = param->kernels[0] * param->kernels[1];
 
-    int max_num_threads = OMP_MAX_THREADS_NUM_;
-    size_t src_pad_size = ROUND_UP(src_pad_w * (dims_input[2] + param->pads[2] + param->pads[3]) * c_pack * sizeof(float), 32);
-    size_t dst_tmp_size = ROUND_UP(dst_z_step * c_pack * sizeof(float), 32);
-    float *workspace = reinterpret_cast<float *>(context_->GetSharedWorkSpace(
-                                                 (src_pad_size + dst_tmp_size) * max_num_threads));
+    auto layout     = GetWorkspaceLayout(inputs, outputs);
+    void *workspace = GetWorkSpace(layout.GetSize());
 
     const float *src_origin = handle_ptr<const float *>(input->GetHandle());
     float *dst_origin = handle_ptr<float *>(output->GetHandle());
 
-    auto dw_full = DepthwiseConv<ActivationType_None, Float8, 8>;
-    if (param->activation_type == ActivationType_ReLU) {
-        dw_full  = DepthwiseConv<ActivationType_ReLU, Float8, 8>;
-    } else if (param->activation_type == ActivationType_ReLU6) {
-        dw_full  = DepthwiseConv<ActivationType_ReLU6, Float8, 8>;
-    }
-    if (arch_ == sse42) {
-        dw_full = DepthwiseConv<ActivationType_None, Float4, 4>;
-        if (param->activation_type == ActivationType_ReLU) {
-            dw_full  = DepthwiseConv<ActivationType_ReLU, Float4, 4>;
-        } else if (param->activation_type == ActivationType_ReLU6) {
-            dw_full  = DepthwiseConv<ActivationType_ReLU6, Float4, 4>;
-        }
-    }
+    auto &kernels = GetX86ComputeKernels(arch_);
+    auto dw_full  = kernels.depthwise_conv[X86ActivationIndex(param->activation_type)];
 
     auto PackWithPadAcc = PackWithPad<8>;
     if (arch_ == sse42) {
@@ -162,31 +185,53 @@ Status X86ConvLayerDepthwise::DoForward(const std::vector<Blob *> &inputs, const
         UnpackAcc = UnpackC4;
     }
 
+    auto CopyWithPadAcc = CopyWithPad<8>;
+    if (arch_ == sse42) {
+        CopyWithPadAcc = CopyWithPad<4>;
+    }
+
+    // blocked blobs are read and written in place, only the padding needs a copy of the input
+    const bool blocked   = IsBlockedBlob(input);
+    const bool has_pad   = param->pads[0] || param->pads[1] || param->pads[2] || param->pads[3];
+    const int src_c_step = blocked ? ROUND_UP(dims_input[1], c_pack) : dims_input[1];
+    const int dst_c_step = blocked ? ROUND_UP(dims_output[1], c_pack) : dims_output[1];
+
     float *weights_data = buffer_weight_.force_to<float*>();
     float *bias_data = buffer_bias_.force_to<float*>();;
 
     for (int batch_idx = 0; batch_idx < batch; batch_idx++) {
-        auto src_ptr = src_origin + batch_idx * dims_input[1] * src_z_step;
-        auto dst_ptr = dst_origin + batch_idx * dims_output[1] * dst_z_step;
+        auto src_ptr = src_origin + batch_idx * src_c_step * src_z_step;
+        auto dst_ptr = dst_origin + batch_idx * dst_c_step * dst_z_step;
 
-        OMP_PARALLEL_FOR_GUIDED_
-        for (int dz = 0; dz < dims_output[1]; dz += c_pack) {
+        PARALLEL_FOR_(0, UP_DIV(dims_output[1], c_pack), [&](long dz_idx, int thread_id) {
+            int dz          = dz_idx * c_pack;
             int real_dz     = MIN(c_pack, dims_output[1] - dz);
             auto *dst_z     = dst_ptr + dst_z_step * dz;
             auto *src_z     = src_ptr + src_z_step * dz;
             auto *weight_dz = weights_data + dz * weight_z_step;
             auto *bias_z    = bias_data + dz;
-            int thread_id   = OMP_TID_;
-            auto *tmp_buf   = workspace + thread_id * ((src_pad_size + dst_tmp_size) / sizeof(float));
-            auto *src_buf   = tmp_buf;
-            auto *dst_buf   = tmp_buf + src_pad_size / sizeof(float);
-
-            PackWithPadAcc(src_z, src_buf, param->pads, dims_input[2], dims_input[3], real_dz);
-            dw_full(dst_buf, src_buf, weight_dz, bias_z, dims_output[3], param->strides[0] * c_pack,
+            auto *src_buf   = layout.Get<float>(workspace, SRC_PAD_PART, thread_id);
+            auto *dst_buf   = layout.Get<float>(workspace, DST_TMP_PART, thread_id);
+
+            const float *dw_src = src_buf;
+            if (blocked) {
+                // the block of channel dz starts at dz * z_step in the blocked layout as well
+                if (has_pad) {
+                    CopyWithPadAcc(src_z, src_buf, param->pads, dims_input[2], dims_input[3]);
+                } else {
+                    dw_src = src_z;
+                }
+                dst_buf = dst_z;
+            } else {
+                PackWithPadAcc(src_z, src_buf, param->pads, dims_input[2], dims_input[3], real_dz);
+            }
+            dw_full(dst_buf, dw_src, weight_dz, bias_z, dims_output[3], param->strides[0] * c_pack,
                     param->kernels[0], param->kernels[1], dilate_x_step, dilate_y_step,
                     dims_output[2], src_pad_w * c_pack * param->strides[1], dims_output[3] * c_pack);
-            UnpackAcc(dst_z, dst_buf, dst_z_step, dst_z_step, dst_z_step, real_dz);
-        }
+            if (!blocked) {
+                UnpackAcc(dst_z, dst_buf, dst_z_step, dst_z_step, dst_z_step, real_dz);
+            }
+        });
     }
     return TNN_OK;
 }
@@ -29,6 +29,10 @@ public:
                            const std::vector<Blob *> &outputs);
 
     virtual Status allocateBufferWeight(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs);
+
+protected:
+    virtual X86WorkspaceLayout GetWorkspaceLayout(const std::vector<Blob *> &inputs,
+                                                  const std::vector<Blob *> &outputs);
 };
 
 }  // namespace TNN_NS
@@ -115,22 +115,12 @@ Status X86DeconvLayerCommon::Init(Context *context, LayerParam *param, LayerReso
     RETURN_ON_NEQ(allocateBufferWeight(inputs, outputs), TNN_OK);
     RETURN_ON_NEQ(allocateBufferBias(inputs, outputs), TNN_OK);
 
-    switch (conv_param->activation_type) {
-        case ActivationType_None:
-            post_func_ = (arch_ == avx2) ? X86_Post_Exec<ActivationType_None, Float8, 8>
-                                         : X86_Post_Exec<ActivationType_None, Float4, 4>;
-            break;
-        case ActivationType_ReLU:
-            post_func_ = (arch_ == avx2) ? X86_Post_Exec<ActivationType_ReLU, Float8, 8>
-                                         : X86_Post_Exec<ActivationType_ReLU, Float4, 4>;
-            break;
-        case ActivationType_ReLU6:
-            post_func_ = (arch_ == avx2) ? X86_Post_Exec<ActivationType_ReLU6, Float8, 8>
-                                         : X86_Post_Exec<ActivationType_ReLU6, Float4, 4>;
-            break;
-        default:
-            break;
+    int activation_index = X86ActivationIndex(conv_param->activation_type);
+    if (activation_index < 0) {
+        LOGE("Error: x86 deconv does not support activation type %d\n", conv_param->activation_type);
+        return Status(TNNERR_LAYER_ERR, "x86 deconv does not support the activation type");
     }
+    post_func_ = GetX86ComputeKernels(arch_).post_exec[activation_index];
 
     return TNN_OK;
 }
@@ -152,7 +142,7 @@ Status X86DeconvLayerCommon::DoForward(const std::vector<Blob *> &inputs, const
         param->kernels[0] * param->kernels[1] * input_dims[2] * input_dims[3] * (output_dims[1] / param->group);
 
     int max_num_threads = OMP_MAX_THREADS_NUM_;
-    conv_ajust_m_blk_size(max_num_threads, conv_in_spatial_dim_, conv_gemm_conf_.M_c_);
+    conv_ajust_m_blk_size(max_num_threads, conv_in_spatial_dim_, conv_gemm_conf_.M_c_, conv_gemm_conf_.m_block_);
 
     int m_c               = conv_gemm_conf_.M_c_;
     int k_c               = conv_gemm_conf_.K_c_;
@@ -14,27 +14,9 @@
 
 #include "tnn/device/x86/acc/x86_unary2_layer_acc.h"
 
-#include <cmath>
-#include <algorithm>
-
 namespace TNN_NS {
-typedef struct x86_abs_operator : x86_unary2_operator {
-    virtual float operator()(const float v) {
-        return fabs(v);
-    }
-
-    virtual Float4 operator()(const Float4 &v) {
-        return Float4::abs(v);
-    }
-
-    virtual Float8 operator()(const Float8 &v) {
-        return Float8::abs(v);
-    }
-} X86_ABS_OP;
-
-X86_REGISTER_UNARY2_KERNEL(LAYER_ABS, avx2, unary2_kernel_avx<X86_ABS_OP>);
-X86_REGISTER_UNARY2_KERNEL(LAYER_ABS, sse42, unary2_kernel_sse<X86_ABS_OP>);
 DECLARE_X86_UNARY2_ACC(Abs, LAYER_ABS);
 REGISTER_X86_ACC(Abs, LAYER_ABS);
+REGISTER_X86_BLOCKED_LAYOUT(LAYER_ABS, false);
 
 }   // namespace TNN_NS
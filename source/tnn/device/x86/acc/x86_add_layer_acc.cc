@@ -92,5 +92,6 @@ Status X86AddLayerAcc::DoForward(const std::vector<Blob *> &inputs, const std::v
 }
 
 REGISTER_X86_ACC(Add, LAYER_ADD);
+REGISTER_X86_BLOCKED_LAYOUT(LAYER_ADD, false);
 
 }   // namespace TNN_NS
\ No newline at end of file
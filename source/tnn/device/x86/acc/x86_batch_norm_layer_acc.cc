@@ -42,6 +42,15 @@ Status X86BatchNormLayerAcc::Init(Context *context, LayerParam *param, LayerReso
     return TNN_OK;
 }
 
+bool X86BatchNormLayerAcc::SupportInplace(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs,
+                                          int input_index) {
+    return input_index == 0;
+}
+
+bool X86BatchNormLayerAcc::SupportBlockedLayout() {
+    return true;
+}
+
 Status X86BatchNormLayerAcc::DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
     
     auto resource = dynamic_cast<BatchNormLayerResource *>(resource_);
@@ -52,10 +61,8 @@ Status X86BatchNormLayerAcc::DoForward(const std::vector<Blob *> &inputs, const
     auto input_blob        = inputs[0];
     auto output_blob       = outputs[0];
 
-    auto x86_fma_func = X86_FMA<Float4, 4>;
-    if (arch_ == avx2) {
-        x86_fma_func = X86_FMA<Float8, 8>;
-    }
+    auto &kernels     = GetX86ComputeKernels(arch_);
+    auto x86_fma_func = IsBlockedBlob(input_blob) ? kernels.fma_blocked : kernels.fma;
 
     RawBuffer scale_handle = resource->scale_handle;
     bool shared_channel     = scale_handle.GetBytesSize() == DataTypeUtils::GetBytesSize(scale_handle.GetDataType());
@@ -71,5 +78,6 @@ Status X86BatchNormLayerAcc::DoForward(const std::vector<Blob *> &inputs, const
 }
 
 REGISTER_X86_ACC(BatchNorm, LAYER_BATCH_NORM);
+REGISTER_X86_BLOCKED_LAYOUT(LAYER_BATCH_NORM, false);
 
 }  // namespace TNN_NS
@@ -27,7 +27,13 @@ public:
                 const std::vector<Blob *> &outputs) override;
     virtual Status DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) override;
 
+    // @brief each element is read before the same element of output is written
+    virtual bool SupportInplace(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs,
+                                int input_index) override;
+
 protected:
+    virtual bool SupportBlockedLayout() override;
+
     std::shared_ptr<LayerResource> bn_acc_f32_resource_ = nullptr;
 };
 
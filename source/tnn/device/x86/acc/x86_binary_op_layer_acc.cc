@@ -18,8 +18,7 @@
 #include "tnn/utils/data_format_converter.h"
 #include "tnn/utils/data_type_utils.h"
 #include "tnn/utils/dims_utils.h"
-#include "tnn/device/x86/acc/Float4.h"
-#include "tnn/device/x86/acc/Float8.h"
+#include "tnn/device/x86/acc/compute/x86_compute.h"
 
 namespace TNN_NS {
 
@@ -46,47 +45,6 @@ template<> float binary_op<X86BinaryOpType::kMIN>(const float &a, const float &b
     return a < b ? a : b;
 }
 
-template<X86BinaryOpType type, typename VEC>
-VEC binary_op(const VEC &a, const VEC &b) {
-    return a;
-}
-template<> Float4 binary_op<X86BinaryOpType::kADD, Float4>(const Float4 &a, const Float4 &b) {
-    return Float4::add(a, b);
-}
-template<> Float4 binary_op<X86BinaryOpType::kSUB, Float4>(const Float4 &a, const Float4 &b) {
-    return Float4::sub(a, b);
-}
-template<> Float4 binary_op<X86BinaryOpType::kMUL, Float4>(const Float4 &a, const Float4 &b) {
-    return Float4::mul(a, b);
-}
-template<> Float4 binary_op<X86BinaryOpType::kDIV, Float4>(const Float4 &a, const Float4 &b) {
-    return Float4::div(a, b);
-}
-template<> Float4 binary_op<X86BinaryOpType::kMAX, Float4>(const Float4 &a, const Float4 &b) {
-    return Float4::max(a, b);
-}
-template<> Float4 binary_op<X86BinaryOpType::kMIN, Float4>(const Float4 &a, const Float4 &b) {
-    return Float4::min(a, b);
-}
-template<> Float8 binary_op<X86BinaryOpType::kADD, Float8>(const Float8 &a, const Float8 &b) {
-    return Float8::add(a, b);
-}
-template<> Float8 binary_op<X86BinaryOpType::kSUB, Float8>(const Float8 &a, const Float8 &b) {
-    return Float8::sub(a, b);
-}
-template<> Float8 binary_op<X86BinaryOpType::kMUL, Float8>(const Float8 &a, const Float8 &b) {
-    return Float8::mul(a, b);
-}
-template<> Float8 binary_op<X86BinaryOpType::kDIV, Float8>(const Float8 &a, const Float8 &b) {
-    return Float8::div(a, b);
-}
-template<> Float8 binary_op<X86BinaryOpType::kMAX, Float8>(const Float8 &a, const Float8 &b) {
-    return Float8::max(a, b);
-}
-template<> Float8 binary_op<X86BinaryOpType::kMIN, Float8>(const Float8 &a, const Float8 &b) {
-    return Float8::min(a, b);
-}
-
 static inline void PadShape(const int pad_size, const int dim_size, DimsVector &pad_shape, DimsVector in_shape) {
     int j = 0;
     for (; j < pad_size; j++) {
@@ -133,40 +91,6 @@ static void BroadCastTypeFilter(const DimsVector &dims_output, const DimsVector
     return;
 }
 
-static void BroadCastInit(const DimsVector &dims, const DimsVector &dims0, const DimsVector &dims1, BroadcastType &type,
-                          DimsVector &dims_broadcast, bool &swap_flag) {
-    if (DimsVectorUtils::Equal(dims0, dims1)) {
-        type = BroadcastTypeNormal;
-        dims_broadcast.clear();
-    } else if (DimsVectorUtils::Equal(dims0, dims1, 1) &&
-              (DimsVectorUtils::Count(dims0, 0, 1) == 1 ||
-               DimsVectorUtils::Count(dims1, 0, 1) == 1)) {
-        type = BroadcastTypeElement;
-        dims_broadcast.clear();
-        if (dims0[0] < dims1[0])
-            swap_flag = true;
-    } else if (DimsVectorUtils::Equal(dims0, dims1, 2) &&
-              (DimsVectorUtils::Count(dims0, 0, 2) == 1 ||
-               DimsVectorUtils::Count(dims1, 0, 2) == 1)) {
-        type = BroadcastTypeHeightWidth;
-        dims_broadcast.clear();
-        if (dims0[1] < dims1[1])
-            swap_flag = true;
-    } else if (DimsVectorUtils::Equal(dims0, dims1, 3) &&
-              (DimsVectorUtils::Count(dims0, 0, 3) == 1 ||
-               DimsVectorUtils::Count(dims1, 0, 3) == 1)) {
-        type = BroadcastTypeWidth;
-        dims_broadcast.clear();
-        if (dims0[1] < dims1[1])
-            swap_flag = true;
-    } else if (DimsVectorUtils::Equal(dims0, dims)) {
-        dims_broadcast = dims1;
-    } else {
-        dims_broadcast = dims0;
-        swap_flag      = true;
-    }
-}
-
 static void BinaryComputeOffset(DimsVector &offset, const DimsVector dims_in, const DimsVector dims_out) {
     DimsVector dims_pad_in;
     int pad_size = dims_out.size() - dims_in.size();
@@ -306,231 +230,6 @@ void BinaryGeneral(DimsVector output_shape, const std::vector<DimsVector> &input
     }
 }
 
-/*
-Binary func with different opreator,
-set dims0 full shape, dims1 broadcast shape, so we need to swap input ptrs
-*/
-template <X86BinaryOpType op_type, typename VEC, int pack>
-Status BinaryFunc(float *output_ptr, const float *input0_ptr, const float *input1_ptr, DimsVector &dims0, DimsVector &dims1, DimsVector &output_dims) {
-    DimsVector dims = DimsVectorUtils::Max(dims0, dims1);
-    DimsVector dims_broadcast;
-    BroadcastType type = BroadcastTypeUnknown;
-    auto _input0       = input0_ptr;
-    auto _input1       = input1_ptr;
-    bool swap_flag     = false;
-
-    BroadCastInit(dims, dims0, dims1, type, dims_broadcast, swap_flag);
-
-    if (swap_flag) {
-        std::swap(_input0, _input1);
-    }
-
-    if (dims_broadcast.size() == 1) {
-        type = BroadcastTypeSingle; // dims_broadcast[0] == 1
-    } else if (dims_broadcast.size() >= 2) {
-        type = (dims_broadcast[1] == 1) ? BroadcastTypeSingle : BroadcastTypeChannel;
-    }
-
-    size_t count = DimsVectorUtils::Count(dims);
-    size_t batch_stride = 1;
-    size_t channel_stride = 1;
-    if (dims.size() > 1) {
-        batch_stride = DimsVectorUtils::Count(dims, 1);
-    }
-    if (dims.size() > 2) {
-        channel_stride = DimsVectorUtils::Count(dims, 2);
-    }
-
-    if (type == BroadcastTypeNormal) {
-        size_t n = 0;
-        for (; n + pack - 1 < count; n += pack) {
-            VEC v1 = VEC::loadu(_input0 + n);
-            VEC v2 = VEC::loadu(_input1 + n);
-            VEC::saveu(output_ptr + n, binary_op<op_type, VEC>(v1, v2));
-        }
-        for (; n < count; n++) {
-            output_ptr[n] = binary_op<op_type>(_input0[n], _input1[n]);
-        }
-        return TNN_OK;
-    }
-
-    if (swap_flag) {
-        if (type == BroadcastTypeSingle) {
-            // broadcast single
-            VEC v2 = VEC(_input1[0]);
-            size_t n = 0;
-            for (; n + pack - 1 < count; n += pack) {
-                VEC v1 = VEC::loadu(_input0 + n);
-                VEC::saveu(output_ptr + n, binary_op<op_type, VEC>(v2, v1));
-            }
-            for (; n < count; n++) {
-                output_ptr[n] = binary_op<op_type>(_input1[0], _input0[n]);
-            }
-        } else if (type == BroadcastTypeChannel) {
-            // broadcast channel
-            for (int b = 0; b < dims[0]; b++) {
-                for (int c = 0; c < dims[1]; c++) {
-                    VEC v2 = VEC(_input1[c]);
-                    auto _input0_c = _input0 + b * batch_stride + c * channel_stride;
-                    auto _output_c = output_ptr + b * batch_stride + c * channel_stride;
-                    int hw = 0;
-                    for (; hw + pack - 1 < channel_stride; hw += pack) {
-                        VEC v1 = VEC::loadu(_input0_c + hw);
-                        VEC::saveu(_output_c + hw, binary_op<op_type, VEC>(v2, v1));
-                    }
-                    for (; hw < channel_stride; hw++) {
-                        _output_c[hw] = binary_op<op_type>(_input1[c], _input0_c[hw]);
-                    }
-                }
-            }
-        } else if (type == BroadcastTypeElement) {
-            // broadcast chw
-            for (int b = 0; b < dims[0]; b++) {
-                auto _input0_b = _input0 + b * batch_stride;
-                auto _output_b = output_ptr + b * batch_stride;
-                int chw = 0;
-                for (; chw + pack - 1 < batch_stride; chw += pack) {
-                    VEC v2 = VEC::loadu(_input1 + chw);
-                    VEC v1 = VEC::loadu(_input0_b + chw);
-                    VEC::saveu(_output_b + chw, binary_op<op_type, VEC>(v2, v1));
-                }
-                for (; chw < batch_stride; chw++) {
-                    _output_b[chw] = binary_op<op_type>(_input1[chw], _input0_b[chw]);
-                }
-            }
-        } else if (type == BroadcastTypeHeightWidth) {
-            // broadcast hw
-            for (int b = 0; b < dims[0]; b++) {
-                for (int c = 0; c < dims[1]; c++) {
-                    auto _input0_c = _input0 + b * batch_stride + c * channel_stride;
-                    auto _output_c = output_ptr + b * batch_stride + c * channel_stride;
-                    int hw = 0;
-                    for (; hw + pack - 1 < channel_stride; hw += pack) {
-                        VEC v2 = VEC::loadu(_input1 + hw);
-                        VEC v1 = VEC::loadu(_input0_c + hw);
-                        VEC::saveu(_output_c + hw, binary_op<op_type, VEC>(v2, v1));
-                    }
-                    for (; hw < channel_stride; hw++) {
-                        _output_c[hw] = binary_op<op_type>(_input1[hw], _input0_c[hw]);
-                    }
-                }
-            }
-        } else if (type == BroadcastTypeWidth) {
-            // broadcast w
-            for (int b = 0; b < dims[0]; b++) {
-                for (int c = 0; c < dims[1]; c++) {
-                    auto _input0_c = _input0 + b * batch_stride + c * channel_stride;
-                    auto _output_c = output_ptr + b * batch_stride + c * channel_stride;
-                    for (int h = 0; h < dims[2]; h++) {
-                        auto _input0_h = _input0_c + h * dims[3];
-                        auto _output_h = _output_c + h * dims[3];
-                        int w = 0;
-                        for (; w + pack - 1 < dims[3]; w += pack) {
-                            VEC v2 = VEC::loadu(_input1 + w);
-                            VEC v1 = VEC::loadu(_input0_h + w);
-                            VEC::saveu(_output_h + w, binary_op<op_type, VEC>(v2, v1));
-                        }
-                        for (; w < dims[3]; w++) {
-                            _output_h[w] = binary_op<op_type>(_input1[w], _input0_h[w]);
-                        }
-                    }
-                }
-            }
-        } else {
-            LOGE("Error: invalid add type\n");
-            return Status(TNNERR_LAYER_ERR, "Error: Binary layer's unsupported broadcast type");
-        }
-    } else {
-        if (type == BroadcastTypeSingle) {
-            // broadcast single
-            VEC v2 = VEC(_input1[0]);
-            size_t n = 0;
-            for (; n + pack - 1 < count; n += pack) {
-                VEC v1 = VEC::loadu(_input0 + n);
-                VEC::saveu(output_ptr + n, binary_op<op_type, VEC>(v1, v2));
-            }
-            for (; n < count; n++) {
-                output_ptr[n] = binary_op<op_type>(_input0[n], _input1[0]);
-            }
-        } else if (type == BroadcastTypeChannel) {
-            // broadcast channel
-            for (int b = 0; b < dims[0]; b++) {
-                for (int c = 0; c < dims[1]; c++) {
-                    VEC v2 = VEC(_input1[c]);
-                    auto _input0_c = _input0 + b * batch_stride + c * channel_stride;
-                    auto _output_c = output_ptr + b * batch_stride + c * channel_stride;
-                    int hw = 0;
-                    for (; hw + pack - 1 < channel_stride; hw += pack) {
-                        VEC v1 = VEC::loadu(_input0_c + hw);
-                        VEC::saveu(_output_c + hw, binary_op<op_type, VEC>(v1, v2));
-                    }
-                    for (; hw < channel_stride; hw++) {
-                        _output_c[hw] = binary_op<op_type>(_input0_c[hw], _input1[c]);
-                    }
-                }
-            }
-        } else if (type == BroadcastTypeElement) {
-            // broadcast chw
-            for (int b = 0; b < dims[0]; b++) {
-                auto _input0_b = _input0 + b * batch_stride;
-                auto _output_b = output_ptr + b * batch_stride;
-                int chw = 0;
-                for (; chw + pack - 1 < batch_stride; chw += pack) {
-                    VEC v2 = VEC::loadu(_input1 + chw);
-                    VEC v1 = VEC::loadu(_input0_b + chw);
-                    VEC::saveu(_output_b + chw, binary_op<op_type, VEC>(v1, v2));
-                }
-                for (; chw < batch_stride; chw++) {
-                    _output_b[chw] = binary_op<op_type>(_input0_b[chw], _input1[chw]);
-                }
-            }
-        } else if (type == BroadcastTypeHeightWidth) {
-            // broadcast hw
-            for (int b = 0; b < dims[0]; b++) {
-                for (int c = 0; c < dims[1]; c++) {
-                    auto _input0_c = _input0 + b * batch_stride + c * channel_stride;
-                    auto _output_c = output_ptr + b * batch_stride + c * channel_stride;
-                    int hw = 0;
-                    for (; hw + pack - 1 < channel_stride; hw += pack) {
-                        VEC v2 = VEC::loadu(_input1 + hw);
-                        VEC v1 = VEC::loadu(_input0_c + hw);
-                        VEC::saveu(_output_c + hw, binary_op<op_type, VEC>(v1, v2));
-                    }
-                    for (; hw < channel_stride; hw++) {
-                        _output_c[hw] = binary_op<op_type>(_input0_c[hw], _input1[hw]);
-                    }
-                }
-            }
-        } else if (type == BroadcastTypeWidth) {
-            // broadcast w
-            for (int b = 0; b < dims[0]; b++) {
-                for (int c = 0; c < dims[1]; c++) {
-                    auto _input0_c = _input0 + b * batch_stride + c * channel_stride;
-                    auto _output_c = output_ptr + b * batch_stride + c * channel_stride;
-                    for (int h = 0; h < dims[2]; h++) {
-                        auto _input0_h = _input0_c + h * dims[3];
-                        auto _output_h = _output_c + h * dims[3];
-                        int w = 0;
-                        for (; w + pack - 1 < dims[3]; w += pack) {
-                            VEC v2 = VEC::loadu(_input1 + w);
-                            VEC v1 = VEC::loadu(_input0_h + w);
-                            VEC::saveu(_output_h + w, binary_op<op_type, VEC>(v1, v2));
-                        }
-                        for (; w < dims[3]; w++) {
-                            _output_h[w] = binary_op<op_type>(_input0_h[w], _input1[w]);
-                        }
-                    }
-                }
-            }
-        } else {
-            LOGE("Error: invalid add type\n");
-            return Status(TNNERR_LAYER_ERR, "Error: Binary layer's unsupported broadcast type");
-        }
-    }
-
-    return TNN_OK;
-}
-
 X86BinaryOpLayerAcc::~X86BinaryOpLayerAcc() {}
 
 Status X86BinaryOpLayerAcc::Init(Context *context, LayerParam *param, LayerResource *resource,
@@ -596,60 +295,12 @@ Status X86BinaryOpLayerAcc::Init(Context *context, LayerParam *param, LayerResou
     }
 
     // set binary function pointer
-    binary_func_ = BinaryFunc<X86BinaryOpType::kADD, Float4, 4>;
-    binary_general_func_ = BinaryGeneral<X86BinaryOpType::kADD>;
-
-    if (arch_ == avx2) {
-        switch(op_type_) {
-            case X86BinaryOpType::kADD :
-                binary_func_ = BinaryFunc<X86BinaryOpType::kADD, Float8, 8>;
-                break;
-            case X86BinaryOpType::kSUB :
-                binary_func_ = BinaryFunc<X86BinaryOpType::kSUB, Float8, 8>;
-                break;
-            case X86BinaryOpType::kMUL :
-                binary_func_ = BinaryFunc<X86BinaryOpType::kMUL, Float8, 8>;
-                break;
-            case X86BinaryOpType::kDIV :
-                binary_func_ = BinaryFunc<X86BinaryOpType::kDIV, Float8, 8>;
-                break;
-            case X86BinaryOpType::kMAX :
-                binary_func_ = BinaryFunc<X86BinaryOpType::kMAX, Float8, 8>;
-                break;
-            case X86BinaryOpType::kMIN :
-                binary_func_ = BinaryFunc<X86BinaryOpType::kMIN, Float8, 8>;
-                break;
-
-            default :
-                LOGE("Error, unknown binary op_type\n");
-                return TNNERR_LAYER_ERR;
-        }
-    } else if (arch_ == sse42) {
-        switch(op_type_) {
-            case X86BinaryOpType::kADD :
-                binary_func_ = BinaryFunc<X86BinaryOpType::kADD, Float4, 4>;
-                break;
-            case X86BinaryOpType::kSUB :
-                binary_func_ = BinaryFunc<X86BinaryOpType::kSUB, Float4, 4>;
-                break;
-            case X86BinaryOpType::kMUL :
-                binary_func_ = BinaryFunc<X86BinaryOpType::kMUL, Float4, 4>;
-                break;
-            case X86BinaryOpType::kDIV :
-                binary_func_ = BinaryFunc<X86BinaryOpType::kDIV, Float4, 4>;
-                break;
-            case X86BinaryOpType::kMAX :
-                binary_func_ = BinaryFunc<X86BinaryOpType::kMAX, Float4, 4>;
-                break;
-            case X86BinaryOpType::kMIN :
-                binary_func_ = BinaryFunc<X86BinaryOpType::kMIN, Float4, 4>;
-                break;
-
-            default :
-                LOGE("Error, unknown binary op_type\n");
-                return TNNERR_LAYER_ERR;
-        }
+    if ((int)op_type_ < 0 || (int)op_type_ >= X86_BINARY_OP_COUNT) {
+        LOGE("Error, unknown binary op_type\n");
+        return TNNERR_LAYER_ERR;
     }
+    binary_func_ = GetX86ElementwiseKernels(arch_).binary[(int)op_type_];
+
     switch(op_type_) {
         case X86BinaryOpType::kADD :
             binary_general_func_ = BinaryGeneral<X86BinaryOpType::kADD>;
@@ -728,6 +379,35 @@ Status X86BinaryOpLayerAcc::Reshape(const std::vector<Blob *> &inputs, const std
     return TNN_OK;
 }
 
+bool X86BinaryOpLayerAcc::SupportBlockedLayout() {
+    return true;
+}
+
+bool X86BinaryOpLayerAcc::SupportInplace(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs,
+                                         int input_index) {
+    return IsInplaceSafe(inputs, outputs, input_index);
+}
+
+/*
+The general impl copies input 0 to output before it reads the other inputs,
+and the inputs after the second are read after output is written.
+Broadcast inputs are read for many elements of output.
+*/
+bool X86BinaryOpLayerAcc::IsInplaceSafe(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs,
+                                        int input_index) {
+    if (input_index < 0 || input_index >= (int)inputs.size() ||
+        !DimsVectorUtils::Equal(inputs[input_index]->GetBlobDesc().dims, outputs[0]->GetBlobDesc().dims)) {
+        return false;
+    }
+    auto layer_param = dynamic_cast<MultidirBroadcastLayerParam *>(param_);
+    auto layer_res   = dynamic_cast<EltwiseLayerResource *>(resource_);
+    int shape_index  = input_index;
+    if (layer_param && layer_res && inputs.size() == 1 && layer_param->weight_input_index == 0) {
+        shape_index = 1;
+    }
+    return shape_index == 0 || (shape_index == 1 && btype_ != BroadcastTypeGeneral);
+}
+
 Status X86BinaryOpLayerAcc::DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
     auto layer_param = dynamic_cast<MultidirBroadcastLayerParam *>(param_);
     if (!layer_param) {
@@ -765,42 +445,102 @@ Status X86BinaryOpLayerAcc::DoForward(const std::vector<Blob *> &inputs, const s
         }
     }
 
+    // blocked inputs of the output shape are computed with their pad channels, the pads are zeroed after.
+    // other blocked inputs are computed in nchw copies, constant inputs are nchw.
+    std::vector<DimsVector> input_shapes = input_shapes_;
+    DimsVector compute_dims              = dims;
+    const bool blocked                   = IsBlockedBlob(output);
+    const int pack                       = GetBlockedDataFormatPack(output->GetBlobDesc().data_format);
+    bool blocked_dense                   = blocked && !(layer_res && inputs.size() == 1);
+    for (auto input : inputs) {
+        blocked_dense = blocked_dense && IsBlockedBlob(input) &&
+                        DimsVectorUtils::Equal(input->GetBlobDesc().dims, dims);
+    }
+    float *blocked_output_ptr = nullptr;
+    if (blocked_dense) {
+        compute_dims[1] = ROUND_UP(dims[1], pack);
+        for (auto &shape : input_shapes) {
+            shape = compute_dims;
+        }
+    } else if (blocked) {
+        size_t nchw_size = ROUND_UP(DimsVectorUtils::Count(dims), 8);
+        for (auto input : inputs) {
+            nchw_size += ROUND_UP(DimsVectorUtils::Count(input->GetBlobDesc().dims), 8);
+        }
+        float *nchw_ptr = reinterpret_cast<float *>(context_->GetSharedWorkSpace(nchw_size * sizeof(float)));
+        for (int i = 0; i < (int)inputs.size(); i++) {
+            if (!IsBlockedBlob(inputs[i])) {
+                continue;
+            }
+            auto input_ptr = handle_ptr<float *>(inputs[i]->GetHandle());
+            BlockedToNCHW(nchw_ptr, input_ptr, inputs[i]->GetBlobDesc().dims, pack);
+            for (auto &ptr : input_ptrs) {
+                ptr = ptr == input_ptr ? nchw_ptr : ptr;
+            }
+            nchw_ptr += ROUND_UP(DimsVectorUtils::Count(inputs[i]->GetBlobDesc().dims), 8);
+        }
+        blocked_output_ptr = nchw_ptr;
+    }
+
+    // output shares memory with an input the kernels can not run in place on, write it to workspace first
+    auto output_ptr    = handle_ptr<float *>(output->GetHandle());
+    int inplace_index  = GetInplaceInputIndex(inputs, outputs);
+    bool use_workspace = inplace_index >= 0 && !IsInplaceSafe(inputs, outputs, inplace_index);
+    if (blocked_output_ptr) {
+        output_ptr    = blocked_output_ptr;
+        use_workspace = false;
+    } else if (use_workspace) {
+        output_ptr = reinterpret_cast<float *>(
+            context_->GetSharedWorkSpace(DimsVectorUtils::Count(compute_dims) * sizeof(float)));
+    }
+
     if (btype_ == BroadcastTypeUnknown) {
         LOGE("Error: unknown broadcast type\n");
         return Status(TNNERR_LAYER_ERR, "Error: Binary layer unknown broadcast type");
     } else if (btype_ == BroadcastTypeGeneral) {
-        auto output_ptr = handle_ptr<float *>(output->GetHandle());
-        binary_general_func_(dims, input_shapes_, output_ptr, input_ptrs);
+        binary_general_func_(compute_dims, input_shapes, output_ptr, input_ptrs);
     } else {
-        auto output_ptr = handle_ptr<float *>(output->GetHandle());
         auto input0_ptr = reinterpret_cast<float *>(input_ptrs[0]);
         auto input1_ptr = reinterpret_cast<float *>(input_ptrs[1]);
 
         // input0_shape != output_shape && input1_shape != output_shape -> general impl
-        if (!DimsVectorUtils::Equal(dims, input_shapes_[0]) &&
-            !DimsVectorUtils::Equal(dims, input_shapes_[1])) {
-            std::vector<DimsVector> shapes_tmp = {input_shapes_[0], input_shapes_[1]};
+        if (!DimsVectorUtils::Equal(compute_dims, input_shapes[0]) &&
+            !DimsVectorUtils::Equal(compute_dims, input_shapes[1])) {
+            std::vector<DimsVector> shapes_tmp = {input_shapes[0], input_shapes[1]};
             std::vector<float *> ptrs_tmp = {input0_ptr, input1_ptr};
 
-            binary_general_func_(dims, shapes_tmp, output_ptr, ptrs_tmp);
+            binary_general_func_(compute_dims, shapes_tmp, output_ptr, ptrs_tmp);
         } else {
             DimsVector input0_pad_shape, input1_pad_shape;
-            input0_pad_shape.resize(dims.size());
-            input1_pad_shape.resize(dims.size());
-            PadShape(dims.size() - input_shapes_[0].size(), dims.size(), input0_pad_shape, input_shapes_[0]);
-            PadShape(dims.size() - input_shapes_[1].size(), dims.size(), input1_pad_shape, input_shapes_[1]);
-
-            binary_func_(output_ptr, input0_ptr, input1_ptr, input0_pad_shape, input1_pad_shape, output->GetBlobDesc().dims);
+            input0_pad_shape.resize(compute_dims.size());
+            input1_pad_shape.resize(compute_dims.size());
+            PadShape(compute_dims.size() - input_shapes[0].size(), compute_dims.size(), input0_pad_shape,
+                     input_shapes[0]);
+            PadShape(compute_dims.size() - input_shapes[1].size(), compute_dims.size(), input1_pad_shape,
+                     input_shapes[1]);
+
+            binary_func_(output_ptr, input0_ptr, input1_ptr, input0_pad_shape, input1_pad_shape, compute_dims);
         }
 
         for (int i = 2; i < input_ptrs.size(); i++) {
             DimsVector input0_pad_shape;
             auto input_ptr = reinterpret_cast<float *>(input_ptrs[i]);
-            PadShape(dims.size() - input_shapes_[i].size(), dims.size(), input0_pad_shape, input_shapes_[i]);
-            binary_func_(output_ptr, output_ptr, input_ptr, dims, input0_pad_shape, output->GetBlobDesc().dims);
+            PadShape(compute_dims.size() - input_shapes[i].size(), compute_dims.size(), input0_pad_shape,
+                     input_shapes[i]);
+            binary_func_(output_ptr, output_ptr, input_ptr, compute_dims, input0_pad_shape, compute_dims);
         }
     }
 
+    if (use_workspace) {
+        memcpy(handle_ptr<float *>(output->GetHandle()), output_ptr,
+               DimsVectorUtils::Count(compute_dims) * sizeof(float));
+    }
+    if (blocked_output_ptr) {
+        NCHWToBlocked(handle_ptr<float *>(output->GetHandle()), blocked_output_ptr, dims, pack);
+    } else if (blocked_dense) {
+        ZeroBlockedPadding(handle_ptr<float *>(output->GetHandle()), dims, pack);
+    }
+
     return TNN_OK;
 }
 
@@ -19,7 +19,6 @@
 
 #include "tnn/device/x86/acc/x86_layer_acc.h"
 #include "tnn/device/x86/x86_device.h"
-#include "tnn/device/x86/acc/Float4.h"
 #include "tnn/interpreter/layer_resource_generator.h"
 
 namespace TNN_NS {
@@ -32,14 +31,14 @@ enum class X86BinaryOpType : int {
     kMAX = 4,
     kMIN = 5,
 };
+#define X86_BINARY_OP_COUNT 6
 
-template <X86BinaryOpType op_type, typename VEC, int pack>
-Status BinaryFunc(float *output_ptr, const float *input0_ptr, const float *input1_ptr,
-                  DimsVector &dims0, DimsVector &dims1, DimsVector &output_dims);
+// @brief set dims0 full shape, dims1 broadcast shape
+typedef Status (*binary_func_t)(float *output_ptr, const float *input0_ptr, const float *input1_ptr,
+                                DimsVector &dims0, DimsVector &dims1, DimsVector &output_dims);
 template <X86BinaryOpType op_type>
 void BinaryGeneral(DimsVector output_shape, const std::vector<DimsVector> &input_shapes,
                    float *output_ptr, std::vector<float *> &input_ptrs);
-using binary_func_t = decltype(&BinaryFunc<X86BinaryOpType::kADD, Float4, 4>);
 using binary_general_func_t = decltype(&BinaryGeneral<X86BinaryOpType::kADD>);
 
 class X86BinaryOpLayerAcc : public X86LayerAcc {
@@ -52,12 +51,20 @@ public:
                 const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) override;
 
     virtual Status Reshape(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) override;
+
+    virtual bool SupportInplace(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs,
+                                int input_index) override;
 protected:
+    virtual bool SupportBlockedLayout() override;
+
     // Calculate Function
     Status Calculate(const std::vector<Blob *> &input_blobs, const std::vector<void *> &input_ptrs,
                      const std::vector<DimsVector> &input_shapes, Blob *output);
     X86BinaryOpType op_type_;
 private:
+    // @brief whether the kernels read each element of the input before the same element of output is written
+    bool IsInplaceSafe(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs, int input_index);
+
     std::vector<DimsVector> input_shapes_;
     BroadcastType btype_;
 
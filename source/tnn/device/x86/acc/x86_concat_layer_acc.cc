@@ -12,15 +12,125 @@
 // CONDITIONS OF ANY KIND, either express or implied. See the License for the
 // specific language governing permissions and limitations under the License.
 
+#include "tnn/core/blob_int8.h"
 #include "tnn/device/x86/acc/x86_layer_acc.h"
 #include "tnn/device/x86/x86_device.h"
+#include "tnn/utils/dims_function_utils.h"
 #include "tnn/utils/dims_utils.h"
 #include "tnn/utils/data_type_utils.h"
 #include "tnn/device/x86/acc/compute/x86_compute_int8.h"
 
 namespace TNN_NS {
 
-DECLARE_X86_ACC(Concat, LAYER_CONCAT);
+class X86ConcatLayerAcc : public X86LayerAcc {
+public:
+    virtual ~X86ConcatLayerAcc(){};
+    virtual Status DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) override;
+
+    virtual int64_t GetConcatOffset(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs,
+                                    int input_index) override;
+
+protected:
+    virtual bool SupportBlockedLayout() override;
+
+private:
+    // @brief whether every input is a contiguous part of the output holding the same bytes
+    bool IsDenseConcat(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs);
+};
+
+/*
+ * Nothing precedes the concat axis of dense nchw float blobs, or the batch axis of nhwc4 int8
+ * blobs concatenated without requantization, so each input is one run of bytes in the output.
+ */
+bool X86ConcatLayerAcc::IsDenseConcat(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
+    auto param = dynamic_cast<ConcatLayerParam *>(param_);
+    if (!param || inputs.empty() || outputs.size() != 1) {
+        return false;
+    }
+    const auto &output_desc = outputs[0]->GetBlobDesc();
+    const int axis          = param->axis;
+    if (axis < 0 || axis >= output_desc.dims.size()) {
+        return false;
+    }
+    for (auto input : inputs) {
+        const auto &input_desc = input->GetBlobDesc();
+        if (input_desc.data_type != output_desc.data_type || input_desc.data_format != output_desc.data_format) {
+            return false;
+        }
+    }
+
+    if (output_desc.data_type != DATA_TYPE_INT8) {
+        return output_desc.data_format == DATA_FORMAT_NCHW && DimsVectorUtils::Count(output_desc.dims, 0, axis) == 1;
+    }
+    if (output_desc.data_format != DATA_FORMAT_NHWC4 || axis != 0) {
+        return false;
+    }
+    auto output_scale = reinterpret_cast<BlobInt8 *>(outputs[0])->GetIntResource()->scale_handle;
+    bool per_tensor   = true;
+    for (auto input : inputs) {
+        per_tensor = per_tensor && reinterpret_cast<BlobInt8 *>(input)->GetIntResource()->scale_handle.GetDataCount() == 1;
+    }
+    if (!per_tensor) {
+        // per channel scales are copied as they are
+        return true;
+    }
+    for (auto input : inputs) {
+        auto input_scale = reinterpret_cast<BlobInt8 *>(input)->GetIntResource()->scale_handle;
+        if (output_scale.GetDataCount() != 1 || input_scale.force_to<float *>()[0] != output_scale.force_to<float *>()[0]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static int64_t GetDenseBytesSize(Blob *blob) {
+    const auto &desc = blob->GetBlobDesc();
+    if (desc.data_type == DATA_TYPE_INT8) {
+        int64_t channel = ROUND_UP(DimsFunctionUtils::GetDim(desc.dims, 1), 4);
+        return desc.dims[0] * channel * DimsVectorUtils::Count(desc.dims, 2);
+    }
+    return (int64_t)DimsVectorUtils::Count(desc.dims) * DataTypeUtils::GetBytesSize(desc.data_type);
+}
+
+int64_t X86ConcatLayerAcc::GetConcatOffset(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs,
+                                           int input_index) {
+    if (input_index < 0 || input_index >= inputs.size() || !IsDenseConcat(inputs, outputs)) {
+        return -1;
+    }
+    int64_t offset = 0;
+    for (int i = 0; i < input_index; i++) {
+        offset += GetDenseBytesSize(inputs[i]);
+    }
+    return offset;
+}
+
+bool X86ConcatLayerAcc::SupportBlockedLayout() {
+    return true;
+}
+
+static void ConcatCommon(int8_t *output_data, const std::vector<int8_t *> &input_datas,
+                         const std::vector<DimsVector> &input_dims, int axis, int datasize) {
+    const auto &dims = input_dims[0];
+    int num_concats  = DimsVectorUtils::Count(dims, 0, axis);
+    int concate_size = DimsVectorUtils::Count(dims, axis + 1);
+
+    int output_concat_axis = 0;
+    for (const auto &input_dim : input_dims) {
+        output_concat_axis += input_dim[axis];
+    }
+    int output_concat_axis_offset = 0;
+    for (size_t i = 0; i < input_datas.size(); ++i) {
+        // use int8_t for all types
+        int8_t *input_data          = input_datas[i];
+        const int input_concat_axis = input_dims[i][axis];
+        for (int n = 0; n < num_concats; ++n) {
+            memcpy(output_data + (n * output_concat_axis + output_concat_axis_offset) * concate_size * datasize,
+                   input_data + n * input_concat_axis * concate_size * datasize,
+                   input_concat_axis * concate_size * datasize);
+        }
+        output_concat_axis_offset += input_concat_axis;
+    }
+}
 
 Status X86ConcatLayerAcc::DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
     auto param = dynamic_cast<ConcatLayerParam *>(param_);
@@ -33,6 +143,22 @@ Status X86ConcatLayerAcc::DoForward(const std::vector<Blob *> &inputs, const std
         return Status(TNNERR_LAYER_ERR, "Concat layer's inputs size must >= 2");
     }
 
+    if (IsDenseConcat(inputs, outputs)) {
+        // inputs placed in the output by the memory plan are already in place. they are placed at the offsets of
+        // the max shapes, smaller shapes move each input towards the start, in order, over no unread input.
+        int8_t *output_data = handle_ptr<int8_t *>(outputs[0]->GetHandle());
+        int64_t offset      = 0;
+        for (auto input : inputs) {
+            int8_t *input_data = handle_ptr<int8_t *>(input->GetHandle());
+            int64_t bytes      = GetDenseBytesSize(input);
+            if (input_data != output_data + offset) {
+                memmove(output_data + offset, input_data, bytes);
+            }
+            offset += bytes;
+        }
+        return TNN_OK;
+    }
+
     if (inputs[0]->GetBlobDesc().data_type == DATA_TYPE_INT8) {
         switch (param->axis) {
             case 1:
@@ -45,44 +171,63 @@ Status X86ConcatLayerAcc::DoForward(const std::vector<Blob *> &inputs, const std
         return TNN_OK;
     }
 
-    auto input  = inputs[0];
     auto output = outputs[0];
-    auto dims   = input->GetBlobDesc().dims;
+    auto dims   = inputs[0]->GetBlobDesc().dims;
 
     const int axis = param->axis;
-    if (axis > dims.size() || axis < 0) {
+    if (axis >= dims.size() || axis < 0) {
         LOGE("Error: Concat layer param invalid\n");
         return Status(TNNERR_PARAM_ERR, "Concat layer param invalid");
     }
 
-    int num_concats = 1;
-    for (int i = 0; i < axis; i++) {
-        num_concats *= dims[i];
+    std::vector<int8_t *> input_datas;
+    std::vector<DimsVector> input_dims;
+    for (auto input : inputs) {
+        input_datas.push_back(handle_ptr<int8_t *>(input->GetHandle()));
+        input_dims.push_back(input->GetBlobDesc().dims);
     }
+    auto datasize = DataTypeUtils::GetBytesSize(inputs[0]->GetBlobDesc().data_type);
 
-    int concate_size = 1;
-    for (int i = axis + 1; i < dims.size(); i++) {
-        concate_size *= dims[i];
+    if (!IsBlockedBlob(output)) {
+        ConcatCommon(handle_ptr<int8_t *>(output->GetHandle()), input_datas, input_dims, axis, datasize);
+        return TNN_OK;
     }
 
-    auto datasize                 = DataTypeUtils::GetBytesSize(input->GetBlobDesc().data_type);
-    int8_t *output_data           = handle_ptr<int8_t *>(output->GetHandle());
-    int output_concat_axis        = output->GetBlobDesc().dims[axis];
-    int output_concat_axis_offset = 0;
-    for (size_t i = 0; i < inputs.size(); ++i) {
-        // use int8_t for all types
-        int8_t *input_data          = handle_ptr<int8_t *>(inputs[i]->GetHandle());
-        const int input_concat_axis = inputs[i]->GetBlobDesc().dims[axis];
-        for (int n = 0; n < num_concats; ++n) {
-            memcpy(output_data + (n * output_concat_axis + output_concat_axis_offset) * concate_size * datasize,
-                   input_data + n * input_concat_axis * concate_size * datasize,
-                   input_concat_axis * concate_size * datasize);
+    // blocked blobs are concatenated as {n, c blocks, h, w, pack}, if no input but the last ends in a partial block
+    const int pack = GetBlockedDataFormatPack(output->GetBlobDesc().data_format);
+    bool by_block  = true;
+    for (int i = 0; i < (int)inputs.size(); i++) {
+        bool aligned = axis != 1 || i == (int)inputs.size() - 1 || input_dims[i][1] % pack == 0;
+        by_block     = by_block && IsBlockedBlob(inputs[i]) && aligned;
+    }
+    if (by_block) {
+        for (auto &input_dim : input_dims) {
+            input_dim = {input_dim[0], UP_DIV(input_dim[1], pack), input_dim[2], input_dim[3], pack};
+        }
+        ConcatCommon(handle_ptr<int8_t *>(output->GetHandle()), input_datas, input_dims, axis, datasize);
+        return TNN_OK;
+    }
+
+    // otherwise the inputs are concatenated in nchw and blocked again
+    const auto &output_dims = output->GetBlobDesc().dims;
+    size_t nchw_size        = ROUND_UP(DimsVectorUtils::Count(output_dims), 8);
+    for (const auto &input_dim : input_dims) {
+        nchw_size += ROUND_UP(DimsVectorUtils::Count(input_dim), 8);
+    }
+    float *nchw_ptr = reinterpret_cast<float *>(context_->GetSharedWorkSpace(nchw_size * sizeof(float)));
+    for (int i = 0; i < (int)inputs.size(); i++) {
+        if (IsBlockedBlob(inputs[i])) {
+            BlockedToNCHW(nchw_ptr, reinterpret_cast<float *>(input_datas[i]), input_dims[i], pack);
+            input_datas[i] = reinterpret_cast<int8_t *>(nchw_ptr);
+            nchw_ptr += ROUND_UP(DimsVectorUtils::Count(input_dims[i]), 8);
         }
-        output_concat_axis_offset += input_concat_axis;
     }
+    ConcatCommon(reinterpret_cast<int8_t *>(nchw_ptr), input_datas, input_dims, axis, datasize);
+    NCHWToBlocked(handle_ptr<float *>(output->GetHandle()), nchw_ptr, output_dims, pack);
     return TNN_OK;
 }
 
 REGISTER_X86_ACC(Concat, LAYER_CONCAT);
+REGISTER_X86_BLOCKED_LAYOUT(LAYER_CONCAT, false);
 
 }
\ No newline at end of file
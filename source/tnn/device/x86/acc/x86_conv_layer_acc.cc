@@ -40,7 +40,16 @@ Status X86ConvLayerAcc::Init(Context *context, LayerParam *param, LayerResource
         return ret;
     }
 
-    auto data_type = inputs[0]->GetBlobDesc().data_type;
+    // float kernels fuse the activations of X86ActivationIndex, int8 kernels fuse relu and relu6
+    auto data_type         = inputs[0]->GetBlobDesc().data_type;
+    const int act_type     = conv_param->activation_type;
+    const bool int8_fusion = act_type == ActivationType_None || act_type == ActivationType_ReLU ||
+                             act_type == ActivationType_ReLU6;
+    if (X86ActivationIndex(act_type) < 0 || (data_type == DATA_TYPE_INT8 && !int8_fusion)) {
+        LOGE("Error: x86 conv does not support activation type %d\n", act_type);
+        return Status(TNNERR_LAYER_ERR, "x86 conv does not support the activation type");
+    }
+
     if (data_type == DATA_TYPE_INT8) {
         X86ConvLayerAccFactory::CreateImpInt8(inputs, outputs, param_, conv_acc_impl_);
     } else {
@@ -69,6 +78,22 @@ Status X86ConvLayerAcc::DoForward(const std::vector<Blob *> &inputs, const std::
     }
 }
 
+size_t X86ConvLayerAcc::GetWorkspaceSize(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
+    return conv_acc_impl_ ? conv_acc_impl_->GetWorkspaceSize(inputs, outputs) : 0;
+}
+
+void X86ConvLayerAcc::SetWorkspace(Blob *workspace) {
+    X86LayerAcc::SetWorkspace(workspace);
+    if (conv_acc_impl_) {
+        conv_acc_impl_->SetWorkspace(workspace);
+    }
+}
+
+bool X86ConvLayerAcc::SupportBlockedLayout() {
+    return true;
+}
+
 REGISTER_X86_ACC(Conv, LAYER_CONVOLUTION);
+REGISTER_X86_BLOCKED_LAYOUT(LAYER_CONVOLUTION, true);
 
 }   // namespace TNN_NS
\ No newline at end of file
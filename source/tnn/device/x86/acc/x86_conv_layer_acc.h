@@ -32,7 +32,13 @@ public:
 
     virtual Status DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) override;
 
+    virtual size_t GetWorkspaceSize(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) override;
+
+    virtual void SetWorkspace(Blob *workspace) override;
+
 protected:
+    virtual bool SupportBlockedLayout() override;
+
     std::shared_ptr<X86LayerAcc> conv_acc_impl_ = nullptr;
     std::shared_ptr<LayerResource> conv_acc_f32_resource_ = nullptr;
 };
@@ -13,27 +13,9 @@
 // specific language governing permissions and limitations under the License.
 #include "tnn/device/x86/acc/x86_unary2_layer_acc.h"
 
-#include <cmath>
-#include <algorithm>
-
 namespace TNN_NS {
-typedef struct x86_exp_operator : x86_unary2_operator {
-    virtual float operator()(const float v) {
-        return exp(v);
-    }
-
-    virtual Float4 operator()(const Float4 &v) {
-        return Float4::exp(v);
-    }
-
-    virtual Float8 operator()(const Float8 &v) {
-        return Float8::exp(v);
-    }
-} X86_EXP_OP;
-
-X86_REGISTER_UNARY2_KERNEL(LAYER_EXP, avx2, unary2_kernel_avx<X86_EXP_OP>);
-X86_REGISTER_UNARY2_KERNEL(LAYER_EXP, sse42, unary2_kernel_sse<X86_EXP_OP>);
 DECLARE_X86_UNARY2_ACC(Exp, LAYER_EXP);
 REGISTER_X86_ACC(Exp, LAYER_EXP);
+REGISTER_X86_BLOCKED_LAYOUT(LAYER_EXP, false);
 
 }   // namespace TNN_NS
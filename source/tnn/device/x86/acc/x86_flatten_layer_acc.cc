@@ -18,7 +18,12 @@
 
 namespace TNN_NS {
 
-DECLARE_X86_ACC(Flatten, LAYER_FLATTEN);
+DECLARE_X86_VIEW_ACC(Flatten, LAYER_FLATTEN);
+
+int64_t X86FlattenLayerAcc::GetViewOffset(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs,
+                                          int output_index) {
+    return IsDenseView(inputs[0], outputs[output_index]) ? 0 : -1;
+}
 
 Status X86FlattenLayerAcc::DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
     auto param = dynamic_cast<FlattenLayerParam *>(param_);
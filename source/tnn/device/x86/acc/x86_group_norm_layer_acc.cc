@@ -44,10 +44,7 @@ Status X86GroupNormLayerAcc::DoForward(const std::vector<Blob *> &inputs, const
     float *b_data = (float *)((char*)bias_blob->GetHandle().base + bias_blob->GetHandle().bytes_offset);
 
     const float epsilon = param->eps;
-    auto x86_groupnorm_func = X86_GroupNorm_FMA<Float4, 4>;
-    if (arch_ == avx2) {
-        x86_groupnorm_func = X86_GroupNorm_FMA<Float8, 8>;
-    }
+    auto x86_groupnorm_func = GetX86ComputeKernels(arch_).group_norm_fma;
 
     if (output_blob->GetBlobDesc().data_type == DATA_TYPE_FLOAT) {
         float *input_data  = (float *)((char *)input_blob->GetHandle().base+ input_blob->GetHandle().bytes_offset);
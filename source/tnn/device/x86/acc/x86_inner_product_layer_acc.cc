@@ -165,6 +165,15 @@ Status X86InnerProductLayerAcc::allocateBufferWeight(const std::vector<Blob *> &
                 memset(w_dst_oc, 0, ic_r4 * hw_size * data_byte_size);
             }
 
+            int8_arch_ = X86GemmInt8Arch(arch_);
+            if (int8_arch_ == avx512_vnni || int8_arch_ == avx_vnni) {
+                // from [oc][hw][ic_r4] to [oc/4][hw*ic_r4/16][o4][i16]
+                RawBuffer vnni_buffer(oc_r4 * ROUND_UP(ic_r4 * hw_size, 16) * data_byte_size);
+                PackINT8Weight(temp_buffer.force_to<int8_t *>(), vnni_buffer.force_to<int8_t *>(), ic_r4 * hw_size,
+                               oc_r4, 1, 1);
+                temp_buffer = vnni_buffer;
+            }
+
             temp_buffer.SetDataType(DATA_TYPE_INT8);
             buffer_weight_ = temp_buffer;
         } else {
@@ -191,6 +200,10 @@ Status X86InnerProductLayerAcc::allocateBufferBias(const std::vector<Blob *> &in
             const float *bias_handle_data = res->bias_handle.force_to<float *>();
             memcpy(temp_buffer.force_to<float *>(), res->bias_handle.force_to<float *>(), bias_handle_size);
         }
+        if (int8_arch_ == avx512_vnni || int8_arch_ == avx_vnni) {
+            X86GemmInt8VnniCompensate(temp_buffer.force_to<int32_t *>(), res->weight_handle.force_to<int8_t *>(),
+                                      dims_output[1], DimsVectorUtils::Count(inputs[0]->GetBlobDesc().dims, 1));
+        }
         buffer_bias_ = temp_buffer;
     }
 
@@ -235,12 +248,9 @@ Status X86InnerProductLayerAcc::DoForward(const std::vector<Blob *> &inputs, con
     auto output_dims  = outputs[0]->GetBlobDesc().dims;
 
     if (output_blob->GetBlobDesc().data_type == DATA_TYPE_FLOAT) {
-        auto X86SgemvFunc = X86Sgemv<Float4, 4>;
-        void (*X86VecAddFunc)(float*, const float*, long) = X86_VectorAdd<Float4, 4>;
-        if (arch_ == avx2) {
-            X86SgemvFunc = X86Sgemv<Float8, 8>;
-            X86VecAddFunc = X86_VectorAdd<Float8, 8>;
-        }
+        auto &kernels      = GetX86ComputeKernels(arch_);
+        auto X86SgemvFunc  = kernels.sgemv;
+        auto X86VecAddFunc = kernels.vector_add;
 
         float *input_data  = handle_ptr<float*>(input_blob->GetHandle());
         float *output_data = handle_ptr<float*>(output_blob->GetHandle());
@@ -284,7 +294,12 @@ Status X86InnerProductLayerAcc::DoForward(const std::vector<Blob *> &inputs, con
         for (int n = 0; n < output_dims[0]; n++) {
             auto input_ptr  = input_data + n * ic_r4 * hw;
             auto output_ptr = output_data + n * oc_r4;
-            X86GemvInt8(output_ptr, input_ptr, weight_data, bias_data, scale_data, ic_r4 * hw, oc_r4);
+            if (int8_arch_ == avx512_vnni || int8_arch_ == avx_vnni) {
+                X86VNNIGemvInt8(output_ptr, input_ptr, weight_data, bias_data, scale_data, ic_r4 * hw, oc_r4,
+                                int8_arch_);
+            } else {
+                X86GemvInt8(output_ptr, input_ptr, weight_data, bias_data, scale_data, ic_r4 * hw, oc_r4);
+            }
         }
     } else {
         return Status(TNNERR_MODEL_ERR, "blob type is unsupported");
@@ -13,7 +13,13 @@
 // specific language governing permissions and limitations under the License.
 
 #include "tnn/device/x86/acc/x86_layer_acc.h"
+
+#include <mutex>
+
 #include "tnn/utils/blob_transfer_utils.h"
+#include "tnn/utils/dims_vector_utils.h"
+#include "tnn/utils/packed_resource_cache.h"
+#include "tnn/utils/string_utils_inner.h"
 
 namespace TNN_NS {
 
@@ -27,10 +33,15 @@ Status X86LayerAcc::Init(Context *context, LayerParam *param, LayerResource *res
     param_    = param;
     resource_ = resource;
 
-    RETURN_ON_NEQ(ReloadConstantBlobs(inputs, false), TNN_OK);
+    {
+        // layers sharing a constant input may init in parallel
+        static std::mutex reload_mtx;
+        std::unique_lock<std::mutex> lck(reload_mtx);
+        RETURN_ON_NEQ(ReloadConstantBlobs(inputs, false), TNN_OK);
+    }
 
     // for layer use intrinsic, avx2 and avx use the same impl
-    if (cpu_with_isa(avx2) || cpu_with_isa(avx)) {
+    if (CpuRunsAvx2Kernels()) {
         arch_ = avx2;
     } else if (cpu_with_isa(sse42)) {
         arch_ = sse42;
@@ -44,9 +55,12 @@ Status X86LayerAcc::Init(Context *context, LayerParam *param, LayerResource *res
 std::vector<DataFormat> X86LayerAcc::SupportDataFormat(DataType data_type, int dims_size, BlobType blob_type) {
     std::vector<DataFormat> support_list;
     if (dims_size == 4) {
-        if (data_type == DATA_TYPE_FLOAT)
+        if (data_type == DATA_TYPE_FLOAT) {
             support_list.push_back(DATA_FORMAT_NCHW);
-        else if (data_type == DATA_TYPE_INT8)
+            if (SupportBlockedLayout()) {
+                support_list.push_back(GetX86BlockedDataFormat());
+            }
+        } else if (data_type == DATA_TYPE_INT8)
             support_list.push_back(DATA_FORMAT_NHWC4);
     }
     return support_list;
@@ -60,7 +74,7 @@ Status X86LayerAcc::Forward(const std::vector<Blob *> &inputs, const std::vector
     timer.Start();
 #endif
 
-    status = this->DoForward(inputs, outputs);
+    status = outputs_as_view_ ? BindViewOutputs(inputs, outputs) : this->DoForward(inputs, outputs);
 
 #if TNN_PROFILE
     pdata->kernel_time = timer.TimeEclapsed();
@@ -76,6 +90,81 @@ Status X86LayerAcc::Reshape(const std::vector<Blob*> &inputs, const std::vector<
     return TNN_OK;
 }
 
+bool X86LayerAcc::SupportBlockedLayout() {
+    return false;
+}
+
+// constant inputs hold the nchw data of their resource whatever the format of the blob desc
+bool X86LayerAcc::IsBlockedBlob(Blob *blob) {
+    const auto &desc = blob->GetBlobDesc();
+    if (desc.data_type != DATA_TYPE_FLOAT || desc.data_format != GetX86BlockedDataFormat()) {
+        return false;
+    }
+    return const_resource_ == nullptr || const_resource_->find(desc.name) == const_resource_->end();
+}
+
+bool X86LayerAcc::IsDenseView(Blob *input, Blob *output) {
+    const auto &input_desc  = input->GetBlobDesc();
+    const auto &output_desc = output->GetBlobDesc();
+    return input_desc.data_type == output_desc.data_type && input_desc.data_type != DATA_TYPE_INT8 &&
+           input_desc.data_format == DATA_FORMAT_NCHW && output_desc.data_format == DATA_FORMAT_NCHW;
+}
+
+// offsets follow the current shapes, they change after reshape
+Status X86LayerAcc::BindViewOutputs(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
+    for (int i = 0; i < (int)outputs.size(); i++) {
+        int64_t offset = GetViewOffset(inputs, outputs, i);
+        if (offset < 0) {
+            LOGE("Error: output %d of layer %s can not be a view of input 0\n", i,
+                 param_ ? param_->name.c_str() : "");
+            return Status(TNNERR_LAYER_ERR, "output can not be a view of input with current shapes");
+        }
+        BlobHandle handle = inputs[0]->GetHandle();
+        handle.bytes_offset += offset;
+        outputs[i]->SetHandle(handle);
+    }
+    return TNN_OK;
+}
+
+// the planned workspace follows the shapes at init, larger shapes after reshape use the shared workspace
+void *X86LayerAcc::GetWorkSpace(size_t size) {
+    if (workspace_ != nullptr &&
+        DimsVectorUtils::Count(workspace_->GetBlobDesc().dims) * sizeof(float) >= size) {
+        return handle_ptr<void *>(workspace_->GetHandle());
+    }
+    return context_->GetSharedWorkSpace(size);
+}
+
+Status X86LayerAcc::GetSharedPackedBuffer(const std::string &variant, std::function<Status(RawBuffer &)> creator,
+                                          RawBuffer &buffer) {
+    // without model key or layer name the buffer can not be told apart from other models, pack it privately
+    const std::string model_key = context_->GetResourceCacheKey();
+    if (model_key.empty() || param_ == nullptr || param_->name.empty()) {
+        return creator(buffer);
+    }
+
+    const std::string name = param_->name + "|" + variant + "|" + ToString((int)arch_);
+    const std::string key  = model_key + "|" + name;
+    std::shared_ptr<RawBuffer> shared_buffer;
+    // buffers loaded from the packed cache file of the model are used instead of packing them again
+    auto cached_buffer = context_->GetPackedResource(name);
+    if (cached_buffer) {
+        auto cached_creator = [&](RawBuffer &new_buffer) {
+            new_buffer = *cached_buffer;
+            return Status(TNN_OK);
+        };
+        RETURN_ON_NEQ(PackedResourceCache::GetOrCreate(key, cached_creator, shared_buffer), TNN_OK);
+    } else {
+        RETURN_ON_NEQ(PackedResourceCache::GetOrCreate(key, creator, shared_buffer), TNN_OK);
+        if (!context_->GetPackedCacheFilePath().empty()) {
+            context_->AddPackedResource(name, shared_buffer);
+        }
+    }
+    shared_packed_buffers_.push_back(shared_buffer);
+    buffer = *shared_buffer;
+    return TNN_OK;
+}
+
 Status X86LayerAcc::DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
     return Status(TNNERR_LAYER_ERR, "DoForward not implement");
 }
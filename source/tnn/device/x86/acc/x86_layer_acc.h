@@ -15,6 +15,9 @@
 #ifndef TNN_SOURCE_TNN_DEVICE_X86_X86_LAYER_ACC_H_
 #define TNN_SOURCE_TNN_DEVICE_X86_X86_LAYER_ACC_H_
 
+#include <functional>
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "tnn/core/abstract_layer_acc.h"
@@ -50,11 +53,35 @@ public:
 #endif
 
 protected:
+    // @brief get packed buffer shared by the accs of all instances created from the same model,
+    // creator is called only if no acc holds the buffer. variant tells different packings of a layer apart.
+    Status GetSharedPackedBuffer(const std::string &variant, std::function<Status(RawBuffer &)> creator,
+                                 RawBuffer &buffer);
+
+    // @brief whether the acc computes float blobs in the blocked layout of GetX86BlockedDataFormat besides nchw
+    virtual bool SupportBlockedLayout();
+
+    // @brief whether the data of blob is in the blocked layout, constant blobs are always nchw
+    bool IsBlockedBlob(Blob *blob);
+
+    // @brief whether the output holds the data of input in the same dense nchw order, so it can be a view of input
+    bool IsDenseView(Blob *input, Blob *output);
+
+    // @brief point the outputs at their part of the memory of input 0 instead of computing them
+    Status BindViewOutputs(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs);
+
+    // @brief scratch memory of size bytes for forward, the planned workspace if it is large enough, otherwise the
+    // workspace shared by the accs of the context
+    void *GetWorkSpace(size_t size);
+
     LayerParam* param_          = nullptr;
     LayerResource* resource_    = nullptr;
     X86Context *context_           = nullptr;
     x86_isa_t arch_;
 
+    // keep the shared packed buffers in cache while the acc is alive
+    std::vector<std::shared_ptr<RawBuffer>> shared_packed_buffers_;
+
 private:
     // @brief return device layer acc support data format
     virtual std::vector<DataFormat> SupportDataFormat(DataType data_type, int dims_size, BlobType blob_type);
@@ -67,10 +94,23 @@ private:
         virtual Status DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) override;  \
     }
 
+#define DECLARE_X86_VIEW_ACC(type_string, layer_type)                                                              \
+    class X86##type_string##LayerAcc : public X86LayerAcc {                                                        \
+    public:                                                                                                        \
+        virtual ~X86##type_string##LayerAcc(){};                                                                   \
+        virtual Status DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) override;  \
+        virtual int64_t GetViewOffset(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs,       \
+                                      int output_index) override;                                                  \
+    }
+
 #define REGISTER_X86_ACC(type_string, layer_type)                                                               \
     X86TypeLayerAccRegister<TypeLayerAccCreator<X86##type_string##LayerAcc>> g_x86_##layer_type##_acc_register( \
         layer_type);                                                                                            \
 
+// layers preferring the blocked layout get nchw inputs reformatted, the others follow the layout of their inputs
+#define REGISTER_X86_BLOCKED_LAYOUT(layer_type, prefer_blocked)                                                 \
+    X86TypeLayerLayoutRegister g_x86_##layer_type##_blocked_layout_register(layer_type, prefer_blocked);
+
 } // TNN_NS
 
 #endif // TNN_SOURCE_TNN_DEVICE_X86_X86_LAYER_ACC_H_
@@ -14,77 +14,14 @@
 
 #include <math.h>
 #include "tnn/device/x86/acc/x86_layer_acc.h"
+#include "tnn/device/x86/acc/compute/x86_compute.h"
 #include "tnn/utils/data_type_utils.h"
 #include "tnn/utils/dims_utils.h"
 
-#include "tnn/device/x86/acc/Float4.h"
-#include "tnn/device/x86/acc/Float8.h"
 namespace TNN_NS {
 
 DECLARE_X86_ACC(LayerNorm, LAYER_LAYER_NORM);
 
-template <typename VEC, int pack>
-static void norm_func(float *input, float *output, int channels, int area, const float *k_data, const float *b_data,
-                      float ep) {
-    float *input_data  = input;
-    float *output_data = output;
-    for (int c = 0; c < channels; c++) {
-        // step 1: calc varience
-        VEC v_sum_x  = VEC(0.f);
-        VEC v_sum_x2 = VEC(0.f);
-        VEC v_temp   = VEC(0.f);
-        float buffer[pack];
-        int head       = 0;
-        const int tail = area - area % pack;
-        double var;
-
-        for (size_t i = head; i < tail; i += pack) {
-            v_temp  = VEC::loadu(input_data + i);
-            v_sum_x = VEC::add(v_sum_x, v_temp);
-            VEC::mla(v_sum_x2, v_temp, v_temp);
-        }
-
-        float sum_x = 0.f, sum_x2 = 0.f;
-        VEC::saveu(buffer, v_sum_x);
-        for (int i = 0; i < pack; i++)
-            sum_x += buffer[i];
-        VEC::saveu(buffer, v_sum_x2);
-        for (int i = 0; i < pack; i++)
-            sum_x2 += buffer[i];
-        for (size_t i = tail; i < area; i++) {
-            var = input_data[i];
-            sum_x += var;
-            sum_x2 += var * var;
-        }
-
-        auto mean_x    = sum_x / area;
-        auto mean_x2   = sum_x2 / area;
-        float variance = mean_x2 - mean_x * mean_x;
-        variance       = variance > 0 ? variance : 0;
-        variance       = 1.0f / sqrt(variance + ep);
-
-        // step2: normlization
-        VEC v_variance = VEC(&variance);
-        VEC v_mean     = VEC(&mean_x);
-        for (size_t i = head; i < tail; i += pack, input_data += pack, output_data += pack) {
-            VEC v_scale = VEC::loadu(k_data + i);
-            VEC v_bias  = VEC::loadu(b_data + i);
-            VEC v_data  = VEC::loadu(input_data);
-
-            v_scale = VEC::mul(v_variance, v_scale);  // var * k
-            v_bias  = VEC::sub(v_bias, VEC::mul(v_scale, v_mean));
-
-            VEC::mla(v_bias, v_data, v_scale);
-            VEC::saveu(output_data, v_bias);
-        }
-
-        for (size_t i = tail; i < area; i++, output_data++, input_data++) {
-            float b      = b_data[i] - variance * mean_x * k_data[i];
-            *output_data = (*input_data) * variance * k_data[i] + b;
-        }
-    }
-}
-
 Status X86LayerNormLayerAcc::DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
     auto layer_param = dynamic_cast<LayerNormLayerParam *>(param_);
     auto input_blob  = inputs[0];
@@ -109,10 +46,7 @@ Status X86LayerNormLayerAcc::DoForward(const std::vector<Blob *> &inputs, const
 
     const float epsilon = layer_param->eps;
 
-    auto func = norm_func<Float8, 8>;
-    if (arch_ == sse42) {
-        func = norm_func<Float4, 4>;
-    }
+    auto func = GetX86ElementwiseKernels(arch_).layer_norm;
 
     if (output_blob->GetBlobDesc().data_type == DATA_TYPE_FLOAT) {
         float *input_data  = (float *)((char *)input_blob->GetHandle().base + input_blob->GetHandle().bytes_offset);
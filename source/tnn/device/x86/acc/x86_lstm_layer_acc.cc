@@ -61,12 +61,13 @@ static void X86LSTMActivate(const float *gates, float *h_t, float *c_t, float *y
     }
 }
 
+// parts of the workspace, the outputs of both directions are only used by bidirectional lstm
+enum { Y_TEMP_PART = 0, FAKE_BIAS_PART, GEMM_BUF_PART, GATES_BUF_PART };
+
 Status X86LSTMONNXLayerAcc::LSTMOneDirection(const float *x, float *y, const float *w, const float *r,
                               const float *b, float *h_t, float *c_t, int seq_len, int batch_size,
-                              int input_size, int hidden_size, int reverse) {
-    int k_c = conv_gemm_conf_.K_c_;
-    int n_block = conv_gemm_conf_.n_block_;
-
+                              int input_size, int hidden_size, int reverse, const X86WorkspaceLayout &layout,
+                              void *workspace) {
     // sgemm for weight tensor
     // weights: [4*hidden_size, input_size]
     // inputs: [seq_len, batch, input_size]
@@ -74,16 +75,11 @@ Status X86LSTMONNXLayerAcc::LSTMOneDirection(const float *x, float *y, const flo
     int N = seq_len * batch_size;
     int M = 4 * hidden_size;
 
-    // two temp buf: gemm_buf and gates_buf
-    size_t gemm_buf_size = ROUND_UP(k_c * ROUND_UP(N, n_block) * sizeof(float), 32);
-    size_t gates_buf_size = ROUND_UP(N * M * sizeof(float), 32);
-    size_t workspace_size = gemm_buf_size + gates_buf_size;
-    float *workspace = reinterpret_cast<float *>(context_->GetSharedWorkSpace(workspace_size));
-    float *gemm_buf = workspace;
-    float *gates_buf = workspace + gemm_buf_size / sizeof(float);
-
-    RawBuffer fake_bias(N * sizeof(float));
-    float *fake_bias_ptr = fake_bias.force_to<float *>();
+    // three temp buf: fake_bias, gemm_buf and gates_buf
+    float *fake_bias_ptr = layout.Get<float>(workspace, FAKE_BIAS_PART);
+    float *gemm_buf      = layout.Get<float>(workspace, GEMM_BUF_PART);
+    float *gates_buf     = layout.Get<float>(workspace, GATES_BUF_PART);
+    memset(fake_bias_ptr, 0, N * sizeof(float));
     conv_sgemm_tn_col_major_prepack_a(M, N, K, w, K, x, K, gates_buf, M,
             fake_bias_ptr, ActivationType_None, gemm_buf, conv_gemm_conf_);
     
@@ -118,6 +114,29 @@ Status X86LSTMONNXLayerAcc::LSTMOneDirection(const float *x, float *y, const flo
     return TNN_OK;
 }
 
+// outputs of both directions before they are interleaved, then the workspace of one direction
+X86WorkspaceLayout X86LSTMONNXLayerAcc::GetWorkspaceLayout(int seq_len, int batch_size, int hidden_size,
+                                                           int direction) {
+    int N = seq_len * batch_size;
+    int M = 4 * hidden_size;
+    X86WorkspaceLayout layout;
+    layout.Add(direction == 2 ? 2 * N * hidden_size * sizeof(float) : 0);
+    layout.Add(N * sizeof(float));
+    layout.Add(conv_gemm_conf_.K_c_ * ROUND_UP(N, conv_gemm_conf_.n_block_) * sizeof(float));
+    layout.Add(N * M * sizeof(float));
+    return layout;
+}
+
+size_t X86LSTMONNXLayerAcc::GetWorkspaceSize(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
+    auto layer_param = dynamic_cast<LSTMONNXLayerParam *>(param_);
+    if (!layer_param || inputs.empty()) {
+        return 0;
+    }
+    const auto input_dims = inputs[0]->GetBlobDesc().dims;
+    return GetWorkspaceLayout(input_dims[0], input_dims[1], layer_param->hidden_size, layer_param->direction)
+        .GetSize();
+}
+
 X86LSTMONNXLayerAcc::~X86LSTMONNXLayerAcc() {}
 
 Status X86LSTMONNXLayerAcc::Init(Context *context, LayerParam *param, LayerResource *resource,
@@ -295,21 +314,24 @@ Status X86LSTMONNXLayerAcc::DoForward(const std::vector<Blob *> &inputs, const s
         memset((void *)c_t, 0, num_directions * batch * hidden_size * sizeof(float));
     }
     
+    auto layout     = GetWorkspaceLayout(T, batch, hidden_size, layer_param->direction);
+    void *workspace = GetWorkSpace(layout.GetSize());
     if (layer_param->direction == 0 || layer_param->direction == 1) {
-        return LSTMOneDirection(x, y, w, r, b, h_t, c_t, T, batch, input_size, hidden_size, layer_param->direction);
+        return LSTMOneDirection(x, y, w, r, b, h_t, c_t, T, batch, input_size, hidden_size, layer_param->direction,
+                                layout, workspace);
     } else if (layer_param->direction == 2) {
         //Y shape [num_directions sequence batch_size hidden_size]
-        auto y_temp = std::shared_ptr<float>(new float[num_directions*T*batch*hidden_size], [](float* p) { delete[] p; });
-        auto y0 = y_temp.get();
+        auto y_temp = layout.Get<float>(workspace, Y_TEMP_PART);
+        auto y0 = y_temp;
         auto y1 = y0 + T * batch * hidden_size;
-        LSTMOneDirection(x, y0, w, r, b, h_t, c_t, T, batch, input_size, hidden_size, 0);
+        LSTMOneDirection(x, y0, w, r, b, h_t, c_t, T, batch, input_size, hidden_size, 0, layout, workspace);
         
         auto w1 = w + w_pack_size;
         auto r1 = r + r_pack_size;
         auto b1 = b + 4 * hidden_size;
         auto h_t1 = h_t + batch * hidden_size;
         auto c_t1 = c_t + batch * hidden_size;
-        LSTMOneDirection(x, y1, w1, r1, b1, h_t1, c_t1, T, batch, input_size, hidden_size, 1);
+        LSTMOneDirection(x, y1, w1, r1, b1, h_t1, c_t1, T, batch, input_size, hidden_size, 1, layout, workspace);
         
         //transpose [num_directions sequence batch_size hidden_size] to [sequence batch_size num_directions*hidden_size]
         for (int i = 0; i < T*batch; i++) {
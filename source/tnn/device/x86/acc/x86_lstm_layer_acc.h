@@ -27,12 +27,17 @@ public:
     Status Init(Context *context, LayerParam *param, LayerResource *resource, const std::vector<Blob *> &inputs,
                 const std::vector<Blob *> &outputs) override;
     virtual Status DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) override;
+    virtual size_t GetWorkspaceSize(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) override;
     virtual Status allocateBufferWeight(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs);
     virtual Status allocateBufferBias(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs);
 protected:
     Status LSTMOneDirection(const float *x, float *y, const float *w, const float *r,
                            const float *b, float *h_t, float *c_t, int seq_len, int batch_size,
-                           int input_size, int hidden_size, int reverse);
+                           int input_size, int hidden_size, int reverse, const X86WorkspaceLayout &layout,
+                           void *workspace);
+    // @brief outputs of both directions, then the zero bias, packed input and gates LSTMOneDirection keeps in the
+    // workspace, GetWorkspaceSize is their size
+    X86WorkspaceLayout GetWorkspaceLayout(int seq_len, int batch_size, int hidden_size, int direction);
 
     RawBuffer buffer_w_;
     RawBuffer buffer_r_;
@@ -46,6 +46,29 @@ Status X86MatMulLayerAcc::Init(Context *context, LayerParam *param, LayerResourc
     return TNN_OK;
 }
 
+// zero bias and the packed matrices of the gemm
+enum { FAKE_BIAS_PART = 0, PACK_BUF_PART };
+
+X86WorkspaceLayout X86MatMulLayerAcc::GetWorkspaceLayout(int N) {
+    X86WorkspaceLayout layout;
+    layout.Add(N * sizeof(float));
+    layout.Add(ROUND_UP(conv_gemm_conf_.M_c_ * conv_gemm_conf_.K_c_ * sizeof(float), 32) +
+               conv_gemm_conf_.K_c_ * ROUND_UP(N, conv_gemm_conf_.n_block_) * sizeof(float));
+    return layout;
+}
+
+size_t X86MatMulLayerAcc::GetWorkspaceSize(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
+    auto param = dynamic_cast<MatMulLayerParam *>(param_);
+    if (!param || inputs[0]->GetBlobDesc().data_type != DATA_TYPE_FLOAT) {
+        return 0;
+    }
+    DimsVector matrix_a_dims = param->matrix_a_dims;
+    if (matrix_a_dims.size() == 1) {
+        matrix_a_dims.insert(matrix_a_dims.begin(), 1);
+    }
+    return GetWorkspaceLayout(matrix_a_dims[matrix_a_dims.size() - 2]).GetSize();
+}
+
 Status X86MatMulLayerAcc::DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
     auto param               = dynamic_cast<MatMulLayerParam *>(param_);
     auto resource            = dynamic_cast<MatMulLayerResource *>(resource_);
@@ -73,21 +96,15 @@ Status X86MatMulLayerAcc::DoForward(const std::vector<Blob *> &inputs, const std
         }
         auto matrix_c = handle_ptr<float *>(outputs[0]->GetHandle());
 
-        int k_c = conv_gemm_conf_.K_c_;
-        int m_c = conv_gemm_conf_.M_c_;
-        int n_block = conv_gemm_conf_.n_block_;
-
         int M = matrix_b_dims[matrix_b_dims.size() - 1];
         int K = matrix_a_dims[matrix_a_dims.size() - 1];
         int N = matrix_a_dims[matrix_a_dims.size() - 2];
 
-        size_t pack_a_size = ROUND_UP(m_c * k_c * sizeof(float), 32);
-        size_t pack_b_size = k_c * ROUND_UP(N, n_block) * sizeof(float);
-        size_t workspace_size = pack_a_size + pack_b_size;
-        float *workspace = reinterpret_cast<float *>(context_->GetSharedWorkSpace(workspace_size));
-
-        RawBuffer fake_bias(N * sizeof(float));
-        float *fake_bias_ptr = fake_bias.force_to<float *>();
+        auto layout          = GetWorkspaceLayout(N);
+        void *buffer         = GetWorkSpace(layout.GetSize());
+        float *fake_bias_ptr = layout.Get<float>(buffer, FAKE_BIAS_PART);
+        float *workspace     = layout.Get<float>(buffer, PACK_BUF_PART);
+        memset(fake_bias_ptr, 0, N * sizeof(float));
 
         int count_a     = DimsVectorUtils::Count(matrix_a_dims);
         int count_b     = DimsVectorUtils::Count(matrix_b_dims);
@@ -28,7 +28,12 @@ public:
 
     virtual Status DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) override;
 
+    virtual size_t GetWorkspaceSize(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) override;
+
 protected:
+    // @brief zero bias and packed matrices of the gemm with N rows of matrix a, GetWorkspaceSize is their size
+    X86WorkspaceLayout GetWorkspaceLayout(int N);
+
     conv_gemm_config<float, float, float> conv_gemm_conf_;
     std::shared_ptr<LayerResource> matmul_acc_f32_resource_ = nullptr;
 
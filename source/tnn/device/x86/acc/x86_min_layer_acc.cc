@@ -19,5 +19,6 @@ namespace TNN_NS {
 DECLARE_X86_BINARY_OP_ACC(Min, X86BinaryOpType::kMIN);
 
 REGISTER_X86_ACC(Min, LAYER_MINIMUM);
+REGISTER_X86_BLOCKED_LAYOUT(LAYER_MINIMUM, false);
 
 }   // namespace TNN_NS
\ No newline at end of file
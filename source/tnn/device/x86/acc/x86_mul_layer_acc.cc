@@ -19,5 +19,6 @@ namespace TNN_NS {
 DECLARE_X86_BINARY_OP_ACC(Mul, X86BinaryOpType::kMUL);
 
 REGISTER_X86_ACC(Mul, LAYER_MUL);
+REGISTER_X86_BLOCKED_LAYOUT(LAYER_MUL, false);
 
 }   // namespace TNN_NS
\ No newline at end of file
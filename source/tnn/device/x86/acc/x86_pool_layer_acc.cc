@@ -38,7 +38,7 @@ Status X86PoolLayerAcc::Reshape(const std::vector<Blob *> &inputs, const std::ve
     auto dims_input  = input->GetBlobDesc().dims;
     auto dims_output = output->GetBlobDesc().dims;
 
-    int corner_l_ = 0, corner_t_ = 0, corner_r_ = dims_output[3], corner_b_ = dims_output[2];
+    corner_l_ = 0, corner_t_ = 0, corner_r_ = dims_output[3], corner_b_ = dims_output[2];
     for (; corner_l_ * param->strides[0] - param->pads[0] < 0; corner_l_++)
         ;
     for (; corner_t_ * param->strides[1] - param->pads[2] < 0; corner_t_++)
@@ -73,14 +73,13 @@ Status X86PoolLayerAcc::DoForward(const std::vector<Blob *> &inputs, const std::
     auto input_ptr  = handle_ptr<float *>(input->GetHandle());
     auto output_ptr = handle_ptr<float *>(output->GetHandle());
 
-    auto X86MaxPoolingAcc = X86MaxPooling<Float4, 4>;
-    auto X86AvgPoolingAcc = X86AvgPooling<Float4, 4>;
+    auto &kernels         = GetX86ComputeKernels(arch_);
+    auto X86MaxPoolingAcc = kernels.max_pooling;
+    auto X86AvgPoolingAcc = kernels.avg_pooling;
     auto PackAcc          = PackC4;
     auto UnpackAcc        = UnpackC4;
     int c_pack = 4;
     if (arch_ == avx2) {
-        X86MaxPoolingAcc = X86MaxPooling<Float8, 8>;
-        X86AvgPoolingAcc = X86AvgPooling<Float8, 8>;
         PackAcc          = PackC8;
         UnpackAcc        = UnpackC8;
         c_pack = 8;
@@ -94,7 +93,30 @@ Status X86PoolLayerAcc::DoForward(const std::vector<Blob *> &inputs, const std::
     float *workspace = reinterpret_cast<float *>(context_->GetSharedWorkSpace(
                         (src_pack_size + dst_pack_size) * max_num_threads));
 
-    if (output->GetBlobDesc().data_type == DATA_TYPE_FLOAT) {
+    auto pool_func = [&](const float *src, float *dst) {
+        if (param->pool_type == 0) {
+            X86MaxPoolingAcc(src, dims_input[3], dims_input[2], dst, dims_output[3], dims_output[2],
+                             param->kernels[0], param->kernels[1], param->strides[0], param->strides[1],
+                             param->pads[0], param->pads[2], corner_l_, corner_r_, corner_t_, corner_b_);
+        } else {
+            X86AvgPoolingAcc(src, dims_input[3], dims_input[2], dst, dims_output[3], dims_output[2],
+                             param->kernels[0], param->kernels[1], param->strides[0], param->strides[1],
+                             param->pads[0], param->pads[2]);
+        }
+    };
+
+    if (output->GetBlobDesc().data_type == DATA_TYPE_FLOAT && IsBlockedBlob(input)) {
+        // the kernels work on channel blocks, blocked blobs need no packing
+        int c_blocks = UP_DIV(dims_output[1], c_pack);
+        for (int b = 0; b < batch; b++) {
+            auto input_b  = input_ptr + b * c_blocks * src_hw * c_pack;
+            auto output_b = output_ptr + b * c_blocks * dst_hw * c_pack;
+            OMP_PARALLEL_FOR_GUIDED_
+            for (int cb = 0; cb < c_blocks; cb++) {
+                pool_func(input_b + cb * src_hw * c_pack, output_b + cb * dst_hw * c_pack);
+            }
+        }
+    } else if (output->GetBlobDesc().data_type == DATA_TYPE_FLOAT) {
         for (int b = 0; b < batch; b++) {
             auto input_b  = reinterpret_cast<float *>(input_ptr) + b * dims_input[1] * src_hw;
             auto output_b = reinterpret_cast<float *>(output_ptr) + b * dims_output[1] * dst_hw;
@@ -106,16 +128,7 @@ Status X86PoolLayerAcc::DoForward(const std::vector<Blob *> &inputs, const std::
                 auto dst_pack_ptr    = workspace_per_t + src_pack_size / sizeof(float);
                 int left_c = MIN(dims_output[1] - c, c_pack);
                 PackAcc(src_pack_ptr, input_b + c * src_hw, src_hw, src_hw, src_hw, left_c);
-                if (param->pool_type == 0) {
-                    X86MaxPoolingAcc(src_pack_ptr, dims_input[3], dims_input[2], dst_pack_ptr,
-                            dims_output[3], dims_output[2], param->kernels[0], param->kernels[1], param->strides[0],
-                            param->strides[1], param->pads[0], param->pads[2], corner_l_, corner_r_, corner_t_,
-                            corner_b_);
-                } else {
-                    X86AvgPoolingAcc(src_pack_ptr, dims_input[3], dims_input[2], dst_pack_ptr,
-                            dims_output[3], dims_output[2], param->kernels[0], param->kernels[1], param->strides[0],
-                            param->strides[1], param->pads[0], param->pads[2]);
-                }
+                pool_func(src_pack_ptr, dst_pack_ptr);
                 UnpackAcc(output_b + c * dst_hw, dst_pack_ptr, dst_hw, dst_hw, dst_hw, left_c);
             }
         }
@@ -143,5 +156,10 @@ Status X86PoolLayerAcc::DoForward(const std::vector<Blob *> &inputs, const std::
     return TNN_OK;
 }
 
+bool X86PoolLayerAcc::SupportBlockedLayout() {
+    return true;
+}
+
 REGISTER_X86_ACC(Pool, LAYER_POOLING);
+REGISTER_X86_BLOCKED_LAYOUT(LAYER_POOLING, false);
 }
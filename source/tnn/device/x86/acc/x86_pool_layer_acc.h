@@ -28,6 +28,9 @@ public:
 
     virtual Status DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) override;
 
+protected:
+    virtual bool SupportBlockedLayout() override;
+
 private:
     int corner_l_;
     int corner_r_;
@@ -15,50 +15,11 @@
 #include "tnn/device/x86/acc/x86_layer_acc.h"
 #include "tnn/utils/dims_utils.h"
 #include "tnn/device/x86/acc/x86_prelu_layer_acc.h"
+#include "tnn/device/x86/acc/compute/x86_compute.h"
 #include "tnn/interpreter/layer_resource_generator.h"
 
-#include "tnn/device/x86/acc/Float4.h"
-#include "tnn/device/x86/acc/Float8.h"
-
 namespace TNN_NS {
 
-template <typename VEC, int pack>
-static void prelu_func(float *input, float *output, const float *slope, DimsVector dims, bool is_channel_shared) {
-    auto plane = DimsVectorUtils::Count(dims, 2);
-
-    for (int b = 0; b < dims[0]; b++) {
-        for (int c = 0; c < dims[1]; c++) {
-            float coef    = is_channel_shared ? slope[0] : slope[c];
-            auto input_c  = input + b * DimsVectorUtils::Count(dims, 1) + c * plane;
-            auto output_c = output + b * DimsVectorUtils::Count(dims, 1) + c * plane;
-            int i         = 0;
-            VEC v_zero(0.f);
-            VEC v_slope(coef);
-            for (; i + pack - 1 < plane; i += pack) {
-                VEC v_data = VEC::loadu(input_c + i);
-                VEC v_res  = VEC::bsl_clt(v_data, v_zero, v_data * v_slope, v_data);
-                VEC::saveu(output_c + i, v_res);
-            }
-
-            if (i > 0 && i < plane) {
-                i = plane - pack;
-                VEC v_data = VEC::loadu(input_c + i);
-                VEC v_res  = VEC::bsl_clt(v_data, v_zero, v_data * v_slope, v_data);
-                VEC::saveu(output_c + i, v_res);
-                i = plane;
-            }
-
-            for (; i < plane; i++) {
-                if (input_c[i] < 0) {
-                    output_c[i] = input_c[i] * coef;
-                } else {
-                    output_c[i] = input_c[i];
-                }
-            }
-        }
-    }
-}
-
 X86PReluLayerAcc::~X86PReluLayerAcc() {}
 
 Status X86PReluLayerAcc::Init(Context *context, LayerParam *param, LayerResource *resource,
@@ -106,10 +67,7 @@ Status X86PReluLayerAcc::DoForward(const std::vector<Blob *> &inputs, const std:
         return Status(TNNERR_COMMON_ERROR, "Error: blob count is zero");
     }
 
-    auto calc = prelu_func<Float8, 8>;
-    if (arch_ == sse42) {
-        calc = prelu_func<Float4, 4>;
-    }
+    auto calc = GetX86ElementwiseKernels(arch_).prelu;
 
     if (output_blob->GetBlobDesc().data_type == DATA_TYPE_FLOAT) {
         const float *slope_data = layer_res->slope_handle.force_to<float *>();
@@ -29,7 +29,12 @@ Status X86ReformatLayerAcc::Init(Context *context, LayerParam *param, LayerResou
     CHECK_PARAM_NULL(reformat_param);
 
     scale_buffer_.resize(inputs.size());
-    if (reformat_param->src_type == DATA_TYPE_INT8 && reformat_param->dst_type == DATA_TYPE_FLOAT) {
+    if (IsLayoutReformat(reformat_param)) {
+        for (auto blob : outputs) {
+            blob->GetBlobDesc().data_format = reformat_param->dst_format;
+        }
+        return TNN_OK;
+    } else if (reformat_param->src_type == DATA_TYPE_INT8 && reformat_param->dst_type == DATA_TYPE_FLOAT) {
         reformat_param->type = DEQUANT_ONLY;
         for (auto blob : outputs) {
             blob->GetBlobDesc().data_format = DATA_FORMAT_NCHW;
@@ -47,6 +52,42 @@ Status X86ReformatLayerAcc::Init(Context *context, LayerParam *param, LayerResou
 
 X86ReformatLayerAcc::~X86ReformatLayerAcc() {}
 
+bool X86ReformatLayerAcc::IsLayoutReformat(ReformatLayerParam *param) {
+    return param->src_format != param->dst_format && param->src_type == DATA_TYPE_FLOAT &&
+           param->dst_type == DATA_TYPE_FLOAT;
+}
+
+std::vector<DataFormat> X86ReformatLayerAcc::SupportDataFormat(DataType data_type, int dims_size,
+                                                               BlobType blob_type) {
+    if (data_type == DATA_TYPE_FLOAT && dims_size >= 2) {
+        return {DATA_FORMAT_NCHW, DATA_FORMAT_NC4HW4, DATA_FORMAT_NC8HW8};
+    } else if (data_type == DATA_TYPE_INT8 && dims_size == 4) {
+        return {DATA_FORMAT_NHWC4};
+    }
+    return {};
+}
+
+// nchw and the blocked layouts of 4 and 8 channels to each other
+Status X86ReformatLayerAcc::ReformatLayout(Blob *input, Blob *output) {
+    auto dims       = input->GetBlobDesc().dims;
+    auto src_pack   = GetBlockedDataFormatPack(input->GetBlobDesc().data_format);
+    auto dst_pack   = GetBlockedDataFormatPack(output->GetBlobDesc().data_format);
+    auto input_ptr  = handle_ptr<float *>(input->GetHandle());
+    auto output_ptr = handle_ptr<float *>(output->GetHandle());
+    if (src_pack == 0 && dst_pack > 0) {
+        NCHWToBlocked(output_ptr, input_ptr, dims, dst_pack);
+    } else if (src_pack > 0 && dst_pack == 0) {
+        BlockedToNCHW(output_ptr, input_ptr, dims, src_pack);
+    } else if (src_pack > 0 && dst_pack > 0) {
+        BlockedToBlocked(output_ptr, dst_pack, input_ptr, src_pack, dims);
+    } else {
+        LOGE("X86ReformatLayerAcc::ReformatLayout Error: src_fmt: %d, dst_fmt: %d\n",
+             input->GetBlobDesc().data_format, output->GetBlobDesc().data_format);
+        return Status(TNNERR_MODEL_ERR, "X86ReformatLayerAcc unsupport reformat layout");
+    }
+    return TNN_OK;
+}
+
 Status X86ReformatLayerAcc::allocateBufferParam(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
     auto param = dynamic_cast<ReformatLayerParam *>(param_);
     CHECK_PARAM_NULL(param);
@@ -83,6 +124,13 @@ Status X86ReformatLayerAcc::DoForward(const std::vector<Blob *> &inputs, const s
     auto param = dynamic_cast<ReformatLayerParam *>(param_);
     CHECK_PARAM_NULL(param);
 
+    if (IsLayoutReformat(param)) {
+        for (int i = 0; i < inputs.size(); ++i) {
+            RETURN_ON_NEQ(ReformatLayout(inputs[i], outputs[i]), TNN_OK);
+        }
+        return TNN_OK;
+    }
+
     for (int i = 0; i < inputs.size(); ++i) {
         auto dims   = outputs[i]->GetBlobDesc().dims;
         int batch   = dims[0];
@@ -32,6 +32,13 @@ public:
     virtual Status DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs);
 
 private:
+    virtual std::vector<DataFormat> SupportDataFormat(DataType data_type, int dims_size, BlobType blob_type);
+
+    // @brief whether the reformat only changes the layout of float blobs
+    bool IsLayoutReformat(ReformatLayerParam *param);
+
+    Status ReformatLayout(Blob *input, Blob *output);
+
     std::vector<RawBuffer> scale_buffer_;
 };
 
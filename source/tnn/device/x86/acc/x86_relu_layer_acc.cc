@@ -15,26 +15,7 @@
 #include "tnn/device/x86/acc/x86_relu_layer_acc.h"
 #include "tnn/device/x86/acc/compute/x86_compute_int8.h"
 
-#include <cmath>
-#include <algorithm>
-
 namespace TNN_NS {
-typedef struct x86_relu_operator : x86_unary2_operator {
-    virtual float operator()(const float v) {
-        return std::max(v, 0.0f);
-    }
-
-    virtual Float4 operator()(const Float4 &v) {
-        return Float4::max(v, Float4(0.f));
-    }
-
-    virtual Float8 operator()(const Float8 &v) {
-        return (Float8::max(v, Float8(0.f)));
-    }
-} X86_RELU_OP;
-
-X86_REGISTER_UNARY2_KERNEL(LAYER_RELU, avx2, unary2_kernel_avx<X86_RELU_OP>);
-X86_REGISTER_UNARY2_KERNEL(LAYER_RELU, sse42, unary2_kernel_sse<X86_RELU_OP>);
 
 Status X86ReluLayerAcc::DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
     if (inputs[0]->GetBlobDesc().data_type == DATA_TYPE_INT8) {
@@ -49,4 +30,5 @@ Status X86ReluLayerAcc::DoForward(const std::vector<Blob *> &inputs, const std::
 }
 
 REGISTER_X86_ACC(Relu, LAYER_RELU);
+REGISTER_X86_BLOCKED_LAYOUT(LAYER_RELU, false);
 }   // namespace TNN_NS
\ No newline at end of file
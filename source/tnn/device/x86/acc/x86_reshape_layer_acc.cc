@@ -19,7 +19,17 @@
 
 namespace TNN_NS {
 
-DECLARE_X86_ACC(Reshape, LAYER_RESHAPE);
+DECLARE_X86_VIEW_ACC(Reshape, LAYER_RESHAPE);
+
+int64_t X86ReshapeLayerAcc::GetViewOffset(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs,
+                                          int output_index) {
+    auto param = dynamic_cast<ReshapeLayerParam *>(param_);
+    // tensorflow reshape moves data
+    if (!param || param->reshape_type != 0 || !IsDenseView(inputs[0], outputs[output_index])) {
+        return -1;
+    }
+    return 0;
+}
 
 Status X86ReshapeLayerAcc::DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
     auto &input  = inputs[0];
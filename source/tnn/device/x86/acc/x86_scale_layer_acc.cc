@@ -20,7 +20,22 @@
 
 namespace TNN_NS {
 
-DECLARE_X86_ACC(Scale, LAYER_SCALE);
+class X86ScaleLayerAcc : public X86LayerAcc {
+public:
+    virtual ~X86ScaleLayerAcc(){};
+    virtual Status DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) override;
+
+    // @brief each element is read before the same element of output is written
+    virtual bool SupportInplace(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs,
+                                int input_index) override {
+        return input_index == 0;
+    }
+
+protected:
+    virtual bool SupportBlockedLayout() override {
+        return true;
+    }
+};
 
 Status X86ScaleLayerAcc::DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
     
@@ -32,10 +47,8 @@ Status X86ScaleLayerAcc::DoForward(const std::vector<Blob *> &inputs, const std:
     auto input_blob        = inputs[0];
     auto output_blob       = outputs[0];
 
-    auto x86_fma_func = X86_FMA<Float4, 4>;
-    if (arch_ == avx2) {
-        x86_fma_func = X86_FMA<Float8, 8>;
-    }
+    auto &kernels     = GetX86ComputeKernels(arch_);
+    auto x86_fma_func = IsBlockedBlob(input_blob) ? kernels.fma_blocked : kernels.fma;
 
     RawBuffer scale_handle = resource->scale_handle;
     bool shared_channel     = scale_handle.GetBytesSize() == DataTypeUtils::GetBytesSize(scale_handle.GetDataType());
@@ -51,5 +64,6 @@ Status X86ScaleLayerAcc::DoForward(const std::vector<Blob *> &inputs, const std:
 }
 
 REGISTER_X86_ACC(Scale, LAYER_SCALE);
+REGISTER_X86_BLOCKED_LAYOUT(LAYER_SCALE, false);
 
 }  // namespace TNN_NS
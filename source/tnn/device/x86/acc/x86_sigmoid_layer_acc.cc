@@ -14,27 +14,9 @@
 
 #include "tnn/device/x86/acc/x86_unary2_layer_acc.h"
 
-#include <cmath>
-#include <algorithm>
-
 namespace TNN_NS {
-typedef struct x86_sigmoid_operator : x86_unary2_operator {
-    virtual float operator()(const float v) {
-        return 1.0f / (1.0f + exp(-v));
-    }
-
-    virtual Float4 operator()(const Float4 &v) {
-        return Float4::sigmoid(v);
-    }
-
-    virtual Float8 operator()(const Float8 &v) {
-        return Float8::sigmoid(v);
-    }
-} X86_SIGMOID_OP;
-
-X86_REGISTER_UNARY2_KERNEL(LAYER_SIGMOID, avx2, unary2_kernel_avx<X86_SIGMOID_OP>);
-X86_REGISTER_UNARY2_KERNEL(LAYER_SIGMOID, sse42, unary2_kernel_sse<X86_SIGMOID_OP>);
 DECLARE_X86_UNARY2_ACC(Sigmoid, LAYER_SIGMOID);
 REGISTER_X86_ACC(Sigmoid, LAYER_SIGMOID);
+REGISTER_X86_BLOCKED_LAYOUT(LAYER_SIGMOID, false);
 
 }  // namespace TNN_NS
@@ -15,8 +15,7 @@
 #include <algorithm>
 #include <cmath>
 
-#include "tnn/device/x86/acc/Float4.h"
-#include "tnn/device/x86/acc/Float8.h"
+#include "tnn/device/x86/acc/compute/x86_compute.h"
 #include "tnn/device/x86/acc/x86_layer_acc.h"
 #include "tnn/utils/data_type_utils.h"
 #include "tnn/utils/dims_utils.h"
@@ -25,131 +24,6 @@ namespace TNN_NS {
 
 DECLARE_X86_ACC(SoftMax, LAYER_SOFTMAX);
 
-template <typename VEC, int pack>
-static void softmax_channel_func(float *input_ptr, float *output_ptr, int channel, int count, void *workspace) {
-    float *temp = reinterpret_cast<float *>(workspace);
-
-    temp[0] = input_ptr[0];
-    // max
-    int ele    = 0;
-    auto v_max = VEC(temp[0]);
-    float vec_buf[pack];
-    for (; ele + pack - 1 < channel; ele += pack) {
-        v_max = VEC::max(v_max, VEC::loadu(input_ptr + ele));
-    }
-    for (; ele < channel; ele++) {
-        temp[0] = std::max(temp[0], input_ptr[ele]);
-    }
-    VEC::saveu(vec_buf, v_max);
-    for (int i = 0; i < pack; i++) {
-        temp[0] = std::max(temp[0], vec_buf[i]);
-    }
-
-    // exp
-    ele = 0;
-    for (; ele + pack - 1 < channel; ele += pack) {
-        VEC::saveu(output_ptr + ele, VEC::exp(VEC::loadu(input_ptr + ele) - VEC(temp[0])));
-    }
-    for (; ele < channel; ele++) {
-        output_ptr[ele] = expf(input_ptr[ele] - temp[0]);
-    }
-
-    // sum
-    temp[0]    = 0.f;
-    auto v_sum = VEC(0.f);
-    ele        = 0;
-    for (; ele + pack - 1 < channel; ele += pack) {
-        v_sum = v_sum + VEC::loadu(output_ptr + ele);
-    }
-    for (; ele < channel; ele++) {
-        temp[0] += output_ptr[ele];
-    }
-    VEC::saveu(vec_buf, v_sum);
-    for (int i = 0; i < pack; i++) {
-        temp[0] += vec_buf[i];
-    }
-
-    // division
-    temp[0] = 1.f / temp[0];
-
-    //
-    ele = 0;
-    for (; ele + pack - 1 < channel; ele += pack) {
-        VEC::saveu(output_ptr + ele, VEC::loadu(output_ptr + ele) * temp[0]);
-    }
-    for (; ele < channel; ele++) {
-        output_ptr[ele] *= temp[0];
-    }
-}
-
-template <typename VEC, int pack>
-static void softmax_func(float *input_ptr, float *output_ptr, int channel, int count, void *workspace) {
-    if (count == 1) {
-        return softmax_channel_func<VEC, pack>(input_ptr, output_ptr, channel, count, workspace);
-    }
-
-    float *temp = reinterpret_cast<float *>(workspace);
-    // max
-    memcpy(temp, input_ptr, count * sizeof(float));
-    for (int c = 1; c < channel; c++) {
-        float *input_channel = input_ptr + c * count;
-        int ele              = 0;
-        for (; ele + pack - 1 < count; ele += pack) {
-            VEC::saveu(temp + ele, VEC::max(VEC::loadu(temp + ele), VEC::loadu(input_channel + ele)));
-        }
-        for (; ele < count; ele++) {
-            temp[ele] = std::max(temp[ele], input_channel[ele]);
-        }
-    }
-
-    // exp
-    for (int c = 0; c < channel; c++) {
-        float *input_channel  = input_ptr + c * count;
-        float *output_channel = output_ptr + c * count;
-
-        int ele = 0;
-        for (; ele + pack - 1 < count; ele += pack) {
-            VEC::saveu(output_channel + ele, VEC::exp(VEC::loadu(input_channel + ele) - VEC::loadu(temp + ele)));
-        }
-        for (; ele < count; ele++) {
-            output_channel[ele] = expf(input_channel[ele] - temp[ele]);
-        }
-    }
-
-    // sum
-    memcpy(temp, output_ptr, count * sizeof(float));
-    for (int c = 1; c < channel; c++) {
-        float *output_channel = output_ptr + c * count;
-        int ele               = 0;
-        for (; ele + pack - 1 < count; ele += pack) {
-            VEC::saveu(temp + ele, VEC::loadu(temp + ele) + VEC::loadu(output_channel + ele));
-        }
-        for (; ele < count; ele++) {
-            temp[ele] += output_channel[ele];
-        }
-    }
-
-    // division
-    int ele = 0;
-    for (; ele + pack - 1 < count; ele += pack) {
-        VEC::saveu(temp + ele, VEC::div(VEC(1.f), VEC::loadu(temp + ele)));
-    }
-    for (; ele < count; ele++) {
-        temp[ele] = 1.0f / temp[ele];
-    }
-
-    for (int c = 0; c < channel; c++) {
-        float *output_channel = output_ptr + c * count;
-        int ele               = 0;
-        for (; ele + pack - 1 < count; ele += pack) {
-            VEC::saveu(output_channel + ele, VEC::loadu(temp + ele) * VEC::loadu(output_channel + ele));
-        }
-        for (; ele < count; ele++) {
-            output_channel[ele] *= temp[ele];
-        }
-    }
-}
-
 Status X86SoftMaxLayerAcc::DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
     auto params = dynamic_cast<SoftmaxLayerParam *>(param_);
 
@@ -171,10 +45,7 @@ Status X86SoftMaxLayerAcc::DoForward(const std::vector<Blob *> &inputs, const st
 
     auto workspace = context_->GetSharedWorkSpace(count * sizeof(float));
 
-    auto func = softmax_func<Float8, 8>;
-    if (arch_ == sse42) {
-        func = softmax_func<Float4, 4>;
-    }
+    auto func = GetX86ElementwiseKernels(arch_).softmax;
 
     for (int n = 0; n < batch; n++) {
         float *const input_batch  = input_data + n * channel * count;
@@ -14,27 +14,9 @@
 
 #include "tnn/device/x86/acc/x86_unary2_layer_acc.h"
 
-#include <cmath>
-#include <algorithm>
-
 namespace TNN_NS {
-typedef struct x86_softplus_operator : x86_unary2_operator {
-    virtual float operator()(const float v) {
-        return log(exp(v) + 1.0f);
-    }
-
-    virtual Float4 operator()(const Float4 &v) {
-        return Float4::log(Float4::exp(v) + Float4(1.0f));
-    }
-
-    virtual Float8 operator()(const Float8 &v) {
-        return Float8::log(Float8::exp(v) + Float8(1.0f));
-    }
-} X86_SOFTPLUS_OP;
-
-X86_REGISTER_UNARY2_KERNEL(LAYER_SOFTPLUS, avx2, unary2_kernel_avx<X86_SOFTPLUS_OP>);
-X86_REGISTER_UNARY2_KERNEL(LAYER_SOFTPLUS, sse42, unary2_kernel_sse<X86_SOFTPLUS_OP>);
 DECLARE_X86_UNARY2_ACC(Softplus, LAYER_SOFTPLUS);
 REGISTER_X86_ACC(Softplus, LAYER_SOFTPLUS);
+REGISTER_X86_BLOCKED_LAYOUT(LAYER_SOFTPLUS, false);
 
 }  // namespace TNN_NS
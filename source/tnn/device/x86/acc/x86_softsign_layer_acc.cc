@@ -14,27 +14,9 @@
 
 #include "tnn/device/x86/acc/x86_unary2_layer_acc.h"
 
-#include <cmath>
-#include <algorithm>
-
 namespace TNN_NS {
-typedef struct x86_softsign_operator : x86_unary2_operator {
-    virtual float operator()(const float v) {
-        return v / (std::abs(v) + 1.0f);
-    }
-
-    virtual Float4 operator()(const Float4 &v) {
-        return Float4::div(v, (Float4::abs(v) + Float4(1.0f)));
-    }
-
-    virtual Float8 operator()(const Float8 &v) {
-        return Float8::div(v, (Float8::abs(v) + Float8(1.0f)));
-    }
-} X86_SOFTSIGN_OP;
-
-X86_REGISTER_UNARY2_KERNEL(LAYER_SOFTSIGN, avx2, unary2_kernel_avx<X86_SOFTSIGN_OP>);
-X86_REGISTER_UNARY2_KERNEL(LAYER_SOFTSIGN, sse42, unary2_kernel_sse<X86_SOFTSIGN_OP>);
 DECLARE_X86_UNARY2_ACC(Softsign, LAYER_SOFTSIGN);
 REGISTER_X86_ACC(Softsign, LAYER_SOFTSIGN);
+REGISTER_X86_BLOCKED_LAYOUT(LAYER_SOFTSIGN, false);
 
 }  // namespace TNN_NS
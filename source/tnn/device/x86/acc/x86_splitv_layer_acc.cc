@@ -18,7 +18,26 @@
 
 namespace TNN_NS {
 
-DECLARE_X86_ACC(SplitV, LAYER_SPLITV);
+DECLARE_X86_VIEW_ACC(SplitV, LAYER_SPLITV);
+
+// slices are contiguous in input if nothing is before the split axis
+int64_t X86SplitVLayerAcc::GetViewOffset(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs,
+                                         int output_index) {
+    auto layer_param = dynamic_cast<SplitVLayerParam *>(param_);
+    auto input_dims  = inputs[0]->GetBlobDesc().dims;
+    if (!layer_param || layer_param->axis < 0 || layer_param->axis >= (int)input_dims.size() ||
+        inputs[0]->GetBlobDesc().data_type != DATA_TYPE_FLOAT || !IsDenseView(inputs[0], outputs[output_index]) ||
+        DimsVectorUtils::Count(input_dims, 0, layer_param->axis) != 1) {
+        return -1;
+    }
+    const int axis = layer_param->axis;
+    int slice_size = DimsVectorUtils::Count(input_dims, axis + 1);
+    int offset     = 0;
+    for (int i = 0; i < output_index; i++) {
+        offset += outputs[i]->GetBlobDesc().dims[axis];
+    }
+    return (int64_t)offset * slice_size * sizeof(float);
+}
 
 Status X86SplitVLayerAcc::DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
     auto layer_param = dynamic_cast<SplitVLayerParam *>(param_);
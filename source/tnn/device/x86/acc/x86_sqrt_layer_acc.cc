@@ -14,27 +14,9 @@
 
 #include "tnn/device/x86/acc/x86_unary2_layer_acc.h"
 
-#include <cmath>
-#include <algorithm>
-
 namespace TNN_NS {
-typedef struct x86_sqrt_operator : x86_unary2_operator {
-    virtual float operator()(const float v) {
-        return sqrt(v);
-    }
-
-    virtual Float4 operator()(const Float4 &v) {
-        return Float4::sqrt(v);
-    }
-
-    virtual Float8 operator()(const Float8 &v) {
-        return Float8::sqrt(v);
-    }
-} X86_SQRT_OP;
-
-X86_REGISTER_UNARY2_KERNEL(LAYER_SQRT, avx2, unary2_kernel_avx<X86_SQRT_OP>);
-X86_REGISTER_UNARY2_KERNEL(LAYER_SQRT, sse42, unary2_kernel_sse<X86_SQRT_OP>);
 DECLARE_X86_UNARY2_ACC(Sqrt, LAYER_SQRT);
 REGISTER_X86_ACC(Sqrt, LAYER_SQRT);
+REGISTER_X86_BLOCKED_LAYOUT(LAYER_SQRT, false);
 
 }   // namespace TNN_NS
\ No newline at end of file
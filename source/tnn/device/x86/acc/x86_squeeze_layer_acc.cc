@@ -18,7 +18,12 @@
 
 namespace TNN_NS {
 
-DECLARE_X86_ACC(Squeeze, LAYER_SQUEEZE);
+DECLARE_X86_VIEW_ACC(Squeeze, LAYER_SQUEEZE);
+
+int64_t X86SqueezeLayerAcc::GetViewOffset(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs,
+                                          int output_index) {
+    return IsDenseView(inputs[0], outputs[output_index]) ? 0 : -1;
+}
 
 Status X86SqueezeLayerAcc::DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
     void *input_data  = handle_ptr<void*>(inputs[0]->GetHandle());
@@ -19,5 +19,6 @@ namespace TNN_NS {
 DECLARE_X86_BINARY_OP_ACC(Sub, X86BinaryOpType::kSUB);
 
 REGISTER_X86_ACC(Sub, LAYER_SUB);
+REGISTER_X86_BLOCKED_LAYOUT(LAYER_SUB, false);
 
 }   // namespace TNN_NS
\ No newline at end of file
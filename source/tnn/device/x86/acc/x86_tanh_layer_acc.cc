@@ -13,26 +13,9 @@
 // specific language governing permissions and limitations under the License.
 
 #include "tnn/device/x86/acc/x86_unary2_layer_acc.h"
-#include <cmath>
-
 namespace TNN_NS {
-typedef struct x86_tanh_operator : x86_unary2_operator {
-    virtual float operator()(const float v) {
-        return tanh(v);
-    }
-
-    virtual Float4 operator()(const Float4 &v) {
-        return Float4::tanh(v);
-    }
-
-    virtual Float8 operator()(const Float8 &v) {
-        return Float8::tanh(v);
-    }
-} X86_TANH_OP;
-
-X86_REGISTER_UNARY2_KERNEL(LAYER_TANH, avx2, unary2_kernel_avx<X86_TANH_OP>);
-X86_REGISTER_UNARY2_KERNEL(LAYER_TANH, sse42, unary2_kernel_sse<X86_TANH_OP>);
 DECLARE_X86_UNARY2_ACC(Tanh, LAYER_TANH);
 REGISTER_X86_ACC(Tanh, LAYER_TANH);
+REGISTER_X86_BLOCKED_LAYOUT(LAYER_TANH, false);
 
 }   // namespace TNN_NS
\ No newline at end of file
@@ -13,16 +13,18 @@
 // specific language governing permissions and limitations under the License.
 
 #include "tnn/device/x86/acc/x86_unary2_layer_acc.h"
+#include "tnn/device/x86/acc/compute/x86_compute.h"
 #include "tnn/device/x86/x86_context.h"
 #include "tnn/utils/dims_utils.h"
-#include "tnn/utils/string_utils_inner.h"
 
 namespace TNN_NS {
 
 Status X86_UNARY2_CALCULATE(DimsVector &dims, const float *src, float *dst, LayerType type, x86_isa_t arch,
                             LayerParam *param) {
-    unary2_kernel_avx_func_t unary2_kernel_func = nullptr;
-    RETURN_ON_NEQ(X86Unary2LayerAcc::GetUnary2Kernel(type, arch, unary2_kernel_func), TNN_OK);
+    unary2_kernel_func_t unary2_kernel_func = GetX86ElementwiseKernels(arch).unary2(type);
+    if (!unary2_kernel_func) {
+        return Status(TNNERR_PARAM_ERR, "X86Unary2LayerAcc can not find unary kernel");
+    }
 
     unary2_kernel_func(dims, src, dst, param);
 
@@ -31,6 +33,15 @@ Status X86_UNARY2_CALCULATE(DimsVector &dims, const float *src, float *dst, Laye
 
 X86Unary2LayerAcc::~X86Unary2LayerAcc() {}
 
+bool X86Unary2LayerAcc::SupportInplace(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs,
+                                       int input_index) {
+    return input_index == 0;
+}
+
+bool X86Unary2LayerAcc::SupportBlockedLayout() {
+    return true;
+}
+
 Status X86Unary2LayerAcc::DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
     auto input  = inputs[0];
     auto output = outputs[0];
@@ -41,8 +52,19 @@ Status X86Unary2LayerAcc::DoForward(const std::vector<Blob *> &inputs, const std
     auto input_data  = handle_ptr<float *>(input->GetHandle());
     auto output_data = handle_ptr<float *>(output->GetHandle());
 
+    // the pad channels of blocked blobs are computed as well, and zeroed again for ops with f(0) != 0
+    const bool blocked = IsBlockedBlob(input);
+    const int pack     = GetBlockedDataFormatPack(input->GetBlobDesc().data_format);
+    if (blocked) {
+        dims[1] = ROUND_UP(dims[1], pack);
+    }
+
     RETURN_ON_NEQ(X86_UNARY2_CALCULATE(dims, input_data, output_data, type_, arch_, param_), TNN_OK);
 
+    if (blocked) {
+        ZeroBlockedPadding(output_data, output->GetBlobDesc().dims, pack);
+    }
+
     return TNN_OK;
 }
 
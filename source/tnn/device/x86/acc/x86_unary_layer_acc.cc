@@ -28,6 +28,11 @@ Status X86UnaryLayerAcc::Init(Context *context, LayerParam *param, LayerResource
     return op_->Init(param);
 }
 
+bool X86UnaryLayerAcc::SupportInplace(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs,
+                                      int input_index) {
+    return input_index == 0;
+}
+
 Status X86UnaryLayerAcc::DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
     auto input  = inputs[0];
     auto output = outputs[0];
@@ -38,10 +43,13 @@ Status X86UnaryLayerAcc::DoForward(const std::vector<Blob *> &inputs, const std:
     auto input_data  = handle_ptr<float*>(input->GetHandle());
     auto output_data = handle_ptr<float*>(output->GetHandle());
 
-    OMP_PARALLEL_FOR_GUIDED_
-    for (int n = 0; n < count; n++) {
-        output_data[n] = (*op_)(input_data[n]);
-    }
+    const int block_size = 1024;
+    PARALLEL_FOR_(0, UP_DIV(count, block_size), [&](long block, int) {
+        int n_end = MIN(count, (int)(block + 1) * block_size);
+        for (int n = block * block_size; n < n_end; n++) {
+            output_data[n] = (*op_)(input_data[n]);
+        }
+    });
 
     return TNN_OK;
 }
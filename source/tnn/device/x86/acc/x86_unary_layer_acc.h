@@ -42,6 +42,10 @@ public:
                         const std::vector<Blob *> &outputs) override;
 
     virtual Status DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) override;
+
+    // @brief each element is read before the same element of output is written
+    virtual bool SupportInplace(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs,
+                                int input_index) override;
 protected:
     std::shared_ptr<X86_UNARY_OP> op_;
 };
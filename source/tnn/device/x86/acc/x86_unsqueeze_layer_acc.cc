@@ -18,7 +18,12 @@
 
 namespace TNN_NS {
 
-DECLARE_X86_ACC(Unsqueeze, LAYER_UNSQUEEZE);
+DECLARE_X86_VIEW_ACC(Unsqueeze, LAYER_UNSQUEEZE);
+
+int64_t X86UnsqueezeLayerAcc::GetViewOffset(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs,
+                                            int output_index) {
+    return IsDenseView(inputs[0], outputs[output_index]) ? 0 : -1;
+}
 
 Status X86UnsqueezeLayerAcc::DoForward(const std::vector<Blob *> &inputs, const std::vector<Blob *> &outputs) {
     void *input_data  = handle_ptr<void*>(inputs[0]->GetHandle());
@@ -53,6 +53,14 @@ Status X86BlobConverterAcc::GetBlobConvertFunc(MatType mat_type, DataType data_t
     return TNN_OK;
 }
 
+std::shared_ptr<Blob> X86BlobConverterAcc::CreateNCHWBlob(const BlobDesc &desc, RawBuffer &buffer) {
+    BlobDesc nchw_desc    = desc;
+    nchw_desc.data_format = DATA_FORMAT_NCHW;
+    BlobHandle handle;
+    handle.base = buffer.force_to<void *>();
+    return std::make_shared<Blob>(nchw_desc, handle);
+}
+
 Status X86BlobConverterAcc::ConvertToMatAsync(Mat &image, MatConvertParam param, void *command_queue) {
     Status ret = TNN_OK;
     if (blob_ == nullptr) {
@@ -87,6 +95,14 @@ Status X86BlobConverterAcc::ConvertToMatAsync(Mat &image, MatConvertParam param,
         } else {
             return ret;
         }
+    } else if (desc.data_type == DATA_TYPE_FLOAT && GetBlockedDataFormatPack(desc.data_format) > 0) {
+        // blocked blobs are converted through nchw
+        RawBuffer nchw_buffer(DimsVectorUtils::Count(desc.dims) * sizeof(float));
+        auto nchw_blob = CreateNCHWBlob(desc, nchw_buffer);
+        BlockedToNCHW(nchw_buffer.force_to<float *>(), handle_ptr<float *>(blob_->GetHandle()), desc.dims,
+                      GetBlockedDataFormatPack(desc.data_format));
+        DefaultBlobConverterAcc nchw_converter(nchw_blob.get());
+        return nchw_converter.ConvertToMatAsync(image, param, command_queue);
     } else {
         return DefaultBlobConverterAcc::ConvertToMatAsync(image, param, command_queue);
     }
@@ -130,6 +146,13 @@ Status X86BlobConverterAcc::ConvertFromMatAsync(Mat &image, MatConvertParam para
         } else {
             return ret;
         }
+    } else if (desc.data_type == DATA_TYPE_FLOAT && GetBlockedDataFormatPack(desc.data_format) > 0) {
+        RawBuffer nchw_buffer(DimsVectorUtils::Count(desc.dims) * sizeof(float));
+        auto nchw_blob = CreateNCHWBlob(desc, nchw_buffer);
+        DefaultBlobConverterAcc nchw_converter(nchw_blob.get());
+        RETURN_ON_NEQ(nchw_converter.ConvertFromMatAsync(image, param, command_queue), TNN_OK);
+        NCHWToBlocked(handle_ptr<float *>(blob_->GetHandle()), nchw_buffer.force_to<float *>(), desc.dims,
+                      GetBlockedDataFormatPack(desc.data_format));
     } else {
         return DefaultBlobConverterAcc::ConvertFromMatAsync(image, param, command_queue);
     }
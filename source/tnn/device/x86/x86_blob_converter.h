@@ -15,8 +15,11 @@
 #ifndef TNN_SOURCE_TNN_DEVICE_X86_X86_BLOB_CONVERTER_H_
 #define TNN_SOURCE_TNN_DEVICE_X86_X86_BLOB_CONVERTER_H_
 
+#include <memory>
+
 #include "tnn/core/macro.h"
 #include "tnn/device/x86/x86_util.h"
+#include "tnn/interpreter/raw_buffer.h"
 #include "tnn/utils/blob_converter_default.h"
 #include "tnn/utils/blob_converter.h"
 
@@ -55,6 +58,9 @@ private:
     std::vector<float> fused_int8_bias;
     X86BlobConvertFunc cvt_func_;
 
+    // @brief blob of desc in nchw on the memory of buffer, to convert blocked blobs through
+    static std::shared_ptr<Blob> CreateNCHWBlob(const BlobDesc &desc, RawBuffer &buffer);
+
     static Status GetBlobConvertFunc(MatType mat_type, DataType data_type, BlobConvertDirection cvt_dir,
                                      X86BlobConvertFunc& cvt_func);
     static std::string GetUniqueBlobConvertKey(MatType mat_type, DataType data_type, BlobConvertDirection cvt_dir);
@@ -29,4 +29,18 @@
 
 #define SIMD_KERNEL_EXTRA_LOAD (64)
 
+// fat binaries build the files of simd kernels again with TNN_X86_COMPUTE_AVX2 and TNN_X86_COMPUTE_AVX512 defined.
+// the simd vector types of those builds live in an inline namespace of their isa, so their inline functions are not
+// merged with the ones of the sse4.2 build at link time.
+#if defined(TNN_X86_COMPUTE_AVX512)
+#define X86_SIMD_NAMESPACE_BEGIN inline namespace simd_avx512 {
+#define X86_SIMD_NAMESPACE_END }
+#elif defined(TNN_X86_COMPUTE_AVX2)
+#define X86_SIMD_NAMESPACE_BEGIN inline namespace simd_avx2 {
+#define X86_SIMD_NAMESPACE_END }
+#else
+#define X86_SIMD_NAMESPACE_BEGIN
+#define X86_SIMD_NAMESPACE_END
+#endif
+
 #endif
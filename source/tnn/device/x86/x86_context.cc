@@ -13,6 +13,11 @@
 // specific language governing permissions and limitations under the License.
 
 #include "tnn/device/x86/x86_context.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "tnn/device/x86/acc/compute/jit/utils/cpu_isa.h"
 #include "tnn/utils/omp_utils.h"
 
 namespace TNN_NS {
@@ -27,11 +32,33 @@ Status X86Context::GetCommandQueue(void** command_queue) {
 
 Status X86Context::OnInstanceForwardBegin() {
     Context::OnInstanceForwardBegin();
-    OMP_SET_THREADS_(GetNumThreads());
+    const int num_threads = GetNumThreads();
+    // layers running in parallel bind slots up to num_threads
+    if ((int)work_space_.size() < num_threads) {
+        work_space_.resize(num_threads);
+    }
+    if (OMP_MAX_THREADS_NUM_ != num_threads) {
+        OMP_SET_THREADS_(num_threads);
+    }
+
+    if (cpu_thread_pool_mode_ != CPU_THREAD_POOL_NONE && num_threads > 1) {
+        // the forward thread takes part in ParallelFor, so the pool needs num_threads - 1 workers
+        if (!thread_pool_ || thread_pool_->GetThreadNum() != num_threads - 1) {
+            if (cpu_thread_pool_mode_ == CPU_THREAD_POOL_SHARED) {
+                thread_pool_ = ThreadPool::GetSharedPool(num_threads - 1, cpu_affinity_);
+            } else {
+                thread_pool_ = std::make_shared<ThreadPool>(num_threads - 1, cpu_affinity_);
+            }
+        }
+        ThreadPool::BindCurrentThread(thread_pool_.get(), num_threads);
+    } else {
+        ThreadPool::BindCurrentThread(nullptr, 1);
+    }
     return TNN_OK;
 }
 
 Status X86Context::OnInstanceForwardEnd() {
+    ThreadPool::BindCurrentThread(nullptr, 1);
     return TNN_OK;
 }
 
@@ -40,12 +67,28 @@ Status X86Context::Synchronize() {
 }
 
 Status X86Context::SetNumThreads(int num_threads) {
-    num_threads_ = MIN(MAX(num_threads, 1), OMP_CORES_);
+    num_threads_ = MAX(num_threads, 1);
     return TNN_OK;
 }
 
 int X86Context::GetNumThreads() {
-    return num_threads_;
+    // the thread pool does not depend on OpenMP, it is limited by hardware threads only
+    if (cpu_thread_pool_mode_ != CPU_THREAD_POOL_NONE) {
+        return MIN(num_threads_, MAX((int)std::thread::hardware_concurrency(), 1));
+    }
+    return MIN(num_threads_, OMP_CORES_);
+}
+
+std::string X86Context::GetPackedCacheTag() {
+    std::string tag = "x86";
+    const std::vector<std::pair<x86_isa_t, std::string>> isa_names = {
+        {sse42, "sse42"}, {avx, "avx"}, {avx2, "avx2"}, {avx512, "avx512"}, {avx512_vnni, "avx512_vnni"}};
+    for (const auto &isa : isa_names) {
+        if (cpu_with_isa(isa.first)) {
+            tag += "_" + isa.second;
+        }
+    }
+    return tag;
 }
 
 void* X86Context::GetSharedWorkSpace(size_t size) {
@@ -53,13 +96,19 @@ void* X86Context::GetSharedWorkSpace(size_t size) {
 }
 
 void* X86Context::GetSharedWorkSpace(size_t size, int index) {
-    while(work_space_.size() < index + 1) {
-        work_space_.push_back(RawBuffer(size, 32));
+    const int slot = ThreadPool::GetBoundSlot();
+    if (slot >= (int)work_space_.size()) {
+        LOGE("Error: work space slot %d is not added by OnInstanceForwardBegin\n", slot);
+        return nullptr;
+    }
+    auto &work_space = work_space_[slot];
+    while(work_space.size() < index + 1) {
+        work_space.push_back(RawBuffer(size, 32));
     }
-    if (work_space_[index].GetBytesSize() < size) {
-        work_space_[index] = RawBuffer(size, 32);
+    if (work_space[index].GetBytesSize() < size) {
+        work_space[index] = RawBuffer(size, 32);
     }
-    return work_space_[index].force_to<void*>();
+    return work_space[index].force_to<void*>();
 }
 
 }  // namespace TNN_NS
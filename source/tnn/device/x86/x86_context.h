@@ -15,11 +15,13 @@
 #ifndef TNN_SOURCE_TNN_DEVICE_X86_X86_CONTEXT_H_
 #define TNN_SOURCE_TNN_DEVICE_X86_X86_CONTEXT_H_
 
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "tnn/core/context.h"
 #include "tnn/interpreter/raw_buffer.h"
+#include "tnn/utils/thread_pool.h"
 
 namespace TNN_NS {
 
@@ -47,12 +49,20 @@ public:
     // @brief get threads run on device
     virtual int GetNumThreads();
 
+    // @brief packed resources depend on the isa the cpu supports
+    virtual std::string GetPackedCacheTag() override;
+
+    // @brief work space of the slot bound to the current thread, see ThreadPool::GetBoundSlot
     void* GetSharedWorkSpace(size_t size);
     void* GetSharedWorkSpace(size_t size, int index);
 
 private:
     int num_threads_ = 1;
-    std::vector<RawBuffer> work_space_;
+    // kernel thread pool, only used if cpu_thread_pool_mode_ is not CPU_THREAD_POOL_NONE
+    std::shared_ptr<ThreadPool> thread_pool_ = nullptr;
+    // layers may run concurrently on different threads, each slot owns its work space. the slots are added
+    // before a forward starts, so the lookup needs no lock
+    std::vector<std::vector<RawBuffer>> work_space_ = std::vector<std::vector<RawBuffer>>(1);
 };
 
 }  // namespace TNN_NS
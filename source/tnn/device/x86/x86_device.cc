@@ -15,7 +15,9 @@
 #include "tnn/device/x86/acc/x86_cpu_adapter_acc.h"
 #include "tnn/device/x86/x86_device.h"
 #include "tnn/device/x86/x86_context.h"
+#include "tnn/device/x86/x86_util.h"
 #include "tnn/utils/blob_memory_size_utils.h"
+#include "tnn/utils/cpu_allocator.h"
 #include "tnn/utils/dims_vector_utils.h"
 
 namespace TNN_NS {
@@ -28,8 +30,12 @@ BlobMemorySizeInfo X86Device::Calculate1DMemorySize(BlobDesc &desc) {
     BlobMemorySizeInfo info;
     info.data_type = desc.data_type;
     int count      = 0;
+    const int pack = x86::GetBlockedDataFormatPack(desc.data_format);
     if (desc.data_type == DATA_TYPE_INT8) {
         count = desc.dims[0] * ROUND_UP(desc.dims[1], 4) * DimsVectorUtils::Count(desc.dims, 2);
+    } else if (pack > 0 && desc.dims.size() > 1) {
+        // blocked layouts pad the channels to whole blocks
+        count = desc.dims[0] * ROUND_UP(desc.dims[1], pack) * DimsVectorUtils::Count(desc.dims, 2);
     } else {
         count = DimsVectorUtils::Count(desc.dims);
     }
@@ -64,25 +70,37 @@ Status X86Device::Allocate(void** handle, MatType mat_type, DimsVector dims) {
 
 Status X86Device::Allocate(void** handle, BlobMemorySizeInfo& size_info) {
     if (handle) {
-        int size = GetBlobMemoryBytesSize(size_info);
-        *handle = malloc(size);
-        if (*handle && size > 0) {
-            memset(*handle, 0, size);
+        auto size = GetBlobMemoryBytesSize(size_info);
+        if (size < 0) {
+            return Status(TNNERR_PARAM_ERR, "X86Device::Allocate bytes size < 0");
+        }
+        *handle = CpuAllocator::GetInstance().Allocate(size, size_info.zero_fill);
+        if (!*handle) {
+            return Status(TNNERR_OUTOFMEMORY, "X86Device::Allocate failed");
         }
     }
     return TNN_OK;
 }
 
 Status X86Device::Free(void* handle) {
-    if (handle) {
-        free(handle);
-    }
+    CpuAllocator::GetInstance().Free(handle);
     return TNN_OK;
 }
 
+// the first layout is the one inputs in other layouts are reformatted to
 std::shared_ptr<const ImplementedLayout> X86Device::GetImplementedLayout(LayerType type) {
-    auto layouts = new ImplementedLayout();
-    layouts->layouts.push_back(DATA_FORMAT_NCHW);
+    auto layouts             = new ImplementedLayout();
+    auto &blocked_layout_map = GetBlockedLayoutMap();
+    auto iter                = blocked_layout_map.find(type);
+    if (iter == blocked_layout_map.end()) {
+        layouts->layouts.push_back(DATA_FORMAT_NCHW);
+    } else if (iter->second) {
+        layouts->layouts.push_back(x86::GetX86BlockedDataFormat());
+        layouts->layouts.push_back(DATA_FORMAT_NCHW);
+    } else {
+        layouts->layouts.push_back(DATA_FORMAT_NCHW);
+        layouts->layouts.push_back(x86::GetX86BlockedDataFormat());
+    }
     return std::shared_ptr<ImplementedLayout>(layouts);
 }
 
@@ -132,6 +150,16 @@ std::map<LayerType, std::shared_ptr<LayerAccCreator>>& X86Device::GetLayerCreato
     return layer_creator_map;
 }
 
+Status X86Device::RegisterBlockedLayout(LayerType type, bool prefer_blocked) {
+    GetBlockedLayoutMap()[type] = prefer_blocked;
+    return TNN_OK;
+}
+
+std::map<LayerType, bool>& X86Device::GetBlockedLayoutMap() {
+    static std::map<LayerType, bool> blocked_layout_map;
+    return blocked_layout_map;
+}
+
 TypeDeviceRegister<X86Device> g_x86_device_register(DEVICE_X86);
 
 } // namespace TNN_NS
@@ -58,9 +58,14 @@ public:
 
     static Status RegisterLayerAccCreator(LayerType type, LayerAccCreator* creator);
 
+    // @brief register that the acc of type computes float blobs in the blocked layout, layers preferring it get
+    // their nchw inputs reformatted, the others keep the layout of their inputs
+    static Status RegisterBlockedLayout(LayerType type, bool prefer_blocked);
+
 private:
     BlobMemorySizeInfo Calculate1DMemorySize(BlobDesc& desc);
     static std::map<LayerType, std::shared_ptr<LayerAccCreator>> &GetLayerCreatorMap();
+    static std::map<LayerType, bool> &GetBlockedLayoutMap();
 };
 
 // @brief X86TypeLayerAccRegister register X86TypeLayerAccCreator
@@ -72,6 +77,14 @@ public:
     }
 };
 
+// @brief X86TypeLayerLayoutRegister register the blocked layout of layer type
+class X86TypeLayerLayoutRegister {
+public:
+    explicit X86TypeLayerLayoutRegister(LayerType type, bool prefer_blocked) {
+        X86Device::RegisterBlockedLayout(type, prefer_blocked);
+    }
+};
+
 } // namespace TNN_NS
 
 #endif // TNN_SOURCE_TNN_DEVICE_X86_X86_DEVICE_H
@@ -18,6 +18,9 @@
 #include <type_traits>
 
 #include "tnn/core/macro.h"
+#include "tnn/device/x86/acc/compute/jit/utils/cpu_isa.h"
+#include "tnn/utils/dims_function_utils.h"
+#include "tnn/utils/dims_vector_utils.h"
 #include "tnn/utils/naive_compute.h"
 
 namespace TNN_NS {
@@ -469,6 +472,118 @@ int UnpackC8(float *dst, const float *src, size_t hw, size_t src_hw_stride, size
     return 0;
 }
 
+bool CpuRunsAvx2Kernels() {
+#ifdef TNN_X86_FAT_BINARY
+    // the avx2 kernels of fat binaries are built with fma, avx only cpus run the sse4.2 ones
+    return cpu_with_isa(avx2);
+#else
+    return cpu_with_isa(avx2) || cpu_with_isa(avx);
+#endif
+}
+
+int GetBlockedDataFormatPack(DataFormat data_format) {
+    switch (data_format) {
+        case DATA_FORMAT_NC4HW4:
+            return 4;
+        case DATA_FORMAT_NC8HW8:
+            return 8;
+        case DATA_FORMAT_NC16HW16:
+            return 16;
+        default:
+            return 0;
+    }
+}
+
+DataFormat GetX86BlockedDataFormat() {
+    static const DataFormat blocked_format = CpuRunsAvx2Kernels() ? DATA_FORMAT_NC8HW8 : DATA_FORMAT_NC4HW4;
+    return blocked_format;
+}
+
+int NCHWToBlocked(float *dst, const float *src, const DimsVector &dims, int pack) {
+    const int batch   = DimsFunctionUtils::GetDim(dims, 0);
+    const int channel = DimsFunctionUtils::GetDim(dims, 1);
+    const int hw      = DimsVectorUtils::Count(dims, 2);
+    const int c_r     = ROUND_UP(channel, pack);
+    for (int b = 0; b < batch; b++) {
+        auto src_b = src + b * channel * hw;
+        auto dst_b = dst + b * c_r * hw;
+        if (pack == 4) {
+            PackC4(dst_b, src_b, hw, hw, hw, channel);
+        } else if (pack == 8) {
+            PackC8(dst_b, src_b, hw, hw, hw, channel);
+        } else {
+            for (int c = 0; c < c_r; c++) {
+                auto dst_c = dst_b + (c / pack) * hw * pack + c % pack;
+                for (int i = 0; i < hw; i++) {
+                    dst_c[i * pack] = c < channel ? src_b[c * hw + i] : 0.f;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+int BlockedToNCHW(float *dst, const float *src, const DimsVector &dims, int pack) {
+    const int batch   = DimsFunctionUtils::GetDim(dims, 0);
+    const int channel = DimsFunctionUtils::GetDim(dims, 1);
+    const int hw      = DimsVectorUtils::Count(dims, 2);
+    const int c_r     = ROUND_UP(channel, pack);
+    for (int b = 0; b < batch; b++) {
+        auto src_b = src + b * c_r * hw;
+        auto dst_b = dst + b * channel * hw;
+        if (pack == 4) {
+            UnpackC4(dst_b, src_b, hw, hw, hw, channel);
+        } else if (pack == 8) {
+            UnpackC8(dst_b, src_b, hw, hw, hw, channel);
+        } else {
+            for (int c = 0; c < channel; c++) {
+                auto src_c = src_b + (c / pack) * hw * pack + c % pack;
+                for (int i = 0; i < hw; i++) {
+                    dst_b[c * hw + i] = src_c[i * pack];
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+int BlockedToBlocked(float *dst, int dst_pack, const float *src, int src_pack, const DimsVector &dims) {
+    const int batch   = DimsFunctionUtils::GetDim(dims, 0);
+    const int channel = DimsFunctionUtils::GetDim(dims, 1);
+    const int hw      = DimsVectorUtils::Count(dims, 2);
+    const int src_c_r = ROUND_UP(channel, src_pack);
+    const int dst_c_r = ROUND_UP(channel, dst_pack);
+    for (int b = 0; b < batch; b++) {
+        auto src_b = src + b * src_c_r * hw;
+        auto dst_b = dst + b * dst_c_r * hw;
+        for (int c = 0; c < dst_c_r; c++) {
+            auto src_c = src_b + (c / src_pack) * hw * src_pack + c % src_pack;
+            auto dst_c = dst_b + (c / dst_pack) * hw * dst_pack + c % dst_pack;
+            for (int i = 0; i < hw; i++) {
+                dst_c[i * dst_pack] = c < channel ? src_c[i * src_pack] : 0.f;
+            }
+        }
+    }
+    return 0;
+}
+
+void ZeroBlockedPadding(float *data, const DimsVector &dims, int pack) {
+    const int batch   = DimsFunctionUtils::GetDim(dims, 0);
+    const int channel = DimsFunctionUtils::GetDim(dims, 1);
+    const int hw      = DimsVectorUtils::Count(dims, 2);
+    const int c_r     = ROUND_UP(channel, pack);
+    if (c_r == channel) {
+        return;
+    }
+    const int valid = channel % pack;
+    for (int b = 0; b < batch; b++) {
+        auto last_block = data + (b * c_r + c_r - pack) * hw;
+        for (int i = 0; i < hw; i++) {
+            memset(last_block + i * pack + valid, 0, (pack - valid) * sizeof(float));
+        }
+    }
+}
+
 template<typename T>
 int MatTranspose(T *dst, const T *src, size_t M, size_t N) {
     for (size_t m = 0; m < M; m++) {
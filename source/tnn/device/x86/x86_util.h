@@ -17,6 +17,7 @@
 
 #include <string.h>
 #include <cstdlib>
+#include <vector>
 #if TNN_PROFILE
 #include <chrono>
 #endif
@@ -56,11 +57,61 @@ int UnpackC4(float *dst, const float *src, size_t hw, size_t src_hw_stride, size
 
 int UnpackC8(float *dst, const float *src, size_t hw, size_t src_hw_stride, size_t dst_hw_stride, size_t channel);
 
+// @brief whether the accs run the avx2 simd kernels on this cpu, otherwise the sse4.2 ones
+bool CpuRunsAvx2Kernels();
+
+// @brief channels of one block of NC4HW4, NC8HW8 and NC16HW16, 0 for the other data formats
+int GetBlockedDataFormatPack(DataFormat data_format);
+
+// @brief the blocked layout the float accs compute in, one channel block is one simd vector of the kernels:
+// NC8HW8 with the avx2 kernels, NC4HW4 with the sse4.2 ones
+DataFormat GetX86BlockedDataFormat();
+
+// @brief nchw to [n][c/pack][dims 2..][pack] and back, the pad channels of blocked dst are zero
+int NCHWToBlocked(float *dst, const float *src, const DimsVector &dims, int pack);
+
+int BlockedToNCHW(float *dst, const float *src, const DimsVector &dims, int pack);
+
+// @brief blocked to blocked of another channel block, dst and src do not overlap
+int BlockedToBlocked(float *dst, int dst_pack, const float *src, int src_pack, const DimsVector &dims);
+
+// @brief zero the pad channels of the last block, after kernels that compute blocked data element by element
+void ZeroBlockedPadding(float *data, const DimsVector &dims, int pack);
+
 template<typename T>
 int MatTranspose(T *dst, const T *src, size_t M, size_t N);
 
 int PackINT8Weight(int8_t *src, int8_t *dst, int input_channel, int output_channel, int height, int width);
 
+// @brief scratch memory of a forward laid out in parts, every item of a part starts 32 byte aligned. accs build the
+// layout in one function that both GetWorkspaceSize and DoForward call, so the planned size is what forward uses
+class X86WorkspaceLayout {
+public:
+    // @brief append a part of count items of bytes each, return the index of the part
+    int Add(size_t bytes, int count = 1) {
+        offsets_.push_back(size_);
+        item_sizes_.push_back(ROUND_UP(bytes, 32));
+        size_ += item_sizes_.back() * count;
+        return (int)offsets_.size() - 1;
+    }
+
+    // @brief bytes of all parts
+    size_t GetSize() const {
+        return size_;
+    }
+
+    // @brief item of part index in the workspace starting at base
+    template <typename T>
+    T *Get(void *base, int index, int item = 0) const {
+        return reinterpret_cast<T *>(static_cast<char *>(base) + offsets_[index] + item_sizes_[index] * item);
+    }
+
+private:
+    std::vector<size_t> offsets_;
+    std::vector<size_t> item_sizes_;
+    size_t size_ = 0;
+};
+
 template<typename T>
 T handle_ptr(BlobHandle &handle) {
     return reinterpret_cast<T>(((char*)handle.base) + handle.bytes_offset);
@@ -35,6 +35,11 @@ public:
     // @brief different interpreter has different order param
     virtual Status Interpret(std::vector<std::string>& params) = 0;
 
+    // @brief interpret params with the options of model config, such as the model path
+    virtual Status Interpret(std::vector<std::string>& params, const ModelConfig& config) {
+        return Interpret(params);
+    };
+
     // @brief interpret extra config, such as conv winograd for specific conv layer
     virtual Status InterpretConfig(std::map<std::string, std::string>& config_map) {
         return TNN_OK;
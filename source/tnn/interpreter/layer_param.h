@@ -62,6 +62,8 @@ enum ActivationType {
     ActivationType_ReLU        = 0x0001,
     ActivationType_ReLU6       = 0x0002,
     ActivationType_SIGMOID_MUL = 0x0100,
+    // x * relu6(x + 3) / 6
+    ActivationType_HARDSWISH   = 0x0200,
 };
 
 enum FusionType {
@@ -66,6 +66,8 @@ struct NetStructure {
     std::vector<std::shared_ptr<LayerInfo>> layers;
     std::set<std::string> blobs;
     ModelType source_model_type = MODEL_TYPE_TNN;
+    // the net is optimized for the device already, it is loaded from the cache saved by an earlier init
+    bool optimized = false;
 
 public:
     std::shared_ptr<NetStructure> Copy() {
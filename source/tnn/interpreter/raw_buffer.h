@@ -36,6 +36,8 @@ public:
     RawBuffer(int bytes_size, char* buffer, DimsVector dims);
     RawBuffer(const RawBuffer &buf);
     RawBuffer(int bytes_size, int alignment);
+    // @brief reference the memory of buffer without copy, buffer keeps it alive
+    RawBuffer(int bytes_size, shared_ptr<char> buffer, DimsVector dims);
     RawBuffer &operator=(RawBuffer buf);
     ~RawBuffer();
 
@@ -32,6 +32,8 @@ DataType GetDataType(int type_value) {
             return DATA_TYPE_INT32;
         case DATA_TYPE_BFP16:
             return DATA_TYPE_BFP16;
+        case DATA_TYPE_AUTO:
+            return DATA_TYPE_AUTO;
         default:
             LOGE("Interpreter: do not support reformat src type");
             return DATA_TYPE_FLOAT;
@@ -51,6 +53,11 @@ Status ReformatLayerInterpreter::InterpretProto(str_arr layer_cfg_arr, int start
         dst_type_value = atoi(layer_cfg_arr[index++].c_str());
     }
     layer_param->dst_type = GetDataType(dst_type_value);
+    // layouts of reformats inserted by the layout optimizer, only saved for nets optimized by tnn
+    if (index + 1 < layer_cfg_arr.size()) {
+        layer_param->src_format = (DataFormat)atoi(layer_cfg_arr[index++].c_str());
+        layer_param->dst_format = (DataFormat)atoi(layer_cfg_arr[index++].c_str());
+    }
     return TNN_OK;
 }
 
@@ -62,6 +69,10 @@ Status ReformatLayerInterpreter::SaveProto(std::ofstream& output_stream, LayerPa
     auto layer_param = dynamic_cast<ReformatLayerParam*>(param);
     output_stream << layer_param->src_type << " ";
     output_stream << layer_param->dst_type << " ";
+    if (layer_param->src_format != DATA_FORMAT_AUTO || layer_param->dst_format != DATA_FORMAT_AUTO) {
+        output_stream << layer_param->src_format << " ";
+        output_stream << layer_param->dst_format << " ";
+    }
     return TNN_OK;
 }
 
@@ -14,12 +14,16 @@
 
 #include "tnn/interpreter/tnn/model_interpreter.h"
 #include <stdlib.h>
+#include <fstream>
 #include <sstream>
 
 #include "tnn/core/common.h"
 #include "tnn/interpreter/tnn/layer_interpreter/abstract_layer_interpreter.h"
 #include "tnn/interpreter/tnn/objseri.h"
+#include "tnn/utils/mapped_file.h"
 #include "tnn/utils/md5.h"
+#include "tnn/utils/reader_stream_buf.h"
+#include "tnn/utils/thread_pool.h"
 
 namespace TNN_NS {
 
@@ -32,7 +36,8 @@ std::string ModelInterpreter::Transfer(std::string content) {
 
 // Check if the magic number is valid.
 bool ModelInterpreter::IsValidVersionNumber(uint32_t number) {
-    return number == g_version_magic_number || number == g_version_magic_number_v2;
+    return number == g_version_magic_number || number == g_version_magic_number_v2 ||
+           number == g_version_magic_number_v3;
 }
 
 std::shared_ptr<Deserializer> ModelInterpreter::GetDeserializer(std::istream &is) {
@@ -132,6 +137,15 @@ Status ModelInterpreter::Interpret(std::vector<std::string> &params) {
         params_md5_.push_back(md5(item));
         LOGD("model params md5: %s\n", md5(item).c_str());
     }
+    // mapped models are not in params, the md5 of their content stands for them
+    if (!model_content_md5_.empty()) {
+        params_md5_.resize(std::max<size_t>(params_md5_.size(), 2));
+        params_md5_[1] = model_content_md5_;
+    }
+    if (!model_reader_md5_.empty()) {
+        params_md5_.resize(std::max<size_t>(params_md5_.size(), 2));
+        params_md5_[1] = model_reader_md5_;
+    }
 
     if (!config_map.empty()) {
         status          = InterpretConfig(config_map);
@@ -139,6 +153,27 @@ Status ModelInterpreter::Interpret(std::vector<std::string> &params) {
     return status;
 }
 
+Status ModelInterpreter::Interpret(std::vector<std::string> &params, const ModelConfig &config) {
+    model_path_             = config.model_path;
+    enable_parallel_decode_ = config.enable_parallel_decode;
+    model_reader_           = config.model_reader;
+    if ((params.empty() || params[0].empty()) && !config.proto_path.empty()) {
+        std::ifstream proto_file(config.proto_path, std::ios::binary);
+        if (!proto_file.is_open()) {
+            LOGE("open proto file %s failed\n", config.proto_path.c_str());
+            return Status(TNNERR_OPEN_FILE, "open proto file failed");
+        }
+        std::ostringstream proto_content;
+        proto_content << proto_file.rdbuf();
+        // params keep the md5 of the proto content as if it is given in params
+        std::vector<std::string> proto_params = params;
+        proto_params.resize(std::max<size_t>(proto_params.size(), 1));
+        proto_params[0] = proto_content.str();
+        return Interpret(proto_params);
+    }
+    return Interpret(params);
+}
+
 // Interpret the extra config map
 Status ModelInterpreter::InterpretConfig(std::map<std::string, std::string>& config_map) {
     NetStructure *structure = GetNetStructure();
@@ -398,7 +433,12 @@ Status ModelInterpreter::InterpretLayer(const std::string &layer_str) {
 }
 
 Status ModelInterpreter::InterpretModel(std::string &model_content) {
-    NetResource *net_resource = GetNetResource();
+    if (model_content.empty() && !model_path_.empty()) {
+        return InterpretMappedModel(model_path_);
+    }
+    if (model_content.empty() && model_reader_) {
+        return InterpretModelReader(model_reader_);
+    }
 
     const auto model_length = model_content.length();
     if (model_length <= 0) {
@@ -410,17 +450,100 @@ Status ModelInterpreter::InterpretModel(std::string &model_content) {
 #endif
     }
 
-    std::istringstream content_stream;
-    content_stream.str(model_content);
+    // read the content in place, raw data is copied out of it in parallel if parallel decode is enabled
+    MemoryStreamBuf stream_buffer(&model_content[0], model_length);
+    std::istream content_stream(&stream_buffer);
+    return InterpretModelStream(content_stream, nullptr, model_content.data(), model_length);
+}
+
+// weights are read by the reader straight into their buffers, the md5 of the content is hashed while it is read
+Status ModelInterpreter::InterpretModelReader(ModelReader reader) {
+    ReaderStreamBuf stream_buffer(reader);
+    std::istream content_stream(&stream_buffer);
+    Status status = InterpretModelStream(content_stream, nullptr, nullptr, 0);
+    RETURN_ON_NEQ(status, TNN_OK);
+
+    model_reader_md5_ = stream_buffer.GetMd5();
+    if (stream_buffer.IsFailed()) {
+        return Status(TNNERR_LOAD_MODEL, "model reader failed");
+    }
+    return TNN_OK;
+}
+
+// weights of aligned models reference the mapping, weights of other models are copied out of it
+Status ModelInterpreter::InterpretMappedModel(const std::string &model_path) {
+    std::shared_ptr<MappedFile> file;
+    RETURN_ON_NEQ(MappedFile::Open(model_path, file), TNN_OK);
+    if (file->GetSize() == 0) {
+        return Status(TNNERR_LOAD_MODEL, "model file is empty");
+    }
+
+    MemoryStreamBuf stream_buffer(file->GetData(), file->GetSize());
+    std::istream content_stream(&stream_buffer);
+    Status status = InterpretModelStream(content_stream, std::shared_ptr<char>(file, file->GetData()),
+                                         file->GetData(), file->GetSize());
+    RETURN_ON_NEQ(status, TNN_OK);
+
+    // v3 models carry the md5 of their content, the weights of older models are copied out anyway
+    if (model_content_md5_.empty()) {
+        const size_t chunk_size = 1 << 30;
+        auto data               = reinterpret_cast<const unsigned char *>(file->GetData());
+        MD5 content_md5;
+        for (size_t offset = 0; offset < file->GetSize(); offset += chunk_size) {
+            content_md5.update(data + offset, (MD5::size_type)std::min(chunk_size, file->GetSize() - offset));
+        }
+        model_content_md5_ = content_md5.finalize().hexdigest();
+    }
+    return TNN_OK;
+}
+
+// raw data is memory bound, large buffers are split so the copies spread over the threads
+void ModelInterpreter::CopyRawData(DeferredDeserializer *deserializer) {
+    const int64_t chunk_size = 1 << 20;
+    std::vector<RawDataCopy> chunks;
+    for (const auto &copy : deserializer->GetRawDataCopies()) {
+        for (int64_t offset = 0; offset < copy.size; offset += chunk_size) {
+            chunks.push_back({copy.dst + offset, copy.src + offset, std::min(chunk_size, copy.size - offset)});
+        }
+    }
+    deserializer->GetRawDataCopies().clear();
+    if (chunks.empty()) {
+        return;
+    }
+
+    auto pool = ThreadPool::GetSharedPool();
+    pool->ParallelFor(
+        0, (long)chunks.size(), [&](long i, int thread_id) { memcpy(chunks[i].dst, chunks[i].src, chunks[i].size); },
+        pool->GetThreadNum() + 1);
+}
+
+Status ModelInterpreter::InterpretModelStream(std::istream &content_stream, std::shared_ptr<char> mapped_data,
+                                              const char *data, int64_t size) {
+    NetResource *net_resource = GetNetResource();
 
     uint32_t magic_version_number = 0;
     content_stream.read(reinterpret_cast<char *>(&magic_version_number), sizeof(g_version_magic_number));
     if (!IsValidVersionNumber(magic_version_number)) {
         content_stream.seekg(0, std::ios::beg);
     }
+    if (magic_version_number == g_version_magic_number_v3) {
+        char content_md5[g_content_md5_length];
+        content_stream.read(content_md5, g_content_md5_length);
+        model_content_md5_ = std::string(content_md5, g_content_md5_length);
+    }
+
+    std::shared_ptr<Deserializer> deserializer;
+    std::shared_ptr<DeferredDeserializer> deferred_deserializer = nullptr;
+    if (mapped_data && magic_version_number == g_version_magic_number_v3) {
+        deserializer = std::make_shared<MappedDeserializer>(content_stream, mapped_data);
+    } else if (enable_parallel_decode_ && data != nullptr) {
+        deferred_deserializer = std::make_shared<DeferredDeserializer>(content_stream, data, size);
+        deserializer          = deferred_deserializer;
+    } else {
+        deserializer = GetDeserializer(content_stream);
+    }
 
     res_header header;
-    auto deserializer = GetDeserializer(content_stream);
     header.deserialize(*deserializer);
     if (header.layer_cnt_ < 0 || header.layer_cnt_ >= 10000) {
         LOGE("tnnmodel is invalid, maybe you should upgrade TNN\n");
@@ -450,12 +573,13 @@ Status ModelInterpreter::InterpretModel(std::string &model_content) {
         }
     }
 
+    if (deferred_deserializer) {
+        CopyRawData(deferred_deserializer.get());
+    }
+
     //解析constant_map
-    const auto pos_cur = content_stream.tellg();
-    content_stream.seekg(0, std::ios::end);
-    auto pos_diff = content_stream.tellg() - pos_cur;
-    content_stream.seekg(pos_cur, std::ios::beg);
-    if (pos_diff < 4) {
+    // streams of model readers can not seek to the end, peek if there is more content instead
+    if (content_stream.peek() == std::char_traits<char>::eof()) {
         return TNN_OK;
     }
 
@@ -469,6 +593,9 @@ Status ModelInterpreter::InterpretModel(std::string &model_content) {
 
         const_map[key] = buffer;
     }
+    if (deferred_deserializer) {
+        CopyRawData(deferred_deserializer.get());
+    }
 
     net_resource->constant_map = const_map;
 
@@ -99,6 +99,9 @@ public:
     // model contents.
     virtual Status Interpret(std::vector<std::string>& params);
 
+    // @brief model interpreter load params, the model is read from config.model_path if params[1] is empty
+    virtual Status Interpret(std::vector<std::string>& params, const ModelConfig& config);
+
     // @brief interpret extra config, such as conv winograd for specific conv layer
     virtual Status InterpretConfig(std::map<std::string, std::string>& config_map);
 
@@ -117,6 +120,16 @@ private:
 protected:
     virtual Status InterpretProto(std::string& content);
     virtual Status InterpretModel(std::string& model_content);
+    // @brief interpret the model file mapped in memory
+    Status InterpretMappedModel(const std::string& model_path);
+    Status InterpretModelReader(ModelReader reader);
+    // @brief interpret the model read from stream, mapped_data is the memory the stream reads if it is mapped
+    // @brief data and size are the memory content_stream reads, raw data is copied from it in parallel if
+    // parallel decode is enabled. mapped_data keeps the mapping of a mapped model alive.
+    Status InterpretModelStream(std::istream& content_stream, std::shared_ptr<char> mapped_data, const char* data,
+                                int64_t size);
+    // @brief run the raw data copies deferred by the deserializer on the shared thread pool
+    void CopyRawData(DeferredDeserializer* deserializer);
     virtual Status InterpretInput(const std::string& inputs_content);
     virtual Status InterpretOutput(const std::string& outputs_content);
     virtual Status InterpretLayer(const std::string& layer_str);
@@ -129,6 +142,13 @@ protected:
 
 protected:
     uint32_t version_magic_number = 0;
+    std::string model_path_;
+    bool enable_parallel_decode_ = false;
+    ModelReader model_reader_    = nullptr;
+    // md5 of the content read by model_reader_ in place of the md5 of params
+    std::string model_reader_md5_;
+    // md5 of the content of a v3 or mapped model in place of the md5 of params
+    std::string model_content_md5_;
 };
 
 }  // namespace TNN_NS
@@ -14,9 +14,12 @@
 
 #include "tnn/interpreter/tnn/model_packer.h"
 
+#include <sstream>
+
 #include "tnn/interpreter/tnn/layer_interpreter/abstract_layer_interpreter.h"
 #include "tnn/interpreter/tnn/model_interpreter.h"
 #include "tnn/interpreter/tnn/objseri.h"
+#include "tnn/utils/md5.h"
 
 namespace TNN_NS {
 
@@ -51,6 +54,10 @@ void ModelPacker::SetVersion(int version) {
     model_version_ = version;
 }
 
+void ModelPacker::SetAlignedWeights(bool aligned_weights) {
+    aligned_weights_ = aligned_weights;
+}
+
 std::shared_ptr<LayerInfo> ModelPacker::FindLayerInfo(std::string layer_name) {
     std::shared_ptr<LayerInfo> layer_info;
 
@@ -198,16 +205,27 @@ Status ModelPacker::PackModel(std::string file_path) {
         LOGE("invalid model file name! (%s)\n", file_path.c_str());
         return Status(TNNERR_PACK_MODEL, "model file cannot be written");
     }
-    auto magic_number = GetMagicNumber();
+    // v3 models are packed in memory first, the md5 of their content goes in front of it
+    std::ostringstream aligned_stream;
+    std::ostream &model_stream = aligned_weights_ ? static_cast<std::ostream &>(aligned_stream) : write_stream;
+    auto magic_number          = aligned_weights_ ? g_version_magic_number_v3 : GetMagicNumber();
     if (magic_number > 0) {
-        write_stream.write(reinterpret_cast<char *>(&magic_number), sizeof(uint32_t));
+        model_stream.write(reinterpret_cast<char *>(&magic_number), sizeof(uint32_t));
+    }
+    if (aligned_weights_) {
+        model_stream.write(std::string(g_content_md5_length, '0').data(), g_content_md5_length);
     }
 
     res_header header;
     header.layer_cnt_ = 0;
 
     int resource_count = 0;
-    auto serializer    = GetSerializer(write_stream);
+    std::shared_ptr<Serializer> serializer;
+    if (aligned_weights_) {
+        serializer = std::make_shared<AlignedSerializer>(model_stream);
+    } else {
+        serializer = GetSerializer(model_stream);
+    }
     auto ret           = PackLayers(serializer, false, resource_count);
     if (ret != TNN_OK) {
         write_stream.close();
@@ -238,7 +256,18 @@ Status ModelPacker::PackModel(std::string file_path) {
             serializer->PutRaw(*(iter.second.get()));
         }
     }
-    
+
+    if (aligned_weights_) {
+        const size_t content_offset = sizeof(uint32_t) + g_content_md5_length;
+        std::string model           = aligned_stream.str();
+        model.replace(sizeof(uint32_t), g_content_md5_length, md5(model.substr(content_offset)));
+        write_stream.write(model.data(), model.size());
+        if (!write_stream.good()) {
+            write_stream.close();
+            return Status(TNNERR_PACK_MODEL, "write model file failed");
+        }
+    }
+
     write_stream.close();
     if (ret != TNN_OK) {
         return ret;
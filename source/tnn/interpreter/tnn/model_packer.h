@@ -32,6 +32,10 @@ public:
     // @brief set the model version to pack
     void SetVersion(int version);
 
+    // @brief pack the model file in v3 with raw data at aligned offsets, so it can be used in place when it is
+    // memory mapped by ModelConfig::model_path. older TNN can not read it.
+    void SetAlignedWeights(bool aligned_weights);
+
 private:
     std::shared_ptr<LayerInfo> FindLayerInfo(std::string layer_name);
     Status PackProto(std::string file_path);
@@ -41,7 +45,8 @@ private:
                         std::shared_ptr<Serializer> &serializer);
 
 protected:
-    int model_version_ = 1;
+    int model_version_    = 1;
+    bool aligned_weights_ = false;
 
     virtual std::string Transfer(std::string content);
     virtual uint32_t GetMagicNumber();
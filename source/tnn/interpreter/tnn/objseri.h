@@ -15,10 +15,14 @@
 #ifndef TNN_SOURCE_TNN_INTERPRETER_TNN_OBJSERI_H_
 #define TNN_SOURCE_TNN_INTERPRETER_TNN_OBJSERI_H_
 
+#include <string.h>
+
 #include <string>
 #include <fstream>
+#include <memory>
 #include <string>
 #include <typeinfo>
+#include <vector>
 #include "tnn/core/common.h"
 #include "tnn/interpreter/raw_buffer.h"
 
@@ -28,6 +32,11 @@
 namespace TNN_NS {
     static const uint32_t g_version_magic_number = 0x0FABC0002;
     static const uint32_t g_version_magic_number_v2 = 0x0FABC0004;
+    // v3 model file: raw data starts at aligned offsets of the file, so a mapped model can be used in place
+    static const uint32_t g_version_magic_number_v3 = 0x0FABC0006;
+    static const int g_raw_data_alignment           = 64;
+    // v3 model files keep the md5 hex string of the content after it right behind the magic number
+    static const int g_content_md5_length = 32;
 
     class Serializer {
     public:
@@ -109,6 +118,33 @@ namespace TNN_NS {
             return;
     }
 
+    // @brief AlignedSerializer writes raw data at g_raw_data_alignment aligned offsets of the stream, the stream
+    // must start at the start of the model file
+    class AlignedSerializer : public Serializer {
+    public:
+        explicit AlignedSerializer(std::ostream &os) : Serializer(os) {}
+
+        virtual void PutRaw(TNN_NS::RawBuffer &value) {
+            int length = value.GetBytesSize();
+            DimsVector dims = value.GetBufferDims();
+            PutInt(g_version_magic_number_v3);
+            PutInt(value.GetDataType());
+            PutInt(length);
+            if (length <= 0) {
+                return;
+            }
+            PutInt((int)(dims.size()));
+            if (dims.size() > 0) {
+                _ostream.write(reinterpret_cast<char *>(dims.data()),
+                               static_cast<std::streamsize>(dims.size() * sizeof(int32_t)));
+            }
+            const char padding[g_raw_data_alignment] = {0};
+            auto position = static_cast<int64_t>(_ostream.tellp());
+            _ostream.write(padding, (g_raw_data_alignment - position % g_raw_data_alignment) % g_raw_data_alignment);
+            _ostream.write(value.force_to<char *>(), static_cast<std::streamsize>(length));
+        }
+    };
+
     class Deserializer {
     public:
         explicit Deserializer(std::istream &is) : _istream(is) {}
@@ -139,19 +175,11 @@ namespace TNN_NS {
         }
 
         virtual void GetRaw(TNN_NS::RawBuffer &value) {
-            auto magic_number  = static_cast<uint32_t>(GetInt());
-            auto data_type = (TNN_NS::DataType)GetInt();
-            int length = GetInt();
-            if (length <= 0) {
-                return;
-            }
-
+            DataType data_type;
+            int length;
             DimsVector dims;
-            if(magic_number == g_version_magic_number_v2) {
-                int size = GetInt();
-                for (int i = 0; i < size; ++i) {
-                    dims.push_back(GetInt());
-                }
+            if (!GetRawHeader(data_type, length, dims)) {
+                return;
             }
  
             value = TNN_NS::RawBuffer(length);
@@ -167,6 +195,29 @@ namespace TNN_NS {
         }
 
     protected:
+        // @brief read the header of raw data up to its first byte, false if the raw data is empty
+        bool GetRawHeader(DataType &data_type, int &length, DimsVector &dims) {
+            auto magic_number = static_cast<uint32_t>(GetInt());
+            data_type         = (TNN_NS::DataType)GetInt();
+            length            = GetInt();
+            if (length <= 0) {
+                return false;
+            }
+
+            if (magic_number == g_version_magic_number_v2 || magic_number == g_version_magic_number_v3) {
+                int size = GetInt();
+                for (int i = 0; i < size; ++i) {
+                    dims.push_back(GetInt());
+                }
+            }
+            if (magic_number == g_version_magic_number_v3) {
+                auto position = static_cast<int64_t>(_istream.tellg());
+                _istream.seekg((g_raw_data_alignment - position % g_raw_data_alignment) % g_raw_data_alignment,
+                               std::ios::cur);
+            }
+            return true;
+        }
+
         std::istream &_istream;
         
         template <typename T>
@@ -204,6 +255,84 @@ namespace TNN_NS {
         return value;
     }
 
+    // @brief MappedDeserializer reads a model file mapped in memory, raw data at aligned offsets references the
+    // mapping without copy. the stream must read the mapping from its start.
+    class MappedDeserializer : public Deserializer {
+    public:
+        MappedDeserializer(std::istream &is, std::shared_ptr<char> data) : Deserializer(is), _data(data) {}
+
+        virtual void GetRaw(TNN_NS::RawBuffer &value) {
+            DataType data_type;
+            int length;
+            DimsVector dims;
+            if (!GetRawHeader(data_type, length, dims)) {
+                return;
+            }
+
+            auto position = static_cast<int64_t>(_istream.tellg());
+            if (position < 0 || position % g_raw_data_alignment != 0) {
+                value = TNN_NS::RawBuffer(length);
+                _istream.read(value.force_to<char *>(), static_cast<std::streamsize>(length));
+            } else {
+                value = TNN_NS::RawBuffer(length, std::shared_ptr<char>(_data, _data.get() + position), dims);
+                _istream.seekg(length, std::ios::cur);
+            }
+            value.SetDataType(data_type);
+            value.SetBufferDims(dims);
+        }
+
+    protected:
+        std::shared_ptr<char> _data;
+    };
+
+    // @brief a raw data copy DeferredDeserializer leaves to its caller
+    struct RawDataCopy {
+        char *dst;
+        const char *src;
+        int64_t size;
+    };
+
+    // @brief DeferredDeserializer reads a model in memory, raw data is allocated while the model is read but not
+    // copied, the caller runs the copies left in GetRawDataCopies, so the copies of all layers can run in parallel.
+    // the stream must read the memory from its start.
+    class DeferredDeserializer : public Deserializer {
+    public:
+        DeferredDeserializer(std::istream &is, const char *data, int64_t size)
+            : Deserializer(is), _data(data), _size(size) {}
+
+        virtual void GetRaw(TNN_NS::RawBuffer &value) {
+            DataType data_type;
+            int length;
+            DimsVector dims;
+            if (!GetRawHeader(data_type, length, dims)) {
+                return;
+            }
+
+            // the copy fills the buffer, no need to clear it
+            value = TNN_NS::RawBuffer(length, std::shared_ptr<char>(new char[length], [](char *p) { delete[] p; }),
+                                      dims);
+            value.SetDataType(data_type);
+            auto position = static_cast<int64_t>(_istream.tellg());
+            if (position < 0 || position + length > _size) {
+                memset(value.force_to<char *>(), 0, length);
+                _istream.read(value.force_to<char *>(), static_cast<std::streamsize>(length));
+                return;
+            }
+            _copies.push_back({value.force_to<char *>(), _data + position, length});
+            _istream.seekg(length, std::ios::cur);
+        }
+
+        // @brief copies of the raw data read so far, the caller runs and clears them
+        std::vector<RawDataCopy> &GetRawDataCopies() {
+            return _copies;
+        }
+
+    protected:
+        const char *_data;
+        int64_t _size;
+        std::vector<RawDataCopy> _copies;
+    };
+
     class Serializable {
     public:
         Serializable() {}
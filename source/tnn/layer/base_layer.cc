@@ -38,6 +38,14 @@ BaseLayer::~BaseLayer() {
 
 Status BaseLayer::Init(Context* context, LayerParam* param, LayerResource* resource, std::vector<Blob*>& input_blobs,
                        std::vector<Blob*>& output_blobs, AbstractDevice* device, bool enable_const_folder) {
+    RETURN_ON_NEQ(InitOutputs(context, param, resource, input_blobs, output_blobs, device, enable_const_folder),
+                  TNN_OK);
+    return InitLayerAcc(context);
+}
+
+Status BaseLayer::InitOutputs(Context* context, LayerParam* param, LayerResource* resource,
+                              std::vector<Blob*>& input_blobs, std::vector<Blob*>& output_blobs, AbstractDevice* device,
+                              bool enable_const_folder) {
     input_blobs_  = input_blobs;
     output_blobs_ = output_blobs;
 
@@ -79,7 +87,6 @@ Status BaseLayer::Init(Context* context, LayerParam* param, LayerResource* resou
             layer_acc_->SetRuntimeMode(runtime_model_);
             layer_acc_->SetConstantResource(const_resource_);
             layer_acc_->SetConstantResourceFlag(const_resource_flag_);
-            return layer_acc_->Init(context, param, resource, input_blobs_, output_blobs_);
         } else {
             LOGE("layer acc of type(%d) is nil\n", type_);
             return Status(TNNERR_LAYER_ERR, "layer acc is nil");
@@ -88,6 +95,26 @@ Status BaseLayer::Init(Context* context, LayerParam* param, LayerResource* resou
     return TNN_OK;
 }
 
+Status BaseLayer::ResolveBlobDataFormats() {
+    if (layer_acc_ == nullptr) {
+        return TNN_OK;
+    }
+    for (auto blob : output_blobs_) {
+        RETURN_ON_NEQ(layer_acc_->ResolveBlobDataFormat(blob, BLOB_OUTPUT), TNN_OK);
+    }
+    for (auto blob : input_blobs_) {
+        RETURN_ON_NEQ(layer_acc_->ResolveBlobDataFormat(blob, BLOB_INPUT), TNN_OK);
+    }
+    return TNN_OK;
+}
+
+Status BaseLayer::InitLayerAcc(Context* context) {
+    if (layer_acc_ == nullptr) {
+        return TNN_OK;
+    }
+    return layer_acc_->Init(context, param_, resource_, input_blobs_, output_blobs_);
+}
+
 Status BaseLayer::FillLayerParamWithConstantResource() {
     return TNN_OK;
 }
@@ -293,6 +320,68 @@ void BaseLayer::SetRuntimeMode(RuntimeMode mode) {
     runtime_model_ = mode;
 }
 
+std::vector<int> BaseLayer::GetInplaceInputIndexes() {
+    std::vector<int> indexes;
+    if (!layer_acc_ || output_blobs_.size() != 1) {
+        return indexes;
+    }
+    for (int i = 0; i < (int)input_blobs_.size(); i++) {
+        if (layer_acc_->SupportInplace(input_blobs_, output_blobs_, i)) {
+            indexes.push_back(i);
+        }
+    }
+    return indexes;
+}
+
+std::vector<int64_t> BaseLayer::GetViewOffsets() {
+    std::vector<int64_t> offsets;
+    if (!layer_acc_ || input_blobs_.empty()) {
+        return offsets;
+    }
+    for (int i = 0; i < (int)output_blobs_.size(); i++) {
+        int64_t offset = layer_acc_->GetViewOffset(input_blobs_, output_blobs_, i);
+        if (offset < 0) {
+            return std::vector<int64_t>();
+        }
+        offsets.push_back(offset);
+    }
+    return offsets;
+}
+
+void BaseLayer::SetOutputsAsView(bool outputs_as_view) {
+    if (layer_acc_) {
+        layer_acc_->SetOutputsAsView(outputs_as_view);
+    }
+}
+
+std::vector<int64_t> BaseLayer::GetConcatOffsets() {
+    std::vector<int64_t> offsets;
+    if (!layer_acc_ || input_blobs_.empty() || output_blobs_.size() != 1) {
+        return offsets;
+    }
+    for (int i = 0; i < (int)input_blobs_.size(); i++) {
+        int64_t offset = layer_acc_->GetConcatOffset(input_blobs_, output_blobs_, i);
+        if (offset < 0) {
+            return std::vector<int64_t>();
+        }
+        offsets.push_back(offset);
+    }
+    return offsets;
+}
+
+size_t BaseLayer::GetWorkspaceSize() {
+    if (!layer_acc_) {
+        return 0;
+    }
+    return layer_acc_->GetWorkspaceSize(input_blobs_, output_blobs_);
+}
+
+void BaseLayer::SetWorkspace(Blob *workspace) {
+    if (layer_acc_) {
+        layer_acc_->SetWorkspace(workspace);
+    }
+}
+
 std::map<LayerType, std::shared_ptr<LayerCreator>>& GetGlobalLayerCreatorMap() {
     // static shared_ptr of LayerCreatorMap.
     static std::once_flag once;
@@ -43,6 +43,18 @@ public:
     virtual Status Init(Context* context, LayerParam* param, LayerResource* resource, std::vector<Blob*>& inputs,
                 std::vector<Blob*>& outputs, AbstractDevice* device, bool enable_const_folder=true);
 
+    // @brief the first part of Init: infer output data types and shapes and create the layer acc
+    Status InitOutputs(Context* context, LayerParam* param, LayerResource* resource, std::vector<Blob*>& inputs,
+                       std::vector<Blob*>& outputs, AbstractDevice* device, bool enable_const_folder=true);
+
+    // @brief decide the auto data formats of the blobs as the layer acc does in its Init,
+    // so the layer acc only reads the blobs in InitLayerAcc
+    Status ResolveBlobDataFormats();
+
+    // @brief the second part of Init: init the layer acc, which prepares its weights. the layer accs of cpu
+    // devices can init in parallel after InitOutputs and ResolveBlobDataFormats of all layers.
+    Status InitLayerAcc(Context* context);
+
     //@brief Reshape recalculate the output tensor dims
     virtual Status Reshape();
 
@@ -83,6 +95,24 @@ public:
     // @brief set runtime mode
     void SetRuntimeMode(RuntimeMode mode);
 
+    // @brief indexes of the inputs whose memory the only output can share, empty if the layer can not run in place
+    std::vector<int> GetInplaceInputIndexes();
+
+    // @brief offsets in bytes of the outputs inside input 0, empty if not all outputs can be views of input 0
+    std::vector<int64_t> GetViewOffsets();
+
+    // @brief set whether the outputs are placed in the memory of input 0
+    void SetOutputsAsView(bool outputs_as_view);
+
+    // @brief offsets in bytes of the inputs inside the only output, empty if not all inputs are dense parts of it
+    std::vector<int64_t> GetConcatOffsets();
+
+    // @brief bytes of scratch memory the layer acc needs in forward with the current shapes
+    size_t GetWorkspaceSize();
+
+    // @brief set the blob holding the planned scratch memory of the layer acc
+    void SetWorkspace(Blob *workspace);
+
 protected:
     LayerType type_;
 
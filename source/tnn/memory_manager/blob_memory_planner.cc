@@ -0,0 +1,134 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include "tnn/memory_manager/blob_memory_planner.h"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+
+namespace TNN_NS {
+
+BlobMemoryPlanner::BlobMemoryPlanner(int alignment) {
+    alignment_ = std::max(alignment, 1);
+}
+
+int BlobMemoryPlanner::AddBlock(int64_t bytes, int first, int last) {
+    Block block;
+    block.bytes = (std::max(bytes, (int64_t)0) + alignment_ - 1) / alignment_ * alignment_;
+    block.first = std::min(first, last);
+    block.last  = std::max(first, last);
+    blocks_.push_back(block);
+    return (int)blocks_.size() - 1;
+}
+
+void BlobMemoryPlanner::ExtendBlock(int block_id, int last) {
+    if (block_id < 0 || block_id >= (int)blocks_.size()) {
+        return;
+    }
+    blocks_[block_id].last = std::max(blocks_[block_id].last, last);
+}
+
+Status BlobMemoryPlanner::Plan() {
+    peak_size_   = 0;
+    lower_bound_ = 0;
+
+    // live bytes change at the first and after the last layer of each block
+    std::map<int, int64_t> live_bytes_diff;
+    for (const auto &block : blocks_) {
+        live_bytes_diff[block.first] += block.bytes;
+        live_bytes_diff[block.last + 1] -= block.bytes;
+    }
+    int64_t live_bytes = 0;
+    for (const auto &iter : live_bytes_diff) {
+        live_bytes += iter.second;
+        lower_bound_ = std::max(lower_bound_, live_bytes);
+    }
+
+    // greedy by size, longer lifetime first for blocks of the same size
+    std::vector<int> order(blocks_.size());
+    for (int i = 0; i < (int)order.size(); i++) {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        if (blocks_[a].bytes != blocks_[b].bytes) {
+            return blocks_[a].bytes > blocks_[b].bytes;
+        }
+        int life_a = blocks_[a].last - blocks_[a].first;
+        int life_b = blocks_[b].last - blocks_[b].first;
+        if (life_a != life_b) {
+            return life_a > life_b;
+        }
+        return a < b;
+    });
+
+    std::vector<int> placed;
+    std::vector<const Block *> overlapped;
+    for (auto id : order) {
+        auto &block = blocks_[id];
+
+        overlapped.clear();
+        for (auto placed_id : placed) {
+            const auto &other = blocks_[placed_id];
+            if (other.first <= block.last && block.first <= other.last) {
+                overlapped.push_back(&other);
+            }
+        }
+        std::sort(overlapped.begin(), overlapped.end(),
+                  [](const Block *a, const Block *b) { return a->offset < b->offset; });
+
+        // best fit: the smallest gap between overlapped blocks that the block fits in
+        int64_t best_offset = -1;
+        int64_t best_gap    = std::numeric_limits<int64_t>::max();
+        int64_t prev_end    = 0;
+        for (auto other : overlapped) {
+            int64_t gap = other->offset - prev_end;
+            if (gap >= block.bytes && gap < best_gap) {
+                best_gap    = gap;
+                best_offset = prev_end;
+            }
+            prev_end = std::max(prev_end, other->offset + other->bytes);
+        }
+        block.offset = best_offset >= 0 ? best_offset : prev_end;
+        peak_size_   = std::max(peak_size_, block.offset + block.bytes);
+        placed.push_back(id);
+    }
+
+    return TNN_OK;
+}
+
+int64_t BlobMemoryPlanner::GetOffset(int block_id) const {
+    if (block_id < 0 || block_id >= (int)blocks_.size()) {
+        return -1;
+    }
+    return blocks_[block_id].offset;
+}
+
+int64_t BlobMemoryPlanner::GetPeakSize() const {
+    return peak_size_;
+}
+
+int64_t BlobMemoryPlanner::GetLowerBound() const {
+    return lower_bound_;
+}
+
+int64_t BlobMemoryPlanner::GetTotalSize() const {
+    int64_t total_size = 0;
+    for (const auto &block : blocks_) {
+        total_size += block.bytes;
+    }
+    return total_size;
+}
+
+}  // namespace TNN_NS
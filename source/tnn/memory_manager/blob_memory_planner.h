@@ -0,0 +1,72 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#ifndef TNN_SOURCE_TNN_MEMORY_MANAGER_BLOB_MEMORY_PLANNER_H_
+#define TNN_SOURCE_TNN_MEMORY_MANAGER_BLOB_MEMORY_PLANNER_H_
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "tnn/core/status.h"
+
+namespace TNN_NS {
+
+// @brief BlobMemoryPlanner places memory blocks with known lifetime at offsets of one arena.
+// blocks are placed from the largest to the smallest, each at the best fitting gap between the
+// placed blocks whose lifetime overlaps with it, or after all of them if no gap fits.
+class BlobMemoryPlanner {
+public:
+    // @param alignment bytes every offset is aligned to
+    explicit BlobMemoryPlanner(int alignment = 64);
+
+    // @brief add a block used from layer first to layer last, both inclusive
+    // @return block id to get the offset after Plan
+    int AddBlock(int64_t bytes, int first, int last);
+
+    // @brief keep an added block alive to layer last at least, for blobs taking over the block in place
+    void ExtendBlock(int block_id, int last);
+
+    // @brief place all added blocks
+    Status Plan();
+
+    // @brief offset of the block in the arena
+    int64_t GetOffset(int block_id) const;
+
+    // @brief arena bytes the plan needs
+    int64_t GetPeakSize() const;
+
+    // @brief max bytes of the blocks alive at the same time, no plan needs fewer bytes
+    int64_t GetLowerBound() const;
+
+    // @brief sum of the block bytes, the arena bytes without memory reuse
+    int64_t GetTotalSize() const;
+
+private:
+    struct Block {
+        int64_t bytes  = 0;
+        int first      = 0;
+        int last       = 0;
+        int64_t offset = -1;
+    };
+
+    int64_t alignment_;
+    std::vector<Block> blocks_;
+    int64_t peak_size_   = 0;
+    int64_t lower_bound_ = 0;
+};
+
+}  // namespace TNN_NS
+
+#endif  // TNN_SOURCE_TNN_MEMORY_MANAGER_BLOB_MEMORY_PLANNER_H_
@@ -25,6 +25,8 @@ namespace TNN_NS {
 struct BlobMemorySizeInfo {
     DataType data_type = DATA_TYPE_FLOAT;
     std::vector<int> dims = {};
+    // devices that can skip it fill the memory with zero only if set
+    bool zero_fill = true;
 };
 
 int64_t GetBlobMemoryBytesSize(BlobMemorySizeInfo& size_info);
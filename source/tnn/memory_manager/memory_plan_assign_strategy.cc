@@ -0,0 +1,37 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include "tnn/memory_manager/memory_plan_assign_strategy.h"
+
+namespace TNN_NS {
+
+MemoryPlanAssignStrategy::MemoryPlanAssignStrategy(void* data, const std::map<BlobMemory*, int64_t>& offsets)
+    : all_blob_memory_data_(data), offsets_(offsets) {}
+
+Status MemoryPlanAssignStrategy::AssignAllBlobMemory(std::set<BlobMemory*>& blob_memory_library) {
+    for (auto& iter : blob_memory_library) {
+        auto offset_iter = offsets_.find(iter);
+        if (offset_iter == offsets_.end()) {
+            return Status(TNNERR_COMMON_ERROR, "blob memory is not in the memory plan");
+        }
+        // offset goes to base, some cpu kernels ignore bytes_offset
+        BlobHandle handle;
+        handle.base         = static_cast<char*>(all_blob_memory_data_) + offset_iter->second;
+        handle.bytes_offset = 0;
+        iter->SetHandleFromExternal(handle);
+    }
+    return TNN_OK;
+}
+
+}  // namespace TNN_NS
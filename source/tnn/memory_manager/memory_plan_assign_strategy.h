@@ -0,0 +1,39 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#ifndef TNN_SOURCE_TNN_MEMORY_MANAGER_MEMORY_PLAN_ASSIGN_STRATEGY_H_
+#define TNN_SOURCE_TNN_MEMORY_MANAGER_MEMORY_PLAN_ASSIGN_STRATEGY_H_
+
+#include <stdint.h>
+
+#include <map>
+
+#include "tnn/memory_manager/memory_assign_strategy.h"
+
+namespace TNN_NS {
+
+// @brief assign blob memory at the offsets planned by BlobMemoryPlanner, only for devices with host memory
+class MemoryPlanAssignStrategy : public MemoryAssignStrategy {
+public:
+    MemoryPlanAssignStrategy(void* data, const std::map<BlobMemory*, int64_t>& offsets);
+    virtual Status AssignAllBlobMemory(std::set<BlobMemory*>& blob_memory_library);
+
+private:
+    void* all_blob_memory_data_;
+    const std::map<BlobMemory*, int64_t>& offsets_;
+};
+
+}  // namespace TNN_NS
+
+#endif  // TNN_SOURCE_TNN_MEMORY_MANAGER_MEMORY_PLAN_ASSIGN_STRATEGY_H_
@@ -0,0 +1,163 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include "tnn/optimizer/layer_memory_scheduler.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace TNN_NS {
+
+namespace optimizer {
+
+    LayerMemoryScheduler::LayerMemoryScheduler(const std::vector<ScheduleLayer> &layers,
+                                               const std::map<std::string, int64_t> &blob_bytes,
+                                               const std::set<std::string> &persistent_blobs)
+        : layers_(layers), blob_bytes_(blob_bytes), persistent_blobs_(persistent_blobs) {
+        for (int i = 0; i < (int)layers_.size(); i++) {
+            for (const auto &name : layers_[i].inputs) {
+                reader_count_[name]++;
+            }
+            for (const auto &name : layers_[i].outputs) {
+                writer_[name] = i;
+            }
+        }
+    }
+
+    int64_t LayerMemoryScheduler::GetBlobBytes(const std::string &name) {
+        auto iter = blob_bytes_.find(name);
+        return iter != blob_bytes_.end() ? iter->second : 0;
+    }
+
+    bool LayerMemoryScheduler::IsPersistent(const std::string &name) {
+        // blobs without reader are never freed
+        return persistent_blobs_.count(name) > 0 || reader_count_.count(name) == 0;
+    }
+
+    int64_t LayerMemoryScheduler::GetPeakBytes(const std::vector<int> &order) {
+        int64_t live_bytes = 0;
+        for (const auto &name : persistent_blobs_) {
+            if (writer_.count(name) == 0) {
+                live_bytes += GetBlobBytes(name);
+            }
+        }
+
+        int64_t peak_bytes = live_bytes;
+        auto reader_count  = reader_count_;
+        for (auto index : order) {
+            const auto &layer = layers_[index];
+            for (const auto &name : layer.outputs) {
+                live_bytes += GetBlobBytes(name);
+            }
+            peak_bytes = std::max(peak_bytes, live_bytes);
+            for (const auto &name : layer.inputs) {
+                if (--reader_count[name] == 0 && !IsPersistent(name) && writer_.count(name) > 0) {
+                    live_bytes -= GetBlobBytes(name);
+                }
+            }
+        }
+        return peak_bytes;
+    }
+
+    Status LayerMemoryScheduler::Schedule(std::vector<int> &order) {
+        const int layer_count = (int)layers_.size();
+        std::vector<int> original_order(layer_count);
+        for (int i = 0; i < layer_count; i++) {
+            original_order[i] = i;
+        }
+        order = original_order;
+
+        // blobs written by more than one layer need write after read ordering, keep the original order
+        std::set<std::string> written;
+        for (const auto &layer : layers_) {
+            for (const auto &name : layer.outputs) {
+                if (!written.insert(name).second) {
+                    return TNN_OK;
+                }
+            }
+        }
+
+        // layers a layer waits for, and layers waiting for it
+        std::vector<int> pending_count(layer_count, 0);
+        std::vector<std::vector<int>> successors(layer_count);
+        for (int i = 0; i < layer_count; i++) {
+            std::set<int> producers;
+            for (const auto &name : layers_[i].inputs) {
+                auto iter = writer_.find(name);
+                if (iter != writer_.end() && iter->second < i) {
+                    producers.insert(iter->second);
+                }
+            }
+            for (auto producer : producers) {
+                successors[producer].push_back(i);
+            }
+            pending_count[i] = (int)producers.size();
+        }
+
+        std::set<int> ready;
+        for (int i = 0; i < layer_count; i++) {
+            if (pending_count[i] == 0) {
+                ready.insert(i);
+            }
+        }
+
+        std::vector<int> scheduled;
+        auto reader_count = reader_count_;
+        while (!ready.empty()) {
+            // the ready layer with the least bytes allocated minus bytes freed, the earliest one on ties
+            int best_layer       = -1;
+            int64_t best_balance = std::numeric_limits<int64_t>::max();
+            for (auto index : ready) {
+                const auto &layer = layers_[index];
+                int64_t balance   = 0;
+                for (const auto &name : layer.outputs) {
+                    balance += GetBlobBytes(name);
+                }
+                std::map<std::string, int> reads;
+                for (const auto &name : layer.inputs) {
+                    reads[name]++;
+                }
+                for (const auto &iter : reads) {
+                    if (reader_count[iter.first] == iter.second && !IsPersistent(iter.first) &&
+                        writer_.count(iter.first) > 0) {
+                        balance -= GetBlobBytes(iter.first);
+                    }
+                }
+                if (balance < best_balance) {
+                    best_balance = balance;
+                    best_layer   = index;
+                }
+            }
+
+            ready.erase(best_layer);
+            scheduled.push_back(best_layer);
+            for (const auto &name : layers_[best_layer].inputs) {
+                reader_count[name]--;
+            }
+            for (auto successor : successors[best_layer]) {
+                if (--pending_count[successor] == 0) {
+                    ready.insert(successor);
+                }
+            }
+        }
+
+        if (GetPeakBytes(scheduled) < GetPeakBytes(original_order)) {
+            order = scheduled;
+        }
+        return TNN_OK;
+    }
+
+}  // namespace optimizer
+
+}  // namespace TNN_NS
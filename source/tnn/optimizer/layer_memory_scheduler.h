@@ -0,0 +1,72 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#ifndef TNN_SOURCE_TNN_OPTIMIZER_LAYER_MEMORY_SCHEDULER_H_
+#define TNN_SOURCE_TNN_OPTIMIZER_LAYER_MEMORY_SCHEDULER_H_
+
+#include <stdint.h>
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "tnn/core/status.h"
+
+namespace TNN_NS {
+
+namespace optimizer {
+
+    // @brief blobs a layer reads and writes, for layer scheduling
+    struct ScheduleLayer {
+        std::vector<std::string> inputs;
+        std::vector<std::string> outputs;
+    };
+
+    //@brief LayerMemoryScheduler orders layers within their data dependencies to lower the peak bytes of live blobs.
+    // a blob is alive from the layer writing it to the last layer reading it, blobs without reader and
+    // persistent blobs such as net inputs and outputs are alive to the end.
+    class LayerMemoryScheduler {
+    public:
+        // @param layers layers in the original order
+        // @param blob_bytes bytes of blobs with memory, other blobs take no memory
+        // @param persistent_blobs blobs alive through the whole forward
+        LayerMemoryScheduler(const std::vector<ScheduleLayer> &layers, const std::map<std::string, int64_t> &blob_bytes,
+                             const std::set<std::string> &persistent_blobs);
+
+        // @brief greedily pick the ready layer freeing the most bytes, keep the original order if it is not better
+        // @param order indices of layers in the scheduled order
+        Status Schedule(std::vector<int> &order);
+
+        // @brief peak bytes of live blobs when layers run in order
+        int64_t GetPeakBytes(const std::vector<int> &order);
+
+    private:
+        int64_t GetBlobBytes(const std::string &name);
+        bool IsPersistent(const std::string &name);
+
+        std::vector<ScheduleLayer> layers_;
+        std::map<std::string, int64_t> blob_bytes_;
+        std::set<std::string> persistent_blobs_;
+        // readers of every blob, a layer reading a blob twice is counted twice
+        std::map<std::string, int> reader_count_;
+        // index of the layer writing every blob
+        std::map<std::string, int> writer_;
+    };
+
+}  // namespace optimizer
+
+}  // namespace TNN_NS
+
+#endif  // TNN_SOURCE_TNN_OPTIMIZER_LAYER_MEMORY_SCHEDULER_H_
@@ -14,6 +14,7 @@
 
 #include "tnn/optimizer/net_optimizer_fuse_conv_post.h"
 
+#include <cmath>
 #include <map>
 #include <memory>
 #include <vector>
@@ -48,13 +49,30 @@ namespace optimizer {
             return true;
         }
         if (device == DEVICE_X86 && net_config.network_type != NETWORK_TYPE_OPENVINO) {
-            kLayerActivationMap[LAYER_RELU]  = ActivationType_ReLU;
-            kLayerActivationMap[LAYER_RELU6] = ActivationType_ReLU6;
+            kLayerActivationMap[LAYER_RELU]      = ActivationType_ReLU;
+            kLayerActivationMap[LAYER_RELU6]     = ActivationType_ReLU6;
+            kLayerActivationMap[LAYER_SIGMOID]   = ActivationType_SIGMOID_MUL;
+            kLayerActivationMap[LAYER_SWISH]     = ActivationType_SIGMOID_MUL;
+            kLayerActivationMap[LAYER_HARDSWISH] = ActivationType_HARDSWISH;
             return true;
         }
         return false;
     }
 
+    // hardswish of the conv output alone, with the alpha and beta of x * relu6(x + 3) / 6
+    static bool IsConvHardSwish(std::shared_ptr<LayerInfo> layer_info, const std::string &conv_output_name) {
+        auto param = dynamic_cast<HardSwishLayerParam *>(layer_info->param.get());
+        if (!param || std::fabs(param->alpha - 1.0f / 6.0f) > 1e-5f || std::fabs(param->beta - 0.5f) > 1e-5f) {
+            return false;
+        }
+        for (const auto &input : layer_info->inputs) {
+            if (input != conv_output_name) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     Status NetOptimizerFuseConvPost::Optimize(NetStructure *structure, NetResource *resource) {
         if (!structure) {
             LOGE("Error: empty NetStructure\n");
@@ -94,6 +112,8 @@ namespace optimizer {
                             conv_output_name_check = true;
                         }
                     }
+                } else if (layer_current_type == LAYER_HARDSWISH) {
+                    conv_output_name_check = IsConvHardSwish(layer_info_current, conv_output_name);
                 } else {
                     conv_output_name_check = true;
                 }
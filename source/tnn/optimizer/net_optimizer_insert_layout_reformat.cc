@@ -58,6 +58,13 @@ namespace optimizer {
         }
         adaptor_device_ = GetDevice(adaptor_device);
 
+        // x86 computes in nchw unless a blocked layout it has kernels for is asked for, it has no avx512 kernels
+        // for NC16HW16
+        if (device == DEVICE_X86) {
+            auto data_format = net_config.data_format;
+            return data_format == DATA_FORMAT_NC4HW4 || data_format == DATA_FORMAT_NC8HW8;
+        }
+
         return device == DEVICE_ARM || device == DEVICE_OPENCL || device == DEVICE_METAL;
     }
 
@@ -0,0 +1,155 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include "tnn/utils/cpu_allocator.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#elif defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace TNN_NS {
+
+static void *AlignedMalloc(size_t size, size_t alignment) {
+#if defined(_WIN32)
+    return _aligned_malloc(size, alignment);
+#else
+    void *ptr = nullptr;
+    if (posix_memalign(&ptr, alignment, size) != 0) {
+        ptr = nullptr;
+    }
+    return ptr;
+#endif
+}
+
+static void AlignedFree(void *ptr) {
+#if defined(_WIN32)
+    _aligned_free(ptr);
+#else
+    free(ptr);
+#endif
+}
+
+CpuAllocator &CpuAllocator::GetInstance() {
+    static CpuAllocator allocator;
+    return allocator;
+}
+
+void *CpuAllocator::Allocate(size_t size, bool zero_fill) {
+    CpuHugePageMode mode;
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        mode = huge_page_mode_;
+    }
+
+    // a zero size allocation still returns a unique pointer
+    size_t bytes = std::max(size, kAlignment);
+    void *ptr    = nullptr;
+    Allocation allocation;
+    allocation.size = size;
+#if defined(__linux__)
+    if (bytes >= kHugePageSize && mode == CPU_HUGE_PAGE_EXPLICIT) {
+#ifdef MAP_HUGETLB
+        size_t mapped_size = (bytes + kHugePageSize - 1) / kHugePageSize * kHugePageSize;
+        void *mapped = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+                            -1, 0);
+        if (mapped != MAP_FAILED) {
+            ptr                    = mapped;
+            allocation.huge_page   = true;
+            allocation.mapped      = true;
+            allocation.mapped_size = mapped_size;
+        }
+#endif
+    }
+    if (!ptr && bytes >= kHugePageSize && mode != CPU_HUGE_PAGE_NONE) {
+        ptr = AlignedMalloc(bytes, kHugePageSize);
+#ifdef MADV_HUGEPAGE
+        if (ptr && madvise(ptr, bytes, MADV_HUGEPAGE) == 0) {
+            allocation.huge_page = true;
+        }
+#endif
+    }
+#endif
+    if (!ptr) {
+        ptr = AlignedMalloc(bytes, kAlignment);
+    }
+    if (!ptr) {
+        LOGE("CpuAllocator failed to allocate %lld bytes\n", (long long)size);
+        return nullptr;
+    }
+    // mapped pages are zero already
+    if (zero_fill && !allocation.mapped) {
+        memset(ptr, 0, size);
+    }
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    allocations_[ptr] = allocation;
+    stats_.allocated_bytes += size;
+    stats_.peak_allocated_bytes = std::max(stats_.peak_allocated_bytes, stats_.allocated_bytes);
+    stats_.allocation_count++;
+    if (allocation.huge_page) {
+        stats_.huge_page_bytes += size;
+    }
+    if (!zero_fill) {
+        stats_.zero_fill_skipped_bytes += size;
+    }
+    return ptr;
+}
+
+void CpuAllocator::Free(void *ptr) {
+    if (!ptr) {
+        return;
+    }
+    Allocation allocation;
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto iter = allocations_.find(ptr);
+        if (iter == allocations_.end()) {
+            // not allocated here
+            free(ptr);
+            return;
+        }
+        allocation = iter->second;
+        allocations_.erase(iter);
+        stats_.allocated_bytes -= allocation.size;
+        if (allocation.huge_page) {
+            stats_.huge_page_bytes -= allocation.size;
+        }
+    }
+#if defined(__linux__)
+    if (allocation.mapped) {
+        munmap(ptr, allocation.mapped_size);
+        return;
+    }
+#endif
+    AlignedFree(ptr);
+}
+
+void CpuAllocator::SetHugePageMode(CpuHugePageMode mode) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    huge_page_mode_ = mode;
+}
+
+CpuMemoryStats CpuAllocator::GetStats() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return stats_;
+}
+
+}  // namespace TNN_NS
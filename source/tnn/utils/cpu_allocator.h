@@ -0,0 +1,74 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#ifndef TNN_SOURCE_TNN_UTILS_CPU_ALLOCATOR_H_
+#define TNN_SOURCE_TNN_UTILS_CPU_ALLOCATOR_H_
+
+#include <stddef.h>
+
+#include <map>
+#include <mutex>
+
+#include "tnn/core/macro.h"
+#include "tnn/utils/cpu_utils.h"
+
+namespace TNN_NS {
+
+typedef enum {
+    CPU_HUGE_PAGE_NONE        = 0,
+    // ask the kernel to back the memory with transparent huge pages
+    CPU_HUGE_PAGE_TRANSPARENT = 1,
+    // map reserved huge pages, transparent ones if none is left
+    CPU_HUGE_PAGE_EXPLICIT    = 2,
+} CpuHugePageMode;
+
+// @brief CpuAllocator allocates the memory of the x86 and naive devices. every allocation is
+// 64 bytes aligned, allocations of at least 2 MB may be backed with huge pages.
+class CpuAllocator {
+public:
+    static CpuAllocator &GetInstance();
+
+    // @brief allocate size bytes, filled with zero unless zero_fill is false
+    void *Allocate(size_t size, bool zero_fill = true);
+
+    // @brief free memory returned by Allocate
+    void Free(void *ptr);
+
+    void SetHugePageMode(CpuHugePageMode mode);
+
+    CpuMemoryStats GetStats();
+
+    static const size_t kAlignment    = 64;
+    static const size_t kHugePageSize = 2 * 1024 * 1024;
+
+private:
+    CpuAllocator() = default;
+
+    struct Allocation {
+        size_t size    = 0;
+        bool huge_page = false;
+        // mapped reserved huge pages of mapped_size bytes
+        bool mapped        = false;
+        size_t mapped_size = 0;
+    };
+
+    std::mutex mutex_;
+    std::map<void *, Allocation> allocations_;
+    CpuMemoryStats stats_;
+    CpuHugePageMode huge_page_mode_ = CPU_HUGE_PAGE_TRANSPARENT;
+};
+
+}  // namespace TNN_NS
+
+#endif  // TNN_SOURCE_TNN_UTILS_CPU_ALLOCATOR_H_
@@ -16,6 +16,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <vector>
+#include "tnn/utils/cpu_allocator.h"
 #include "tnn/utils/cpu_info.h"
 
 #ifdef _OPENMP
@@ -600,4 +601,16 @@ void CpuUtils::SetCpuDenormal(int denormal) {
 #endif
 }
 
+Status CpuUtils::SetCpuHugePage(int huge_page) {
+    if (huge_page < CPU_HUGE_PAGE_NONE || huge_page > CPU_HUGE_PAGE_EXPLICIT) {
+        return Status(TNNERR_PARAM_ERR, "huge page mode not supported");
+    }
+    CpuAllocator::GetInstance().SetHugePageMode((CpuHugePageMode)huge_page);
+    return TNN_OK;
+}
+
+CpuMemoryStats CpuUtils::GetCpuMemoryStats() {
+    return CpuAllocator::GetInstance().GetStats();
+}
+
 }  // namespace TNN_NS
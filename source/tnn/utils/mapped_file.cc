@@ -0,0 +1,150 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include "tnn/utils/mapped_file.h"
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#undef LoadLibrary
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace TNN_NS {
+
+#if defined(_WIN32)
+
+Status MappedFile::Open(const std::string &path, std::shared_ptr<MappedFile> &file) {
+    std::shared_ptr<MappedFile> mapped(new MappedFile());
+    HANDLE file_handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                                     FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file_handle == INVALID_HANDLE_VALUE) {
+        LOGE("open model file failed (%s)\n", path.c_str());
+        return Status(TNNERR_LOAD_MODEL, "model file cannot be opened");
+    }
+    mapped->file_handle_ = file_handle;
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file_handle, &file_size)) {
+        return Status(TNNERR_LOAD_MODEL, "model file size cannot be read");
+    }
+    mapped->size_ = (size_t)file_size.QuadPart;
+    if (mapped->size_ == 0) {
+        file = mapped;
+        return TNN_OK;
+    }
+
+    HANDLE mapping_handle = CreateFileMappingA(file_handle, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+    if (mapping_handle == NULL) {
+        return Status(TNNERR_LOAD_MODEL, "model file cannot be mapped");
+    }
+    mapped->mapping_handle_ = mapping_handle;
+    mapped->data_           = static_cast<char *>(MapViewOfFile(mapping_handle, FILE_MAP_COPY, 0, 0, 0));
+    if (mapped->data_ == nullptr) {
+        return Status(TNNERR_LOAD_MODEL, "model file cannot be mapped");
+    }
+    file = mapped;
+    return TNN_OK;
+}
+
+MappedFile::~MappedFile() {
+    if (data_) {
+        UnmapViewOfFile(data_);
+    }
+    if (mapping_handle_) {
+        CloseHandle(mapping_handle_);
+    }
+    if (file_handle_) {
+        CloseHandle(file_handle_);
+    }
+}
+
+#else
+
+Status MappedFile::Open(const std::string &path, std::shared_ptr<MappedFile> &file) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        LOGE("open model file failed (%s)\n", path.c_str());
+        return Status(TNNERR_LOAD_MODEL, "model file cannot be opened");
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0) {
+        close(fd);
+        return Status(TNNERR_LOAD_MODEL, "model file size cannot be read");
+    }
+
+    std::shared_ptr<MappedFile> mapped(new MappedFile());
+    mapped->size_ = (size_t)file_stat.st_size;
+    if (mapped->size_ > 0) {
+        // private writable mapping, accs converting weights in place get their own copy of the pages
+        void *data = mmap(nullptr, mapped->size_, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            close(fd);
+            LOGE("mmap model file failed (%s)\n", path.c_str());
+            return Status(TNNERR_LOAD_MODEL, "model file cannot be mapped");
+        }
+        mapped->data_ = static_cast<char *>(data);
+    }
+    // the mapping stays valid after the descriptor is closed
+    close(fd);
+    file = mapped;
+    return TNN_OK;
+}
+
+MappedFile::~MappedFile() {
+    if (data_) {
+        munmap(data_, size_);
+    }
+}
+
+#endif
+
+char *MappedFile::GetData() {
+    return data_;
+}
+
+size_t MappedFile::GetSize() {
+    return size_;
+}
+
+MemoryStreamBuf::MemoryStreamBuf(char *data, size_t size) {
+    setg(data, data, data + size);
+}
+
+std::streambuf::pos_type MemoryStreamBuf::seekoff(off_type off, std::ios_base::seekdir dir,
+                                                  std::ios_base::openmode which) {
+    char *target = gptr();
+    if (dir == std::ios_base::beg) {
+        target = eback() + off;
+    } else if (dir == std::ios_base::cur) {
+        target = gptr() + off;
+    } else if (dir == std::ios_base::end) {
+        target = egptr() + off;
+    }
+    if (!(which & std::ios_base::in) || target < eback() || target > egptr()) {
+        return pos_type(off_type(-1));
+    }
+    setg(eback(), target, egptr());
+    return pos_type(target - eback());
+}
+
+std::streambuf::pos_type MemoryStreamBuf::seekpos(pos_type pos, std::ios_base::openmode which) {
+    return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+}  // namespace TNN_NS
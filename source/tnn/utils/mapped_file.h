@@ -0,0 +1,68 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#ifndef TNN_SOURCE_TNN_UTILS_MAPPED_FILE_H_
+#define TNN_SOURCE_TNN_UTILS_MAPPED_FILE_H_
+
+#include <stdint.h>
+#include <memory>
+#include <streambuf>
+#include <string>
+
+#include "tnn/core/macro.h"
+#include "tnn/core/status.h"
+
+namespace TNN_NS {
+
+// @brief MappedFile maps a whole file into memory. pages are shared with the page cache of other processes mapping
+// the same file until the process writes them, written pages are copied and never reach the file.
+class MappedFile {
+public:
+    ~MappedFile();
+
+    // @brief map the file at path
+    static Status Open(const std::string &path, std::shared_ptr<MappedFile> &file);
+
+    // @brief start of the mapping, aligned to the page size
+    char *GetData();
+
+    // @brief bytes of the file
+    size_t GetSize();
+
+private:
+    MappedFile() = default;
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    char *data_  = nullptr;
+    size_t size_ = 0;
+#if defined(_WIN32)
+    void *file_handle_    = nullptr;
+    void *mapping_handle_ = nullptr;
+#endif
+};
+
+// @brief MemoryStreamBuf lets an istream read memory in place without copying it into a string
+class MemoryStreamBuf : public std::streambuf {
+public:
+    MemoryStreamBuf(char *data, size_t size);
+
+protected:
+    virtual pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which);
+    virtual pos_type seekpos(pos_type pos, std::ios_base::openmode which);
+};
+
+}  // namespace TNN_NS
+
+#endif  // TNN_SOURCE_TNN_UTILS_MAPPED_FILE_H_
@@ -358,6 +358,8 @@ void FloatActivate(Tacc &result, const int activation_type) {
         }
     } else if(activation_type == ActivationType_SIGMOID_MUL) {
         result = 1.0f / (1.0f + exp(-result)) * result;
+    } else if (activation_type == ActivationType_HARDSWISH) {
+        result = result * std::min(std::max(result + 3.0f, 0.0f), 6.0f) / 6.0f;
     }
 }
 
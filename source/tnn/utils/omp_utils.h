@@ -54,4 +54,13 @@
 #define OMP_SET_THREADS_(t)
 
 #endif  // _OPENMP
+
+#include "tnn/utils/thread_pool.h"
+
+// PARALLEL_FOR_ runs body(i, thread_id) for i in [begin, end) on the TNN thread pool bound to the current
+// thread, it falls back to OMP_PARALLEL_FOR_DYNAMIC_ if no pool is bound.
+// per-thread buffers indexed by thread_id must be sized with PARALLEL_MAX_THREADS_NUM_.
+#define PARALLEL_FOR_(begin, end, body) (TNN_NS::ParallelFor((begin), (end), (body)))
+#define PARALLEL_MAX_THREADS_NUM_ (TNN_NS::ParallelMaxThreads())
+
 #endif  // TNN_SOURCE_TNN_UTILS_OMP_UTILS_H_
@@ -0,0 +1,217 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include "tnn/utils/packed_resource_cache.h"
+
+#include <stdio.h>
+
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+#include "tnn/core/macro.h"
+#include "tnn/utils/md5.h"
+#include "tnn/version.h"
+
+namespace TNN_NS {
+
+struct PackedResourceEntry {
+    // held while the buffer is created, so other instances wait instead of packing it again
+    std::mutex mutex;
+    std::weak_ptr<RawBuffer> buffer;
+};
+
+Status PackedResourceCache::GetOrCreate(const std::string &key, std::function<Status(RawBuffer &)> creator,
+                                        std::shared_ptr<RawBuffer> &buffer) {
+    static std::mutex entries_mtx;
+    static std::map<std::string, std::shared_ptr<PackedResourceEntry>> entries;
+
+    std::shared_ptr<PackedResourceEntry> entry;
+    {
+        std::unique_lock<std::mutex> lck(entries_mtx);
+        auto iter = entries.find(key);
+        if (iter != entries.end()) {
+            entry = iter->second;
+        } else {
+            // drop entries of released models before adding a new one
+            for (auto it = entries.begin(); it != entries.end();) {
+                if (it->second.use_count() == 1 && it->second->buffer.expired()) {
+                    it = entries.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+            entry        = std::make_shared<PackedResourceEntry>();
+            entries[key] = entry;
+        }
+    }
+
+    std::unique_lock<std::mutex> lck(entry->mutex);
+    buffer = entry->buffer.lock();
+    if (buffer) {
+        return TNN_OK;
+    }
+
+    auto new_buffer = std::make_shared<RawBuffer>();
+    RETURN_ON_NEQ(creator(*new_buffer), TNN_OK);
+    entry->buffer = new_buffer;
+    buffer        = new_buffer;
+    return TNN_OK;
+}
+
+static const int g_packed_file_magic_number = 0x0FABC1001;
+// packed resources are read with aligned loads
+static const int g_packed_resource_alignment = 64;
+
+static void PutInt(std::ostream &os, int value) {
+    os.write(reinterpret_cast<const char *>(&value), sizeof(int));
+}
+
+static void PutString(std::ostream &os, const std::string &value) {
+    PutInt(os, (int)value.size());
+    os.write(value.data(), value.size());
+}
+
+static bool GetInt(std::istream &is, int &value) {
+    return (bool)is.read(reinterpret_cast<char *>(&value), sizeof(int));
+}
+
+static bool GetString(std::istream &is, std::string &value, size_t max_size) {
+    int size = 0;
+    if (!GetInt(is, size) || size < 0 || (size_t)size > max_size) {
+        return false;
+    }
+    value.resize(size);
+    return size == 0 || (bool)is.read(&value[0], size);
+}
+
+static std::string GetTnnVersion() {
+    return std::string(commit_hash_tnn) + "_" + std::string(commit_date_tnn);
+}
+
+/*
+ * file layout: magic, tnn version, tag, md5 of the content, content.
+ * content: resource count, then key, data type, dims and bytes of each resource.
+ */
+Status PackedResourceFile::Load(const std::string &path, const std::string &tag,
+                                std::map<std::string, std::shared_ptr<RawBuffer>> &resources) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return Status(TNNERR_OPEN_FILE, "packed resource cache file not found");
+    }
+
+    int magic_number = 0;
+    std::string version, file_tag, content_md5, content;
+    if (!GetInt(file, magic_number) || magic_number != g_packed_file_magic_number ||
+        !GetString(file, version, 256) || version != GetTnnVersion() || !GetString(file, file_tag, 256) ||
+        file_tag != tag || !GetString(file, content_md5, 256)) {
+        LOGD("packed resource cache %s is written by another tnn version or for another device\n", path.c_str());
+        return Status(TNNERR_INVALID_MODEL, "packed resource cache is stale");
+    }
+    std::stringstream content_stream;
+    content_stream << file.rdbuf();
+    content = content_stream.str();
+    if (md5(content) != content_md5) {
+        LOGD("packed resource cache %s is broken\n", path.c_str());
+        return Status(TNNERR_INVALID_MODEL, "packed resource cache is broken");
+    }
+
+    std::istringstream is(content);
+    int count = 0;
+    GetInt(is, count);
+    std::map<std::string, std::shared_ptr<RawBuffer>> loaded;
+    for (int i = 0; i < count; i++) {
+        std::string key;
+        int data_type = 0, dims_size = 0, bytes_size = 0;
+        if (!GetString(is, key, content.size()) || !GetInt(is, data_type) || !GetInt(is, dims_size) ||
+            dims_size < 0 || dims_size > 16) {
+            return Status(TNNERR_INVALID_MODEL, "packed resource cache is broken");
+        }
+        DimsVector dims(dims_size);
+        for (int d = 0; d < dims_size; d++) {
+            GetInt(is, dims[d]);
+        }
+        if (!GetInt(is, bytes_size) || bytes_size < 0 || (size_t)bytes_size > content.size()) {
+            return Status(TNNERR_INVALID_MODEL, "packed resource cache is broken");
+        }
+
+        auto buffer = std::make_shared<RawBuffer>(bytes_size, g_packed_resource_alignment);
+        if (bytes_size > 0 && !is.read(buffer->force_to<char *>(), bytes_size)) {
+            return Status(TNNERR_INVALID_MODEL, "packed resource cache is broken");
+        }
+        buffer->SetDataType((DataType)data_type);
+        buffer->SetBufferDims(dims);
+        loaded[key] = buffer;
+    }
+
+    resources = loaded;
+    return TNN_OK;
+}
+
+Status PackedResourceFile::Save(const std::string &path, const std::string &tag,
+                                const std::map<std::string, std::shared_ptr<RawBuffer>> &resources) {
+    std::ostringstream os;
+    PutInt(os, (int)resources.size());
+    for (const auto &iter : resources) {
+        auto &buffer = *iter.second;
+        auto dims    = buffer.GetBufferDims();
+        PutString(os, iter.first);
+        PutInt(os, (int)buffer.GetDataType());
+        PutInt(os, (int)dims.size());
+        for (auto dim : dims) {
+            PutInt(os, dim);
+        }
+        PutInt(os, buffer.GetBytesSize());
+        os.write(buffer.force_to<char *>(), buffer.GetBytesSize());
+    }
+    const std::string content = os.str();
+
+    // instances of other processes may load the file meanwhile, they must not see it half written
+    std::ostringstream temp_suffix;
+    temp_suffix << ".tmp" << std::this_thread::get_id() << "_"
+                << std::chrono::steady_clock::now().time_since_epoch().count();
+    const std::string temp_path = path + temp_suffix.str();
+    {
+        std::ofstream file(temp_path, std::ios::binary);
+        if (!file.is_open()) {
+            LOGE("open packed resource cache %s failed\n", temp_path.c_str());
+            return Status(TNNERR_OPEN_FILE, "open packed resource cache file failed");
+        }
+        PutInt(file, g_packed_file_magic_number);
+        PutString(file, GetTnnVersion());
+        PutString(file, tag);
+        PutString(file, md5(content));
+        file.write(content.data(), content.size());
+        if (!file.good()) {
+            file.close();
+            remove(temp_path.c_str());
+            return Status(TNNERR_OPEN_FILE, "write packed resource cache file failed");
+        }
+    }
+
+    if (rename(temp_path.c_str(), path.c_str()) != 0) {
+        // rename does not replace an existing file on windows
+        remove(path.c_str());
+        if (rename(temp_path.c_str(), path.c_str()) != 0) {
+            remove(temp_path.c_str());
+            return Status(TNNERR_OPEN_FILE, "rename packed resource cache file failed");
+        }
+    }
+    return TNN_OK;
+}
+
+}  // namespace TNN_NS
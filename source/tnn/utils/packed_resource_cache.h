@@ -0,0 +1,53 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#ifndef TNN_SOURCE_TNN_UTILS_PACKED_RESOURCE_CACHE_H_
+#define TNN_SOURCE_TNN_UTILS_PACKED_RESOURCE_CACHE_H_
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "tnn/core/status.h"
+#include "tnn/interpreter/raw_buffer.h"
+
+namespace TNN_NS {
+
+// @brief PackedResourceCache shares read-only packed resources, such as transformed conv weights,
+// between layer accs of the instances created from the same model in one process.
+class PackedResourceCache {
+public:
+    // @brief get the buffer cached with key, creator is called to create it if nobody holds it.
+    // the cached buffer is released once all the returned pointers are released.
+    static Status GetOrCreate(const std::string &key, std::function<Status(RawBuffer &)> creator,
+                              std::shared_ptr<RawBuffer> &buffer);
+};
+
+// @brief PackedResourceFile saves the packed resources of a network to a cache file, so the next start loads them
+// instead of packing again. the file is rejected if it is broken, or written by another tnn version or for another tag.
+class PackedResourceFile {
+public:
+    // @brief load the resources saved in path, tag tells the devices and isa the resources are packed for apart
+    static Status Load(const std::string &path, const std::string &tag,
+                       std::map<std::string, std::shared_ptr<RawBuffer>> &resources);
+
+    // @brief save the resources to path, the file is written to a temp file first and then renamed to path
+    static Status Save(const std::string &path, const std::string &tag,
+                       const std::map<std::string, std::shared_ptr<RawBuffer>> &resources);
+};
+
+}  // namespace TNN_NS
+
+#endif  // TNN_SOURCE_TNN_UTILS_PACKED_RESOURCE_CACHE_H_
@@ -0,0 +1,122 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include "tnn/utils/reader_stream_buf.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+namespace TNN_NS {
+
+ReaderStreamBuf::ReaderStreamBuf(ModelReader reader, size_t buffer_size)
+    : reader_(reader), buffer_(std::max<size_t>(buffer_size, 16)) {
+    setg(buffer_.data(), buffer_.data(), buffer_.data());
+}
+
+int64_t ReaderStreamBuf::Read(char *data, int64_t size) {
+    int64_t total = 0;
+    // readers may return fewer bytes than asked before the end
+    while (total < size && !finished_ && !failed_) {
+        int64_t bytes = reader_ ? reader_(data + total, size - total) : -1;
+        if (bytes < 0 || bytes > size - total) {
+            failed_ = true;
+        } else if (bytes == 0) {
+            finished_ = true;
+        } else {
+            md5_.update(data + total, (MD5::size_type)bytes);
+            total += bytes;
+        }
+    }
+    return total;
+}
+
+std::streambuf::int_type ReaderStreamBuf::underflow() {
+    if (gptr() < egptr()) {
+        return traits_type::to_int_type(*gptr());
+    }
+    buffer_position_ += egptr() - eback();
+    int64_t bytes = Read(buffer_.data(), (int64_t)buffer_.size());
+    setg(buffer_.data(), buffer_.data(), buffer_.data() + bytes);
+    return bytes > 0 ? traits_type::to_int_type(*gptr()) : traits_type::eof();
+}
+
+std::streamsize ReaderStreamBuf::xsgetn(char *data, std::streamsize size) {
+    std::streamsize total = std::min<std::streamsize>(size, egptr() - gptr());
+    memcpy(data, gptr(), total);
+    gbump((int)total);
+    if (total == size) {
+        return total;
+    }
+
+    if (size - total >= (std::streamsize)buffer_.size()) {
+        // large raw data is read into its buffer without passing the stream buffer
+        buffer_position_ += egptr() - eback();
+        int64_t bytes = Read(data + total, size - total);
+        buffer_position_ += bytes;
+        setg(buffer_.data(), buffer_.data(), buffer_.data());
+        return total + bytes;
+    }
+
+    while (total < size && underflow() != traits_type::eof()) {
+        std::streamsize bytes = std::min<std::streamsize>(size - total, egptr() - gptr());
+        memcpy(data + total, gptr(), bytes);
+        gbump((int)bytes);
+        total += bytes;
+    }
+    return total;
+}
+
+std::streambuf::pos_type ReaderStreamBuf::seekoff(off_type off, std::ios_base::seekdir dir,
+                                                  std::ios_base::openmode which) {
+    int64_t current = buffer_position_ + (gptr() - eback());
+    if (dir == std::ios_base::beg) {
+        return seekpos(pos_type(off), which);
+    } else if (dir == std::ios_base::cur) {
+        return seekpos(pos_type(current + off), which);
+    }
+    // the size of the content is unknown until it is read
+    return pos_type(off_type(-1));
+}
+
+std::streambuf::pos_type ReaderStreamBuf::seekpos(pos_type pos, std::ios_base::openmode which) {
+    const int64_t target = (int64_t)pos;
+    if (!(which & std::ios_base::in) || target < buffer_position_) {
+        return pos_type(off_type(-1));
+    }
+    // skip forward by reading, so the md5 covers the skipped bytes
+    while (target > buffer_position_ + (egptr() - eback())) {
+        setg(eback(), egptr(), egptr());
+        if (underflow() == traits_type::eof()) {
+            return pos_type(off_type(-1));
+        }
+    }
+    setg(eback(), eback() + (target - buffer_position_), egptr());
+    return pos_type(target);
+}
+
+std::string ReaderStreamBuf::GetMd5() {
+    while (!finished_ && !failed_) {
+        setg(eback(), egptr(), egptr());
+        underflow();
+    }
+    MD5 md5 = md5_;
+    return md5.finalize().hexdigest();
+}
+
+bool ReaderStreamBuf::IsFailed() {
+    return failed_;
+}
+
+}  // namespace TNN_NS
@@ -0,0 +1,61 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#ifndef TNN_SOURCE_TNN_UTILS_READER_STREAM_BUF_H_
+#define TNN_SOURCE_TNN_UTILS_READER_STREAM_BUF_H_
+
+#include <stdint.h>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+#include "tnn/core/common.h"
+#include "tnn/utils/md5.h"
+
+namespace TNN_NS {
+
+// @brief ReaderStreamBuf lets an istream read the content given by a ModelReader through a buffer of fixed size.
+// reads larger than the buffer go straight to the destination. it seeks forward, and backward within the buffer.
+class ReaderStreamBuf : public std::streambuf {
+public:
+    explicit ReaderStreamBuf(ModelReader reader, size_t buffer_size = 1 << 16);
+
+    // @brief read the rest of the content and get the md5 of the whole content
+    std::string GetMd5();
+
+    // @brief whether the reader returned an error
+    bool IsFailed();
+
+protected:
+    virtual int_type underflow();
+    virtual std::streamsize xsgetn(char *data, std::streamsize size);
+    virtual pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which);
+    virtual pos_type seekpos(pos_type pos, std::ios_base::openmode which);
+
+private:
+    // @brief read up to size bytes from the reader and hash them, returns the bytes read
+    int64_t Read(char *data, int64_t size);
+
+    ModelReader reader_;
+    std::vector<char> buffer_;
+    // stream position of the start of buffer_
+    int64_t buffer_position_ = 0;
+    bool failed_             = false;
+    bool finished_           = false;
+    MD5 md5_;
+};
+
+}  // namespace TNN_NS
+
+#endif  // TNN_SOURCE_TNN_UTILS_READER_STREAM_BUF_H_
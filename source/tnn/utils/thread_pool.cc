@@ -0,0 +1,245 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include "tnn/utils/thread_pool.h"
+
+#include <algorithm>
+#include <map>
+
+#include "tnn/utils/cpu_utils.h"
+#include "tnn/utils/omp_utils.h"
+
+namespace TNN_NS {
+
+// pause iterations an idle thread spins before it parks or yields, roughly 0.1ms ~ 0.5ms
+static const int kSpinCount = 4096;
+
+static inline void CpuRelax() {
+#if defined(_MSC_VER)
+    std::this_thread::yield();
+#elif defined(__i386__) || defined(__x86_64__)
+    __asm__ __volatile__("pause");
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+struct ParallelForJob {
+    const std::function<void(long, int)> *func;
+    long end;
+    std::atomic<long> next;
+    std::atomic<long> done;
+};
+
+// a worker only calls func after it claims an iteration, the caller waits for all claimed iterations,
+// so workers starting after the job is finished never touch func
+static void RunParallelForJob(ParallelForJob *job, int thread_id) {
+    while (true) {
+        long i = job->next.fetch_add(1);
+        if (i >= job->end) {
+            return;
+        }
+        (*job->func)(i, thread_id);
+        job->done.fetch_add(1, std::memory_order_release);
+    }
+}
+
+struct BoundThreadPool {
+    ThreadPool *pool = nullptr;
+    int num_threads  = 1;
+    int slot         = 0;
+};
+
+static BoundThreadPool &GetBoundThreadPool() {
+    static thread_local BoundThreadPool bound;
+    return bound;
+}
+
+ThreadPool::ThreadPool(int num_threads) : ThreadPool(num_threads, std::vector<int>()) {}
+
+ThreadPool::ThreadPool(int num_threads, const std::vector<int> &cpu_ids) : cpu_ids_(cpu_ids), pending_tasks_(0) {
+    num_threads = std::max(num_threads, 1);
+    for (int i = 0; i < num_threads; i++) {
+        workers_.emplace_back(&ThreadPool::WorkerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::unique_lock<std::mutex> lck(mutex_);
+        stop_ = true;
+    }
+    condition_.notify_all();
+    for (auto &worker : workers_) {
+        worker.join();
+    }
+}
+
+void ThreadPool::Enqueue(std::function<void()> task) {
+    bool notify = false;
+    {
+        std::unique_lock<std::mutex> lck(mutex_);
+        tasks_.push(std::move(task));
+        pending_tasks_++;
+        notify = parked_workers_ > 0;
+    }
+    if (notify) {
+        condition_.notify_one();
+    }
+}
+
+int ThreadPool::GetThreadNum() {
+    return (int)workers_.size();
+}
+
+void ThreadPool::ParallelFor(long begin, long end, const std::function<void(long, int)> &func, int max_threads) {
+    const long count = end - begin;
+    if (count <= 0) {
+        return;
+    }
+    int num_helpers = (int)std::min<long>(std::min(max_threads - 1, (int)workers_.size()), count - 1);
+    if (num_helpers <= 0) {
+        for (long i = begin; i < end; i++) {
+            func(i, 0);
+        }
+        return;
+    }
+
+    auto job  = std::make_shared<ParallelForJob>();
+    job->func = &func;
+    job->end  = end;
+    job->next = begin;
+    job->done = 0;
+
+    int notify_count = 0;
+    {
+        std::unique_lock<std::mutex> lck(mutex_);
+        for (int t = 1; t <= num_helpers; t++) {
+            tasks_.push([job, t]() { RunParallelForJob(job.get(), t); });
+        }
+        pending_tasks_ += num_helpers;
+        notify_count = std::min(num_helpers, parked_workers_);
+    }
+    for (int i = 0; i < notify_count; i++) {
+        condition_.notify_one();
+    }
+
+    RunParallelForJob(job.get(), 0);
+    for (int spin = 0; job->done.load(std::memory_order_acquire) < count; spin++) {
+        if (spin < kSpinCount) {
+            CpuRelax();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void ThreadPool::WorkerLoop(int worker_id) {
+    if (!cpu_ids_.empty()) {
+        std::vector<int> cpu = {cpu_ids_[worker_id % cpu_ids_.size()]};
+        if (CpuUtils::SetCpuAffinity(cpu) != TNN_OK) {
+            LOGE("ThreadPool: failed to pin worker %d to cpu %d\n", worker_id, cpu[0]);
+        }
+    }
+
+    while (true) {
+        // spin before parking, the next task usually comes within a few microseconds during forward
+        for (int spin = 0; spin < kSpinCount && pending_tasks_.load(std::memory_order_acquire) == 0; spin++) {
+            CpuRelax();
+        }
+
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lck(mutex_);
+            if (!stop_ && tasks_.empty()) {
+                parked_workers_++;
+                condition_.wait(lck, [this] { return stop_ || !tasks_.empty(); });
+                parked_workers_--;
+            }
+            if (stop_ && tasks_.empty()) {
+                return;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop();
+            pending_tasks_--;
+        }
+        task();
+    }
+}
+
+std::shared_ptr<ThreadPool> ThreadPool::GetSharedPool() {
+    static std::once_flag once;
+    static std::shared_ptr<ThreadPool> pool;
+    std::call_once(once, []() { pool.reset(new ThreadPool((int)std::thread::hardware_concurrency())); });
+    return pool;
+}
+
+std::shared_ptr<ThreadPool> ThreadPool::GetSharedPool(int num_threads, const std::vector<int> &cpu_ids) {
+    static std::mutex pools_mtx;
+    static std::map<std::pair<int, std::vector<int>>, std::weak_ptr<ThreadPool>> pools;
+
+    std::unique_lock<std::mutex> lck(pools_mtx);
+    // drop the pools no instance holds any more, so the registry only keeps the keys in use
+    for (auto iter = pools.begin(); iter != pools.end();) {
+        if (iter->second.expired()) {
+            iter = pools.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+    auto key  = std::make_pair(num_threads, cpu_ids);
+    auto pool = pools[key].lock();
+    if (!pool) {
+        pool = std::make_shared<ThreadPool>(num_threads, cpu_ids);
+        pools[key] = pool;
+    }
+    return pool;
+}
+
+void ThreadPool::BindCurrentThread(ThreadPool *pool, int num_threads, int slot) {
+    auto &bound       = GetBoundThreadPool();
+    bound.pool        = pool;
+    bound.num_threads = pool ? std::max(num_threads, 1) : 1;
+    bound.slot        = slot;
+}
+
+ThreadPool *ThreadPool::GetBoundPool() {
+    return GetBoundThreadPool().pool;
+}
+
+int ThreadPool::GetBoundSlot() {
+    return GetBoundThreadPool().slot;
+}
+
+void ParallelFor(long begin, long end, const std::function<void(long, int)> &func) {
+    auto &bound = GetBoundThreadPool();
+    if (bound.pool) {
+        bound.pool->ParallelFor(begin, end, func, bound.num_threads);
+        return;
+    }
+    OMP_PARALLEL_FOR_DYNAMIC_
+    for (long i = begin; i < end; i++) {
+        func(i, OMP_TID_);
+    }
+}
+
+int ParallelMaxThreads() {
+    auto &bound = GetBoundThreadPool();
+    if (bound.pool) {
+        return bound.num_threads;
+    }
+    return OMP_MAX_THREADS_NUM_;
+}
+
+}  // namespace TNN_NS
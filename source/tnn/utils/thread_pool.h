@@ -0,0 +1,98 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#ifndef TNN_SOURCE_TNN_UTILS_THREAD_POOL_H_
+#define TNN_SOURCE_TNN_UTILS_THREAD_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include "tnn/core/macro.h"
+
+namespace TNN_NS {
+
+// @brief ThreadPool runs tasks on a fixed set of worker threads in FIFO order.
+// idle workers spin for a short while before they park, so back-to-back kernels do not pay a wake up.
+class ThreadPool {
+public:
+    // @brief create pool with num_threads workers, at least one worker is created
+    explicit ThreadPool(int num_threads);
+
+    // @brief create pool with num_threads workers, worker i is pinned to cpu_ids[i % cpu_ids.size()],
+    // workers are not pinned if cpu_ids is empty
+    ThreadPool(int num_threads, const std::vector<int> &cpu_ids);
+
+    // @brief wait for the workers to finish all queued tasks and join them
+    ~ThreadPool();
+
+    // @brief push a task to the queue, it will run on one of the workers
+    void Enqueue(std::function<void()> task);
+
+    // @brief get worker count of the pool
+    int GetThreadNum();
+
+    // @brief run func(i, thread_id) for i in [begin, end). the caller runs as thread 0 and at most
+    // max_threads - 1 workers help it, so thread_id is always less than max_threads.
+    // returns when all iterations are done, it is safe to call from different threads at the same time.
+    void ParallelFor(long begin, long end, const std::function<void(long, int)> &func, int max_threads);
+
+    // @brief process-wide pool shared by all networks, one worker per hardware thread
+    static std::shared_ptr<ThreadPool> GetSharedPool();
+
+    // @brief process-wide pool shared by the instances using the same worker count and cpu ids,
+    // the pool is released when no instance holds it
+    static std::shared_ptr<ThreadPool> GetSharedPool(int num_threads, const std::vector<int> &cpu_ids);
+
+    // @brief make ParallelFor called in the current thread run on pool with up to num_threads threads,
+    // pass nullptr to unbind. tasks running at the same time bind different slots, less than their count
+    static void BindCurrentThread(ThreadPool *pool, int num_threads, int slot = 0);
+
+    // @brief get the pool bound to the current thread, nullptr if none
+    static ThreadPool *GetBoundPool();
+
+    // @brief get the slot bound to the current thread, scratch memory of a task is indexed by it
+    static int GetBoundSlot();
+
+private:
+    ThreadPool(const ThreadPool &);
+    ThreadPool &operator=(const ThreadPool &);
+
+    void WorkerLoop(int worker_id);
+
+    std::vector<std::thread> workers_;
+    std::vector<int> cpu_ids_;
+    std::queue<std::function<void()>> tasks_;
+    std::atomic<int> pending_tasks_;
+    int parked_workers_ = 0;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool stop_ = false;
+};
+
+// @brief run func(i, thread_id) for i in [begin, end) on the pool bound to the current thread,
+// OpenMP is used if no pool is bound, and the loop runs serially if TNN is built without OpenMP
+void ParallelFor(long begin, long end, const std::function<void(long, int)> &func);
+
+// @brief max threads ParallelFor may use in the current thread, used to size per-thread buffers
+int ParallelMaxThreads();
+
+}  // namespace TNN_NS
+
+#endif  // TNN_SOURCE_TNN_UTILS_THREAD_POOL_H_
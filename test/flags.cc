@@ -54,6 +54,12 @@ DEFINE_string(is, "", input_shape_message);
 
 DEFINE_bool(et, false, enable_tune_message);
 
+DEFINE_bool(pl, false, parallel_layers_message);
+
+DEFINE_int32(tp, 0, thread_pool_message);
+
+DEFINE_bool(pm, false, memory_plan_message);
+
 DEFINE_string(sc, "", scale_message);
 
 DEFINE_string(bi, "", bias_message);
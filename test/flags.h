@@ -61,6 +61,12 @@ static const char network_type_message[] = "network type: NAIVE, NPU, COREML, SN
 
 static const char enable_tune_message[] = "enable tune kernel(default false)";
 
+static const char parallel_layers_message[] = "run independent layers concurrently, x86 and naive only(default false)";
+
+static const char thread_pool_message[] = "cpu thread pool mode, x86 only(0: openmp, 1: shared pool, 2: owned pool, default 0)";
+
+static const char memory_plan_message[] = "plan blob memory by lifetime, x86, naive and arm only(default false)";
+
 static const char scale_message[] = "input scale: s0,s1,s2,...)";
 
 static const char bias_message[] = "input bias: b0,b1,b2,...)";
@@ -103,6 +109,12 @@ DECLARE_string(is);
 
 DECLARE_bool(et);
 
+DECLARE_bool(pl);
+
+DECLARE_int32(tp);
+
+DECLARE_bool(pm);
+
 DECLARE_string(sc);
 
 DECLARE_string(bi);
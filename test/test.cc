@@ -105,6 +105,7 @@ namespace test {
                     blob_converter->ConvertFromMatAsync(*input_mat_map[name], input_params_map[name], command_queue);
                 }
                 ret = instance->ForwardAsync(nullptr);
+                instance->WaitForwardAsync();
                 for(auto element : output_converters_map) {
                     auto name = element.first;
                     auto blob_converter = element.second;
@@ -136,6 +137,9 @@ namespace test {
                 ret = instance->Forward();
 #else
                 ret = instance->ForwardAsync(nullptr);
+                if (ret == TNN_OK) {
+                    ret = instance->WaitForwardAsync();
+                }
 #endif
                 if (!CheckResult("Forward", ret)) {
                     return ret;
@@ -207,6 +211,9 @@ namespace test {
         printf("    -fc \"<format for compare>\t%s \n", output_format_cmp_message);
         printf("    -nt \"<network type>\t%s \n", output_format_cmp_message);
         printf("    -et \"<enable tune>\t%s \n", enable_tune_message);
+        printf("    -pl \"<parallel layers>\t%s \n", parallel_layers_message);
+        printf("    -tp \"<thread pool mode>\t%s \n", thread_pool_message);
+        printf("    -pm \"<memory plan>\t%s \n", memory_plan_message);
         printf("    -sc \"<input scale>\t%s \n", scale_message);
         printf("    -bi \"<input bias>\t%s \n", bias_message);
     }
@@ -310,6 +317,9 @@ namespace test {
         config.precision = ConvertPrecision(FLAGS_pr);
 
         config.enable_tune_kernel = FLAGS_et;
+        config.enable_parallel_layers = FLAGS_pl;
+        config.cpu_thread_pool_mode = (CpuThreadPoolMode)FLAGS_tp;
+        config.enable_memory_plan = FLAGS_pm;
 #if defined(__ANDROID__)
         config.cache_path = "/data/local/tmp/";
 #else
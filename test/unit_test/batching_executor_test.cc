@@ -0,0 +1,161 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include <memory>
+#include <thread>
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+
+#include "test/flags.h"
+#include "test/test_utils.h"
+#include "test/unit_test/unit_test_common.h"
+#include "tnn/core/batching_executor.h"
+#include "tnn/core/tnn.h"
+#include "tnn/utils/dims_utils.h"
+
+namespace TNN_NS {
+
+static const DimsVector kSampleDims = {1, 8, 16, 16};
+
+// a 3x3 conv without pad, so inputs smaller than the kernel fail to reshape
+static Status InitConvTNN(TNN &tnn) {
+    const std::string proto_path = "batching_executor_test.tnnproto";
+    const std::string model_path = "batching_executor_test.tnnmodel";
+    RETURN_ON_NEQ(PackConvModel(proto_path, model_path, 8, 16, false, 0), TNN_OK);
+    ModelConfig model_config;
+    model_config.params = {ReadFile(proto_path), ReadFile(model_path)};
+    remove(proto_path.c_str());
+    remove(model_path.c_str());
+    return tnn.Init(model_config);
+}
+
+static NetworkConfig CreateNetworkConfig() {
+    NetworkConfig config;
+    config.device_type = ConvertDeviceType(FLAGS_dt);
+    config.precision   = PRECISION_HIGH;
+    return config;
+}
+
+static std::shared_ptr<Mat> CreateRandomInput(DimsVector dims) {
+    auto input = std::make_shared<Mat>(DEVICE_NAIVE, NCHW_FLOAT, dims);
+    InitRandom(static_cast<float *>(input->GetData()), DimsVectorUtils::Count(dims), 1.0f);
+    return input;
+}
+
+// output of each sample forwarded alone
+static Status ForwardSample(TNN &tnn, std::shared_ptr<Mat> input, std::shared_ptr<Mat> &output) {
+    Status status;
+    auto config   = CreateNetworkConfig();
+    auto instance = tnn.CreateInst(config, status, {{"input", input->GetDims()}});
+    RETURN_ON_NEQ(status, TNN_OK);
+    RETURN_ON_NEQ(instance->SetInputMat(input, MatConvertParam(), "input"), TNN_OK);
+    RETURN_ON_NEQ(instance->Forward(), TNN_OK);
+    return instance->GetOutputMat(output, MatConvertParam(), "conv", DEVICE_NAIVE);
+}
+
+// run the requests from one thread each and check the outputs against forwards of each sample
+static void ForwardConcurrently(TNN &tnn, BatchingExecutor &executor, int request_count) {
+    std::vector<MatMap> inputs(request_count), outputs(request_count);
+    std::vector<Status> status(request_count);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < request_count; i++) {
+        inputs[i]["input"] = CreateRandomInput(kSampleDims);
+        threads.push_back(std::thread([&, i]() { status[i] = executor.Forward(inputs[i], outputs[i]); }));
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (int i = 0; i < request_count; i++) {
+        ASSERT_EQ((int)status[i], (int)TNN_OK) << "request " << i;
+        std::shared_ptr<Mat> expected = nullptr;
+        ASSERT_EQ((int)ForwardSample(tnn, inputs[i]["input"], expected), (int)TNN_OK);
+        auto output = outputs[i]["conv"];
+        ASSERT_TRUE(output != nullptr);
+        ASSERT_TRUE(DimsVectorUtils::Equal(output->GetDims(), expected->GetDims()));
+        auto output_data   = static_cast<float *>(output->GetData());
+        auto expected_data = static_cast<float *>(expected->GetData());
+        for (int j = 0; j < DimsVectorUtils::Count(expected->GetDims()); j++) {
+            ASSERT_NEAR(output_data[j], expected_data[j], 1e-3f) << "request " << i << " index " << j;
+        }
+    }
+}
+
+static int GetInstanceBatch(BatchingExecutor &executor) {
+    BlobMap input_blobs;
+    executor.GetInstance()->GetAllInputBlobs(input_blobs);
+    return input_blobs["input"]->GetBlobDesc().dims[0];
+}
+
+TEST(BatchingExecutorTest, MergesConcurrentRequests) {
+    if (!GetDevice(ConvertDeviceType(FLAGS_dt))) {
+        GTEST_SKIP();
+    }
+    TNN tnn;
+    ASSERT_EQ((int)InitConvTNN(tnn), (int)TNN_OK);
+    BatchingExecutor executor;
+    BatchingConfig batching_config;
+    batching_config.max_batch_size = 4;
+    // the batch is run as soon as it is full, the delay only bounds a slow test machine
+    batching_config.max_queue_delay_us = 10000000;
+    auto config                        = CreateNetworkConfig();
+    ASSERT_EQ((int)executor.Init(tnn, config, {{"input", kSampleDims}}, {{"input", {4, 8, 16, 16}}},
+                                 batching_config),
+              (int)TNN_OK);
+    ForwardConcurrently(tnn, executor, 4);
+    EXPECT_EQ(GetInstanceBatch(executor), 4);
+}
+
+TEST(BatchingExecutorTest, RunsPartialBatchAfterDelay) {
+    if (!GetDevice(ConvertDeviceType(FLAGS_dt))) {
+        GTEST_SKIP();
+    }
+    TNN tnn;
+    ASSERT_EQ((int)InitConvTNN(tnn), (int)TNN_OK);
+    BatchingExecutor executor;
+    BatchingConfig batching_config;
+    batching_config.max_batch_size     = 4;
+    batching_config.max_queue_delay_us = 500000;
+    auto config                        = CreateNetworkConfig();
+    ASSERT_EQ((int)executor.Init(tnn, config, {{"input", kSampleDims}}, {{"input", {4, 8, 16, 16}}},
+                                 batching_config),
+              (int)TNN_OK);
+    ForwardConcurrently(tnn, executor, 3);
+    EXPECT_EQ(GetInstanceBatch(executor), 3);
+}
+
+// a request failing to reshape the instance fails alone, the next requests still run
+TEST(BatchingExecutorTest, FailedReshapeKeepsExecutorRunning) {
+    if (!GetDevice(ConvertDeviceType(FLAGS_dt))) {
+        GTEST_SKIP();
+    }
+    TNN tnn;
+    ASSERT_EQ((int)InitConvTNN(tnn), (int)TNN_OK);
+    BatchingExecutor executor;
+    BatchingConfig batching_config;
+    batching_config.max_batch_size     = 4;
+    batching_config.max_queue_delay_us = 0;
+    auto config                        = CreateNetworkConfig();
+    ASSERT_EQ((int)executor.Init(tnn, config, {{"input", kSampleDims}}, {{"input", {4, 8, 16, 16}}},
+                                 batching_config),
+              (int)TNN_OK);
+
+    MatMap inputs, outputs;
+    inputs["input"] = CreateRandomInput({1, 8, 1, 1});
+    EXPECT_NE((int)executor.Forward(inputs, outputs), (int)TNN_OK);
+    ForwardConcurrently(tnn, executor, 1);
+    EXPECT_EQ(GetInstanceBatch(executor), 1);
+}
+
+}  // namespace TNN_NS
@@ -0,0 +1,223 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+#include <memory>
+#include <algorithm>
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "test/flags.h"
+#include "test/test_utils.h"
+#include "test/unit_test/unit_test_common.h"
+#include "tnn/core/instance.h"
+#include "tnn/interpreter/layer_param.h"
+#include "tnn/utils/dims_utils.h"
+
+namespace TNN_NS {
+
+static std::shared_ptr<AbstractModelInterpreter> CreateBindInterpreter() {
+    return CreateNetInterpreter({{"input", {1, 8, 16, 16}}},
+                                {
+                                    CreateLayerInfo("ReLU", std::make_shared<LayerParam>(), {"input"}, {"relu"}),
+                                    CreateLayerInfo("Sigmoid", std::make_shared<LayerParam>(), {"input"}, {"sigmoid"}),
+                                },
+                                {"relu", "sigmoid"});
+}
+
+static std::shared_ptr<Instance> CreateBindInstance(DeviceType device_type, std::vector<std::string> bound_blobs,
+                                                    bool enable_memory_plan = false) {
+    NetworkConfig config;
+    config.device_type        = device_type;
+    config.enable_memory_plan = enable_memory_plan;
+    config.bound_blobs        = bound_blobs;
+
+    std::shared_ptr<Instance> instance = nullptr;
+    if (CreateNetInstance(CreateBindInterpreter(), config, instance) != TNN_OK) {
+        return nullptr;
+    }
+    return instance;
+}
+
+static void ExpectBoundOutputs(const std::vector<float> &input, const std::vector<float> &relu,
+                               const std::vector<float> &sigmoid) {
+    for (int i = 0; i < (int)input.size(); i++) {
+        ASSERT_NEAR(relu[i], std::max(input[i], 0.f), 1e-5f) << "index " << i;
+        ASSERT_NEAR(sigmoid[i], 1.f / (1.f + std::exp(-input[i])), 1e-4f) << "index " << i;
+    }
+}
+
+TEST(BindBlobTest, ForwardReadsAndWritesUserMemory) {
+    auto device_type = ConvertDeviceType(FLAGS_dt);
+    if (!GetDevice(device_type)) {
+        GTEST_SKIP();
+    }
+    const DimsVector dims = {1, 8, 16, 16};
+    const int count       = DimsVectorUtils::Count(dims);
+
+    for (bool enable_memory_plan : {false, true}) {
+        // sigmoid is not listed, it is copied to user memory after forward
+        auto instance = CreateBindInstance(device_type, {"input", "relu"}, enable_memory_plan);
+        ASSERT_TRUE(instance != nullptr);
+
+        std::vector<float> relu(count), sigmoid(count);
+        ASSERT_EQ((int)instance->BindOutput("relu", relu.data()), (int)TNN_OK);
+        ASSERT_EQ((int)instance->BindOutput("sigmoid", sigmoid.data()), (int)TNN_OK);
+        for (int iteration = 0; iteration < 2; iteration++) {
+            // a new input buffer each forward
+            std::vector<float> input(count);
+            InitRandom(input.data(), count, 1.0f);
+            ASSERT_EQ((int)instance->BindInput("input", input.data(), dims), (int)TNN_OK);
+            ASSERT_EQ((int)instance->Forward(), (int)TNN_OK);
+            ExpectBoundOutputs(input, relu, sigmoid);
+
+            BlobMap input_blobs, output_blobs;
+            instance->GetAllInputBlobs(input_blobs);
+            instance->GetAllOutputBlobs(output_blobs);
+            if (device_type == DEVICE_X86 || device_type == DEVICE_NAIVE) {
+                EXPECT_EQ(input_blobs["input"]->GetHandle().base, (void *)input.data());
+                EXPECT_EQ(output_blobs["relu"]->GetHandle().base, (void *)relu.data());
+            }
+            EXPECT_NE(output_blobs["sigmoid"]->GetHandle().base, (void *)sigmoid.data());
+        }
+
+        // unbound blobs are back in their own memory
+        std::vector<float> input(count);
+        InitRandom(input.data(), count, 1.0f);
+        ASSERT_EQ((int)instance->BindInput("input", input.data(), dims), (int)TNN_OK);
+        ASSERT_EQ((int)instance->BindInput("input", nullptr, dims), (int)TNN_OK);
+        ASSERT_EQ((int)instance->BindOutput("relu", nullptr), (int)TNN_OK);
+        BlobMap input_blobs;
+        instance->GetAllInputBlobs(input_blobs);
+        EXPECT_NE(input_blobs["input"]->GetHandle().base, (void *)input.data());
+    }
+}
+
+// an input bound out of place is copied by every forward, not only when it is bound
+TEST(BindBlobTest, ForwardCopiesBoundInputEachTime) {
+    auto device_type = ConvertDeviceType(FLAGS_dt);
+    if (!GetDevice(device_type)) {
+        GTEST_SKIP();
+    }
+    const DimsVector dims = {1, 8, 16, 16};
+    const int count       = DimsVectorUtils::Count(dims);
+    auto instance         = CreateBindInstance(device_type, {});
+    ASSERT_TRUE(instance != nullptr);
+
+    std::vector<float> input(count), relu(count), sigmoid(count);
+    ASSERT_EQ((int)instance->BindInput("input", input.data(), dims), (int)TNN_OK);
+    ASSERT_EQ((int)instance->BindOutput("relu", relu.data()), (int)TNN_OK);
+    ASSERT_EQ((int)instance->BindOutput("sigmoid", sigmoid.data()), (int)TNN_OK);
+    for (int iteration = 0; iteration < 2; iteration++) {
+        InitRandom(input.data(), count, 1.0f);
+        ASSERT_EQ((int)instance->Forward(), (int)TNN_OK);
+        ExpectBoundOutputs(input, relu, sigmoid);
+    }
+}
+
+// outputs bound out of place are copied when ForwardAsync completes, whichever call waits for it
+TEST(BindBlobTest, ForwardAsyncCopiesBoundOutputs) {
+    auto device_type = ConvertDeviceType(FLAGS_dt);
+    if (device_type != DEVICE_X86 && device_type != DEVICE_NAIVE) {
+        GTEST_SKIP();
+    }
+    if (!GetDevice(device_type)) {
+        GTEST_SKIP();
+    }
+    const DimsVector dims = {1, 8, 16, 16};
+    const int count       = DimsVectorUtils::Count(dims);
+    auto instance         = CreateBindInstance(device_type, {});
+    ASSERT_TRUE(instance != nullptr);
+
+    std::vector<float> input(count), relu(count), sigmoid(count);
+    ASSERT_EQ((int)instance->BindInput("input", input.data(), dims), (int)TNN_OK);
+    ASSERT_EQ((int)instance->BindOutput("relu", relu.data()), (int)TNN_OK);
+    ASSERT_EQ((int)instance->BindOutput("sigmoid", sigmoid.data()), (int)TNN_OK);
+
+    // the callback reads the outputs
+    InitRandom(input.data(), count, 1.0f);
+    std::vector<float> callback_relu, callback_sigmoid;
+    ASSERT_EQ((int)instance->ForwardAsync([&]() {
+        callback_relu    = relu;
+        callback_sigmoid = sigmoid;
+    }),
+              (int)TNN_OK);
+    ASSERT_EQ((int)instance->WaitForwardAsync(), (int)TNN_OK);
+    ExpectBoundOutputs(input, callback_relu, callback_sigmoid);
+
+    // GetOutputMat waits implicitly
+    InitRandom(input.data(), count, 1.0f);
+    ASSERT_EQ((int)instance->ForwardAsync(nullptr), (int)TNN_OK);
+    std::shared_ptr<Mat> output = nullptr;
+    ASSERT_EQ((int)instance->GetOutputMat(output, MatConvertParam(), "relu", DEVICE_NAIVE), (int)TNN_OK);
+    ExpectBoundOutputs(input, relu, sigmoid);
+
+    // a Forward right after waits for the async forward before it writes the inputs
+    InitRandom(input.data(), count, 1.0f);
+    ASSERT_EQ((int)instance->ForwardAsync(nullptr), (int)TNN_OK);
+    ASSERT_EQ((int)instance->Forward(), (int)TNN_OK);
+    ExpectBoundOutputs(input, relu, sigmoid);
+}
+
+// memory bound before a reshape holds the old dims, so blobs changing dims are unbound
+TEST(BindBlobTest, ReshapeUnbindsChangedBlobs) {
+    auto device_type = ConvertDeviceType(FLAGS_dt);
+    if (device_type != DEVICE_X86 && device_type != DEVICE_NAIVE) {
+        GTEST_SKIP();
+    }
+    if (!GetDevice(device_type)) {
+        GTEST_SKIP();
+    }
+    const DimsVector dims = {1, 8, 16, 16};
+    const int count       = DimsVectorUtils::Count(dims);
+    auto instance         = CreateBindInstance(device_type, {"input", "relu"});
+    ASSERT_TRUE(instance != nullptr);
+
+    std::vector<float> input(count), relu(count, -1.f), sigmoid(count, -1.f);
+    InitRandom(input.data(), count, 1.0f);
+    ASSERT_EQ((int)instance->BindInput("input", input.data(), dims), (int)TNN_OK);
+    ASSERT_EQ((int)instance->BindOutput("relu", relu.data()), (int)TNN_OK);
+    ASSERT_EQ((int)instance->BindOutput("sigmoid", sigmoid.data()), (int)TNN_OK);
+
+    // the same dims keep the bindings
+    ASSERT_EQ((int)instance->Reshape({{"input", dims}}), (int)TNN_OK);
+    ASSERT_EQ((int)instance->Forward(), (int)TNN_OK);
+    ExpectBoundOutputs(input, relu, sigmoid);
+
+    const DimsVector small_dims = {1, 8, 8, 8};
+    ASSERT_EQ((int)instance->Reshape({{"input", small_dims}}), (int)TNN_OK);
+    BlobMap input_blobs, output_blobs;
+    instance->GetAllInputBlobs(input_blobs);
+    instance->GetAllOutputBlobs(output_blobs);
+    EXPECT_NE(input_blobs["input"]->GetHandle().base, (void *)input.data());
+    EXPECT_NE(output_blobs["relu"]->GetHandle().base, (void *)relu.data());
+
+    // forwards of the new dims leave the old user memory alone
+    std::vector<float> relu_before = relu, sigmoid_before = sigmoid;
+    auto small_input = std::make_shared<Mat>(DEVICE_NAIVE, NCHW_FLOAT, small_dims);
+    InitRandom(static_cast<float *>(small_input->GetData()), DimsVectorUtils::Count(small_dims), 1.0f);
+    ASSERT_EQ((int)instance->SetInputMat(small_input, MatConvertParam(), "input"), (int)TNN_OK);
+    ASSERT_EQ((int)instance->Forward(), (int)TNN_OK);
+    EXPECT_EQ(relu, relu_before);
+    EXPECT_EQ(sigmoid, sigmoid_before);
+
+    std::shared_ptr<Mat> output = nullptr;
+    ASSERT_EQ((int)instance->GetOutputMat(output, MatConvertParam(), "relu", DEVICE_NAIVE), (int)TNN_OK);
+    auto input_data  = static_cast<float *>(small_input->GetData());
+    auto output_data = static_cast<float *>(output->GetData());
+    for (int i = 0; i < DimsVectorUtils::Count(small_dims); i++) {
+        ASSERT_NEAR(output_data[i], std::max(input_data[i], 0.f), 1e-5f) << "index " << i;
+    }
+}
+
+}  // namespace TNN_NS
@@ -0,0 +1,75 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "tnn/memory_manager/blob_memory_planner.h"
+
+namespace TNN_NS {
+
+static bool IsOverlapped(int64_t offset_a, int64_t bytes_a, int64_t offset_b, int64_t bytes_b) {
+    return offset_a < offset_b + bytes_b && offset_b < offset_a + bytes_a;
+}
+
+TEST(BlobMemoryPlannerTest, ReusesMemoryOfDeadBlocks) {
+    // chain a -> b -> c -> d, only neighbours are alive at the same time
+    BlobMemoryPlanner planner(64);
+    int a = planner.AddBlock(1000, 0, 1);
+    int b = planner.AddBlock(4000, 1, 2);
+    int c = planner.AddBlock(1000, 2, 3);
+    int d = planner.AddBlock(3000, 3, 4);
+    ASSERT_EQ((int)planner.Plan(), (int)TNN_OK);
+
+    for (int id : {a, b, c, d}) {
+        EXPECT_EQ(planner.GetOffset(id) % 64, 0);
+    }
+    EXPECT_FALSE(IsOverlapped(planner.GetOffset(a), 1024, planner.GetOffset(b), 4032));
+    EXPECT_FALSE(IsOverlapped(planner.GetOffset(b), 4032, planner.GetOffset(c), 1024));
+    EXPECT_FALSE(IsOverlapped(planner.GetOffset(c), 1024, planner.GetOffset(d), 3008));
+
+    EXPECT_EQ(planner.GetLowerBound(), 4032 + 1024);
+    EXPECT_EQ(planner.GetPeakSize(), planner.GetLowerBound());
+    EXPECT_EQ(planner.GetTotalSize(), 1024 + 4032 + 1024 + 3008);
+}
+
+TEST(BlobMemoryPlannerTest, NeverOverlapsLiveBlocks) {
+    BlobMemoryPlanner planner(64);
+    const int count = 64;
+    std::vector<int64_t> bytes(count);
+    std::vector<int> first(count), last(count), ids(count);
+    for (int i = 0; i < count; i++) {
+        bytes[i] = 100 + (i * 7919) % 5000;
+        first[i] = (i * 31) % 40;
+        last[i]  = first[i] + (i * 17) % 9;
+        ids[i]   = planner.AddBlock(bytes[i], first[i], last[i]);
+    }
+    ASSERT_EQ((int)planner.Plan(), (int)TNN_OK);
+
+    for (int i = 0; i < count; i++) {
+        int64_t aligned_i = (bytes[i] + 63) / 64 * 64;
+        EXPECT_LE(planner.GetOffset(ids[i]) + aligned_i, planner.GetPeakSize());
+        for (int j = i + 1; j < count; j++) {
+            if (first[i] <= last[j] && first[j] <= last[i]) {
+                int64_t aligned_j = (bytes[j] + 63) / 64 * 64;
+                EXPECT_FALSE(IsOverlapped(planner.GetOffset(ids[i]), aligned_i, planner.GetOffset(ids[j]), aligned_j));
+            }
+        }
+    }
+    EXPECT_GE(planner.GetPeakSize(), planner.GetLowerBound());
+    EXPECT_LT(planner.GetPeakSize(), planner.GetTotalSize());
+}
+
+}  // namespace TNN_NS
@@ -0,0 +1,184 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+#include <memory>
+#include <gtest/gtest.h>
+
+#include "test/flags.h"
+#include "test/test_utils.h"
+#include "test/unit_test/unit_test_common.h"
+#include "tnn/core/instance.h"
+#include "tnn/interpreter/layer_param.h"
+#include "tnn/utils/dims_utils.h"
+
+namespace TNN_NS {
+
+static std::shared_ptr<LayerInfo> CreateConvLayerInfo(std::string name, std::string input, int input_channel,
+                                                      int output_channel, int kernel, int stride, int group) {
+    auto param            = std::make_shared<ConvLayerParam>();
+    param->input_channel  = input_channel;
+    param->output_channel = output_channel;
+    param->group          = group;
+    param->kernels        = {kernel, kernel};
+    param->dialations     = {1, 1};
+    param->strides        = {stride, stride};
+    param->pads           = {kernel / 2, kernel / 2, kernel / 2, kernel / 2};
+    param->bias           = 1;
+    return CreateLayerInfo("Convolution", param, {input}, {name});
+}
+
+static std::shared_ptr<ConvLayerResource> CreateConvResource(int input_channel, int output_channel, int kernel,
+                                                             int group) {
+    auto resource           = std::make_shared<ConvLayerResource>();
+    const int filter_count  = output_channel * input_channel / group * kernel * kernel;
+    resource->filter_handle = RawBuffer(filter_count * sizeof(float));
+    resource->bias_handle   = RawBuffer(output_channel * sizeof(float));
+    InitRandom(resource->filter_handle.force_to<float *>(), filter_count, 0.5f);
+    InitRandom(resource->bias_handle.force_to<float *>(), output_channel, 0.5f);
+    return resource;
+}
+
+static std::shared_ptr<LayerInfo> CreatePoolLayerInfo(std::string name, std::string input) {
+    auto param            = std::make_shared<PoolingLayerParam>();
+    param->pool_type      = 0;
+    param->kernels        = {3, 3};
+    param->kernels_params = {3, 3};
+    param->strides        = {2, 2};
+    param->pads           = {1, 1, 1, 1};
+    param->kernel_indexs  = {-1, -1};
+    param->output_shape   = {0, 0};
+    return CreateLayerInfo("Pooling", param, {input}, {name});
+}
+
+/*
+ * covers the blocked kernels of the x86 layers: direct, winograd, depthwise and grouped convs, batch norm, relu,
+ * max pooling, concat of aligned and unaligned channels, sigmoid and add, with a softmax computed in nchw between.
+ * the channels end in partial blocks of 4, 8 and 16.
+ */
+static std::shared_ptr<AbstractModelInterpreter> CreateBlockedInterpreter() {
+    auto bn_param      = std::make_shared<BatchNormLayerParam>();
+    bn_param->channels = 20;
+
+    auto bn_resource          = std::make_shared<BatchNormLayerResource>();
+    bn_resource->scale_handle = RawBuffer(20 * sizeof(float));
+    bn_resource->bias_handle  = RawBuffer(20 * sizeof(float));
+    InitRandom(bn_resource->scale_handle.force_to<float *>(), 20, 1.0f);
+    InitRandom(bn_resource->bias_handle.force_to<float *>(), 20, 1.0f);
+
+    return CreateNetInterpreter(
+        {{"input", {1, 13, 17, 19}}},
+        {
+            CreateConvLayerInfo("conv0", "input", 13, 20, 5, 1, 1),
+            CreateLayerInfo("BatchNormCxx", bn_param, {"conv0"}, {"bn0"}),
+            CreateLayerInfo("ReLU", std::make_shared<LayerParam>(), {"bn0"}, {"relu0"}),
+            CreateConvLayerInfo("dw0", "relu0", 20, 20, 3, 2, 20),
+            CreateConvLayerInfo("conv1", "dw0", 20, 24, 3, 1, 1),
+            CreatePoolLayerInfo("pool0", "conv1"),
+            CreateConvLayerInfo("conv2", "pool0", 24, 12, 1, 1, 1),
+            CreateConvLayerInfo("conv3", "pool0", 24, 24, 3, 1, 2),
+            CreateLayerInfo("Concat", std::make_shared<ConcatLayerParam>(), {"conv2", "conv3"}, {"concat0"}),
+            CreateLayerInfo("Concat", std::make_shared<ConcatLayerParam>(), {"conv3", "conv2"}, {"concat1"}),
+            CreateLayerInfo("Sigmoid", std::make_shared<LayerParam>(), {"concat0"}, {"sigmoid0"}),
+            CreateLayerInfo("Add", std::make_shared<MultidirBroadcastLayerParam>(), {"sigmoid0", "concat1"}, {"add0"}),
+            CreateLayerInfo("Softmax", std::make_shared<SoftmaxLayerParam>(), {"add0"}, {"softmax0"}),
+            CreateConvLayerInfo("conv4", "softmax0", 36, 8, 1, 1, 1),
+        },
+        {"add0", "conv4"},
+        {
+            {"conv0", CreateConvResource(13, 20, 5, 1)},
+            {"bn0", bn_resource},
+            {"dw0", CreateConvResource(20, 20, 3, 20)},
+            {"conv1", CreateConvResource(20, 24, 3, 1)},
+            {"conv2", CreateConvResource(24, 12, 1, 1)},
+            {"conv3", CreateConvResource(24, 24, 3, 2)},
+            {"conv4", CreateConvResource(36, 8, 1, 1)},
+        });
+}
+
+static Status RunBlockedNet(std::shared_ptr<AbstractModelInterpreter> interpreter, DeviceType device_type,
+                            DataFormat data_format, std::shared_ptr<Mat> input,
+                            std::vector<std::shared_ptr<Mat>> &outputs) {
+    NetworkConfig config;
+    config.device_type = device_type;
+    config.data_format = data_format;
+
+    std::shared_ptr<Instance> instance = nullptr;
+    MatMap output_mats;
+    RETURN_ON_NEQ(CreateNetInstance(interpreter, config, instance, {{"input", input->GetDims()}}), TNN_OK);
+    RETURN_ON_NEQ(ForwardNet(instance, {{"input", input}}, {"add0", "conv4"}, output_mats), TNN_OK);
+    outputs = {output_mats["add0"], output_mats["conv4"]};
+    return TNN_OK;
+}
+
+TEST(BlockedLayoutTest, BlockedNetMatchesNaive) {
+    if (ConvertDeviceType(FLAGS_dt) != DEVICE_X86 || !GetDevice(DEVICE_X86)) {
+        GTEST_SKIP();
+    }
+    auto interpreter = CreateBlockedInterpreter();
+    ASSERT_TRUE(interpreter != nullptr);
+    DimsVector dims = {1, 13, 17, 19};
+    auto input      = std::make_shared<Mat>(DEVICE_NAIVE, NCHW_FLOAT, dims);
+    InitRandom(static_cast<float *>(input->GetData()), DimsVectorUtils::Count(dims), 1.0f);
+
+    std::vector<std::shared_ptr<Mat>> expected;
+    ASSERT_EQ((int)RunBlockedNet(interpreter, DEVICE_NAIVE, DATA_FORMAT_AUTO, input, expected), (int)TNN_OK);
+    for (auto data_format : {DATA_FORMAT_NC4HW4, DATA_FORMAT_NC8HW8}) {
+        std::vector<std::shared_ptr<Mat>> outputs;
+        ASSERT_EQ((int)RunBlockedNet(interpreter, DEVICE_X86, data_format, input, outputs), (int)TNN_OK);
+        for (int o = 0; o < (int)expected.size(); o++) {
+            ASSERT_TRUE(DimsVectorUtils::Equal(outputs[o]->GetDims(), expected[o]->GetDims()));
+            auto output_data   = static_cast<float *>(outputs[o]->GetData());
+            auto expected_data = static_cast<float *>(expected[o]->GetData());
+            for (int i = 0; i < DimsVectorUtils::Count(expected[o]->GetDims()); i++) {
+                ASSERT_NEAR(output_data[i], expected_data[i], 1e-3f)
+                    << "format " << data_format << " output " << o << " index " << i;
+            }
+        }
+    }
+}
+
+// x86 has no kernels for 16 channel blocks, NC16HW16 is not delivered and the net is computed in nchw
+TEST(BlockedLayoutTest, NC16HW16RunsInNCHW) {
+    if (ConvertDeviceType(FLAGS_dt) != DEVICE_X86 || !GetDevice(DEVICE_X86)) {
+        GTEST_SKIP();
+    }
+    auto interpreter = CreateBlockedInterpreter();
+    ASSERT_TRUE(interpreter != nullptr);
+    DimsVector dims = {1, 13, 17, 19};
+    auto input      = std::make_shared<Mat>(DEVICE_NAIVE, NCHW_FLOAT, dims);
+    InitRandom(static_cast<float *>(input->GetData()), DimsVectorUtils::Count(dims), 1.0f);
+
+    std::vector<std::shared_ptr<Mat>> expected;
+    ASSERT_EQ((int)RunBlockedNet(interpreter, DEVICE_NAIVE, DATA_FORMAT_AUTO, input, expected), (int)TNN_OK);
+
+    NetworkConfig config;
+    config.device_type                 = DEVICE_X86;
+    config.data_format                 = DATA_FORMAT_NC16HW16;
+    std::shared_ptr<Instance> instance = nullptr;
+    MatMap outputs;
+    ASSERT_EQ((int)CreateNetInstance(interpreter, config, instance, {{"input", dims}}), (int)TNN_OK);
+    ASSERT_EQ((int)ForwardNet(instance, {{"input", input}}, {"add0", "conv4"}, outputs), (int)TNN_OK);
+
+    BlobMap output_blobs;
+    instance->GetAllOutputBlobs(output_blobs);
+    for (auto item : output_blobs) {
+        EXPECT_EQ(item.second->GetBlobDesc().data_format, DATA_FORMAT_NCHW) << item.first;
+    }
+    auto add_data      = static_cast<float *>(outputs["add0"]->GetData());
+    auto expected_data = static_cast<float *>(expected[0]->GetData());
+    for (int i = 0; i < DimsVectorUtils::Count(expected[0]->GetDims()); i++) {
+        ASSERT_NEAR(add_data[i], expected_data[i], 1e-3f) << "index " << i;
+    }
+}
+
+}  // namespace TNN_NS
@@ -0,0 +1,110 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+#include <memory>
+#include <gtest/gtest.h>
+
+#include "test/flags.h"
+#include "test/test_utils.h"
+#include "test/unit_test/unit_test_common.h"
+#include "tnn/core/instance.h"
+#include "tnn/interpreter/layer_param.h"
+#include "tnn/utils/dims_utils.h"
+
+namespace TNN_NS {
+
+// relu and sigmoid are written in place of their channels of the concat output unless relu is also a net output
+static std::shared_ptr<AbstractModelInterpreter> CreateConcatInterpreter(bool relu_as_output) {
+    auto concat_param  = std::make_shared<ConcatLayerParam>();
+    concat_param->axis = 1;
+
+    std::set<std::string> outputs = {"concat"};
+    if (relu_as_output) {
+        outputs.insert("relu");
+    }
+    return CreateNetInterpreter({{"input", {1, 8, 16, 16}}},
+                                {
+                                    CreateLayerInfo("ReLU", std::make_shared<LayerParam>(), {"input"}, {"relu"}),
+                                    CreateLayerInfo("Sigmoid", std::make_shared<LayerParam>(), {"input"}, {"sigmoid"}),
+                                    CreateLayerInfo("Concat", concat_param, {"relu", "sigmoid"}, {"concat"}),
+                                },
+                                outputs);
+}
+
+static Status RunConcatNet(DeviceType device_type, bool enable_memory_plan, bool relu_as_output,
+                           std::shared_ptr<Mat> input, std::shared_ptr<Mat> &output, int *memory_size = nullptr) {
+    NetworkConfig config;
+    config.device_type        = device_type;
+    config.enable_memory_plan = enable_memory_plan;
+
+    std::shared_ptr<Instance> instance = nullptr;
+    RETURN_ON_NEQ(CreateNetInstance(CreateConcatInterpreter(relu_as_output), config, instance), TNN_OK);
+    if (memory_size) {
+        RETURN_ON_NEQ(instance->GetForwardMemorySize(*memory_size), TNN_OK);
+    }
+    // smaller inputs than the planned shapes move the inputs of the concat to their offsets
+    if (!DimsVectorUtils::Equal(input->GetDims(), {1, 8, 16, 16})) {
+        RETURN_ON_NEQ(instance->Reshape({{"input", input->GetDims()}}), TNN_OK);
+    }
+    MatMap outputs;
+    RETURN_ON_NEQ(ForwardNet(instance, {{"input", input}}, {"concat"}, outputs), TNN_OK);
+    output = outputs["concat"];
+    return TNN_OK;
+}
+
+TEST(ConcatEliminationTest, ConcatMatchesNaive) {
+    auto device_type = ConvertDeviceType(FLAGS_dt);
+    if (!GetDevice(device_type)) {
+        GTEST_SKIP();
+    }
+    for (auto dims : {DimsVector({1, 8, 16, 16}), DimsVector({1, 8, 8, 8})}) {
+        auto input = std::make_shared<Mat>(DEVICE_NAIVE, NCHW_FLOAT, dims);
+        InitRandom(static_cast<float *>(input->GetData()), DimsVectorUtils::Count(dims), 1.0f);
+
+        std::shared_ptr<Mat> expected = nullptr;
+        ASSERT_EQ((int)RunConcatNet(DEVICE_NAIVE, false, false, input, expected), (int)TNN_OK);
+        for (bool enable_memory_plan : {false, true}) {
+            for (bool relu_as_output : {false, true}) {
+                std::shared_ptr<Mat> output = nullptr;
+                ASSERT_EQ((int)RunConcatNet(device_type, enable_memory_plan, relu_as_output, input, output),
+                          (int)TNN_OK);
+                ASSERT_TRUE(DimsVectorUtils::Equal(output->GetDims(), expected->GetDims()));
+                auto output_data   = static_cast<float *>(output->GetData());
+                auto expected_data = static_cast<float *>(expected->GetData());
+                for (int i = 0; i < DimsVectorUtils::Count(expected->GetDims()); i++) {
+                    ASSERT_NEAR(output_data[i], expected_data[i], 1e-4f) << "index " << i;
+                }
+            }
+        }
+    }
+}
+
+TEST(ConcatEliminationTest, ConcatInputsTakeNoMemory) {
+    if (ConvertDeviceType(FLAGS_dt) != DEVICE_X86 || !GetDevice(DEVICE_X86)) {
+        GTEST_SKIP();
+    }
+    auto input = std::make_shared<Mat>(DEVICE_NAIVE, NCHW_FLOAT, DimsVector({1, 8, 16, 16}));
+    InitRandom(static_cast<float *>(input->GetData()), DimsVectorUtils::Count(input->GetDims()), 1.0f);
+
+    int memory_size             = 0;
+    std::shared_ptr<Mat> output = nullptr;
+    ASSERT_EQ((int)RunConcatNet(DEVICE_X86, true, false, input, output, &memory_size), (int)TNN_OK);
+    // input and concat, relu and sigmoid are part of concat
+    EXPECT_EQ(memory_size, 8 * 256 * 4 + 16 * 256 * 4);
+
+    // relu is read by the user, concat copies it
+    ASSERT_EQ((int)RunConcatNet(DEVICE_X86, true, true, input, output, &memory_size), (int)TNN_OK);
+    EXPECT_EQ(memory_size, 8 * 256 * 4 * 3 + 16 * 256 * 4);
+}
+
+}  // namespace TNN_NS
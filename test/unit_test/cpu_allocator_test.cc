@@ -0,0 +1,67 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include <stdint.h>
+
+#include <gtest/gtest.h>
+
+#include "tnn/utils/cpu_allocator.h"
+#include "tnn/utils/cpu_utils.h"
+
+namespace TNN_NS {
+
+TEST(CpuAllocatorTest, AlignsAndFillsWithZero) {
+    auto &allocator = CpuAllocator::GetInstance();
+    auto before     = CpuUtils::GetCpuMemoryStats();
+    for (size_t size : {size_t(0), size_t(1), size_t(100), size_t(4096 + 3)}) {
+        auto data = static_cast<uint8_t *>(allocator.Allocate(size));
+        ASSERT_NE(data, nullptr);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(data) % CpuAllocator::kAlignment, 0);
+        for (size_t i = 0; i < size; i++) {
+            ASSERT_EQ(data[i], 0) << "size " << size << " index " << i;
+        }
+        allocator.Free(data);
+    }
+    auto after = CpuUtils::GetCpuMemoryStats();
+    EXPECT_EQ(after.allocated_bytes, before.allocated_bytes);
+    EXPECT_EQ(after.allocation_count, before.allocation_count + 4);
+    EXPECT_GE(after.peak_allocated_bytes, before.allocated_bytes + 4096 + 3);
+}
+
+TEST(CpuAllocatorTest, CountsHugePagesAndSkippedZeroFill) {
+    auto &allocator   = CpuAllocator::GetInstance();
+    const size_t size = 2 * CpuAllocator::kHugePageSize + 100;
+    for (int mode : {CPU_HUGE_PAGE_NONE, CPU_HUGE_PAGE_TRANSPARENT, CPU_HUGE_PAGE_EXPLICIT}) {
+        ASSERT_EQ((int)CpuUtils::SetCpuHugePage(mode), (int)TNN_OK);
+        auto before = CpuUtils::GetCpuMemoryStats();
+        auto data   = static_cast<uint8_t *>(allocator.Allocate(size, false));
+        ASSERT_NE(data, nullptr);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(data) % CpuAllocator::kAlignment, 0);
+        // the memory is usable to its end
+        data[0] = data[size - 1] = 1;
+
+        auto during = CpuUtils::GetCpuMemoryStats();
+        EXPECT_EQ(during.allocated_bytes, before.allocated_bytes + (int64_t)size);
+        EXPECT_EQ(during.zero_fill_skipped_bytes, before.zero_fill_skipped_bytes + (int64_t)size);
+        if (mode == CPU_HUGE_PAGE_NONE) {
+            EXPECT_EQ(during.huge_page_bytes, before.huge_page_bytes);
+        }
+        allocator.Free(data);
+        EXPECT_EQ(CpuUtils::GetCpuMemoryStats().huge_page_bytes, before.huge_page_bytes);
+    }
+    ASSERT_EQ((int)CpuUtils::SetCpuHugePage(CPU_HUGE_PAGE_TRANSPARENT), (int)TNN_OK);
+    EXPECT_NE((int)CpuUtils::SetCpuHugePage(3), (int)TNN_OK);
+}
+
+}  // namespace TNN_NS
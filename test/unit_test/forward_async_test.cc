@@ -0,0 +1,189 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include <atomic>
+#include <cmath>
+#include <future>
+#include <memory>
+#include <thread>
+#include <gtest/gtest.h>
+
+#include "test/flags.h"
+#include "test/test_utils.h"
+#include "test/unit_test/unit_test_common.h"
+#include "tnn/core/instance.h"
+#include "tnn/interpreter/layer_param.h"
+#include "tnn/utils/dims_utils.h"
+
+namespace TNN_NS {
+
+static const DimsVector kAsyncDims = {1, 8, 16, 16};
+
+static std::shared_ptr<Instance> CreateSigmoidInstance(DeviceType device_type) {
+    auto interpreter = CreateNetInterpreter(
+        {{"input", kAsyncDims}}, {CreateLayerInfo("Sigmoid", std::make_shared<LayerParam>(), {"input"}, {"sigmoid"})},
+        {"sigmoid"});
+    NetworkConfig config;
+    config.device_type = device_type;
+
+    std::shared_ptr<Instance> instance = nullptr;
+    if (CreateNetInstance(interpreter, config, instance) != TNN_OK) {
+        return nullptr;
+    }
+    return instance;
+}
+
+static std::shared_ptr<Mat> CreateRandomInput() {
+    auto input = std::make_shared<Mat>(DEVICE_NAIVE, NCHW_FLOAT, kAsyncDims);
+    InitRandom(static_cast<float *>(input->GetData()), DimsVectorUtils::Count(kAsyncDims), 1.0f);
+    return input;
+}
+
+static void ExpectSigmoid(std::shared_ptr<Mat> input, std::shared_ptr<Mat> output) {
+    ASSERT_TRUE(output != nullptr);
+    ASSERT_TRUE(DimsVectorUtils::Equal(output->GetDims(), kAsyncDims));
+    auto input_data  = static_cast<float *>(input->GetData());
+    auto output_data = static_cast<float *>(output->GetData());
+    for (int i = 0; i < DimsVectorUtils::Count(kAsyncDims); i++) {
+        ASSERT_NEAR(output_data[i], 1.0f / (1.0f + std::exp(-input_data[i])), 1e-4f) << "index " << i;
+    }
+}
+
+static bool IsAsyncDevice(DeviceType device_type) {
+    return (device_type == DEVICE_X86 || device_type == DEVICE_NAIVE) && GetDevice(device_type);
+}
+
+// the callback runs on the worker thread when the forward is complete, WaitForwardAsync returns after it
+TEST(ForwardAsyncTest, CallbackRunsOnWorker) {
+    auto device_type = ConvertDeviceType(FLAGS_dt);
+    if (!IsAsyncDevice(device_type)) {
+        GTEST_SKIP();
+    }
+    auto instance = CreateSigmoidInstance(device_type);
+    ASSERT_TRUE(instance != nullptr);
+    auto input = CreateRandomInput();
+    ASSERT_EQ((int)instance->SetInputMat(input, MatConvertParam(), "input"), (int)TNN_OK);
+
+    std::atomic<bool> called(false);
+    std::thread::id callback_thread;
+    auto status = instance->ForwardAsync([&]() {
+        callback_thread = std::this_thread::get_id();
+        called          = true;
+    });
+    ASSERT_EQ((int)status, (int)TNN_OK);
+    ASSERT_EQ((int)instance->WaitForwardAsync(), (int)TNN_OK);
+    EXPECT_TRUE(called);
+    EXPECT_NE(callback_thread, std::this_thread::get_id());
+
+    std::shared_ptr<Mat> output = nullptr;
+    ASSERT_EQ((int)instance->GetOutputMat(output, MatConvertParam(), "sigmoid", DEVICE_NAIVE), (int)TNN_OK);
+    ExpectSigmoid(input, output);
+}
+
+// the forward is complete when the callback runs, so the callback can read the outputs
+TEST(ForwardAsyncTest, CallbackReadsOutputs) {
+    auto device_type = ConvertDeviceType(FLAGS_dt);
+    if (!IsAsyncDevice(device_type)) {
+        GTEST_SKIP();
+    }
+    auto instance = CreateSigmoidInstance(device_type);
+    ASSERT_TRUE(instance != nullptr);
+    auto input = CreateRandomInput();
+    ASSERT_EQ((int)instance->SetInputMat(input, MatConvertParam(), "input"), (int)TNN_OK);
+
+    std::shared_ptr<Mat> output = nullptr;
+    Status wait_status, output_status;
+    std::promise<void> called;
+    std::shared_future<Status> forward;
+    auto status = instance->ForwardAsync(
+        [&]() {
+            wait_status   = instance->WaitForwardAsync();
+            output_status = instance->GetOutputMat(output, MatConvertParam(), "sigmoid", DEVICE_NAIVE);
+            called.set_value();
+        },
+        forward);
+    ASSERT_EQ((int)status, (int)TNN_OK);
+    ASSERT_TRUE(forward.valid());
+    EXPECT_EQ((int)Status(forward.get()), (int)TNN_OK);
+    called.get_future().wait();
+    EXPECT_EQ((int)wait_status, (int)TNN_OK);
+    ASSERT_EQ((int)output_status, (int)TNN_OK);
+    ExpectSigmoid(input, output);
+}
+
+// a forward started while another is in flight waits for it, each reads its own input
+TEST(ForwardAsyncTest, ForwardWhileInFlight) {
+    auto device_type = ConvertDeviceType(FLAGS_dt);
+    if (!IsAsyncDevice(device_type)) {
+        GTEST_SKIP();
+    }
+    auto instance = CreateSigmoidInstance(device_type);
+    ASSERT_TRUE(instance != nullptr);
+    auto first  = CreateRandomInput();
+    auto second = CreateRandomInput();
+
+    std::shared_ptr<Mat> first_output = nullptr;
+    Status output_status;
+    std::shared_future<Status> forward;
+    ASSERT_EQ((int)instance->SetInputMat(first, MatConvertParam(), "input"), (int)TNN_OK);
+    ASSERT_EQ((int)instance->ForwardAsync(
+                  [&]() {
+                      output_status = instance->GetOutputMat(first_output, MatConvertParam(), "sigmoid", DEVICE_NAIVE);
+                  },
+                  forward),
+              (int)TNN_OK);
+    ASSERT_EQ((int)instance->SetInputMat(second, MatConvertParam(), "input"), (int)TNN_OK);
+    ASSERT_EQ((int)instance->Forward(), (int)TNN_OK);
+    EXPECT_EQ((int)Status(forward.get()), (int)TNN_OK);
+    ASSERT_EQ((int)output_status, (int)TNN_OK);
+    ExpectSigmoid(first, first_output);
+
+    std::shared_ptr<Mat> second_output = nullptr;
+    ASSERT_EQ((int)instance->GetOutputMat(second_output, MatConvertParam(), "sigmoid", DEVICE_NAIVE), (int)TNN_OK);
+    ExpectSigmoid(second, second_output);
+}
+
+// a forward started by a callback runs after that callback, so the callback can not wait for it
+TEST(ForwardAsyncTest, CallbackCanNotWaitForNextForward) {
+    auto device_type = ConvertDeviceType(FLAGS_dt);
+    if (!IsAsyncDevice(device_type)) {
+        GTEST_SKIP();
+    }
+    auto instance = CreateSigmoidInstance(device_type);
+    ASSERT_TRUE(instance != nullptr);
+    auto input = CreateRandomInput();
+    ASSERT_EQ((int)instance->SetInputMat(input, MatConvertParam(), "input"), (int)TNN_OK);
+
+    Status next_status, wait_status;
+    std::promise<void> next_called;
+    std::shared_future<Status> forward, next_forward;
+    auto status = instance->ForwardAsync(
+        [&]() {
+            next_status = instance->ForwardAsync([&]() { next_called.set_value(); }, next_forward);
+            wait_status = instance->WaitForwardAsync();
+        },
+        forward);
+    ASSERT_EQ((int)status, (int)TNN_OK);
+    EXPECT_EQ((int)Status(forward.get()), (int)TNN_OK);
+    next_called.get_future().wait();
+    EXPECT_EQ((int)next_status, (int)TNN_OK);
+    EXPECT_NE((int)wait_status, (int)TNN_OK);
+    EXPECT_EQ((int)Status(next_forward.get()), (int)TNN_OK);
+
+    std::shared_ptr<Mat> output = nullptr;
+    ASSERT_EQ((int)instance->GetOutputMat(output, MatConvertParam(), "sigmoid", DEVICE_NAIVE), (int)TNN_OK);
+    ExpectSigmoid(input, output);
+}
+
+}  // namespace TNN_NS
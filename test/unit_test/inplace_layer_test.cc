@@ -0,0 +1,104 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+#include <math.h>
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "test/flags.h"
+#include "test/test_utils.h"
+#include "test/unit_test/unit_test_common.h"
+#include "tnn/core/instance.h"
+#include "tnn/interpreter/layer_param.h"
+#include "tnn/utils/dims_utils.h"
+
+namespace TNN_NS {
+
+// every layer after the first one can write its output over the blob it reads for the last time
+static std::shared_ptr<AbstractModelInterpreter> CreateElementwiseChainInterpreter() {
+    auto binary_param = []() { return std::make_shared<MultidirBroadcastLayerParam>(); };
+    return CreateNetInterpreter({{"input", {1, 8, 16, 16}}, {"bias", {1, 8, 1, 1}}},
+                                {
+                                    CreateLayerInfo("Add", binary_param(), {"input", "input"}, {"add"}),
+                                    CreateLayerInfo("ReLU", std::make_shared<LayerParam>(), {"add"}, {"relu"}),
+                                    CreateLayerInfo("Sigmoid", std::make_shared<LayerParam>(), {"relu"}, {"sigmoid"}),
+                                    // the full shape input is the second one
+                                    CreateLayerInfo("Mul", binary_param(), {"bias", "sigmoid"}, {"mul"}),
+                                    CreateLayerInfo("Sub", binary_param(), {"mul", "input"}, {"sub"}),
+                                },
+                                {"sub"});
+}
+
+static std::shared_ptr<Mat> RunElementwiseChain(DeviceType device_type, bool enable_memory_plan,
+                                                std::shared_ptr<Mat> input, std::shared_ptr<Mat> bias,
+                                                int *memory_size = nullptr) {
+    NetworkConfig config;
+    config.device_type        = device_type;
+    config.enable_memory_plan = enable_memory_plan;
+
+    std::shared_ptr<Instance> instance = nullptr;
+    MatMap outputs;
+    if (CreateNetInstance(CreateElementwiseChainInterpreter(), config, instance) != TNN_OK) {
+        return nullptr;
+    }
+    if (memory_size && instance->GetForwardMemorySize(*memory_size) != TNN_OK) {
+        return nullptr;
+    }
+    if (ForwardNet(instance, {{"input", input}, {"bias", bias}}, {"sub"}, outputs) != TNN_OK) {
+        return nullptr;
+    }
+    return outputs["sub"];
+}
+
+TEST(InplaceLayerTest, ElementwiseChainMatchesNaive) {
+    auto device_type = ConvertDeviceType(FLAGS_dt);
+    if (!GetDevice(device_type)) {
+        GTEST_SKIP();
+    }
+    auto input = std::make_shared<Mat>(DEVICE_NAIVE, NCHW_FLOAT, DimsVector({1, 8, 16, 16}));
+    auto bias  = std::make_shared<Mat>(DEVICE_NAIVE, NCHW_FLOAT, DimsVector({1, 8, 1, 1}));
+    InitRandom(static_cast<float *>(input->GetData()), DimsVectorUtils::Count(input->GetDims()), 1.0f);
+    InitRandom(static_cast<float *>(bias->GetData()), DimsVectorUtils::Count(bias->GetDims()), 1.0f);
+
+    auto expected = RunElementwiseChain(DEVICE_NAIVE, false, input, bias);
+    ASSERT_TRUE(expected != nullptr);
+    const int count = DimsVectorUtils::Count(expected->GetDims());
+    for (bool enable_memory_plan : {false, true}) {
+        auto output = RunElementwiseChain(device_type, enable_memory_plan, input, bias);
+        ASSERT_TRUE(output != nullptr);
+        auto output_data   = static_cast<float *>(output->GetData());
+        auto expected_data = static_cast<float *>(expected->GetData());
+        for (int i = 0; i < count; i++) {
+            ASSERT_NEAR(output_data[i], expected_data[i], 1e-4f) << "index " << i;
+        }
+    }
+}
+
+TEST(InplaceLayerTest, ChainTakesOneBlockOfMemoryPlan) {
+    if (ConvertDeviceType(FLAGS_dt) != DEVICE_X86 || !GetDevice(DEVICE_X86)) {
+        GTEST_SKIP();
+    }
+    auto input = std::make_shared<Mat>(DEVICE_NAIVE, NCHW_FLOAT, DimsVector({1, 8, 16, 16}));
+    auto bias  = std::make_shared<Mat>(DEVICE_NAIVE, NCHW_FLOAT, DimsVector({1, 8, 1, 1}));
+    InitRandom(static_cast<float *>(input->GetData()), DimsVectorUtils::Count(input->GetDims()), 1.0f);
+    InitRandom(static_cast<float *>(bias->GetData()), DimsVectorUtils::Count(bias->GetDims()), 1.0f);
+
+    int memory_size = 0;
+    ASSERT_TRUE(RunElementwiseChain(DEVICE_X86, true, input, bias, &memory_size) != nullptr);
+    // input, bias padded to 64 bytes and the one block all layers write in place
+    EXPECT_EQ(memory_size, 8 * 16 * 16 * 4 + 64 + 8 * 16 * 16 * 4);
+}
+
+}  // namespace TNN_NS
@@ -0,0 +1,172 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include <string.h>
+
+#include <memory>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "test/flags.h"
+#include "test/test_utils.h"
+#include "test/unit_test/unit_test_common.h"
+#include "tnn/core/instance.h"
+#include "tnn/interpreter/default_model_interpreter.h"
+#include "tnn/interpreter/layer_param.h"
+#include "tnn/utils/dims_utils.h"
+
+namespace TNN_NS {
+
+static std::shared_ptr<AbstractModelInterpreter> CreateConvInterpreter() {
+    std::shared_ptr<ConvLayerParam> param(new ConvLayerParam());
+    param->name           = "Conv";
+    param->input_channel  = 8;
+    param->output_channel = 8;
+    param->group          = 1;
+    param->kernels        = {3, 3};
+    param->dialations     = {1, 1};
+    param->strides        = {1, 1};
+    param->pads           = {1, 1, 1, 1};
+    param->bias           = 1;
+    return GenerateInterpreter("Convolution", {{1, 8, 16, 16}}, param);
+}
+
+static std::shared_ptr<Instance> CreateConvInstance(DeviceType device_type,
+                                                    std::shared_ptr<AbstractModelInterpreter> interpreter) {
+    ModelConfig model_config;
+    model_config.params = {"", ""};
+    NetworkConfig config;
+    config.device_type = device_type;
+    config.precision   = PRECISION_HIGH;
+
+    auto instance = std::make_shared<Instance>(config, model_config);
+    if (instance->Init(interpreter, InputShapesMap()) != TNN_OK) {
+        return nullptr;
+    }
+    return instance;
+}
+
+static std::shared_ptr<Mat> RunInstance(std::shared_ptr<Instance> instance, std::shared_ptr<Mat> input) {
+    std::shared_ptr<Mat> output = nullptr;
+    if (instance->SetInputMat(input, MatConvertParam()) != TNN_OK || instance->Forward() != TNN_OK ||
+        instance->GetOutputMat(output, MatConvertParam(), "", DEVICE_NAIVE) != TNN_OK) {
+        return nullptr;
+    }
+    return output;
+}
+
+TEST(InstanceCloneTest, CloneMatchesSource) {
+    auto device_type = ConvertDeviceType(FLAGS_dt);
+    if (!GetDevice(device_type)) {
+        GTEST_SKIP();
+    }
+    auto instance = CreateConvInstance(device_type, CreateConvInterpreter());
+    ASSERT_TRUE(instance != nullptr);
+
+    Status status;
+    auto clone = instance->Clone(status);
+    ASSERT_EQ((int)status, (int)TNN_OK);
+    auto clone_of_clone = clone->Clone(status);
+    ASSERT_EQ((int)status, (int)TNN_OK);
+
+    auto input = std::make_shared<Mat>(DEVICE_NAIVE, NCHW_FLOAT, DimsVector({1, 8, 16, 16}));
+    InitRandom(static_cast<float *>(input->GetData()), DimsVectorUtils::Count(input->GetDims()), 1.0f);
+
+    auto expected = RunInstance(instance, input);
+    ASSERT_TRUE(expected != nullptr);
+    const size_t bytes = DimsVectorUtils::Count(expected->GetDims()) * sizeof(float);
+    for (auto inst : {clone, clone_of_clone}) {
+        auto output = RunInstance(inst, input);
+        ASSERT_TRUE(output != nullptr);
+        ASSERT_TRUE(DimsVectorUtils::Equal(output->GetDims(), expected->GetDims()));
+        EXPECT_EQ(memcmp(output->GetData(), expected->GetData(), bytes), 0);
+    }
+
+    // clone stays valid after the source instance is released
+    instance = nullptr;
+    auto output = RunInstance(clone, input);
+    ASSERT_TRUE(output != nullptr);
+    EXPECT_EQ(memcmp(output->GetData(), expected->GetData(), bytes), 0);
+}
+
+TEST(InstanceCloneTest, ClonesForwardConcurrently) {
+    auto device_type = ConvertDeviceType(FLAGS_dt);
+    if (!GetDevice(device_type)) {
+        GTEST_SKIP();
+    }
+    auto instance = CreateConvInstance(device_type, CreateConvInterpreter());
+    ASSERT_TRUE(instance != nullptr);
+    Status status;
+    auto clone = instance->Clone(status);
+    ASSERT_EQ((int)status, (int)TNN_OK);
+
+    auto input = std::make_shared<Mat>(DEVICE_NAIVE, NCHW_FLOAT, DimsVector({1, 8, 16, 16}));
+    InitRandom(static_cast<float *>(input->GetData()), DimsVectorUtils::Count(input->GetDims()), 1.0f);
+    auto expected = RunInstance(instance, input);
+    ASSERT_TRUE(expected != nullptr);
+    const size_t bytes = DimsVectorUtils::Count(expected->GetDims()) * sizeof(float);
+
+    int mismatch_count = 0;
+    std::thread worker([&]() {
+        for (int i = 0; i < 8; i++) {
+            auto output = RunInstance(clone, input);
+            if (!output || memcmp(output->GetData(), expected->GetData(), bytes) != 0) {
+                mismatch_count++;
+            }
+        }
+    });
+    for (int i = 0; i < 8; i++) {
+        auto output = RunInstance(instance, input);
+        ASSERT_TRUE(output != nullptr);
+        EXPECT_EQ(memcmp(output->GetData(), expected->GetData(), bytes), 0);
+    }
+    worker.join();
+    EXPECT_EQ(mismatch_count, 0);
+}
+
+// the clone inits its own layer accs, on x86 they take the weights packed by the source instead of packing again
+TEST(InstanceCloneTest, CloneSharesPackedWeights) {
+    if (ConvertDeviceType(FLAGS_dt) != DEVICE_X86 || !GetDevice(DEVICE_X86)) {
+        GTEST_SKIP();
+    }
+    auto interpreter = CreateConvInterpreter();
+    ASSERT_TRUE(interpreter != nullptr);
+    auto instance = CreateConvInstance(DEVICE_X86, interpreter);
+    ASSERT_TRUE(instance != nullptr);
+
+    auto input = std::make_shared<Mat>(DEVICE_NAIVE, NCHW_FLOAT, DimsVector({1, 8, 16, 16}));
+    InitRandom(static_cast<float *>(input->GetData()), DimsVectorUtils::Count(input->GetDims()), 1.0f);
+    auto expected = RunInstance(instance, input);
+    ASSERT_TRUE(expected != nullptr);
+
+    // a clone packing the weights again would pack the cleared filter, the instance inits from its copy of the
+    // interpreter and the clone shares it
+    auto net_resource = dynamic_cast<DefaultModelInterpreter *>(instance->GetInterpreter().get())->GetNetResource();
+    ASSERT_TRUE(net_resource->resource_map.size() == 1);
+    auto conv_resource = std::dynamic_pointer_cast<ConvLayerResource>(net_resource->resource_map.begin()->second);
+    ASSERT_TRUE(conv_resource != nullptr);
+    memset(conv_resource->filter_handle.force_to<void *>(), 0, conv_resource->filter_handle.GetBytesSize());
+
+    Status status;
+    auto clone = instance->Clone(status);
+    ASSERT_EQ((int)status, (int)TNN_OK);
+    auto output = RunInstance(clone, input);
+    ASSERT_TRUE(output != nullptr);
+    EXPECT_EQ(memcmp(output->GetData(), expected->GetData(),
+                     DimsVectorUtils::Count(expected->GetDims()) * sizeof(float)),
+              0);
+}
+
+}  // namespace TNN_NS
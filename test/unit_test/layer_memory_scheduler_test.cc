@@ -0,0 +1,154 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "test/flags.h"
+#include "test/test_utils.h"
+#include "test/unit_test/unit_test_common.h"
+#include "tnn/core/default_network.h"
+#include "tnn/optimizer/layer_memory_scheduler.h"
+
+namespace TNN_NS {
+
+using optimizer::LayerMemoryScheduler;
+using optimizer::ScheduleLayer;
+
+static ScheduleLayer MakeLayer(std::vector<std::string> inputs, std::vector<std::string> outputs) {
+    ScheduleLayer layer;
+    layer.inputs  = inputs;
+    layer.outputs = outputs;
+    return layer;
+}
+
+TEST(LayerMemorySchedulerTest, FinishesBranchBeforeStartingNext) {
+    // two branches expand the input, the original order keeps both large blobs alive
+    std::vector<ScheduleLayer> layers = {
+        MakeLayer({"input"}, {"a1"}), MakeLayer({"input"}, {"b1"}), MakeLayer({"a1"}, {"a2"}),
+        MakeLayer({"b1"}, {"b2"}),    MakeLayer({"a2", "b2"}, {"output"}),
+    };
+    std::map<std::string, int64_t> blob_bytes = {
+        {"input", 100}, {"a1", 1000}, {"b1", 1000}, {"a2", 10}, {"b2", 10}, {"output", 20},
+    };
+    LayerMemoryScheduler scheduler(layers, blob_bytes, {"input", "output"});
+
+    std::vector<int> order;
+    ASSERT_EQ((int)scheduler.Schedule(order), (int)TNN_OK);
+    ASSERT_EQ(order.size(), layers.size());
+
+    EXPECT_EQ(scheduler.GetPeakBytes({0, 1, 2, 3, 4}), 100 + 1000 + 1000 + 10);
+    EXPECT_EQ(scheduler.GetPeakBytes(order), 100 + 1000 + 10 + 10);
+
+    // every layer runs after the layers writing its inputs
+    std::set<std::string> ready = {"input"};
+    for (auto index : order) {
+        for (const auto &name : layers[index].inputs) {
+            EXPECT_TRUE(ready.count(name) > 0);
+        }
+        ready.insert(layers[index].outputs.begin(), layers[index].outputs.end());
+    }
+}
+
+TEST(LayerMemorySchedulerTest, KeepsOrderOfChain) {
+    std::vector<ScheduleLayer> layers = {
+        MakeLayer({"input"}, {"x"}),
+        MakeLayer({"x"}, {"y"}),
+        MakeLayer({"y"}, {"output"}),
+    };
+    std::map<std::string, int64_t> blob_bytes = {{"input", 8}, {"x", 8}, {"y", 8}, {"output", 8}};
+    LayerMemoryScheduler scheduler(layers, blob_bytes, {"input", "output"});
+
+    std::vector<int> order;
+    ASSERT_EQ((int)scheduler.Schedule(order), (int)TNN_OK);
+    EXPECT_EQ(order, std::vector<int>({0, 1, 2}));
+}
+
+TEST(LayerMemorySchedulerTest, PeakIsNotAboveModelOrder) {
+    std::mt19937 random(7);
+    for (int graph = 0; graph < 100; graph++) {
+        // every layer reads one or two blobs written before it
+        std::vector<ScheduleLayer> layers;
+        std::vector<std::string> blobs            = {"input"};
+        std::map<std::string, int64_t> blob_bytes = {{"input", 64}};
+        for (int i = 0; i < 12; i++) {
+            std::vector<std::string> inputs = {blobs[random() % blobs.size()]};
+            if (random() % 2) {
+                inputs.push_back(blobs[random() % blobs.size()]);
+            }
+            auto output = "blob" + std::to_string(i);
+            layers.push_back(MakeLayer(inputs, {output}));
+            blob_bytes[output] = 1 + random() % 1000;
+            blobs.push_back(output);
+        }
+        LayerMemoryScheduler scheduler(layers, blob_bytes, {"input", blobs.back()});
+
+        std::vector<int> order, model_order;
+        ASSERT_EQ((int)scheduler.Schedule(order), (int)TNN_OK);
+        for (int i = 0; i < (int)layers.size(); i++) {
+            model_order.push_back(i);
+        }
+        EXPECT_LE(scheduler.GetPeakBytes(order), scheduler.GetPeakBytes(model_order)) << "graph " << graph;
+    }
+}
+
+// two branches widen the input by a concat and narrow it back by a reduce sum
+static std::shared_ptr<AbstractModelInterpreter> CreateBranchInterpreter() {
+    auto concat_param       = std::make_shared<ConcatLayerParam>();
+    concat_param->axis      = 1;
+    auto reduce_param       = std::make_shared<ReduceLayerParam>();
+    reduce_param->axis      = {1};
+    reduce_param->keep_dims = 1;
+
+    return CreateNetInterpreter(
+        {{"input", {1, 8, 16, 16}}},
+        {
+            CreateLayerInfo("Concat", concat_param, {"input", "input", "input", "input"}, {"a1"}),
+            CreateLayerInfo("Concat", concat_param, {"input", "input", "input", "input"}, {"b1"}),
+            CreateLayerInfo("ReduceSum", reduce_param, {"a1"}, {"a2"}),
+            CreateLayerInfo("ReduceSum", reduce_param, {"b1"}, {"b2"}),
+            CreateLayerInfo("Add", std::make_shared<MultidirBroadcastLayerParam>(), {"a2", "b2"}, {"output"}),
+        },
+        {"output"});
+}
+
+TEST(LayerMemorySchedulerTest, NetworkReportsLowerPeak) {
+    auto device_type = ConvertDeviceType(FLAGS_dt);
+    if ((device_type != DEVICE_X86 && device_type != DEVICE_NAIVE) || !GetDevice(device_type)) {
+        GTEST_SKIP();
+    }
+    ModelConfig model_config;
+    model_config.params = {"", ""};
+    NetworkConfig config;
+    config.device_type        = device_type;
+    config.precision          = PRECISION_HIGH;
+    config.enable_memory_plan = true;
+
+    auto interpreter = CreateBranchInterpreter();
+    ASSERT_TRUE(interpreter != nullptr);
+    DefaultNetwork network;
+    ASSERT_EQ((int)network.Init(config, model_config, interpreter.get(), InputShapesMap(), InputShapesMap(), false),
+              (int)TNN_OK);
+    int64_t model_order_peak = 0, schedule_peak = 0;
+    ASSERT_EQ((int)network.GetLayerSchedulePeakBytes(model_order_peak, schedule_peak), (int)TNN_OK);
+    EXPECT_GT(model_order_peak, 0);
+    EXPECT_LT(schedule_peak, model_order_peak);
+}
+
+}  // namespace TNN_NS
@@ -47,7 +47,7 @@ INSTANTIATE_TEST_SUITE_P(LayerTest, ConvLayerTest,
                              testing::Values(DATA_TYPE_FLOAT, DATA_TYPE_HALF),
                              // activation_type
                              testing::Values(ActivationType_None, ActivationType_ReLU, ActivationType_ReLU6,
-                                             ActivationType_SIGMOID_MUL)));
+                                             ActivationType_SIGMOID_MUL, ActivationType_HARDSWISH)));
 
 TEST_P(ConvLayerTest, ConvLayer) {
     // get param
@@ -77,10 +77,8 @@ TEST_P(ConvLayerTest, ConvLayer) {
         GTEST_SKIP();
     }
 
-    if (activation_type == ActivationType_ReLU6 && DEVICE_X86 == dev) {
-        GTEST_SKIP();
-    }
-    if (activation_type == ActivationType_SIGMOID_MUL && DEVICE_X86 == dev) {
+    // hardswish is fused into the convs of x86 only
+    if (activation_type == ActivationType_HARDSWISH && DEVICE_X86 != dev && DEVICE_NAIVE != dev) {
         GTEST_SKIP();
     }
 
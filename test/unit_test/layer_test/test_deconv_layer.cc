@@ -87,12 +87,6 @@ TEST_P(DeconvLayerTest, DeconvLayer) {
         GTEST_SKIP();
     }
 
-    if (activation_type == ActivationType_ReLU6 && DEVICE_X86 == dev) {
-        GTEST_SKIP();
-    }
-    if (activation_type == ActivationType_SIGMOID_MUL && DEVICE_X86 == dev) {
-        GTEST_SKIP();
-    }
     // APPLE_NPU can not support Activation inplace
     if (activation_type != ActivationType_None && DEVICE_APPLE_NPU == dev) {
         GTEST_SKIP();
@@ -0,0 +1,196 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+#include <algorithm>
+#include <memory>
+#include <gtest/gtest.h>
+
+#include "test/flags.h"
+#include "test/test_utils.h"
+#include "test/unit_test/unit_test_common.h"
+#include "tnn/core/instance.h"
+#include "tnn/interpreter/layer_param.h"
+#include "tnn/utils/dims_utils.h"
+
+namespace TNN_NS {
+
+static std::shared_ptr<LayerInfo> CreateConvLayerInfo(std::string name, std::string input, int kernel) {
+    auto param            = std::make_shared<ConvLayerParam>();
+    param->input_channel  = 16;
+    param->output_channel = 16;
+    param->group          = 1;
+    param->kernels        = {kernel, kernel};
+    param->dialations     = {1, 1};
+    param->strides        = {1, 1};
+    param->pads           = {kernel / 2, kernel / 2, kernel / 2, kernel / 2};
+    param->bias           = 1;
+    return CreateLayerInfo("Convolution", param, {input}, {name});
+}
+
+static std::shared_ptr<ConvLayerResource> CreateConvResource(int kernel) {
+    auto resource           = std::make_shared<ConvLayerResource>();
+    const int filter_count  = 16 * 16 * kernel * kernel;
+    resource->filter_handle = RawBuffer(filter_count * sizeof(float), {16, 16, kernel, kernel});
+    resource->bias_handle   = RawBuffer(16 * sizeof(float), {16});
+    InitRandom(resource->filter_handle.force_to<float *>(), filter_count, 1.0f);
+    InitRandom(resource->bias_handle.force_to<float *>(), 16, 1.0f);
+    return resource;
+}
+
+// a 3x3 conv and a 1x1 conv, both with scratch memory on x86. the weights are set in the net resource, instances
+// copy the interpreter and would generate different random weights otherwise
+static std::shared_ptr<AbstractModelInterpreter> CreateConvInterpreter() {
+    return CreateNetInterpreter({{"input", {1, 16, 32, 32}}},
+                                {CreateConvLayerInfo("conv0", "input", 3), CreateConvLayerInfo("conv1", "conv0", 1)},
+                                {"conv1"}, {{"conv0", CreateConvResource(3)}, {"conv1", CreateConvResource(1)}});
+}
+
+static Status RunConvNet(std::shared_ptr<AbstractModelInterpreter> interpreter, DeviceType device_type,
+                         bool enable_memory_plan, std::shared_ptr<Mat> input, std::shared_ptr<Mat> &output,
+                         int *memory_size = nullptr) {
+    NetworkConfig config;
+    config.device_type        = device_type;
+    config.enable_memory_plan = enable_memory_plan;
+
+    // memory and workspaces are planned for the max input shape
+    InputShapesMap min_shapes = {{"input", {1, 16, 32, 32}}};
+    InputShapesMap max_shapes = {{"input", {1, 16, 48, 40}}};
+    std::shared_ptr<Instance> instance = nullptr;
+    RETURN_ON_NEQ(CreateNetInstance(interpreter, config, instance, min_shapes, max_shapes), TNN_OK);
+    if (memory_size) {
+        RETURN_ON_NEQ(instance->GetForwardMemorySize(*memory_size), TNN_OK);
+    }
+    // a smaller input than the planned shapes runs in the planned memory
+    if (!DimsVectorUtils::Equal(input->GetDims(), max_shapes["input"])) {
+        RETURN_ON_NEQ(instance->Reshape({{"input", input->GetDims()}}), TNN_OK);
+    }
+    MatMap outputs;
+    RETURN_ON_NEQ(ForwardNet(instance, {{"input", input}}, {"conv1"}, outputs), TNN_OK);
+    output = outputs["conv1"];
+    return TNN_OK;
+}
+
+static float *BlobData(Blob *blob) {
+    auto handle = blob->GetHandle();
+    return reinterpret_cast<float *>(static_cast<char *>(handle.base) + handle.bytes_offset);
+}
+
+static std::shared_ptr<Blob> CreateFloatBlob(DimsVector dims, float value) {
+    BlobDesc desc;
+    desc.device_type = DEVICE_X86;
+    desc.data_type   = DATA_TYPE_FLOAT;
+    desc.data_format = DATA_FORMAT_NCHW;
+    desc.dims        = dims;
+    auto blob        = std::make_shared<Blob>(desc, true);
+    auto data        = BlobData(blob.get());
+    std::fill(data, data + DimsVectorUtils::Count(dims), value);
+    return blob;
+}
+
+TEST(LayerWorkspaceTest, PlannedWorkspaceMatchesNaive) {
+    auto device_type = ConvertDeviceType(FLAGS_dt);
+    if (!GetDevice(device_type)) {
+        GTEST_SKIP();
+    }
+    auto interpreter = CreateConvInterpreter();
+    ASSERT_TRUE(interpreter != nullptr);
+    for (auto dims : {DimsVector({1, 16, 32, 32}), DimsVector({1, 16, 48, 40})}) {
+        auto input = std::make_shared<Mat>(DEVICE_NAIVE, NCHW_FLOAT, dims);
+        InitRandom(static_cast<float *>(input->GetData()), DimsVectorUtils::Count(dims), 1.0f);
+
+        std::shared_ptr<Mat> expected = nullptr;
+        ASSERT_EQ((int)RunConvNet(interpreter, DEVICE_NAIVE, false, input, expected), (int)TNN_OK);
+        for (bool enable_memory_plan : {false, true}) {
+            std::shared_ptr<Mat> output = nullptr;
+            ASSERT_EQ((int)RunConvNet(interpreter, device_type, enable_memory_plan, input, output), (int)TNN_OK);
+            ASSERT_TRUE(DimsVectorUtils::Equal(output->GetDims(), expected->GetDims()));
+            auto output_data   = static_cast<float *>(output->GetData());
+            auto expected_data = static_cast<float *>(expected->GetData());
+            for (int i = 0; i < DimsVectorUtils::Count(expected->GetDims()); i++) {
+                ASSERT_NEAR(output_data[i], expected_data[i], 1e-3f) << "index " << i;
+            }
+        }
+    }
+}
+
+TEST(LayerWorkspaceTest, WorkspaceIsPartOfForwardMemory) {
+    if (ConvertDeviceType(FLAGS_dt) != DEVICE_X86 || !GetDevice(DEVICE_X86)) {
+        GTEST_SKIP();
+    }
+    auto interpreter = CreateConvInterpreter();
+    ASSERT_TRUE(interpreter != nullptr);
+    auto input = std::make_shared<Mat>(DEVICE_NAIVE, NCHW_FLOAT, DimsVector({1, 16, 32, 32}));
+    InitRandom(static_cast<float *>(input->GetData()), DimsVectorUtils::Count(input->GetDims()), 1.0f);
+
+    int memory_size             = 0;
+    std::shared_ptr<Mat> output = nullptr;
+    ASSERT_EQ((int)RunConvNet(interpreter, DEVICE_X86, true, input, output, &memory_size), (int)TNN_OK);
+    // input, conv0 and conv1 are alive while conv1 runs, its workspace comes on top of them
+    EXPECT_GT(memory_size, 3 * 16 * 32 * 32 * 4);
+}
+
+// a workspace smaller than the forward needs, as after a reshape beyond the planned shapes, is left alone and the acc
+// takes the shared workspace of its context instead
+TEST(LayerWorkspaceTest, SmallWorkspaceFallsBackToShared) {
+    if (ConvertDeviceType(FLAGS_dt) != DEVICE_X86 || !GetDevice(DEVICE_X86)) {
+        GTEST_SKIP();
+    }
+    auto device = GetDevice(DEVICE_X86);
+    std::shared_ptr<Context> context(device->CreateContext(0));
+    ASSERT_TRUE(context != nullptr);
+    context->SetPrecision(PRECISION_HIGH);
+
+    auto layer_info = CreateConvLayerInfo("conv0", "input", 3);
+    auto resource   = CreateConvResource(3);
+    auto input      = CreateFloatBlob({1, 16, 32, 32}, 0.f);
+    auto output     = CreateFloatBlob({1, 16, 32, 32}, 0.f);
+    InitRandom(BlobData(input.get()), DimsVectorUtils::Count(input->GetBlobDesc().dims), 1.0f);
+    std::vector<Blob *> inputs = {input.get()}, outputs = {output.get()};
+
+    std::shared_ptr<AbstractLayerAcc> acc(device->CreateLayerAcc(LAYER_CONVOLUTION));
+    ASSERT_TRUE(acc != nullptr);
+    ASSERT_EQ((int)acc->Init(context.get(), layer_info->param.get(), resource.get(), inputs, outputs), (int)TNN_OK);
+    const size_t size = acc->GetWorkspaceSize(inputs, outputs);
+    ASSERT_GT(size, 0);
+
+    ASSERT_EQ((int)acc->Forward(inputs, outputs), (int)TNN_OK);
+    auto output_data = BlobData(output.get());
+    const int count  = DimsVectorUtils::Count(output->GetBlobDesc().dims);
+    std::vector<float> expected(output_data, output_data + count);
+
+    const float unused       = 1234.5f;
+    const int full_count     = (int)((size + sizeof(float) - 1) / sizeof(float));
+    auto small_workspace     = CreateFloatBlob({full_count / 2}, unused);
+    auto full_workspace      = CreateFloatBlob({full_count}, unused);
+    auto small_workspace_ptr = BlobData(small_workspace.get());
+    auto full_workspace_ptr  = BlobData(full_workspace.get());
+
+    acc->SetWorkspace(small_workspace.get());
+    std::fill(output_data, output_data + count, 0.f);
+    ASSERT_EQ((int)acc->Forward(inputs, outputs), (int)TNN_OK);
+    for (int i = 0; i < count; i++) {
+        ASSERT_NEAR(output_data[i], expected[i], 1e-4f) << "index " << i;
+    }
+    EXPECT_EQ(std::count(small_workspace_ptr, small_workspace_ptr + full_count / 2, unused), full_count / 2);
+
+    // a large enough workspace is the one written
+    acc->SetWorkspace(full_workspace.get());
+    std::fill(output_data, output_data + count, 0.f);
+    ASSERT_EQ((int)acc->Forward(inputs, outputs), (int)TNN_OK);
+    for (int i = 0; i < count; i++) {
+        ASSERT_NEAR(output_data[i], expected[i], 1e-4f) << "index " << i;
+    }
+    EXPECT_LT(std::count(full_workspace_ptr, full_workspace_ptr + full_count, unused), full_count);
+}
+
+}  // namespace TNN_NS
@@ -0,0 +1,127 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+#include <memory>
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+
+#include "test/flags.h"
+#include "test/test_utils.h"
+#include "test/unit_test/unit_test_common.h"
+#include "tnn/core/instance.h"
+#include "tnn/interpreter/tnn/model_interpreter.h"
+#include "tnn/interpreter/tnn/model_packer.h"
+#include "tnn/utils/dims_utils.h"
+
+namespace TNN_NS {
+
+static Status InterpretConvModel(const std::string &proto_path, const std::string &model_path, bool mapped,
+                                 std::shared_ptr<ModelInterpreter> &interpreter) {
+    ModelConfig config;
+    config.params = {ReadFile(proto_path), mapped ? "" : ReadFile(model_path)};
+    if (mapped) {
+        config.model_path = model_path;
+    }
+    interpreter = std::make_shared<ModelInterpreter>();
+    return interpreter->Interpret(config.params, config);
+}
+
+static RawBuffer &GetFilter(std::shared_ptr<ModelInterpreter> interpreter) {
+    auto resource = interpreter->GetNetResource()->resource_map["conv"];
+    return dynamic_cast<ConvLayerResource *>(resource.get())->filter_handle;
+}
+
+TEST(MappedModelTest, AlignedWeightsAreMappedInPlace) {
+    const std::string proto_path = "mapped_model_test.tnnproto";
+    const std::string model_path = "mapped_model_test.tnnmodel";
+    ASSERT_EQ((int)PackConvModel(proto_path, model_path, 8, 16, true), (int)TNN_OK);
+
+    std::shared_ptr<ModelInterpreter> copied = nullptr;
+    std::shared_ptr<ModelInterpreter> mapped = nullptr;
+    ASSERT_EQ((int)InterpretConvModel(proto_path, model_path, false, copied), (int)TNN_OK);
+    ASSERT_EQ((int)InterpretConvModel(proto_path, model_path, true, mapped), (int)TNN_OK);
+
+    auto &copied_filter = GetFilter(copied);
+    auto &mapped_filter = GetFilter(mapped);
+    ASSERT_EQ(mapped_filter.GetBytesSize(), 8 * 8 * 9 * (int)sizeof(float));
+    EXPECT_TRUE(DimsVectorUtils::Equal(mapped_filter.GetBufferDims(), {8, 8, 3, 3}));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(mapped_filter.force_to<char *>()) % g_raw_data_alignment, 0u);
+    EXPECT_EQ(memcmp(copied_filter.force_to<char *>(), mapped_filter.force_to<char *>(),
+                     mapped_filter.GetBytesSize()), 0);
+
+    // the mapping stays alive while the weights are referenced
+    auto weights = mapped_filter;
+    mapped       = nullptr;
+    EXPECT_EQ(memcmp(copied_filter.force_to<char *>(), weights.force_to<char *>(), weights.GetBytesSize()), 0);
+
+    remove(proto_path.c_str());
+    remove(model_path.c_str());
+}
+
+TEST(MappedModelTest, UnalignedModelFromPathMatchesContent) {
+    const std::string proto_path = "mapped_model_test_v2.tnnproto";
+    const std::string model_path = "mapped_model_test_v2.tnnmodel";
+    ASSERT_EQ((int)PackConvModel(proto_path, model_path, 8, 16, false), (int)TNN_OK);
+
+    std::shared_ptr<ModelInterpreter> copied = nullptr;
+    std::shared_ptr<ModelInterpreter> mapped = nullptr;
+    ASSERT_EQ((int)InterpretConvModel(proto_path, model_path, false, copied), (int)TNN_OK);
+    ASSERT_EQ((int)InterpretConvModel(proto_path, model_path, true, mapped), (int)TNN_OK);
+
+    auto &copied_filter = GetFilter(copied);
+    auto &mapped_filter = GetFilter(mapped);
+    ASSERT_EQ(mapped_filter.GetBytesSize(), copied_filter.GetBytesSize());
+    EXPECT_EQ(memcmp(copied_filter.force_to<char *>(), mapped_filter.force_to<char *>(),
+                     mapped_filter.GetBytesSize()), 0);
+    // the md5 of a mapped model is the md5 of its content
+    EXPECT_EQ(copied->GetParamsMd5()[1], mapped->GetParamsMd5()[1]);
+
+    remove(proto_path.c_str());
+    remove(model_path.c_str());
+}
+
+// a model packed again to the same path with the same size gets a new md5, so caches keyed by it are not reused
+TEST(MappedModelTest, RepackedModelGetsNewMd5) {
+    const std::string proto_path = "mapped_model_test_repacked.tnnproto";
+    const std::string model_path = "mapped_model_test_repacked.tnnmodel";
+    for (bool aligned_weights : {true, false}) {
+        std::vector<std::string> model_md5;
+        for (int pack = 0; pack < 2; pack++) {
+            ASSERT_EQ((int)PackConvModel(proto_path, model_path, 8, 16, aligned_weights), (int)TNN_OK);
+            std::shared_ptr<ModelInterpreter> copied = nullptr;
+            std::shared_ptr<ModelInterpreter> mapped = nullptr;
+            ASSERT_EQ((int)InterpretConvModel(proto_path, model_path, false, copied), (int)TNN_OK);
+            ASSERT_EQ((int)InterpretConvModel(proto_path, model_path, true, mapped), (int)TNN_OK);
+            ASSERT_EQ(mapped->GetParamsMd5().size(), 2u);
+            EXPECT_EQ(copied->GetParamsMd5()[1], mapped->GetParamsMd5()[1]);
+            model_md5.push_back(mapped->GetParamsMd5()[1]);
+        }
+        EXPECT_NE(model_md5[0], model_md5[1]) << "aligned weights " << aligned_weights;
+    }
+    remove(proto_path.c_str());
+    remove(model_path.c_str());
+}
+
+TEST(MappedModelTest, MissingModelFileFails) {
+    const std::string proto_path = "mapped_model_test_missing.tnnproto";
+    const std::string model_path = "mapped_model_test_missing.tnnmodel";
+    ASSERT_EQ((int)PackConvModel(proto_path, model_path, 8, 16, true), (int)TNN_OK);
+    remove(model_path.c_str());
+
+    std::shared_ptr<ModelInterpreter> mapped = nullptr;
+    EXPECT_NE((int)InterpretConvModel(proto_path, model_path, true, mapped), (int)TNN_OK);
+    remove(proto_path.c_str());
+}
+
+}  // namespace TNN_NS
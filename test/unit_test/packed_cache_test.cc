@@ -0,0 +1,288 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include <algorithm>
+#include <memory>
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+
+#include "test/flags.h"
+#include "test/test_utils.h"
+#include "test/unit_test/unit_test_common.h"
+#include "tnn/core/abstract_device.h"
+#include "tnn/core/instance.h"
+#include "tnn/interpreter/tnn/model_interpreter.h"
+#include "tnn/interpreter/tnn/model_packer.h"
+#include "tnn/utils/dims_utils.h"
+#include "tnn/utils/md5.h"
+#include "tnn/utils/packed_resource_cache.h"
+#include "tnn/utils/string_utils_inner.h"
+
+namespace TNN_NS {
+
+static std::map<std::string, std::shared_ptr<RawBuffer>> CreatePackedResources() {
+    auto weight = std::make_shared<RawBuffer>(100 * sizeof(float), 32);
+    InitRandom(weight->force_to<float *>(), 100, 1.0f);
+    weight->SetBufferDims({10, 10});
+    auto scale = std::make_shared<RawBuffer>(3);
+    scale->SetDataType(DATA_TYPE_INT8);
+    memset(scale->force_to<char *>(), 7, 3);
+    return {{"conv|conv_gemm|2", weight}, {"conv|conv_int8_gemm|2", scale}};
+}
+
+// a 3x3 conv packed to files and read back as model params, so the params md5 names the packed cache file
+static std::vector<std::string> CreateConvModelParams() {
+    const std::string proto_path = "packed_cache_test.tnnproto";
+    const std::string model_path = "packed_cache_test.tnnmodel";
+    if (PackConvModel(proto_path, model_path, 8, 16) != TNN_OK) {
+        return {};
+    }
+    std::vector<std::string> params = {ReadFile(proto_path), ReadFile(model_path)};
+    remove(proto_path.c_str());
+    remove(model_path.c_str());
+    return params;
+}
+
+// a 3x3 conv followed by a relu the optimizer fuses into the conv, the relu writes the output named conv
+static std::vector<std::string> CreateConvReluModelParams() {
+    auto param            = std::make_shared<ConvLayerParam>();
+    param->input_channel  = 8;
+    param->output_channel = 8;
+    param->group          = 1;
+    param->kernels        = {3, 3};
+    param->dialations     = {1, 1};
+    param->strides        = {1, 1};
+    param->pads           = {1, 1, 1, 1};
+    param->bias           = 1;
+
+    NetStructure net_structure;
+    net_structure.inputs_shape_map    = {{"input", {1, 8, 16, 16}}};
+    net_structure.input_data_type_map = {{"input", DATA_TYPE_FLOAT}};
+    net_structure.layers              = {CreateLayerInfo("Convolution", param, {"input"}, {"conv0"}),
+                                         CreateLayerInfo("ReLU", std::make_shared<LayerParam>(), {"conv0"}, {"conv"})};
+    net_structure.blobs               = {"input", "conv0", "conv"};
+    net_structure.outputs             = {"conv"};
+
+    auto resource           = std::make_shared<ConvLayerResource>();
+    resource->filter_handle = RawBuffer(8 * 8 * 9 * sizeof(float), {8, 8, 3, 3});
+    resource->bias_handle   = RawBuffer(8 * sizeof(float), {8});
+    InitRandom(resource->filter_handle.force_to<float *>(), 8 * 8 * 9, 1.0f);
+    InitRandom(resource->bias_handle.force_to<float *>(), 8, 1.0f);
+    NetResource net_resource;
+    net_resource.resource_map["conv0"] = resource;
+
+    const std::string proto_path = "packed_cache_test_relu.tnnproto";
+    const std::string model_path = "packed_cache_test_relu.tnnmodel";
+    ModelPacker packer(&net_structure, &net_resource);
+    if (packer.Pack(proto_path, model_path) != TNN_OK) {
+        return {};
+    }
+    std::vector<std::string> params = {ReadFile(proto_path), ReadFile(model_path)};
+    remove(proto_path.c_str());
+    remove(model_path.c_str());
+    return params;
+}
+
+static Status RunConvModel(const std::vector<std::string> &params, const std::string &cache_path,
+                           std::shared_ptr<Mat> input, std::vector<float> &output) {
+    ModelConfig model_config;
+    model_config.params = params;
+    NetworkConfig config;
+    config.device_type = DEVICE_X86;
+    config.precision   = PRECISION_HIGH;
+    config.cache_path  = cache_path;
+
+    auto interpreter = std::make_shared<ModelInterpreter>();
+    RETURN_ON_NEQ(interpreter->Interpret(model_config.params), TNN_OK);
+    auto instance = std::make_shared<Instance>(config, model_config);
+    RETURN_ON_NEQ(instance->Init(interpreter, InputShapesMap()), TNN_OK);
+    RETURN_ON_NEQ(instance->SetInputMat(input, MatConvertParam(), "input"), TNN_OK);
+    RETURN_ON_NEQ(instance->Forward(), TNN_OK);
+    std::shared_ptr<Mat> output_mat = nullptr;
+    RETURN_ON_NEQ(instance->GetOutputMat(output_mat, MatConvertParam(), "conv", DEVICE_NAIVE), TNN_OK);
+    auto data = static_cast<float *>(output_mat->GetData());
+    output    = std::vector<float>(data, data + DimsVectorUtils::Count(output_mat->GetDims()));
+    return TNN_OK;
+}
+
+TEST(PackedCacheTest, SavedResourcesAreLoaded) {
+    const std::string path = "packed_cache_test_save.packed";
+    auto resources         = CreatePackedResources();
+    ASSERT_EQ((int)PackedResourceFile::Save(path, "x86_avx2", resources), (int)TNN_OK);
+
+    std::map<std::string, std::shared_ptr<RawBuffer>> loaded;
+    ASSERT_EQ((int)PackedResourceFile::Load(path, "x86_avx2", loaded), (int)TNN_OK);
+    ASSERT_EQ(loaded.size(), resources.size());
+    for (const auto &iter : resources) {
+        ASSERT_TRUE(loaded.find(iter.first) != loaded.end());
+        auto &expected = *iter.second;
+        auto &buffer   = *loaded[iter.first];
+        ASSERT_EQ(buffer.GetBytesSize(), expected.GetBytesSize());
+        EXPECT_EQ(buffer.GetDataType(), expected.GetDataType());
+        EXPECT_TRUE(DimsVectorUtils::Equal(buffer.GetBufferDims(), expected.GetBufferDims()));
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(buffer.force_to<char *>()) % 32, 0u);
+        EXPECT_EQ(memcmp(buffer.force_to<char *>(), expected.force_to<char *>(), buffer.GetBytesSize()), 0);
+    }
+    remove(path.c_str());
+}
+
+TEST(PackedCacheTest, StaleOrBrokenFileIsRejected) {
+    const std::string path = "packed_cache_test_stale.packed";
+    std::map<std::string, std::shared_ptr<RawBuffer>> loaded;
+    EXPECT_NE((int)PackedResourceFile::Load(path, "x86_avx2", loaded), (int)TNN_OK);
+
+    ASSERT_EQ((int)PackedResourceFile::Save(path, "x86_avx2", CreatePackedResources()), (int)TNN_OK);
+    // packed for another isa
+    EXPECT_NE((int)PackedResourceFile::Load(path, "x86_sse42", loaded), (int)TNN_OK);
+
+    // a byte of the packed data is flipped
+    std::string content = ReadFile(path);
+    content[content.size() - 10] ^= 0x5a;
+    {
+        std::ofstream file(path, std::ios::binary);
+        file.write(content.data(), content.size());
+    }
+    EXPECT_NE((int)PackedResourceFile::Load(path, "x86_avx2", loaded), (int)TNN_OK);
+
+    // the file is cut
+    {
+        std::ofstream file(path, std::ios::binary);
+        file.write(content.data(), content.size() / 2);
+    }
+    EXPECT_NE((int)PackedResourceFile::Load(path, "x86_avx2", loaded), (int)TNN_OK);
+    EXPECT_TRUE(loaded.empty());
+    remove(path.c_str());
+}
+
+TEST(PackedCacheTest, NextStartLoadsPackedWeights) {
+    auto device = GetDevice(DEVICE_X86);
+    if (ConvertDeviceType(FLAGS_dt) != DEVICE_X86 || !device) {
+        GTEST_SKIP();
+    }
+    std::shared_ptr<Context> context(device->CreateContext(0));
+    ASSERT_TRUE(context != nullptr);
+    const std::string tag = context->GetPackedCacheTag();
+    ASSERT_FALSE(tag.empty());
+
+    auto params = CreateConvModelParams();
+    ASSERT_EQ(params.size(), 2u);
+    auto input = std::make_shared<Mat>(DEVICE_NAIVE, NCHW_FLOAT, DimsVector({1, 8, 16, 16}));
+    InitRandom(static_cast<float *>(input->GetData()), 8 * 16 * 16, 1.0f);
+
+    // cache file of DefaultNetwork: CACHE_TAG, device type, device id, precision, model type, params md5 and tag
+    const std::string cache_file = "./d1_" + ToString((int)DEVICE_X86) + "_0_" + ToString((int)PRECISION_HIGH) + "_" +
+                                   ToString((int)MODEL_TYPE_TNN) + "_" + md5(params[0]) + md5(params[1]) + "_" +
+                                   tag + ".packed";
+    remove(cache_file.c_str());
+
+    std::vector<float> expected, first, second;
+    ASSERT_EQ((int)RunConvModel(params, "", input, expected), (int)TNN_OK);
+    ASSERT_EQ((int)RunConvModel(params, ".", input, first), (int)TNN_OK);
+    std::map<std::string, std::shared_ptr<RawBuffer>> packed;
+    ASSERT_EQ((int)PackedResourceFile::Load(cache_file, tag, packed), (int)TNN_OK);
+    ASSERT_FALSE(packed.empty());
+    ASSERT_EQ((int)RunConvModel(params, ".", input, second), (int)TNN_OK);
+    ASSERT_EQ(first.size(), expected.size());
+    ASSERT_EQ(second.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_NEAR(first[i], expected[i], 1e-4f) << "index " << i;
+        ASSERT_NEAR(second[i], expected[i], 1e-4f) << "index " << i;
+    }
+
+    // zero the cached weights, the next start uses them instead of packing the model weights, leaving the bias
+    for (auto &iter : packed) {
+        memset(iter.second->force_to<char *>(), 0, iter.second->GetBytesSize());
+    }
+    ASSERT_EQ((int)PackedResourceFile::Save(cache_file, tag, packed), (int)TNN_OK);
+    std::vector<float> zeroed;
+    ASSERT_EQ((int)RunConvModel(params, ".", input, zeroed), (int)TNN_OK);
+    const int plane = 16 * 16;
+    for (int c = 0; c < 8; c++) {
+        for (int i = 1; i < plane; i++) {
+            ASSERT_FLOAT_EQ(zeroed[c * plane + i], zeroed[c * plane]);
+        }
+    }
+    remove(cache_file.c_str());
+    remove((cache_file.substr(0, cache_file.rfind(".packed")) + ".optimized").c_str());
+}
+
+// the optimized net is saved with the packed weights, the next start uses it instead of optimizing the model
+TEST(PackedCacheTest, NextStartLoadsOptimizedNet) {
+    auto device = GetDevice(DEVICE_X86);
+    if (ConvertDeviceType(FLAGS_dt) != DEVICE_X86 || !device) {
+        GTEST_SKIP();
+    }
+    std::shared_ptr<Context> context(device->CreateContext(0));
+    ASSERT_TRUE(context != nullptr);
+    const std::string tag = context->GetPackedCacheTag();
+
+    auto params = CreateConvReluModelParams();
+    ASSERT_EQ(params.size(), 2u);
+    auto input = std::make_shared<Mat>(DEVICE_NAIVE, NCHW_FLOAT, DimsVector({1, 8, 16, 16}));
+    InitRandom(static_cast<float *>(input->GetData()), 8 * 16 * 16, 1.0f);
+
+    const std::string cache_file = "./d1_" + ToString((int)DEVICE_X86) + "_0_" + ToString((int)PRECISION_HIGH) + "_" +
+                                   ToString((int)MODEL_TYPE_TNN) + "_" + md5(params[0]) + md5(params[1]) + "_" + tag;
+    const std::string optimized_file = cache_file + ".optimized";
+    remove((cache_file + ".packed").c_str());
+    remove(optimized_file.c_str());
+
+    std::vector<float> expected, first, second;
+    ASSERT_EQ((int)RunConvModel(params, "", input, expected), (int)TNN_OK);
+    ASSERT_EQ((int)RunConvModel(params, ".", input, first), (int)TNN_OK);
+    std::map<std::string, std::shared_ptr<RawBuffer>> entries;
+    ASSERT_EQ((int)PackedResourceFile::Load(optimized_file, tag, entries), (int)TNN_OK);
+    ASSERT_TRUE(entries.count("proto") > 0 && entries.count("model") > 0);
+    std::vector<std::string> optimized_params = {
+        std::string(entries["proto"]->force_to<char *>(), entries["proto"]->GetBytesSize()),
+        std::string(entries["model"]->force_to<char *>(), entries["model"]->GetBytesSize())};
+    EXPECT_EQ(optimized_params[0].find("ReLU"), std::string::npos);
+
+    ASSERT_EQ((int)RunConvModel(params, ".", input, second), (int)TNN_OK);
+    ASSERT_EQ(second.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_NEAR(first[i], expected[i], 1e-4f) << "index " << i;
+        ASSERT_NEAR(second[i], expected[i], 1e-4f) << "index " << i;
+    }
+
+    // drop the activation fused into the conv of the cached net, the relu of the model does not run any more
+    ModelInterpreter interpreter;
+    ASSERT_EQ((int)interpreter.Interpret(optimized_params), (int)TNN_OK);
+    auto net_structure = interpreter.GetNetStructure();
+    ASSERT_EQ(net_structure->layers.size(), 1u);
+    auto conv_param = dynamic_cast<ConvLayerParam *>(net_structure->layers[0]->param.get());
+    ASSERT_TRUE(conv_param != nullptr);
+    EXPECT_EQ(conv_param->activation_type, (int)ActivationType_ReLU);
+    conv_param->activation_type = ActivationType_None;
+    const std::string proto_path = "packed_cache_test_optimized.tnnproto";
+    const std::string model_path = "packed_cache_test_optimized.tnnmodel";
+    ModelPacker packer(net_structure, interpreter.GetNetResource());
+    packer.SetVersion(2);
+    ASSERT_EQ((int)packer.Pack(proto_path, model_path), (int)TNN_OK);
+    std::string proto = ReadFile(proto_path);
+    entries["proto"]  = std::make_shared<RawBuffer>((int)proto.size());
+    memcpy(entries["proto"]->force_to<char *>(), proto.data(), proto.size());
+    remove(proto_path.c_str());
+    remove(model_path.c_str());
+    ASSERT_EQ((int)PackedResourceFile::Save(optimized_file, tag, entries), (int)TNN_OK);
+
+    std::vector<float> unfused;
+    ASSERT_EQ((int)RunConvModel(params, ".", input, unfused), (int)TNN_OK);
+    EXPECT_LT(*std::min_element(unfused.begin(), unfused.end()), 0.0f);
+    remove((cache_file + ".packed").c_str());
+    remove(optimized_file.c_str());
+}
+
+}  // namespace TNN_NS
@@ -0,0 +1,61 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "tnn/utils/packed_resource_cache.h"
+
+namespace TNN_NS {
+
+TEST(PackedResourceCacheTest, SharesBufferWhileHeld) {
+    int create_count = 0;
+    auto creator     = [&](RawBuffer &buffer) -> Status {
+        create_count++;
+        buffer = RawBuffer(64);
+        return TNN_OK;
+    };
+
+    std::shared_ptr<RawBuffer> first, second, other;
+    ASSERT_EQ((int)PackedResourceCache::GetOrCreate("model|conv_0|conv_gemm", creator, first), (int)TNN_OK);
+    ASSERT_EQ((int)PackedResourceCache::GetOrCreate("model|conv_0|conv_gemm", creator, second), (int)TNN_OK);
+    EXPECT_EQ(create_count, 1);
+    EXPECT_EQ(first->force_to<char *>(), second->force_to<char *>());
+
+    ASSERT_EQ((int)PackedResourceCache::GetOrCreate("model|conv_1|conv_gemm", creator, other), (int)TNN_OK);
+    EXPECT_EQ(create_count, 2);
+    EXPECT_NE(first->force_to<char *>(), other->force_to<char *>());
+
+    // released buffers are packed again on the next request
+    first  = nullptr;
+    second = nullptr;
+    ASSERT_EQ((int)PackedResourceCache::GetOrCreate("model|conv_0|conv_gemm", creator, first), (int)TNN_OK);
+    EXPECT_EQ(create_count, 3);
+}
+
+TEST(PackedResourceCacheTest, CreatorErrorIsNotCached) {
+    std::shared_ptr<RawBuffer> buffer;
+    auto failed = [](RawBuffer &) -> Status { return Status(TNNERR_MODEL_ERR, "pack failed"); };
+    EXPECT_NE((int)PackedResourceCache::GetOrCreate("model|conv_2|conv_gemm", failed, buffer), (int)TNN_OK);
+
+    auto creator = [](RawBuffer &buffer) -> Status {
+        buffer = RawBuffer(16);
+        return TNN_OK;
+    };
+    EXPECT_EQ((int)PackedResourceCache::GetOrCreate("model|conv_2|conv_gemm", creator, buffer), (int)TNN_OK);
+    EXPECT_EQ(buffer->GetBytesSize(), 16);
+}
+
+}  // namespace TNN_NS
@@ -0,0 +1,168 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include <memory>
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+
+#include "test/flags.h"
+#include "test/test_utils.h"
+#include "test/unit_test/unit_test_common.h"
+#include "tnn/core/instance.h"
+#include "tnn/interpreter/tnn/model_interpreter.h"
+#include "tnn/interpreter/tnn/model_packer.h"
+#include "tnn/utils/dims_utils.h"
+
+namespace TNN_NS {
+
+// a chain of 3x3 and 1x1 convs with random weights
+static std::vector<std::string> CreateConvChainParams(int layer_count) {
+    const int channels = 64;
+    NetStructure net_structure;
+    NetResource net_resource;
+    net_structure.inputs_shape_map    = {{"input", {1, channels, 16, 16}}};
+    net_structure.input_data_type_map = {{"input", DATA_TYPE_FLOAT}};
+    net_structure.blobs               = {"input"};
+    std::string input                 = "input";
+    for (int i = 0; i < layer_count; i++) {
+        const std::string name = "conv" + std::to_string(i);
+        const int kernel       = i % 2 == 0 ? 3 : 1;
+
+        auto param            = std::make_shared<ConvLayerParam>();
+        param->type           = "Convolution";
+        param->name           = name;
+        param->input_channel  = channels;
+        param->output_channel = channels;
+        param->group          = 1;
+        param->kernels        = {kernel, kernel};
+        param->dialations     = {1, 1};
+        param->strides        = {1, 1};
+        param->pads           = {kernel / 2, kernel / 2, kernel / 2, kernel / 2};
+        param->bias           = 1;
+
+        auto layer_info      = std::make_shared<LayerInfo>();
+        layer_info->type     = LAYER_CONVOLUTION;
+        layer_info->type_str = "Convolution";
+        layer_info->name     = name;
+        layer_info->inputs   = {input};
+        layer_info->outputs  = {name};
+        layer_info->param    = param;
+        net_structure.layers.push_back(layer_info);
+        net_structure.blobs.insert(name);
+
+        const int filter_count  = channels * channels * kernel * kernel;
+        auto resource           = std::make_shared<ConvLayerResource>();
+        resource->filter_handle = RawBuffer(filter_count * sizeof(float), {channels, channels, kernel, kernel});
+        resource->bias_handle   = RawBuffer(channels * sizeof(float), {channels});
+        InitRandom(resource->filter_handle.force_to<float *>(), filter_count, 0.1f);
+        InitRandom(resource->bias_handle.force_to<float *>(), channels, 0.1f);
+        net_resource.resource_map[name] = resource;
+        input                           = name;
+    }
+    net_structure.outputs = {input};
+
+    const std::string proto_path = "parallel_init_test.tnnproto";
+    const std::string model_path = "parallel_init_test.tnnmodel";
+    ModelPacker packer(&net_structure, &net_resource);
+    if (packer.Pack(proto_path, model_path) != TNN_OK) {
+        return {};
+    }
+    std::vector<std::string> params = {ReadFile(proto_path), ReadFile(model_path)};
+    remove(proto_path.c_str());
+    remove(model_path.c_str());
+    return params;
+}
+
+static Status InterpretModel(std::vector<std::string> params, bool enable_parallel_decode,
+                             std::shared_ptr<ModelInterpreter> &interpreter) {
+    ModelConfig config;
+    config.params                 = params;
+    config.enable_parallel_decode = enable_parallel_decode;
+    interpreter                   = std::make_shared<ModelInterpreter>();
+    return interpreter->Interpret(config.params, config);
+}
+
+static Status RunModel(std::shared_ptr<ModelInterpreter> interpreter, DeviceType device_type,
+                       bool enable_parallel_init, std::shared_ptr<Mat> input, const std::string &output_name,
+                       std::shared_ptr<Mat> &output) {
+    ModelConfig model_config;
+    NetworkConfig config;
+    config.device_type          = device_type;
+    config.precision            = PRECISION_HIGH;
+    config.enable_parallel_init = enable_parallel_init;
+
+    auto instance = std::make_shared<Instance>(config, model_config);
+    RETURN_ON_NEQ(instance->Init(interpreter, InputShapesMap()), TNN_OK);
+    RETURN_ON_NEQ(instance->SetInputMat(input, MatConvertParam(), "input"), TNN_OK);
+    RETURN_ON_NEQ(instance->Forward(), TNN_OK);
+    return instance->GetOutputMat(output, MatConvertParam(), output_name, DEVICE_NAIVE);
+}
+
+TEST(ParallelInitTest, ParallelDecodeMatchesSerialDecode) {
+    auto params = CreateConvChainParams(12);
+    ASSERT_EQ(params.size(), 2u);
+
+    std::shared_ptr<ModelInterpreter> serial   = nullptr;
+    std::shared_ptr<ModelInterpreter> parallel = nullptr;
+    ASSERT_EQ((int)InterpretModel(params, false, serial), (int)TNN_OK);
+    ASSERT_EQ((int)InterpretModel(params, true, parallel), (int)TNN_OK);
+
+    auto &serial_map   = serial->GetNetResource()->resource_map;
+    auto &parallel_map = parallel->GetNetResource()->resource_map;
+    ASSERT_EQ(parallel_map.size(), serial_map.size());
+    for (auto &iter : serial_map) {
+        ASSERT_TRUE(parallel_map.find(iter.first) != parallel_map.end());
+        auto expected = dynamic_cast<ConvLayerResource *>(iter.second.get());
+        auto resource = dynamic_cast<ConvLayerResource *>(parallel_map[iter.first].get());
+        ASSERT_TRUE(expected != nullptr && resource != nullptr);
+        for (auto pair : {std::make_pair(&expected->filter_handle, &resource->filter_handle),
+                          std::make_pair(&expected->bias_handle, &resource->bias_handle)}) {
+            ASSERT_EQ(pair.second->GetBytesSize(), pair.first->GetBytesSize());
+            EXPECT_EQ(pair.second->GetDataType(), pair.first->GetDataType());
+            EXPECT_TRUE(DimsVectorUtils::Equal(pair.second->GetBufferDims(), pair.first->GetBufferDims()));
+            EXPECT_EQ(memcmp(pair.second->force_to<char *>(), pair.first->force_to<char *>(),
+                             pair.first->GetBytesSize()), 0) << iter.first;
+        }
+    }
+}
+
+TEST(ParallelInitTest, ParallelInitMatchesSerialInit) {
+    auto device_type = ConvertDeviceType(FLAGS_dt);
+    if ((device_type != DEVICE_X86 && device_type != DEVICE_NAIVE) || !GetDevice(device_type)) {
+        GTEST_SKIP();
+    }
+    const int layer_count = 8;
+    auto params           = CreateConvChainParams(layer_count);
+    ASSERT_EQ(params.size(), 2u);
+    std::shared_ptr<ModelInterpreter> interpreter = nullptr;
+    ASSERT_EQ((int)InterpretModel(params, true, interpreter), (int)TNN_OK);
+
+    auto input = std::make_shared<Mat>(DEVICE_NAIVE, NCHW_FLOAT, DimsVector({1, 64, 16, 16}));
+    InitRandom(static_cast<float *>(input->GetData()), 64 * 16 * 16, 1.0f);
+    const std::string output_name = "conv" + std::to_string(layer_count - 1);
+
+    std::shared_ptr<Mat> expected = nullptr;
+    std::shared_ptr<Mat> output   = nullptr;
+    ASSERT_EQ((int)RunModel(interpreter, device_type, false, input, output_name, expected), (int)TNN_OK);
+    ASSERT_EQ((int)RunModel(interpreter, device_type, true, input, output_name, output), (int)TNN_OK);
+    ASSERT_TRUE(DimsVectorUtils::Equal(output->GetDims(), expected->GetDims()));
+    auto output_data   = static_cast<float *>(output->GetData());
+    auto expected_data = static_cast<float *>(expected->GetData());
+    for (int i = 0; i < DimsVectorUtils::Count(expected->GetDims()); i++) {
+        ASSERT_FLOAT_EQ(output_data[i], expected_data[i]) << "index " << i;
+    }
+}
+
+}  // namespace TNN_NS
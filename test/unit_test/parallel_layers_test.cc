@@ -0,0 +1,145 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include <memory>
+#include <gtest/gtest.h>
+
+#include "test/flags.h"
+#include "test/test_utils.h"
+#include "test/unit_test/unit_test_common.h"
+#include "tnn/core/instance.h"
+#include "tnn/interpreter/layer_param.h"
+#include "tnn/utils/dims_utils.h"
+
+namespace TNN_NS {
+
+// two branches on the input joined by a concat, relu and sigmoid can run at the same time
+static std::shared_ptr<AbstractModelInterpreter> CreateBranchInterpreter() {
+    auto concat_param  = std::make_shared<ConcatLayerParam>();
+    concat_param->axis = 1;
+
+    return CreateNetInterpreter({{"input", {1, 8, 16, 16}}},
+                                {
+                                    CreateLayerInfo("ReLU", std::make_shared<LayerParam>(), {"input"}, {"relu"}),
+                                    CreateLayerInfo("Sigmoid", std::make_shared<LayerParam>(), {"input"}, {"sigmoid"}),
+                                    CreateLayerInfo("Concat", concat_param, {"relu", "sigmoid"}, {"concat"}),
+                                    CreateLayerInfo("Abs", std::make_shared<LayerParam>(), {"concat"}, {"abs"}),
+                                },
+                                {"abs"});
+}
+
+static std::shared_ptr<Instance> CreateBranchInstance(DeviceType device_type, bool enable_parallel_layers,
+                                                      std::vector<std::string> bound_blobs = {}) {
+    NetworkConfig config;
+    config.device_type            = device_type;
+    config.enable_parallel_layers = enable_parallel_layers;
+    config.bound_blobs            = bound_blobs;
+
+    std::shared_ptr<Instance> instance = nullptr;
+    if (CreateNetInstance(CreateBranchInterpreter(), config, instance) != TNN_OK) {
+        return nullptr;
+    }
+    instance->SetCpuNumThreads(4);
+    return instance;
+}
+
+static Status ForwardInput(std::shared_ptr<Instance> instance, std::shared_ptr<Mat> input, std::vector<float> &output) {
+    MatMap outputs;
+    RETURN_ON_NEQ(ForwardNet(instance, {{"input", input}}, {"abs"}, outputs), TNN_OK);
+    auto data = static_cast<float *>(outputs["abs"]->GetData());
+    output.assign(data, data + DimsVectorUtils::Count(outputs["abs"]->GetDims()));
+    return TNN_OK;
+}
+
+static Status ForwardBound(std::shared_ptr<Instance> instance, std::vector<float> &input, DimsVector dims,
+                           std::vector<float> &output) {
+    RETURN_ON_NEQ(instance->BindInput("input", input.data(), dims), TNN_OK);
+    RETURN_ON_NEQ(instance->Forward(), TNN_OK);
+    std::shared_ptr<Mat> mat = nullptr;
+    RETURN_ON_NEQ(instance->GetOutputMat(mat, MatConvertParam(), "abs", DEVICE_NAIVE), TNN_OK);
+    auto data = static_cast<float *>(mat->GetData());
+    output.assign(data, data + DimsVectorUtils::Count(mat->GetDims()));
+    return TNN_OK;
+}
+
+TEST(ParallelLayersTest, ParallelMatchesSequential) {
+    auto device_type = ConvertDeviceType(FLAGS_dt);
+    if (device_type != DEVICE_X86 && device_type != DEVICE_NAIVE) {
+        GTEST_SKIP();
+    }
+    if (!GetDevice(device_type)) {
+        GTEST_SKIP();
+    }
+    auto sequential = CreateBranchInstance(device_type, false);
+    auto parallel   = CreateBranchInstance(device_type, true);
+    ASSERT_TRUE(sequential != nullptr && parallel != nullptr);
+
+    // the net is reshaped smaller for the last input
+    std::vector<DimsVector> shapes = {{1, 8, 16, 16}, {1, 8, 16, 16}, {1, 8, 8, 8}};
+    for (size_t index = 0; index < shapes.size(); index++) {
+        if (index > 0 && !DimsVectorUtils::Equal(shapes[index], shapes[index - 1])) {
+            ASSERT_EQ((int)sequential->Reshape({{"input", shapes[index]}}), (int)TNN_OK);
+            ASSERT_EQ((int)parallel->Reshape({{"input", shapes[index]}}), (int)TNN_OK);
+        }
+        auto input = std::make_shared<Mat>(DEVICE_NAIVE, NCHW_FLOAT, shapes[index]);
+        InitRandom(static_cast<float *>(input->GetData()), DimsVectorUtils::Count(shapes[index]), 1.0f);
+
+        std::vector<float> expected, output;
+        ASSERT_EQ((int)ForwardInput(sequential, input, expected), (int)TNN_OK);
+        ASSERT_EQ((int)ForwardInput(parallel, input, output), (int)TNN_OK);
+        ASSERT_EQ(output.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); i++) {
+            ASSERT_NEAR(output[i], expected[i], 1e-5f) << "input " << index << " index " << i;
+        }
+    }
+}
+
+// the layer graph is kept between forwards, it must follow a rebound input and a reshape
+TEST(ParallelLayersTest, ParallelFollowsReboundInput) {
+    auto device_type = ConvertDeviceType(FLAGS_dt);
+    if (device_type != DEVICE_X86 && device_type != DEVICE_NAIVE) {
+        GTEST_SKIP();
+    }
+    if (!GetDevice(device_type)) {
+        GTEST_SKIP();
+    }
+    auto sequential = CreateBranchInstance(device_type, false, {"input"});
+    auto parallel   = CreateBranchInstance(device_type, true, {"input"});
+    ASSERT_TRUE(sequential != nullptr && parallel != nullptr);
+
+    std::vector<DimsVector> shapes = {{1, 8, 16, 16}, {1, 8, 16, 16}, {1, 8, 16, 16}, {1, 8, 8, 8}};
+    std::vector<std::vector<float>> inputs(shapes.size());
+    for (size_t i = 0; i < shapes.size(); i++) {
+        inputs[i].resize(DimsVectorUtils::Count(shapes[i]));
+        InitRandom(inputs[i].data(), inputs[i].size(), 1.0f);
+    }
+    // the first input is bound again after the second, then the net is reshaped smaller
+    DimsVector dims = shapes[0];
+    for (int index : {0, 1, 0, 2, 3}) {
+        if (!DimsVectorUtils::Equal(shapes[index], dims)) {
+            dims = shapes[index];
+            ASSERT_EQ((int)sequential->Reshape({{"input", dims}}), (int)TNN_OK);
+            ASSERT_EQ((int)parallel->Reshape({{"input", dims}}), (int)TNN_OK);
+        }
+        std::vector<float> expected, output;
+        ASSERT_EQ((int)ForwardBound(sequential, inputs[index], dims, expected), (int)TNN_OK);
+        ASSERT_EQ((int)ForwardBound(parallel, inputs[index], dims, output), (int)TNN_OK);
+        ASSERT_EQ(output.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); i++) {
+            ASSERT_NEAR(output[i], expected[i], 1e-5f) << "input " << index << " index " << i;
+        }
+    }
+}
+
+}  // namespace TNN_NS
@@ -0,0 +1,115 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include <memory>
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+
+#include "test/flags.h"
+#include "test/test_utils.h"
+#include "test/unit_test/unit_test_common.h"
+#include "tnn/interpreter/tnn/model_interpreter.h"
+#include "tnn/interpreter/tnn/model_packer.h"
+#include "tnn/utils/md5.h"
+
+namespace TNN_NS {
+
+// a reader returning at most 1000 bytes each call, so reads are split across calls
+static ModelReader FileReader(const std::string &path) {
+    auto file = std::shared_ptr<FILE>(fopen(path.c_str(), "rb"), [](FILE *f) {
+        if (f) {
+            fclose(f);
+        }
+    });
+    return [file](char *data, int64_t size) -> int64_t {
+        if (!file) {
+            return -1;
+        }
+        return (int64_t)fread(data, 1, (size_t)std::min<int64_t>(size, 1000), file.get());
+    };
+}
+
+static RawBuffer &GetFilter(std::shared_ptr<ModelInterpreter> interpreter) {
+    auto resource = interpreter->GetNetResource()->resource_map["conv"];
+    return dynamic_cast<ConvLayerResource *>(resource.get())->filter_handle;
+}
+
+TEST(StreamingModelTest, ReaderModelMatchesContent) {
+    const std::string proto_path = "streaming_model_test.tnnproto";
+    const std::string model_path = "streaming_model_test.tnnmodel";
+    ASSERT_EQ((int)PackConvModel(proto_path, model_path, 64, 8), (int)TNN_OK);
+
+    ModelConfig content_config;
+    content_config.params = {ReadFile(proto_path), ReadFile(model_path)};
+    auto content          = std::make_shared<ModelInterpreter>();
+    ASSERT_EQ((int)content->Interpret(content_config.params, content_config), (int)TNN_OK);
+
+    ModelConfig reader_config;
+    reader_config.params       = {"", ""};
+    reader_config.proto_path   = proto_path;
+    reader_config.model_reader = FileReader(model_path);
+    auto streamed              = std::make_shared<ModelInterpreter>();
+    ASSERT_EQ((int)streamed->Interpret(reader_config.params, reader_config), (int)TNN_OK);
+
+    auto &content_filter  = GetFilter(content);
+    auto &streamed_filter = GetFilter(streamed);
+    ASSERT_EQ(streamed_filter.GetBytesSize(), content_filter.GetBytesSize());
+    EXPECT_EQ(memcmp(content_filter.force_to<char *>(), streamed_filter.force_to<char *>(),
+                     streamed_filter.GetBytesSize()), 0);
+    EXPECT_EQ(streamed->GetNetStructure()->layers.size(), content->GetNetStructure()->layers.size());
+
+    // cache file names depend on the md5 of params, they are the same for both ways of loading
+    ASSERT_EQ(streamed->GetParamsMd5().size(), content->GetParamsMd5().size());
+    EXPECT_EQ(streamed->GetParamsMd5()[0], content->GetParamsMd5()[0]);
+    EXPECT_EQ(streamed->GetParamsMd5()[1], content->GetParamsMd5()[1]);
+
+    remove(proto_path.c_str());
+    remove(model_path.c_str());
+}
+
+TEST(StreamingModelTest, FailedReaderFails) {
+    const std::string proto_path = "streaming_model_test_failed.tnnproto";
+    const std::string model_path = "streaming_model_test_failed.tnnmodel";
+    ASSERT_EQ((int)PackConvModel(proto_path, model_path, 64, 8), (int)TNN_OK);
+
+    ModelConfig config;
+    config.params       = {ReadFile(proto_path), ""};
+    int64_t read_bytes  = 0;
+    auto reader         = FileReader(model_path);
+    config.model_reader = [&](char *data, int64_t size) -> int64_t {
+        // fail in the middle of the weights
+        if (read_bytes > 20000) {
+            return -1;
+        }
+        int64_t bytes = reader(data, size);
+        read_bytes += bytes;
+        return bytes;
+    };
+    auto interpreter = std::make_shared<ModelInterpreter>();
+    EXPECT_NE((int)interpreter->Interpret(config.params, config), (int)TNN_OK);
+
+    remove(proto_path.c_str());
+    remove(model_path.c_str());
+}
+
+TEST(StreamingModelTest, MissingProtoFileFails) {
+    ModelConfig config;
+    config.params     = {"", ""};
+    config.proto_path = "streaming_model_test_missing.tnnproto";
+    auto interpreter  = std::make_shared<ModelInterpreter>();
+    EXPECT_NE((int)interpreter->Interpret(config.params, config), (int)TNN_OK);
+}
+
+}  // namespace TNN_NS
@@ -0,0 +1,76 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "tnn/utils/omp_utils.h"
+#include "tnn/utils/thread_pool.h"
+
+namespace TNN_NS {
+
+TEST(ThreadPoolTest, ParallelForVisitsEachIndexOnce) {
+    ThreadPool pool(3);
+    for (int max_threads : {1, 2, 4, 8}) {
+        std::vector<std::atomic<int>> visits(1000);
+        for (auto &v : visits) {
+            v = 0;
+        }
+        std::atomic<bool> thread_id_in_range(true);
+        pool.ParallelFor(0, (long)visits.size(), [&](long i, int thread_id) {
+            if (thread_id < 0 || thread_id >= max_threads) {
+                thread_id_in_range = false;
+            }
+            visits[i]++;
+        }, max_threads);
+
+        EXPECT_TRUE(thread_id_in_range);
+        for (auto &v : visits) {
+            EXPECT_EQ(v, 1);
+        }
+    }
+}
+
+TEST(ThreadPoolTest, ParallelForFromManyThreads) {
+    auto pool = ThreadPool::GetSharedPool(3, {});
+    EXPECT_EQ(pool, ThreadPool::GetSharedPool(3, {}));
+
+    std::vector<long> sums(8, 0);
+    std::vector<std::thread> callers;
+    for (int c = 0; c < (int)sums.size(); c++) {
+        callers.emplace_back([&, c]() {
+            ThreadPool::BindCurrentThread(pool.get(), 4);
+            EXPECT_EQ(PARALLEL_MAX_THREADS_NUM_, 4);
+            for (int iter = 0; iter < 50; iter++) {
+                std::vector<long> partial(4, 0);
+                PARALLEL_FOR_(0, 256, [&](long i, int thread_id) { partial[thread_id] += i; });
+                for (auto p : partial) {
+                    sums[c] += p;
+                }
+            }
+            ThreadPool::BindCurrentThread(nullptr, 1);
+        });
+    }
+    for (auto &caller : callers) {
+        caller.join();
+    }
+    for (auto sum : sums) {
+        EXPECT_EQ(sum, 50L * 255 * 256 / 2);
+    }
+}
+
+}  // namespace TNN_NS
@@ -14,6 +14,7 @@
 
 #include "test/unit_test/unit_test_common.h"
 
+#include <fstream>
 #include <iostream>
 #include <sstream>
 
@@ -21,6 +22,7 @@
 #include "test/test_utils.h"
 #include "tnn/core/macro.h"
 #include "tnn/interpreter/default_model_interpreter.h"
+#include "tnn/interpreter/tnn/model_packer.h"
 #include "tnn/utils/bfp16.h"
 
 namespace TNN_NS {
@@ -160,4 +162,113 @@ std::shared_ptr<AbstractModelInterpreter> GenerateInterpreter(std::string layer_
     return std::shared_ptr<AbstractModelInterpreter>(interpreter);
 }
 
+std::shared_ptr<LayerInfo> CreateLayerInfo(std::string layer_type_str, std::shared_ptr<LayerParam> param,
+                                           std::vector<std::string> inputs, std::vector<std::string> outputs) {
+    param->type          = layer_type_str;
+    param->name          = outputs[0];
+    auto layer_info      = std::make_shared<LayerInfo>();
+    layer_info->type     = GlobalConvertLayerType(layer_type_str);
+    layer_info->type_str = layer_type_str;
+    layer_info->name     = outputs[0];
+    layer_info->inputs   = inputs;
+    layer_info->outputs  = outputs;
+    layer_info->param    = param;
+    return layer_info;
+}
+
+std::shared_ptr<AbstractModelInterpreter> CreateNetInterpreter(
+    InputShapesMap inputs_shape, std::vector<std::shared_ptr<LayerInfo>> layers, std::set<std::string> outputs,
+    std::map<std::string, std::shared_ptr<LayerResource>> resources) {
+    auto interpreter = std::shared_ptr<AbstractModelInterpreter>(CreateModelInterpreter(MODEL_TYPE_TNN));
+    auto default_interpreter = dynamic_cast<DefaultModelInterpreter*>(interpreter.get());
+    if (!default_interpreter) {
+        return nullptr;
+    }
+
+    NetStructure* net_structure     = default_interpreter->GetNetStructure();
+    net_structure->inputs_shape_map = inputs_shape;
+    net_structure->layers           = layers;
+    net_structure->outputs          = outputs;
+    for (auto item : inputs_shape) {
+        net_structure->blobs.insert(item.first);
+    }
+    for (auto layer : layers) {
+        net_structure->blobs.insert(layer->outputs.begin(), layer->outputs.end());
+    }
+    default_interpreter->GetNetResource()->resource_map = resources;
+    return interpreter;
+}
+
+Status CreateNetInstance(std::shared_ptr<AbstractModelInterpreter> interpreter, NetworkConfig config,
+                         std::shared_ptr<Instance>& instance, InputShapesMap min_inputs_shape,
+                         InputShapesMap max_inputs_shape) {
+    if (!interpreter) {
+        return Status(TNNERR_INVALID_MODEL, "interpreter is nil");
+    }
+    ModelConfig model_config;
+    model_config.params = {"", ""};
+    config.precision    = PRECISION_HIGH;
+
+    instance = std::make_shared<Instance>(config, model_config);
+    if (max_inputs_shape.empty()) {
+        return instance->Init(interpreter, min_inputs_shape);
+    }
+    return instance->Init(interpreter, min_inputs_shape, max_inputs_shape);
+}
+
+Status ForwardNet(std::shared_ptr<Instance> instance, const MatMap& inputs, const std::vector<std::string>& output_names,
+                  MatMap& outputs) {
+    for (auto item : inputs) {
+        RETURN_ON_NEQ(instance->SetInputMat(item.second, MatConvertParam(), item.first), TNN_OK);
+    }
+    RETURN_ON_NEQ(instance->Forward(), TNN_OK);
+    outputs.clear();
+    for (auto name : output_names) {
+        std::shared_ptr<Mat> output = nullptr;
+        RETURN_ON_NEQ(instance->GetOutputMat(output, MatConvertParam(), name, DEVICE_NAIVE), TNN_OK);
+        outputs[name] = output;
+    }
+    return TNN_OK;
+}
+
+std::string ReadFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    std::ostringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+Status PackConvModel(const std::string& proto_path, const std::string& model_path, int channel, int height_width,
+                     bool aligned_weights, int pad) {
+    auto param            = std::make_shared<ConvLayerParam>();
+    param->input_channel  = channel;
+    param->output_channel = channel;
+    param->group          = 1;
+    param->kernels        = {3, 3};
+    param->dialations     = {1, 1};
+    param->strides        = {1, 1};
+    param->pads           = {pad, pad, pad, pad};
+    param->bias           = 1;
+
+    NetStructure net_structure;
+    net_structure.inputs_shape_map    = {{"input", {1, channel, height_width, height_width}}};
+    net_structure.input_data_type_map = {{"input", DATA_TYPE_FLOAT}};
+    net_structure.layers              = {CreateLayerInfo("Convolution", param, {"input"}, {"conv"})};
+    net_structure.blobs               = {"input", "conv"};
+    net_structure.outputs             = {"conv"};
+
+    const int filter_count  = channel * channel * 9;
+    auto resource           = std::make_shared<ConvLayerResource>();
+    resource->filter_handle = RawBuffer(filter_count * sizeof(float), {channel, channel, 3, 3});
+    resource->bias_handle   = RawBuffer(channel * sizeof(float), {channel});
+    InitRandom(resource->filter_handle.force_to<float*>(), filter_count, 1.0f);
+    InitRandom(resource->bias_handle.force_to<float*>(), channel, 1.0f);
+    NetResource net_resource;
+    net_resource.resource_map["conv"] = resource;
+
+    ModelPacker packer(&net_structure, &net_resource);
+    packer.SetAlignedWeights(aligned_weights);
+    return packer.Pack(proto_path, model_path);
+}
+
 }  // namespace TNN_NS
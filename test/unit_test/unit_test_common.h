@@ -16,16 +16,21 @@
 #define TNN_TEST_UNIT_TEST_COMMON_H_
 
 #include <chrono>
+#include <memory>
+#include <map>
 #include <random>
+#include <set>
 #include <string>
 #include <vector>
 
 #include "tnn/core/abstract_device.h"
 #include "tnn/core/context.h"
+#include "tnn/core/instance.h"
 #include "tnn/core/macro.h"
 #include "tnn/interpreter/abstract_model_interpreter.h"
 #include "tnn/interpreter/layer_param.h"
 #include "tnn/interpreter/layer_resource.h"
+#include "tnn/interpreter/net_structure.h"
 #include "tnn/utils/random_data_utils.h"
 
 namespace TNN_NS {
@@ -40,6 +45,31 @@ std::shared_ptr<AbstractModelInterpreter> GenerateInterpreter(std::string layer_
                                                               int output_count                        = 1,
                                                               std::vector<DataType> input_dtype       = {});
 
+// @brief layer of a hand built net structure, named after its first output
+std::shared_ptr<LayerInfo> CreateLayerInfo(std::string layer_type_str, std::shared_ptr<LayerParam> param,
+                                           std::vector<std::string> inputs, std::vector<std::string> outputs);
+
+// @brief interpreter of a hand built net, its blobs are the net inputs and the outputs of the layers
+std::shared_ptr<AbstractModelInterpreter> CreateNetInterpreter(
+    InputShapesMap inputs_shape, std::vector<std::shared_ptr<LayerInfo>> layers, std::set<std::string> outputs,
+    std::map<std::string, std::shared_ptr<LayerResource>> resources = {});
+
+// @brief init an instance of the interpreter in high precision, max_inputs_shape is only passed on if not empty
+Status CreateNetInstance(std::shared_ptr<AbstractModelInterpreter> interpreter, NetworkConfig config,
+                         std::shared_ptr<Instance> &instance, InputShapesMap min_inputs_shape = InputShapesMap(),
+                         InputShapesMap max_inputs_shape = InputShapesMap());
+
+// @brief set the input mats, forward and get the named outputs as nchw float mats of the naive device
+Status ForwardNet(std::shared_ptr<Instance> instance, const MatMap &inputs, const std::vector<std::string> &output_names,
+                  MatMap &outputs);
+
+// @brief whole content of a file, empty if it can not be read
+std::string ReadFile(const std::string& path);
+
+// @brief a 3x3 conv named conv with random weights, packed to proto_path and model_path
+Status PackConvModel(const std::string& proto_path, const std::string& model_path, int channel, int height_width,
+                     bool aligned_weights = false, int pad = 1);
+
 }  // namespace TNN_NS
 
 #endif  // TNN_TEST_UNIT_TEST_COMMON_H_
@@ -0,0 +1,107 @@
+// Tencent is pleased to support the open source community by making TNN available.
+//
+// Copyright (C) 2020 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+// in compliance with the License. You may obtain a copy of the License at
+//
+// https://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed
+// under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "test/flags.h"
+#include "test/test_utils.h"
+#include "test/unit_test/unit_test_common.h"
+#include "tnn/core/instance.h"
+#include "tnn/interpreter/layer_param.h"
+#include "tnn/utils/dims_utils.h"
+
+namespace TNN_NS {
+
+// reshape and split outputs are views of the add output, the second split output starts inside it
+static std::shared_ptr<AbstractModelInterpreter> CreateViewInterpreter() {
+    auto reshape_param      = std::make_shared<ReshapeLayerParam>();
+    reshape_param->axis     = 0;
+    reshape_param->num_axes = 4;
+    reshape_param->shape    = {1, 8, 256, 1};
+    auto split_param        = std::make_shared<SplitVLayerParam>();
+    split_param->axis       = 1;
+    split_param->slices     = {3, 5};
+
+    return CreateNetInterpreter(
+        {{"input", {1, 8, 16, 16}}},
+        {
+            CreateLayerInfo("Add", std::make_shared<MultidirBroadcastLayerParam>(), {"input", "input"}, {"add"}),
+            CreateLayerInfo("Reshape", reshape_param, {"add"}, {"reshape"}),
+            CreateLayerInfo("SplitV", split_param, {"reshape"}, {"split0", "split1"}),
+            CreateLayerInfo("ReLU", std::make_shared<LayerParam>(), {"split1"}, {"relu"}),
+            CreateLayerInfo("Sigmoid", std::make_shared<LayerParam>(), {"split0"}, {"sigmoid"}),
+        },
+        {"relu", "sigmoid"});
+}
+
+static Status RunViewNet(DeviceType device_type, bool enable_memory_plan, std::shared_ptr<Mat> input,
+                         std::vector<std::shared_ptr<Mat>> &outputs, int *memory_size = nullptr) {
+    NetworkConfig config;
+    config.device_type        = device_type;
+    config.enable_memory_plan = enable_memory_plan;
+
+    std::shared_ptr<Instance> instance = nullptr;
+    RETURN_ON_NEQ(CreateNetInstance(CreateViewInterpreter(), config, instance), TNN_OK);
+    if (memory_size) {
+        RETURN_ON_NEQ(instance->GetForwardMemorySize(*memory_size), TNN_OK);
+    }
+    // views are pointed at their data again in every forward
+    MatMap output_mats;
+    for (int i = 0; i < 2; i++) {
+        RETURN_ON_NEQ(ForwardNet(instance, {{"input", input}}, {"relu", "sigmoid"}, output_mats), TNN_OK);
+    }
+    outputs = {output_mats["relu"], output_mats["sigmoid"]};
+    return TNN_OK;
+}
+
+TEST(ViewLayerTest, ReshapeAndSplitMatchNaive) {
+    auto device_type = ConvertDeviceType(FLAGS_dt);
+    if (!GetDevice(device_type)) {
+        GTEST_SKIP();
+    }
+    auto input = std::make_shared<Mat>(DEVICE_NAIVE, NCHW_FLOAT, DimsVector({1, 8, 16, 16}));
+    InitRandom(static_cast<float *>(input->GetData()), DimsVectorUtils::Count(input->GetDims()), 1.0f);
+
+    std::vector<std::shared_ptr<Mat>> expected;
+    ASSERT_EQ((int)RunViewNet(DEVICE_NAIVE, false, input, expected), (int)TNN_OK);
+    for (bool enable_memory_plan : {false, true}) {
+        std::vector<std::shared_ptr<Mat>> outputs;
+        ASSERT_EQ((int)RunViewNet(device_type, enable_memory_plan, input, outputs), (int)TNN_OK);
+        for (int i = 0; i < (int)outputs.size(); i++) {
+            ASSERT_TRUE(DimsVectorUtils::Equal(outputs[i]->GetDims(), expected[i]->GetDims()));
+            auto output_data   = static_cast<float *>(outputs[i]->GetData());
+            auto expected_data = static_cast<float *>(expected[i]->GetData());
+            for (int j = 0; j < DimsVectorUtils::Count(expected[i]->GetDims()); j++) {
+                ASSERT_NEAR(output_data[j], expected_data[j], 1e-4f) << "output " << i << " index " << j;
+            }
+        }
+    }
+}
+
+TEST(ViewLayerTest, ViewsTakeNoMemory) {
+    if (ConvertDeviceType(FLAGS_dt) != DEVICE_X86 || !GetDevice(DEVICE_X86)) {
+        GTEST_SKIP();
+    }
+    auto input = std::make_shared<Mat>(DEVICE_NAIVE, NCHW_FLOAT, DimsVector({1, 8, 16, 16}));
+    InitRandom(static_cast<float *>(input->GetData()), DimsVectorUtils::Count(input->GetDims()), 1.0f);
+
+    int memory_size = 0;
+    std::vector<std::shared_ptr<Mat>> outputs;
+    ASSERT_EQ((int)RunViewNet(DEVICE_X86, true, input, outputs, &memory_size), (int)TNN_OK);
+    // input, add with its views and sigmoid in place of the first split, relu
+    EXPECT_EQ(memory_size, 8 * 256 * 4 + 8 * 256 * 4 + 5 * 256 * 4);
+}
+
+}  // namespace TNN_NS